@@ -89,12 +89,46 @@
  * 若未定义，默认值为 0。 */
 #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
 
+/* 将 configUSE_READY_PRIORITY_BITMAP 设为 1 时，通用算法改用两级位图查找最高就绪优先级：
+ * 第一级的每一位对应 32 个优先级组成的一组，第二级记录组内各优先级是否有就绪任务，
+ * 两次“前导零计数”即可找到结果，与 configMAX_PRIORITIES 的大小无关（最多 256 个优先级）。
+ * 只能在 configUSE_PORT_OPTIMISED_TASK_SELECTION 为 0 的单核配置下使用。
+ * 若未定义，默认值为 0。 */
+#define configUSE_READY_PRIORITY_BITMAP            0
+
+/* 将 configUSE_EDF_SCHEDULING 设为 1 时，优先级为 configEDF_PRIORITY 的任务按最早截止时间优先（EDF）调度：
+ * 任务用 vTaskSetDeadline() 声明周期和相对截止时间，每次 xTaskDelayUntil() 释放新的一个周期时，
+ * 绝对截止时间 = 本周期的释放时间 + 相对截止时间，该优先级的就绪任务中截止时间最早的先运行。
+ * 其它优先级的任务不受影响，仍按固定优先级抢占调度。只支持单核。
+ * 若未定义，默认值为 0。 */
+#define configUSE_EDF_SCHEDULING                   0
+#define configEDF_PRIORITY                         ( configMAX_PRIORITIES - 2 )
+
+/* 将 configUSE_TASK_BUDGETS 设为 1 时，可以用 vTaskSetBudget() 给任务设置 CPU 预算：
+ * 每个补充周期内任务最多运行若干个节拍（在节拍中断中按当前运行的任务计数），
+ * 用完后任务被降到指定的低优先级，或者被挂起，直到下一个补充时间再恢复，
+ * 以此限制失控的中等优先级任务对低优先级任务造成的最坏延迟。只支持单核。
+ * 若未定义，默认值为 0。 */
+#define configUSE_TASK_BUDGETS                     0
+
 /* 将 configUSE_TICKLESS_IDLE 设为 1 以使用低功耗无滴答模式；设为 0 时，
  * 滴答中断会始终运行。并非所有 FreeRTOS 移植版本都支持无滴答模式。
  * 详见：https://www.freertos.org/low-power-tickless-rtos.html
  * 若未定义，默认值为 0。 */
 #define configUSE_TICKLESS_IDLE                    0
 
+/* 将 configUSE_DELAYED_TASK_WHEEL 设为 1 时，超时阻塞的任务放在两级时间轮中，
+ * vTaskDelay()、带超时的队列操作以及节拍中断中的唤醒处理都是 O(1) 的，
+ * 适合有大量任务同时带超时阻塞的系统；设为 0 时使用按唤醒时间排序的延迟链表，
+ * 插入时需要遍历链表。若未定义，默认值为 0。
+ * configDELAYED_TASK_WHEEL_BITS 设置每一级的槽数（2 的幂，取值 1～10，16 位节拍时最大为 7），
+ * 时间轮覆盖 2^(2*configDELAYED_TASK_WHEEL_BITS) 个节拍，超时更长的任务仍放在有序延迟链表中，
+ * 插入时要遍历链表，进入范围后再移入时间轮。时间轮占用 2*2^configDELAYED_TASK_WHEEL_BITS 个 List_t
+ * 和同样多的位图位。若未定义，默认值为 5（两级各 32 个槽，覆盖 1024 个节拍，1kHz 节拍下约 1 秒）；
+ * 取 8 时两级各 256 个槽，覆盖 65536 个节拍（约 65 秒），占用约 10KB。 */
+#define configUSE_DELAYED_TASK_WHEEL               0
+#define configDELAYED_TASK_WHEEL_BITS              5
+
 /* configMAX_PRIORITIES 设置可用的任务优先级数量。
  * 任务可被分配的优先级范围是 0 到 (configMAX_PRIORITIES - 1)。
  * 0 是最低优先级。*/
@@ -339,6 +373,14 @@
  * to 0 if left undefined. */
 #define configCHECK_FOR_STACK_OVERFLOW        2
 
+/* 将 configCHECK_FOR_STACK_OVERFLOW 设为 3 时，栈最深端 16 字节的保护区中最先被溢出改写的那个字
+ * 换成每个任务不同的随机金丝雀值，每次切换只比较这一个字（方法 2 要比较整个保护区）。保护区的其余部分
+ * 由节拍中断每 configSTACK_OVERFLOW_DEEP_CHECK_PERIOD 个节拍轮流检查一个任务，发现改写时在节拍中断中
+ * 调用栈溢出钩子。金丝雀值默认由内核的伪随机数生成，有硬件随机数发生器时可以定义
+ * configSTACK_CANARY_RANDOM() 返回随机数。若未定义，configSTACK_OVERFLOW_DEEP_CHECK_PERIOD 默认为 1。 */
+/* #define configSTACK_OVERFLOW_DEEP_CHECK_PERIOD    1 */
+/* #define configSTACK_CANARY_RANDOM()               ( RNG->DR ) */
+
 /******************************************************************************/
 /* Run time and task stats gathering related definitions. *********************/
 /******************************************************************************/
@@ -607,6 +649,150 @@
 #define configUSE_QUEUE_SETS                   0
 #define configUSE_APPLICATION_TASK_TAG         0
 
+/* 将 configUSE_QUEUE_ZERO_COPY 设为 1 时提供零拷贝队列接口：发送方用 pvQueueReserveSend()
+ * 预留一个槽、直接在队列存储区中填写数据后调用 xQueueCommitSend() 提交，接收方用
+ * pvQueueAcquireReceive() 取得队首数据项的地址、原地读取后调用 vQueueReleaseReceive() 释放，
+ * 省去大数据项在 xQueueSend()/xQueueReceive() 中的两次 memcpy。若未定义，默认值为 0。 */
+#define configUSE_QUEUE_ZERO_COPY              0
+
+/* 将 configUSE_QUEUE_BATCH 设为 1 时提供批量收发接口 uxQueueSendMultiple()、uxQueueReceiveMultiple()
+ * 以及对应的 FromISR 版本：一次调用在同一个临界区内发送或接收多个数据项（最多两次 memcpy），
+ * 等待的任务按整批处理一次，而不是每个数据项都进出一次临界区、检查一次等待列表。
+ * 若未定义，默认值为 0。 */
+#define configUSE_QUEUE_BATCH                  0
+
+/* 将 configUSE_QUEUE_HANDOFF 设为 1 时，队列为空且有任务阻塞在 xQueueReceive() 中，xQueueSend() 系列
+ * （包括 FromISR 版本）直接把数据项复制到优先级最高的接收任务的缓冲区并唤醒它，不写入队列存储区，
+ * 也不修改 uxMessagesWaiting，一次收发只复制一次。同时允许 xQueueCreate( 0, uxItemSize ) 创建会合队列：
+ * 没有存储区，发送方一直阻塞到有接收方取走数据项为止（反之亦然）。会合队列不支持 xQueuePeek()、
+ * 零拷贝接口、批量接口和队列集，中断中只能向它发送。若未定义，默认值为 0。 */
+#define configUSE_QUEUE_HANDOFF                0
+
+/* 将 configUSE_QUEUE_FIXED_SIZE_COPY 设为 1 时，创建队列时按数据项大小为它选定一个复制函数，
+ * 数据项大小为 1、2、4、8 或 16 字节的队列各有一个复制长度为编译期常量的函数，编译器把复制展开成
+ * 一两条读写指令，不再调用库函数 memcpy()；其余大小的队列仍调用 memcpy()。收发时通过 Queue_t 中的
+ * 函数指针调用，不按大小分支，QueueHandle_t 和所有接口不变。每个队列多占一个指针。若未定义，默认值为 0。 */
+#define configUSE_QUEUE_FIXED_SIZE_COPY        0
+
+/* 将 configUSE_SEMAPHORE_FAST_PATH 设为 1 时，xSemaphoreTake()/xSemaphoreGive() 在信号量可用（或未满）、
+ * 互斥量无人持有时直接用比较交换修改计数和持有者，不进入临界区，也不检查超时和事件列表；
+ * 只有发现有任务正在阻塞或已经阻塞时才进入临界区唤醒对方。持有者继承了优先级时，释放互斥量
+ * 仍在临界区内恢复优先级。比较交换默认使用 atomic.h（要求 UBaseType_t 和指针为 32 位），
+ * 移植层可以在 portmacro.h 中定义 portATOMIC_COMPARE_AND_SWAP_UBASE() 和
+ * portATOMIC_COMPARE_AND_SWAP_POINTER() 代替。只支持单核；属于队列集的信号量释放时仍走完整路径。
+ * 若未定义，默认值为 0。 */
+#define configUSE_SEMAPHORE_FAST_PATH          0
+
+/* 将 configUSE_PRIORITY_CEILING_MUTEXES 设为 1 时，可以用 xSemaphoreCreateMutexWithCeiling() 和
+ * xSemaphoreCreateMutexWithCeilingStatic() 创建优先级天花板互斥量（立即天花板协议）：任务获取成功时
+ * 优先级直接提升到创建时指定的天花板，阻塞的任务不再做优先级继承，也就没有继承链；释放最后一个
+ * 互斥量时和优先级继承一样恢复基础优先级。天花板应取所有使用该锁的任务中的最高优先级。
+ * 获取天花板互斥量要修改就绪列表，不走 configUSE_SEMAPHORE_FAST_PATH 的无锁获取。需要 configUSE_MUTEXES。
+ * 若未定义，默认值为 0。 */
+#define configUSE_PRIORITY_CEILING_MUTEXES     0
+
+/* 将 configUSE_SPSC_QUEUES 设为 1 时编译 spsc_queue.c，提供单生产者/单消费者无锁队列
+ * （xSpscQueueSend()/xSpscQueueSendFromISR()、xSpscQueueReceive()/xSpscQueueReceiveFromISR()）。
+ * 写入者只修改写索引、读取者只修改读索引，对方没有阻塞等待时收发都不进入临界区，
+ * 适合串口接收、ADC 采样等中断到任务的数据通道。只支持单核，且要求
+ * configUSE_TASK_NOTIFICATIONS 为 1。若未定义，默认值为 0。 */
+#define configUSE_SPSC_QUEUES                  0
+
+/* configSPSC_NOTIFY_INDEX 是 SPSC 队列阻塞等待使用的任务通知索引，必须小于
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES。阻塞在 SPSC 队列上的任务不能再用这个索引收发其它通知，
+ * 否则应用的通知会被当作队列唤醒，队列的唤醒也会满足无关的 ulTaskNotifyTakeIndexed()。
+ * 若未定义，默认为通知数组的最后一个索引；只有 1 个索引时它与 xTaskNotifyGive() 等使用的
+ * 索引 0 重合，使用 SPSC 队列时应把 configTASK_NOTIFICATION_ARRAY_ENTRIES 设为至少 2。 */
+#define configSPSC_NOTIFY_INDEX                ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+
+/* 将 configUSE_MPMC_QUEUES 设为 1 时编译 mpmc_queue.c，提供多生产者/多消费者无锁队列
+ * （xMpmcQueueSend()/xMpmcQueueReceive() 及其 FromISR 版本）。每个槽位带一个序号，收发方用一次
+ * 比较交换占用读写位置，队列不满不空时不进入临界区；队列满或空时仍通过事件列表阻塞。
+ * 主要用于 SMP 构建，此时移植层必须提供 portATOMIC_COMPARE_AND_SWAP_U32() 和
+ * portMEMORY_FULL_BARRIER()。队列长度必须是不小于 2 的 2 的幂。若未定义，默认值为 0。 */
+#define configUSE_MPMC_QUEUES                  0
+
+/* 将 configUSE_GRANULAR_LOCKS 设为 1（仅 SMP）时，队列、信号量、流缓冲区和软件定时器各自用一把
+ * 对象自旋锁保护自身数据，只有操作事件列表、就绪列表时才嵌套获取内核的中断锁，不同对象上的收发
+ * 可以在多个核心上并行。互斥量因优先级继承仍使用全局临界区。锁的顺序为：内核任务锁 -> 对象锁
+ * -> 内核中断锁。移植层必须提供 portSPINLOCK_TYPE、portINIT_SPINLOCK()、portGET_SPINLOCK()
+ * 和 portRELEASE_SPINLOCK()，且同一核心可以递归获取同一把锁；不能与 configUSE_QUEUE_SETS 同时使用。
+ * 若未定义，默认值为 0。 */
+#define configUSE_GRANULAR_LOCKS               0
+
+/* 将 configUSE_ADAPTIVE_MUTEXES 设为 1（仅 SMP）时，xSemaphoreTake() 发现互斥量被其它核心上正在运行的
+ * 任务持有，先自旋等待它释放：每次轮询之间执行 portSPIN_WAIT_HINT()（默认 portNOP()，移植层可以定义为
+ * YIELD/PAUSE 等指令），次数从 1 倍增到 64；持有者被抢占、阻塞，或一次获取中累计等待
+ * configADAPTIVE_MUTEX_SPIN_LIMIT 次后，照常挂到等待列表上并继承优先级。持有者的临界区只有
+ * 几微秒时，可以省去一次阻塞和唤醒的任务切换。xTicksToWait 为 0 时不自旋。若未定义，默认值为 0。 */
+#define configUSE_ADAPTIVE_MUTEXES             0
+#define configADAPTIVE_MUTEX_SPIN_LIMIT        2000
+
+/* 将 configUSE_TICK_COUNT_SEQLOCK 设为 1 时，节拍中断每次修改节拍计数后，把节拍计数和溢出次数
+ * 写入两个缓冲区中空闲的一个，再递增一个字长的序号；读取方先读序号、再读序号对应的缓冲区，
+ * 序号不变即得到一致的值，否则重读。xTaskGetTickCount()、xTaskGetTickCountFromISR()、
+ * vTaskSetTimeOutState() 和 xTaskCheckForTimeOut() 因此不必屏蔽中断，软件定时器取当前时间也不必。
+ * 打断节拍中断的高优先级中断读到的是上一次发布的值，不会等待。本文件使用 64 位 TickType_t，
+ * Cortex-M3 无法原子地读取，建议设为 1。SMP 下移植层还需提供 portMEMORY_FULL_BARRIER()。
+ * 若未定义，默认值为 0。 */
+#define configUSE_TICK_COUNT_SEQLOCK           0
+
+/* 将 configUSE_TRACE_RECORDER 设为 1 时，trace_recorder.h 为任务切换、任务就绪/阻塞、中断进入/退出
+ * 以及队列、信号量、流缓冲区、任务通知、事件组和定时器命令等接口的进入/返回定义跟踪宏。
+ * 每个事件 8 字节（32 位时间戳 + 8 位事件码 + 24 位参数），写入当前核心的无锁环形缓冲区，
+ * 不屏蔽中断；节拍中断每次最多转存 configTRACE_RECORDER_DRAIN_EVENTS 个事件到流缓冲区，
+ * 环形缓冲区满时丢弃并计数。应用程序调用 xTraceRecorderStart() 开始记录，用一个低优先级任务
+ * 循环调用 xTraceRecorderRead() 把数据送到主机，由 Posix/trace/trace_decode.c 解码。
+ * 默认时间戳是节拍计数，分辨率太低，建议像下面这样改用 DWT 周期计数器。
+ * 需要 configUSE_STREAM_BUFFERS，不能与 configUSE_GRANULAR_LOCKS 同时使用。若未定义，默认值为 0。 */
+#define configUSE_TRACE_RECORDER               0
+/* #define configTRACE_RECORDER_TIMESTAMP()       ( *( ( volatile uint32_t * ) 0xE0001004UL ) ) */
+/* #define configTRACE_RECORDER_TIMESTAMP_HZ      configCPU_CLOCK_HZ */
+
+/* 将 configUSE_TASK_SNAPSHOT 设为 1 时，内核把所有任务按创建顺序链接在一个链表中（每个 TCB 多一个链表项），
+ * 监控任务可以用 vTaskSnapshotBegin()/eTaskSnapshotRead() 每次只挂起调度器读取几个任务的 TaskStatus_t，
+ * 代替一次遍历全部状态链表的 uxTaskGetSystemState()。期间有任务创建或删除时读取方会得到
+ * eTaskSnapshotChanged 并从头开始，读完时的任务集合总是一致的。vTaskListTasks() 和
+ * vTaskGetRunTimeStatistics() 也改为每次读取 configTASK_SNAPSHOT_CHUNK_LENGTH 个任务。
+ * 需要 configUSE_TRACE_FACILITY。若未定义，默认值为 0。 */
+#define configUSE_TASK_SNAPSHOT                0
+#define configTASK_SNAPSHOT_CHUNK_LENGTH       8
+
+/* 将 configUSE_TASK_POOL 设为 1 时，动态创建任务的 TCB 和栈从内核维护的对象池中分配，删除任务时还回池中，
+ * 运行期间反复创建和删除任务不会产生堆碎片。栈按深度分为 configTASK_POOL_STACK_CLASSES 种规格，
+ * 第 n 种（从 1 开始）的深度为 configTASK_POOL_MIN_STACK_DEPTH << ( n - 1 )，任务取能容纳所需深度的最小规格，
+ * 超过最大规格的栈仍从堆分配。池空时一次从堆分配 configTASK_POOL_SLAB_OBJECTS 个对象，已分配的对象不再还给堆；
+ * 可以在启动调度器前用 xTaskPoolReserve() 预先分配，用 uxTaskPoolGetStats() 查看占用情况。
+ * 需要 configSUPPORT_DYNAMIC_ALLOCATION。若未定义，默认值为 0。 */
+#define configUSE_TASK_POOL                    0
+#define configTASK_POOL_STACK_CLASSES          4
+#define configTASK_POOL_MIN_STACK_DEPTH        configMINIMAL_STACK_SIZE
+#define configTASK_POOL_SLAB_OBJECTS           4
+
+/* 将 configUSE_TASK_NAME_INDEX 设为 1 时，内核按任务名的散列值把所有未删除的任务放入
+ * configTASK_NAME_INDEX_BUCKETS 个桶中（每个 TCB 多一个指针和一个散列值），xTaskGetHandle() 只在
+ * 一个短临界区内查找一个桶，不再挂起调度器遍历所有状态链表。已调用 vTaskDelete() 但还没有被空闲任务
+ * 回收的任务不再能按名称找到。桶数必须是 2 的幂，取任务数附近的值即可。
+ * 需要 INCLUDE_xTaskGetHandle。若未定义，默认值为 0。 */
+#define configUSE_TASK_NAME_INDEX              0
+#define configTASK_NAME_INDEX_BUCKETS          16
+
+/* 将 configUSE_STACK_WATERMARK 设为 1 时，每次任务切换都在 taskCHECK_FOR_STACK_OVERFLOW() 旁边比较一次
+ * pxTopOfStack，记录任务用到过的最深栈位置；uxTaskGetStackHighWaterMark()、uxTaskGetStackHighWaterMark2()
+ * 和 vTaskGetInfo() 直接由记录算出结果，耗时与栈大小无关。只在切换时采样会漏掉两次切换之间更深的使用
+ * （例如中断嵌套或函数调用在切换前已经返回），将 configSTACK_WATERMARK_SCAN_WORDS 设为大于 0 的值时，
+ * 空闲任务每次循环在临界区内接着上次的位置检查这么多个栈字，逐个任务把记录修正为填充值扫描的结果。
+ * 若未定义，默认值均为 0。 */
+#define configUSE_STACK_WATERMARK              0
+#define configSTACK_WATERMARK_SCAN_WORDS       0
+
+/* 将 configUSE_BATCHED_TASK_CLEANUP 设为 1 时，空闲任务每次循环在一个临界区内从 xTasksWaitingTermination
+ * 中取下最多 configTASK_CLEANUP_BATCH_LENGTH 个已自删除的任务，退出临界区后再释放它们的 TCB 和栈；
+ * 剩下的任务留到下一次循环，两次调用空闲钩子之间的耗时有上限。设为 0 时空闲任务每清理一个任务进出
+ * 一次临界区，并且一直清理到链表为空。若未定义，默认值为 0。 */
+#define configUSE_BATCHED_TASK_CLEANUP         0
+#define configTASK_CLEANUP_BATCH_LENGTH        8
+
 /* Set the following INCLUDE_* constants to 1 to incldue the named API function,
  * or 0 to exclude the named API function.  Most linkers will remove unused
  * functions even when the constant is 1. */
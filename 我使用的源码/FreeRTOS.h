@@ -597,6 +597,18 @@
     #define portPOINTER_SIZE_TYPE    uint32_t
 #endif
 
+/* 设为 1 时启用内核跟踪记录器（trace_recorder.c）：任务切换、阻塞原因、中断和部分 API 的
+ * 进入/返回由跟踪宏写入每个核心的无锁环形缓冲区，节拍中断把它们转存到流缓冲区，
+ * 再由应用程序用 xTraceRecorderRead() 读出，交给主机上的解码程序分析。
+ * 应用程序自己定义的跟踪宏优先，记录器只定义尚未定义的宏。 */
+#ifndef configUSE_TRACE_RECORDER
+    #define configUSE_TRACE_RECORDER    0
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+    #include "trace_recorder.h"
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 
@@ -662,6 +674,16 @@
     #define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )
 #endif
 
+#ifndef traceTASK_PRIORITY_CEILING
+
+/* Called when a task takes a priority ceiling mutex and its priority is
+ * raised to the mutex's ceiling.  pxTCBOfMutexHolder is a pointer to the TCB
+ * of the task that took the mutex.  uxCeilingPriority is the priority it is
+ * raised to.  The priority is restored through traceTASK_PRIORITY_DISINHERIT
+ * when the task gives back its last mutex. */
+    #define traceTASK_PRIORITY_CEILING( pxTCBOfMutexHolder, uxCeilingPriority )
+#endif
+
 #ifndef traceBLOCKING_ON_QUEUE_RECEIVE
 
 /* Task is about to block because it cannot read from a
@@ -835,10 +857,25 @@
     #define traceTASK_DELAY()
 #endif
 
+/* EDF 任务在截止时间之后才完成本周期的工作（调用 xTaskDelayUntil()）。 */
+#ifndef traceTASK_DEADLINE_MISSED
+    #define traceTASK_DEADLINE_MISSED( pxTask )
+#endif
+
 #ifndef traceTASK_PRIORITY_SET
     #define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
 #endif
 
+/* 任务在本周期内用完了 CPU 预算，即将被降级或挂起。在节拍中断中调用。 */
+#ifndef traceTASK_BUDGET_EXHAUSTED
+    #define traceTASK_BUDGET_EXHAUSTED( pxTask )
+#endif
+
+/* 预算耗尽的任务在补充时间到达后恢复了原来的优先级或就绪状态。 */
+#ifndef traceTASK_BUDGET_REPLENISHED
+    #define traceTASK_BUDGET_REPLENISHED( pxTask )
+#endif
+
 #ifndef traceTASK_SUSPEND
     #define traceTASK_SUSPEND( pxTaskToSuspend )
 #endif
@@ -1203,6 +1240,22 @@
     #define traceRETURN_xQueueCreateMutexStatic( xNewQueue )
 #endif
 
+#ifndef traceENTER_xQueueCreateMutexWithCeiling
+    #define traceENTER_xQueueCreateMutexWithCeiling( uxCeilingPriority )
+#endif
+
+#ifndef traceRETURN_xQueueCreateMutexWithCeiling
+    #define traceRETURN_xQueueCreateMutexWithCeiling( xNewQueue )
+#endif
+
+#ifndef traceENTER_xQueueCreateMutexWithCeilingStatic
+    #define traceENTER_xQueueCreateMutexWithCeilingStatic( uxCeilingPriority, pxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCreateMutexWithCeilingStatic
+    #define traceRETURN_xQueueCreateMutexWithCeilingStatic( xNewQueue )
+#endif
+
 #ifndef traceENTER_xQueueGetMutexHolder
     #define traceENTER_xQueueGetMutexHolder( xSemaphore )
 #endif
@@ -1259,6 +1312,70 @@
     #define traceRETURN_xQueueGenericSend( xReturn )
 #endif
 
+#ifndef traceENTER_pvQueueReserveSend
+    #define traceENTER_pvQueueReserveSend( xQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_pvQueueReserveSend
+    #define traceRETURN_pvQueueReserveSend( pvReturn )
+#endif
+
+#ifndef traceENTER_xQueueCommitSend
+    #define traceENTER_xQueueCommitSend( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCommitSend
+    #define traceRETURN_xQueueCommitSend( xReturn )
+#endif
+
+#ifndef traceENTER_pvQueueAcquireReceive
+    #define traceENTER_pvQueueAcquireReceive( xQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_pvQueueAcquireReceive
+    #define traceRETURN_pvQueueAcquireReceive( pvReturn )
+#endif
+
+#ifndef traceENTER_vQueueReleaseReceive
+    #define traceENTER_vQueueReleaseReceive( xQueue )
+#endif
+
+#ifndef traceRETURN_vQueueReleaseReceive
+    #define traceRETURN_vQueueReleaseReceive()
+#endif
+
+#ifndef traceENTER_uxQueueSendMultiple
+    #define traceENTER_uxQueueSendMultiple( xQueue, pvItemsToQueue, uxItemCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_uxQueueSendMultiple
+    #define traceRETURN_uxQueueSendMultiple( uxReturn )
+#endif
+
+#ifndef traceENTER_uxQueueSendMultipleFromISR
+    #define traceENTER_uxQueueSendMultipleFromISR( xQueue, pvItemsToQueue, uxItemCount, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_uxQueueSendMultipleFromISR
+    #define traceRETURN_uxQueueSendMultipleFromISR( uxReturn )
+#endif
+
+#ifndef traceENTER_uxQueueReceiveMultiple
+    #define traceENTER_uxQueueReceiveMultiple( xQueue, pvBuffer, uxMaxItems, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_uxQueueReceiveMultiple
+    #define traceRETURN_uxQueueReceiveMultiple( uxReturn )
+#endif
+
+#ifndef traceENTER_uxQueueReceiveMultipleFromISR
+    #define traceENTER_uxQueueReceiveMultipleFromISR( xQueue, pvBuffer, uxMaxItems, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_uxQueueReceiveMultipleFromISR
+    #define traceRETURN_uxQueueReceiveMultipleFromISR( uxReturn )
+#endif
+
 #ifndef traceENTER_xQueueGenericSendFromISR
     #define traceENTER_xQueueGenericSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken, xCopyPosition )
 #endif
@@ -1947,6 +2064,38 @@
     #define traceRETURN_uxTaskGetSystemState( uxTask )
 #endif
 
+#ifndef traceENTER_xTaskPoolReserve
+    #define traceENTER_xTaskPoolReserve( uxStackDepth, uxCount )
+#endif
+
+#ifndef traceRETURN_xTaskPoolReserve
+    #define traceRETURN_xTaskPoolReserve( xReturn )
+#endif
+
+#ifndef traceENTER_uxTaskPoolGetStats
+    #define traceENTER_uxTaskPoolGetStats( pxStatsArray, uxArraySize )
+#endif
+
+#ifndef traceRETURN_uxTaskPoolGetStats
+    #define traceRETURN_uxTaskPoolGetStats( uxClasses )
+#endif
+
+#ifndef traceENTER_vTaskSnapshotBegin
+    #define traceENTER_vTaskSnapshotBegin( pxSnapshot )
+#endif
+
+#ifndef traceRETURN_vTaskSnapshotBegin
+    #define traceRETURN_vTaskSnapshotBegin()
+#endif
+
+#ifndef traceENTER_eTaskSnapshotRead
+    #define traceENTER_eTaskSnapshotRead( pxSnapshot, pxTaskStatusArray, uxArraySize, puxCount )
+#endif
+
+#ifndef traceRETURN_eTaskSnapshotRead
+    #define traceRETURN_eTaskSnapshotRead( eReturn )
+#endif
+
 #if ( configNUMBER_OF_CORES == 1 )
     #ifndef traceENTER_xTaskGetIdleTaskHandle
         #define traceENTER_xTaskGetIdleTaskHandle()
@@ -1991,6 +2140,38 @@
     #define traceRETURN_xTaskAbortDelay( xReturn )
 #endif
 
+#ifndef traceENTER_vTaskSetDeadline
+    #define traceENTER_vTaskSetDeadline( xTask, xPeriod, xRelativeDeadline )
+#endif
+
+#ifndef traceRETURN_vTaskSetDeadline
+    #define traceRETURN_vTaskSetDeadline()
+#endif
+
+#ifndef traceENTER_xTaskGetDeadline
+    #define traceENTER_xTaskGetDeadline( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetDeadline
+    #define traceRETURN_xTaskGetDeadline( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetBudget
+    #define traceENTER_vTaskSetBudget( xTask, xBudget, xPeriod, eAction, uxDemotedPriority )
+#endif
+
+#ifndef traceRETURN_vTaskSetBudget
+    #define traceRETURN_vTaskSetBudget()
+#endif
+
+#ifndef traceENTER_xTaskGetBudgetRemaining
+    #define traceENTER_xTaskGetBudgetRemaining( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetBudgetRemaining
+    #define traceRETURN_xTaskGetBudgetRemaining( xReturn )
+#endif
+
 #ifndef traceENTER_xTaskIncrementTick
     #define traceENTER_xTaskIncrementTick()
 #endif
@@ -2271,6 +2452,70 @@
     #define traceRETURN_vTaskExitCriticalFromISR()
 #endif
 
+#ifndef traceENTER_vTaskEnterCriticalObject
+    #define traceENTER_vTaskEnterCriticalObject( pxSpinlock )
+#endif
+
+#ifndef traceRETURN_vTaskEnterCriticalObject
+    #define traceRETURN_vTaskEnterCriticalObject()
+#endif
+
+#ifndef traceENTER_vTaskEnterCriticalObjectFromISR
+    #define traceENTER_vTaskEnterCriticalObjectFromISR( pxSpinlock )
+#endif
+
+#ifndef traceRETURN_vTaskEnterCriticalObjectFromISR
+    #define traceRETURN_vTaskEnterCriticalObjectFromISR( uxSavedInterruptStatus )
+#endif
+
+#ifndef traceENTER_vTaskExitCriticalObject
+    #define traceENTER_vTaskExitCriticalObject( pxSpinlock )
+#endif
+
+#ifndef traceRETURN_vTaskExitCriticalObject
+    #define traceRETURN_vTaskExitCriticalObject()
+#endif
+
+#ifndef traceENTER_vTaskExitCriticalObjectFromISR
+    #define traceENTER_vTaskExitCriticalObjectFromISR( uxSavedInterruptStatus, pxSpinlock )
+#endif
+
+#ifndef traceRETURN_vTaskExitCriticalObjectFromISR
+    #define traceRETURN_vTaskExitCriticalObjectFromISR()
+#endif
+
+#ifndef traceENTER_vTaskSetHandOffBuffer
+    #define traceENTER_vTaskSetHandOffBuffer( pvBuffer )
+#endif
+
+#ifndef traceRETURN_vTaskSetHandOffBuffer
+    #define traceRETURN_vTaskSetHandOffBuffer()
+#endif
+
+#ifndef traceENTER_xTaskClearHandOffBuffer
+    #define traceENTER_xTaskClearHandOffBuffer()
+#endif
+
+#ifndef traceRETURN_xTaskClearHandOffBuffer
+    #define traceRETURN_xTaskClearHandOffBuffer( xReturn )
+#endif
+
+#ifndef traceENTER_pvTaskGetEventListHandOffBuffer
+    #define traceENTER_pvTaskGetEventListHandOffBuffer( pxEventList )
+#endif
+
+#ifndef traceRETURN_pvTaskGetEventListHandOffBuffer
+    #define traceRETURN_pvTaskGetEventListHandOffBuffer( pvReturn )
+#endif
+
+#ifndef traceENTER_xTaskRemoveFromEventListAfterHandOff
+    #define traceENTER_xTaskRemoveFromEventListAfterHandOff( pxEventList )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveFromEventListAfterHandOff
+    #define traceRETURN_xTaskRemoveFromEventListAfterHandOff( xReturn )
+#endif
+
 #ifndef traceENTER_vTaskListTasks
     #define traceENTER_vTaskListTasks( pcWriteBuffer, uxBufferLength )
 #endif
@@ -2303,6 +2548,38 @@
     #define traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB )
 #endif
 
+#ifndef traceENTER_vTaskPriorityRaiseToCeiling
+    #define traceENTER_vTaskPriorityRaiseToCeiling( uxCeilingPriority )
+#endif
+
+#ifndef traceRETURN_vTaskPriorityRaiseToCeiling
+    #define traceRETURN_vTaskPriorityRaiseToCeiling()
+#endif
+
+#ifndef traceENTER_xTaskPriorityDisinheritCeiling
+    #define traceENTER_xTaskPriorityDisinheritCeiling( pxMutexHolder )
+#endif
+
+#ifndef traceRETURN_xTaskPriorityDisinheritCeiling
+    #define traceRETURN_xTaskPriorityDisinheritCeiling( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskDecrementMutexHeldCount
+    #define traceENTER_xTaskDecrementMutexHeldCount()
+#endif
+
+#ifndef traceRETURN_xTaskDecrementMutexHeldCount
+    #define traceRETURN_xTaskDecrementMutexHeldCount( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskIsRunningOnOtherCore
+    #define traceENTER_xTaskIsRunningOnOtherCore( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskIsRunningOnOtherCore
+    #define traceRETURN_xTaskIsRunningOnOtherCore( xReturn )
+#endif
+
 #ifndef traceENTER_ulTaskGenericNotifyTake
     #define traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait )
 #endif
@@ -2583,6 +2860,134 @@
     #define traceRETURN_ucStreamBufferGetStreamBufferType( ucStreamBufferType )
 #endif
 
+#ifndef traceENTER_xSpscQueueCreate
+    #define traceENTER_xSpscQueueCreate( uxQueueLength, uxItemSize )
+#endif
+
+#ifndef traceRETURN_xSpscQueueCreate
+    #define traceRETURN_xSpscQueueCreate( pvAllocatedMemory )
+#endif
+
+#ifndef traceENTER_xSpscQueueCreateStatic
+    #define traceENTER_xSpscQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xSpscQueueCreateStatic
+    #define traceRETURN_xSpscQueueCreateStatic( xReturn )
+#endif
+
+#ifndef traceENTER_vSpscQueueDelete
+    #define traceENTER_vSpscQueueDelete( xQueue )
+#endif
+
+#ifndef traceRETURN_vSpscQueueDelete
+    #define traceRETURN_vSpscQueueDelete()
+#endif
+
+#ifndef traceENTER_xSpscQueueSend
+    #define traceENTER_xSpscQueueSend( xQueue, pvItemToQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xSpscQueueSend
+    #define traceRETURN_xSpscQueueSend( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscQueueSendFromISR
+    #define traceENTER_xSpscQueueSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xSpscQueueSendFromISR
+    #define traceRETURN_xSpscQueueSendFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscQueueReceive
+    #define traceENTER_xSpscQueueReceive( xQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xSpscQueueReceive
+    #define traceRETURN_xSpscQueueReceive( xReturn )
+#endif
+
+#ifndef traceENTER_xSpscQueueReceiveFromISR
+    #define traceENTER_xSpscQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xSpscQueueReceiveFromISR
+    #define traceRETURN_xSpscQueueReceiveFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_uxSpscQueueMessagesWaiting
+    #define traceENTER_uxSpscQueueMessagesWaiting( xQueue )
+#endif
+
+#ifndef traceRETURN_uxSpscQueueMessagesWaiting
+    #define traceRETURN_uxSpscQueueMessagesWaiting( uxReturn )
+#endif
+
+#ifndef traceENTER_xMpmcQueueCreate
+    #define traceENTER_xMpmcQueueCreate( uxQueueLength, uxItemSize )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueCreate
+    #define traceRETURN_xMpmcQueueCreate( pvAllocatedMemory )
+#endif
+
+#ifndef traceENTER_xMpmcQueueCreateStatic
+    #define traceENTER_xMpmcQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueCreateStatic
+    #define traceRETURN_xMpmcQueueCreateStatic( xReturn )
+#endif
+
+#ifndef traceENTER_vMpmcQueueDelete
+    #define traceENTER_vMpmcQueueDelete( xQueue )
+#endif
+
+#ifndef traceRETURN_vMpmcQueueDelete
+    #define traceRETURN_vMpmcQueueDelete()
+#endif
+
+#ifndef traceENTER_xMpmcQueueSend
+    #define traceENTER_xMpmcQueueSend( xQueue, pvItemToQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueSend
+    #define traceRETURN_xMpmcQueueSend( xReturn )
+#endif
+
+#ifndef traceENTER_xMpmcQueueSendFromISR
+    #define traceENTER_xMpmcQueueSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueSendFromISR
+    #define traceRETURN_xMpmcQueueSendFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xMpmcQueueReceive
+    #define traceENTER_xMpmcQueueReceive( xQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueReceive
+    #define traceRETURN_xMpmcQueueReceive( xReturn )
+#endif
+
+#ifndef traceENTER_xMpmcQueueReceiveFromISR
+    #define traceENTER_xMpmcQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xMpmcQueueReceiveFromISR
+    #define traceRETURN_xMpmcQueueReceiveFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_uxMpmcQueueMessagesWaiting
+    #define traceENTER_uxMpmcQueueMessagesWaiting( xQueue )
+#endif
+
+#ifndef traceRETURN_uxMpmcQueueMessagesWaiting
+    #define traceRETURN_uxMpmcQueueMessagesWaiting( uxReturn )
+#endif
+
 #ifndef traceENTER_vListInitialise
     #define traceENTER_vListInitialise( pxList )
 #endif
@@ -2701,6 +3106,29 @@
     #define configUSE_TICKLESS_IDLE    0
 #endif
 
+/* 设为 1 时，超时阻塞的任务放在两级时间轮中（见 task.c），插入和到期处理都是 O(1)，
+ * 超出时间轮范围的任务仍放在有序的延迟链表中。 */
+#ifndef configUSE_DELAYED_TASK_WHEEL
+    #define configUSE_DELAYED_TASK_WHEEL    0
+#endif
+
+/* 时间轮每一级的槽数为 2 的 configDELAYED_TASK_WHEEL_BITS 次方，
+ * 时间轮覆盖的范围为 2 的 ( 2 * configDELAYED_TASK_WHEEL_BITS ) 次方个节拍，更长的超时仍插入有序延迟链表。 */
+#ifndef configDELAYED_TASK_WHEEL_BITS
+    #define configDELAYED_TASK_WHEEL_BITS    5
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    #if ( ( configDELAYED_TASK_WHEEL_BITS < 1 ) || ( configDELAYED_TASK_WHEEL_BITS > 10 ) )
+        #error configDELAYED_TASK_WHEEL_BITS must be between 1 and 10.
+    #endif
+
+    /* 节拍计数的段数必须多于时间轮的槽数，否则回绕后不同的段会落到同一个槽。 */
+    #if ( ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS ) && ( configDELAYED_TASK_WHEEL_BITS > 7 ) )
+        #error configDELAYED_TASK_WHEEL_BITS must not exceed 7 when TickType_t is 16 bits wide.
+    #endif
+#endif
+
 #ifndef configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING
     #define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
 #endif
@@ -2717,6 +3145,154 @@
     #define configUSE_QUEUE_SETS    0
 #endif
 
+/* 设为 1 时提供零拷贝队列接口（pvQueueReserveSend()/xQueueCommitSend()、
+ * pvQueueAcquireReceive()/vQueueReleaseReceive()），直接在队列存储区中写入和读取数据项。 */
+#ifndef configUSE_QUEUE_ZERO_COPY
+    #define configUSE_QUEUE_ZERO_COPY    0
+#endif
+
+/* 设为 1 时提供批量收发接口（uxQueueSendMultiple()、uxQueueReceiveMultiple() 及其 FromISR 版本），
+ * 在一次临界区内移动多个数据项。 */
+#ifndef configUSE_QUEUE_BATCH
+    #define configUSE_QUEUE_BATCH    0
+#endif
+
+/* 设为 1 时，队列为空且有任务阻塞在 xQueueReceive() 中，发送方直接把数据项复制到该任务的接收缓冲区
+ * 并唤醒它，不经过队列存储区；同时允许创建长度为 0 的会合队列。 */
+#ifndef configUSE_QUEUE_HANDOFF
+    #define configUSE_QUEUE_HANDOFF    0
+#endif
+
+/* 设为 1 时，创建队列时按数据项大小选定复制函数，1、2、4、8 或 16 字节的数据项用常量长度的复制代替调用 memcpy()。 */
+#ifndef configUSE_QUEUE_FIXED_SIZE_COPY
+    #define configUSE_QUEUE_FIXED_SIZE_COPY    0
+#endif
+
+/* 设为 1 时，信号量和互斥量没有竞争时用比较交换获取和释放，不进入临界区。只支持单核。 */
+#ifndef configUSE_SEMAPHORE_FAST_PATH
+    #define configUSE_SEMAPHORE_FAST_PATH    0
+#endif
+
+/* 设为 1 时可以用 xSemaphoreCreateMutexWithCeiling() 创建优先级天花板互斥量：获取成功时持有者的优先级
+ * 直接提升到创建时指定的天花板优先级，阻塞的获取方不再做优先级继承。 */
+#ifndef configUSE_PRIORITY_CEILING_MUTEXES
+    #define configUSE_PRIORITY_CEILING_MUTEXES    0
+#endif
+
+/* 设为 1 时编译 spsc_queue.c，提供单生产者/单消费者无锁队列（xSpscQueueSend() 等），
+ * 用于中断到任务的定长数据通道。 */
+#ifndef configUSE_SPSC_QUEUES
+    #define configUSE_SPSC_QUEUES    0
+#endif
+
+/* SPSC 队列阻塞等待使用的任务通知索引，应用不能在使用 SPSC 队列的任务上使用它。
+ * 默认取通知数组的最后一个，避开 xTaskNotifyGive() 等使用的默认索引 0。 */
+#ifndef configSPSC_NOTIFY_INDEX
+    #define configSPSC_NOTIFY_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+#endif
+
+/* 设为 1 时编译 mpmc_queue.c，提供按槽位序号实现的多生产者/多消费者无锁队列（xMpmcQueueSend() 等），
+ * 队列不满不空时收发不进入临界区，SMP 上各核可以并行收发。 */
+#ifndef configUSE_MPMC_QUEUES
+    #define configUSE_MPMC_QUEUES    0
+#endif
+
+/* 设为 1 时（仅 SMP）队列、信号量、流缓冲区和软件定时器改用各自的对象自旋锁保护自身数据，
+ * 只在操作事件列表、就绪列表时才嵌套获取内核锁，不同对象上的收发可以在多个核心上并行执行。
+ * 端口需提供 portSPINLOCK_TYPE、portINIT_SPINLOCK()、portGET_SPINLOCK() 和 portRELEASE_SPINLOCK()。 */
+#ifndef configUSE_GRANULAR_LOCKS
+    #define configUSE_GRANULAR_LOCKS    0
+#endif
+
+/* 设为 1 时（仅 SMP）获取被其它核心上正在运行的任务持有的互斥量，先带退避地自旋等待它释放，
+ * 持有者被抢占或阻塞、或者自旋次数达到 configADAPTIVE_MUTEX_SPIN_LIMIT 时才阻塞。 */
+#ifndef configUSE_ADAPTIVE_MUTEXES
+    #define configUSE_ADAPTIVE_MUTEXES    0
+#endif
+
+/* 自适应互斥量一次获取最多执行的自旋等待次数（portSPIN_WAIT_HINT() 的次数）。 */
+#ifndef configADAPTIVE_MUTEX_SPIN_LIMIT
+    #define configADAPTIVE_MUTEX_SPIN_LIMIT    2000
+#endif
+
+/* 设为 1 时节拍计数和溢出次数由节拍中断以双缓冲序列锁的形式发布，xTaskGetTickCount()、
+ * xTaskGetTickCountFromISR()、vTaskSetTimeOutState() 和 xTaskCheckForTimeOut() 读取时不再屏蔽中断。
+ * 用于 TickType_t 比处理器字长更宽（portTICK_TYPE_IS_ATOMIC 为 0）的移植层，
+ * 例如 32 位内核上使用 TICK_TYPE_WIDTH_64_BITS。 */
+#ifndef configUSE_TICK_COUNT_SEQLOCK
+    #define configUSE_TICK_COUNT_SEQLOCK    0
+#endif
+
+/* 设为 1 时内核按创建顺序把所有任务链接在一起，vTaskSnapshotBegin()/eTaskSnapshotRead() 每次只在
+ * 调度器挂起期间读取一段 TaskStatus_t，任务的创建或删除由 uxTaskNumber 检测，读取方据此重新开始。
+ * vTaskListTasks() 和 vTaskGetRunTimeStatistics() 也改为分段读取。需要 configUSE_TRACE_FACILITY。 */
+#ifndef configUSE_TASK_SNAPSHOT
+    #define configUSE_TASK_SNAPSHOT    0
+#endif
+
+/* vTaskListTasks() 和 vTaskGetRunTimeStatistics() 每次挂起调度器时最多读取的任务数。 */
+#ifndef configTASK_SNAPSHOT_CHUNK_LENGTH
+    #define configTASK_SNAPSHOT_CHUNK_LENGTH    8U
+#endif
+
+/* 设为 1 时 xTaskCreate() 从任务对象池取 TCB 和栈：TCB 一种规格，栈按深度分为
+ * configTASK_POOL_STACK_CLASSES 种规格，从 configTASK_POOL_MIN_STACK_DEPTH 起每种加倍。
+ * 池空时一次从堆分配 configTASK_POOL_SLAB_OBJECTS 个对象，删除任务时对象归还到池中，不再还给堆。
+ * 超过最大规格的栈仍直接从堆分配。 */
+#ifndef configUSE_TASK_POOL
+    #define configUSE_TASK_POOL    0
+#endif
+
+#ifndef configTASK_POOL_STACK_CLASSES
+    #define configTASK_POOL_STACK_CLASSES    4U
+#endif
+
+#ifndef configTASK_POOL_MIN_STACK_DEPTH
+    #define configTASK_POOL_MIN_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
+
+#ifndef configTASK_POOL_SLAB_OBJECTS
+    #define configTASK_POOL_SLAB_OBJECTS    4U
+#endif
+
+/* 设为 1 时内核按任务名维护一个散列索引，xTaskGetHandle() 只查找一个桶，不再挂起调度器遍历所有状态链表。
+ * configTASK_NAME_INDEX_BUCKETS 是桶数，必须是 2 的幂。 */
+#ifndef configUSE_TASK_NAME_INDEX
+    #define configUSE_TASK_NAME_INDEX    0
+#endif
+
+#ifndef configTASK_NAME_INDEX_BUCKETS
+    #define configTASK_NAME_INDEX_BUCKETS    16U
+#endif
+
+/* 设为 1 时每个任务记录切换出去时见到的最深栈指针，uxTaskGetStackHighWaterMark()、
+ * uxTaskGetStackHighWaterMark2() 和 vTaskGetInfo() 直接由该记录算出剩余栈空间，不再逐字节扫描栈。
+ * configSTACK_WATERMARK_SCAN_WORDS 大于 0 时，空闲任务每次循环还会接着上次的位置扫描这么多个字，
+ * 把两次切换之间（例如中断中）用到的更深位置也补进记录。 */
+#ifndef configUSE_STACK_WATERMARK
+    #define configUSE_STACK_WATERMARK    0
+#endif
+
+/* 设为 1 时空闲任务在一个临界区内取下最多 configTASK_CLEANUP_BATCH_LENGTH 个已自删除的任务，
+ * 退出临界区后再逐个释放 TCB 和栈，剩下的留到空闲任务的下一次循环。 */
+#ifndef configUSE_BATCHED_TASK_CLEANUP
+    #define configUSE_BATCHED_TASK_CLEANUP    0
+#endif
+
+#ifndef configTASK_CLEANUP_BATCH_LENGTH
+    #define configTASK_CLEANUP_BATCH_LENGTH    8U
+#endif
+
+/* configCHECK_FOR_STACK_OVERFLOW 为 3 时，切换时只比较金丝雀字，
+ * 节拍中断每隔这么多个节拍轮流检查一个任务的整个栈保护区。 */
+#ifndef configSTACK_OVERFLOW_DEEP_CHECK_PERIOD
+    #define configSTACK_OVERFLOW_DEEP_CHECK_PERIOD    1U
+#endif
+
+#ifndef configSTACK_WATERMARK_SCAN_WORDS
+    #define configSTACK_WATERMARK_SCAN_WORDS    0U
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
     #define portTASK_USES_FLOATING_POINT()
 #endif
@@ -2765,6 +3341,22 @@
     #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
 #endif
 
+/* 通用任务选择（configUSE_PORT_OPTIMISED_TASK_SELECTION 为 0）时，
+ * 用两级位图记录有就绪任务的优先级，选择最高优先级任务不再需要逐级向下扫描。 */
+#ifndef configUSE_READY_PRIORITY_BITMAP
+    #define configUSE_READY_PRIORITY_BITMAP    0
+#endif
+
+#if ( configUSE_READY_PRIORITY_BITMAP == 1 )
+    #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION != 0 )
+        #error configUSE_READY_PRIORITY_BITMAP replaces the generic task selection, so configUSE_PORT_OPTIMISED_TASK_SELECTION must be 0.
+    #endif
+
+    #if ( configMAX_PRIORITIES > 256 )
+        #error configUSE_READY_PRIORITY_BITMAP supports at most 256 priorities (8 groups of 32).
+    #endif
+#endif
+
 #ifndef configAPPLICATION_ALLOCATED_HEAP
     #define configAPPLICATION_ALLOCATED_HEAP    0
 #endif
@@ -2879,6 +3471,131 @@
     #error configUSE_PORT_OPTIMISED_TASK_SELECTION is not supported in SMP FreeRTOS
 #endif
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_READY_PRIORITY_BITMAP != 0 ) )
+    #error configUSE_READY_PRIORITY_BITMAP is not supported in SMP FreeRTOS
+#endif
+
+/* 最早截止时间优先（EDF）调度：优先级为 configEDF_PRIORITY 的就绪任务按绝对截止时间排序，
+ * 其它优先级仍按固定优先级调度。 */
+#ifndef configUSE_EDF_SCHEDULING
+    #define configUSE_EDF_SCHEDULING    0
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    #ifndef configEDF_PRIORITY
+        #error configEDF_PRIORITY must be defined when configUSE_EDF_SCHEDULING is 1.
+    #endif
+
+    #if ( configEDF_PRIORITY >= configMAX_PRIORITIES )
+        #error configEDF_PRIORITY must be less than configMAX_PRIORITIES.
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_EDF_SCHEDULING is not supported in SMP FreeRTOS
+    #endif
+#endif
+
+/* 任务 CPU 预算：每个周期内任务最多运行的节拍数，用完后降级或挂起到下一个补充时间。 */
+#ifndef configUSE_TASK_BUDGETS
+    #define configUSE_TASK_BUDGETS    0
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_TASK_BUDGETS != 0 ) )
+    #error configUSE_TASK_BUDGETS is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SPSC_QUEUES != 0 ) )
+    #error configUSE_SPSC_QUEUES is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_SEMAPHORE_FAST_PATH != 0 ) )
+    #error configUSE_SEMAPHORE_FAST_PATH is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 to use configUSE_PRIORITY_CEILING_MUTEXES
+#endif
+
+#if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+    #if ( configNUMBER_OF_CORES == 1 )
+        #error configUSE_ADAPTIVE_MUTEXES is not supported in single core FreeRTOS
+    #endif
+
+    #if ( configUSE_MUTEXES != 1 )
+        #error configUSE_MUTEXES must be set to 1 to use configUSE_ADAPTIVE_MUTEXES
+    #endif
+#endif
+
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    #if ( configNUMBER_OF_CORES == 1 )
+        #error configUSE_GRANULAR_LOCKS is not supported in single core FreeRTOS
+    #endif
+
+    #if ( configUSE_QUEUE_SETS == 1 )
+        #error configUSE_QUEUE_SETS cannot be used together with configUSE_GRANULAR_LOCKS
+    #endif
+
+    #ifndef portSPINLOCK_TYPE
+        #error portSPINLOCK_TYPE, portINIT_SPINLOCK(), portGET_SPINLOCK() and portRELEASE_SPINLOCK() must be defined by the port to use configUSE_GRANULAR_LOCKS
+    #endif
+#endif
+
+#if ( ( configUSE_TICK_COUNT_SEQLOCK == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+    #ifndef portMEMORY_FULL_BARRIER
+        #error portMEMORY_FULL_BARRIER must be defined in portmacro.h to use configUSE_TICK_COUNT_SEQLOCK in SMP FreeRTOS
+    #endif
+#endif
+
+#if ( ( configUSE_TASK_SNAPSHOT == 1 ) && ( configUSE_TRACE_FACILITY != 1 ) )
+    #error configUSE_TRACE_FACILITY must be set to 1 to use configUSE_TASK_SNAPSHOT
+#endif
+
+#if ( configUSE_TASK_POOL == 1 )
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+        #error configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 to use configUSE_TASK_POOL
+    #endif
+
+    #if ( ( configTASK_POOL_STACK_CLASSES < 1 ) || ( configTASK_POOL_STACK_CLASSES > 16 ) )
+        #error configTASK_POOL_STACK_CLASSES must be between 1 and 16
+    #endif
+
+    #if ( configTASK_POOL_SLAB_OBJECTS < 1 )
+        #error configTASK_POOL_SLAB_OBJECTS must be at least 1
+    #endif
+#endif
+
+#if ( ( configUSE_BATCHED_TASK_CLEANUP == 1 ) && ( configTASK_CLEANUP_BATCH_LENGTH < 1 ) )
+    #error configTASK_CLEANUP_BATCH_LENGTH must be at least 1
+#endif
+
+#if ( ( configCHECK_FOR_STACK_OVERFLOW == 3 ) && ( configSTACK_OVERFLOW_DEEP_CHECK_PERIOD < 1 ) )
+    #error configSTACK_OVERFLOW_DEEP_CHECK_PERIOD must be at least 1
+#endif
+
+#if ( ( configSTACK_WATERMARK_SCAN_WORDS > 0 ) && ( configUSE_STACK_WATERMARK != 1 ) )
+    #error configUSE_STACK_WATERMARK must be set to 1 to use configSTACK_WATERMARK_SCAN_WORDS
+#endif
+
+#if ( configUSE_TASK_NAME_INDEX == 1 )
+    #if ( INCLUDE_xTaskGetHandle != 1 )
+        #error INCLUDE_xTaskGetHandle must be set to 1 to use configUSE_TASK_NAME_INDEX
+    #endif
+
+    #if ( ( configTASK_NAME_INDEX_BUCKETS < 1 ) || ( ( configTASK_NAME_INDEX_BUCKETS & ( configTASK_NAME_INDEX_BUCKETS - 1 ) ) != 0 ) )
+        #error configTASK_NAME_INDEX_BUCKETS must be a power of two
+    #endif
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+    #if ( configUSE_STREAM_BUFFERS == 0 )
+        #error configUSE_STREAM_BUFFERS must be set to 1 to use configUSE_TRACE_RECORDER
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        #error configUSE_TRACE_RECORDER cannot be used together with configUSE_GRANULAR_LOCKS
+    #endif
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
     #define configINITIAL_TICK_COUNT    0
 #endif
@@ -3183,6 +3900,34 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iDummy22;
     #endif
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xDummy27[ 3 ];
+    #endif
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        StaticListItem_t xDummy28;
+        TickType_t xDummy29[ 4 ];
+        UBaseType_t uxDummy30[ 2 ];
+        uint8_t ucDummy31[ 2 ];
+    #endif
+    #if ( ( configUSE_TASK_SNAPSHOT == 1 ) || ( configSTACK_WATERMARK_SCAN_WORDS > 0 ) || ( configCHECK_FOR_STACK_OVERFLOW == 3 ) )
+        StaticListItem_t xDummy32;
+    #endif
+    #if ( configUSE_STACK_WATERMARK == 1 )
+        void * pxDummy33;
+    #endif
+    #if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+        StackType_t xDummy34;
+    #endif
+    #if ( configUSE_TASK_POOL == 1 )
+        uint8_t ucDummy35;
+    #endif
+    #if ( configUSE_TASK_NAME_INDEX == 1 )
+        void * pxDummy36;
+        uint32_t ulDummy37;
+    #endif
+    #if ( configUSE_QUEUE_HANDOFF == 1 )
+        void * pvDummy38;
+    #endif
 } StaticTask_t;
 
 /*
@@ -3224,6 +3969,26 @@ typedef struct xSTATIC_QUEUE
         UBaseType_t uxDummy8;  // 占位成员8（跟踪功能相关的计数字段）
         uint8_t ucDummy9;      // 占位成员9（跟踪功能相关的状态字段）
     #endif
+
+    // 若启用零拷贝队列接口
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucDummy10;     // 占位成员10（零拷贝预留/占用状态）
+    #endif
+
+    // 若启用优先级天花板互斥量
+    #if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+        UBaseType_t uxDummy12;  // 占位成员12（天花板优先级）
+    #endif
+
+    // 若启用按数据项大小选定的复制函数
+    #if ( configUSE_QUEUE_FIXED_SIZE_COPY == 1 )
+        void * pvDummy13;       // 占位成员13（复制数据项的函数）
+    #endif
+
+    // 若启用对象级自旋锁
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xDummySpinlock;  // 占位成员11（队列自身的自旋锁）
+    #endif
 } StaticQueue_t;
 
 // 将 StaticQueue_t 重定义为 StaticSemaphore_t
@@ -3283,6 +4048,9 @@ typedef struct xSTATIC_TIMER
         UBaseType_t uxDummy7;
     #endif
     uint8_t ucDummy8;
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xDummySpinlock;
+    #endif
 } StaticTimer_t;
 
 /*
@@ -3311,11 +4079,42 @@ typedef struct xSTATIC_STREAM_BUFFER
         void * pvDummy5[ 2 ];
     #endif
     UBaseType_t uxDummy6;
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xDummySpinlock;
+    #endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * 静态创建 SPSC 队列时用来保存控制结构的类型，大小和对齐与 spsc_queue.c 中的
+ * SpscQueue_t 一致。
+ */
+#if ( configUSE_SPSC_QUEUES == 1 )
+    typedef struct xSTATIC_SPSC_QUEUE
+    {
+        UBaseType_t uxDummy1[ 4 ];
+        void * pvDummy2[ 3 ];
+        uint8_t ucDummy3;
+    } StaticSpscQueue_t;
+#endif
+
+/*
+ * 静态创建 MPMC 队列时用来保存控制结构的类型，大小和对齐与 mpmc_queue.c 中的
+ * MpmcQueue_t 一致。
+ */
+#if ( configUSE_MPMC_QUEUES == 1 )
+    typedef struct xSTATIC_MPMC_QUEUE
+    {
+        uint32_t ulDummy1[ 2 ];
+        void * pvDummy2[ 2 ];
+        UBaseType_t uxDummy3[ 4 ];
+        StaticList_t xDummy4[ 2 ];
+        uint8_t ucDummy5;
+    } StaticMpmcQueue_t;
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
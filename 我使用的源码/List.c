@@ -5,7 +5,7 @@
 #define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
 #include "FreeRTOS.h"
-#include "list.h"
+#include "List.h"
 
 /* 
  对于支持 MPU（内存保护单元）的移植版本（MPU ports），
@@ -35,6 +35,9 @@ list_t 类型仅能存储指向 list_item_t 类型的指针。每个 ListItem_t
 "#define configLIST_VOLATILE volatile"
 */
 
+#ifndef LIST_H
+#define LIST_H
+
 #ifndef configLIST_VOLATILE
     #define configLIST_VOLATILE
 #endif /* configSUPPORT_CROSS_MODULE_OPTIMISATION */
@@ -206,7 +209,7 @@ typedef struct xLIST
         ( pxConstList )->pxIndex = ( pxConstList )->pxIndex->pxNext;                           \
         if( ( void * ) ( pxConstList )->pxIndex == ( void * ) &( ( pxConstList )->xListEnd ) ) \
         {                                                                                      \
-            // 若索引指向哨兵节点，重置为列表头部（避免遍历到无效项）
+            /* 若索引指向哨兵节点，重置为列表头部（避免遍历到无效项） */ \
             ( pxConstList )->pxIndex = ( pxConstList )->xListEnd.pxNext;                       \
         }                                                                                      \
         ( pxTCB ) = ( pxConstList )->pxIndex->pvOwner;                                         \
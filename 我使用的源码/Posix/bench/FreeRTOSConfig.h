@@ -0,0 +1,187 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*******************************************************************************
+ * 内核微基准测试（bench.c）使用的配置，只用于 POSIX 主机移植。
+ * 各配置项的含义见 ARM_CM3/FreeRTOSConfig.h 中的说明，这里只解释与测试相关的取值。
+ ******************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+/* 与硬件描述相关的定义。********************************************************/
+/******************************************************************************/
+
+/* 主机上没有真正的外设时钟，该值只用于满足内核的配置检查。 */
+#define configCPU_CLOCK_HZ                         ( ( unsigned long ) 1000000 )
+
+/******************************************************************************/
+/* Scheduling behaviour related definitions. **********************************/
+/******************************************************************************/
+
+/* 1ms 节拍，便于把定时器抖动换算成纳秒。 */
+#define configTICK_RATE_HZ                         1000
+#define configUSE_PREEMPTION                       1
+#define configUSE_TIME_SLICING                     1
+
+/* 使用通用 C 算法选择任务，测量的是内核本身的代码路径。 */
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#define configUSE_TICKLESS_IDLE                    0
+#define configMAX_PRIORITIES                       8
+#define configMINIMAL_STACK_SIZE                   256
+#define configMAX_TASK_NAME_LEN                    16
+#define configTICK_TYPE_WIDTH_IN_BITS              TICK_TYPE_WIDTH_64_BITS
+#define configIDLE_SHOULD_YIELD                    1
+/* 索引 0 留给控制任务和 pingpong/notify、isr 测试组，SPSC 队列阻塞使用索引 1（configSPSC_NOTIFY_INDEX 的默认值）。 */
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES      2
+#define configQUEUE_REGISTRY_SIZE                  0
+#define configENABLE_BACKWARD_COMPATIBILITY        0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS    0
+#define configUSE_MINI_LIST_ITEM                   1
+#define configSTACK_DEPTH_TYPE                     size_t
+#define configMESSAGE_BUFFER_LENGTH_TYPE           size_t
+#define configHEAP_CLEAR_MEMORY_ON_FREE            0
+#define configUSE_NEWLIB_REENTRANT                 0
+
+/******************************************************************************/
+/* Software timer related definitions. ****************************************/
+/******************************************************************************/
+
+/* 定时器抖动测试会一次启动上百个定时器，命令队列取大一些。 */
+#define configUSE_TIMERS                           1
+#define configTIMER_TASK_PRIORITY                  ( configMAX_PRIORITIES - 1 )
+#define configTIMER_TASK_STACK_DEPTH               configMINIMAL_STACK_SIZE
+#define configTIMER_QUEUE_LENGTH                   32
+
+#define configUSE_EVENT_GROUPS                     0
+#define configUSE_STREAM_BUFFERS                   1
+
+/******************************************************************************/
+/* 内存分配相关定义 ***********************************************************/
+/******************************************************************************/
+
+/* 背景任务最多有上百个，每个任务都要分配 TCB 和栈。 */
+#define configSUPPORT_STATIC_ALLOCATION            0
+#define configSUPPORT_DYNAMIC_ALLOCATION           1
+#define configTOTAL_HEAP_SIZE                      ( 4 * 1024 * 1024 )
+#define configAPPLICATION_ALLOCATED_HEAP           0
+
+/******************************************************************************/
+/* Hook and callback function related definitions. ****************************/
+/******************************************************************************/
+
+#define configUSE_IDLE_HOOK                        0
+#define configUSE_TICK_HOOK                        0
+#define configUSE_MALLOC_FAILED_HOOK               0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK         0
+
+/* 默认不做栈溢出检查，避免检查本身的开销混入测量结果。改为 2 或 3 编译，
+ * 对比 uncontended/100x vTaskSwitchContext 即为每次切换时检查的开销。 */
+#define configCHECK_FOR_STACK_OVERFLOW             0
+
+/******************************************************************************/
+/* Run time and task stats gathering related definitions. *********************/
+/******************************************************************************/
+
+#define configGENERATE_RUN_TIME_STATS              0
+#define configUSE_TRACE_FACILITY                   0
+#define configUSE_STATS_FORMATTING_FUNCTIONS       0
+
+/******************************************************************************/
+/* Definitions that include or exclude functionality. *************************/
+/******************************************************************************/
+
+#define configUSE_TASK_NOTIFICATIONS               1
+#define configUSE_MUTEXES                          1
+#define configUSE_RECURSIVE_MUTEXES                0
+#define configUSE_COUNTING_SEMAPHORES              1
+#define configUSE_QUEUE_SETS                       0
+
+/* uncontended 测试组对比大数据项的复制接口和零拷贝接口。 */
+#define configUSE_QUEUE_ZERO_COPY                  1
+
+/* uncontended 测试组对比逐个收发和批量收发。 */
+#define configUSE_QUEUE_BATCH                      1
+
+/* pingpong/queue 中接收方总是先阻塞在空队列上，改为 0 编译对比直接交付的效果；
+ * 为 1 时另外测量长度为 0 的会合队列。 */
+#define configUSE_QUEUE_HANDOFF                    1
+
+/* uncontended/queue send+recv 和 pingpong/queue 使用 4 字节数据项，改为 0 编译对比调用 memcpy() 的开销。 */
+#define configUSE_QUEUE_FIXED_SIZE_COPY            1
+
+/* uncontended/mutex take+give 和 uncontended/semaphore give+take 不进入临界区，改为 0 编译对比。 */
+#define configUSE_SEMAPHORE_FAST_PATH              1
+
+/* uncontended/ceiling mutex take+give 测量获取时提升、释放时恢复优先级的开销。 */
+#define configUSE_PRIORITY_CEILING_MUTEXES         1
+
+/* uncontended 测试组对比普通队列和 SPSC 无锁队列。 */
+#define configUSE_SPSC_QUEUES                      1
+
+/* mpmc 测试组用同样的配置对比普通队列和无锁 MPMC 队列。 */
+#define configUSE_MPMC_QUEUES                      1
+#define configUSE_APPLICATION_TASK_TAG             0
+
+/* 设为 1 时记录整个运行过程的内核跟踪（见 bench.c 的说明），用于测量记录器的开销。
+ * 时间戳取 1us 分辨率的主机时钟。pingpong 每秒产生上百万个事件，而节拍只有 1kHz，
+ * 环形缓冲区、每个节拍的转存数和流缓冲区都要相应加大，否则大部分事件会被丢弃。 */
+#define configUSE_TRACE_RECORDER                   0
+#define configTRACE_RECORDER_TIMESTAMP()           ( ( uint32_t ) ( ullPortGetTimeNs() / 1000U ) )
+#define configTRACE_RECORDER_TIMESTAMP_HZ          1000000U
+#define configTRACE_RECORDER_RING_LENGTH           8192U
+#define configTRACE_RECORDER_DRAIN_EVENTS          4096U
+#define configTRACE_RECORDER_STREAM_BUFFER_SIZE    ( 512U * 1024U )
+
+#define INCLUDE_vTaskPrioritySet                   1
+#define INCLUDE_uxTaskPriorityGet                  1
+#define INCLUDE_vTaskDelete                        1
+#define INCLUDE_vTaskSuspend                       1
+#define INCLUDE_vTaskDelayUntil                    1
+#define INCLUDE_vTaskDelay                         1
+#define INCLUDE_xTaskGetSchedulerState             1
+#define INCLUDE_xTaskGetCurrentTaskHandle          1
+#define INCLUDE_xTaskGetIdleTaskHandle             0
+#define INCLUDE_xTimerPendFunctionCall             0
+
+/* 断言失败时直接终止进程，基准测试脚本据此判定失败。 */
+#define configASSERT( x )                                                     \
+    do                                                                        \
+    {                                                                         \
+        if( ( x ) == 0 )                                                      \
+        {                                                                     \
+            fprintf( stderr, "configASSERT failed: %s:%d\n", __FILE__, __LINE__ ); \
+            abort();                                                          \
+        }                                                                     \
+    } while( 0 )
+
+#endif /* FREERTOS_CONFIG_H */
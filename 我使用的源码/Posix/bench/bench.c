@@ -0,0 +1,1220 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+* 内核微基准测试（POSIX 主机移植）。
+*
+* 测量内核热点路径的吞吐量和延迟分布（最小值/p50/p90/p99/p99.9/最大值，单位 ns）：
+* - pingpong：两个任务通过任务通知、队列、二值信号量来回传递，一次往返包含两次
+*   vTaskSwitchContext()，并在延时列表中放入 0/32/128 个背景任务，观察任务数增长的影响；
+*   queue-timeout 与 queue 相同，但以有限超时阻塞，背景任务的唤醒时间都早于该超时，
+*   用来衡量阻塞任务插入延时列表的开销（对比 configUSE_DELAYED_TASK_WHEEL 的效果）；
+*   queue 测试中接收方总是先阻塞，对比 configUSE_QUEUE_HANDOFF 开关前后即为直接交付的效果，
+*   开启时另外测量长度为 0 的会合队列（queue-rendezvous）；
+* - mpmc：N 个生产者、M 个消费者通过不同深度的队列传递带时间戳的消息，
+*   测量 xQueueGenericSend()/xQueueReceive() 的吞吐量和端到端延迟，并用同样的配置
+*   测量无锁 MPMC 队列（configUSE_MPMC_QUEUES）；
+* - uncontended：无竞争情况下互斥量获取/释放、信号量释放/获取（configUSE_SEMAPHORE_FAST_PATH）、
+*   优先级天花板互斥量（configUSE_PRIORITY_CEILING_MUTEXES）每次获取/释放提升和恢复优先级的开销、
+*   队列发送/接收的单次开销，
+*   256 字节记录走复制接口和零拷贝接口（configUSE_QUEUE_ZERO_COPY）的对比，
+*   32 个数据项逐个收发和批量收发（configUSE_QUEUE_BATCH）的对比，
+*   SPSC/MPMC 无锁队列（configUSE_SPSC_QUEUES/configUSE_MPMC_QUEUES）的收发开销，
+*   以及不发生线程切换时 vTaskSwitchContext() 本身的开销（用来对比 configCHECK_FOR_STACK_OVERFLOW
+*   的各种方法）；
+* - timer：1/32/128 个周期定时器，测量守护任务调用回调的周期抖动 |实际周期 - 设定周期|；
+* - isr：模拟中断中 vTaskNotifyGiveFromISR() 唤醒高优先级任务，测量从触发中断到任务运行的延迟。
+*
+* 主机上的绝对数值包含线程切换和信号投递的开销，只适合与同一台机器上的历史结果对比，
+* 用来发现回归。
+*
+* 编译运行（在“我使用的源码”目录下）：
+*   gcc -O2 -IPosix/bench -I. -IPosix -o rtos_bench Posix/bench/bench.c Posix/port.c \
+*       Posix/utils/wait_for_event.c task.c queue.c List.c timers.c heap_4.c stream_buffer.c \
+*       spsc_queue.c mpmc_queue.c trace_recorder.c -pthread
+*   ./rtos_bench [测试组名...]      不带参数时运行全部测试组
+*
+* 将 configUSE_TRACE_RECORDER 设为 1 编译时，整个运行过程的内核跟踪写入当前目录下的
+* rtos_trace.bin，可以用 Posix/trace/trace_decode.c 解码；对比开关前后的结果即为记录器的开销。
+*----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+#include "spsc_queue.h"
+#include "mpmc_queue.h"
+/*-----------------------------------------------------------*/
+
+/* 任务优先级：控制任务只低于定时器守护任务，被测任务都在它之下。 */
+#define benchCONTROL_PRIORITY       ( configMAX_PRIORITIES - 2 )
+#define benchHIGH_PRIORITY          ( tskIDLE_PRIORITY + 4 )
+#define benchLOW_PRIORITY           ( tskIDLE_PRIORITY + 3 )
+#define benchWORKER_PRIORITY        ( tskIDLE_PRIORITY + 2 )
+#define benchBACKGROUND_PRIORITY    ( tskIDLE_PRIORITY + 1 )
+
+#define benchSTACK_SIZE             configMINIMAL_STACK_SIZE
+
+/* 每项测试保存的最大样本数。 */
+#define benchMAX_SAMPLES            50000U
+
+#define benchPINGPONG_ROUNDS        20000U
+#define benchPINGPONG_TIMEOUT       ( ( TickType_t ) 1000 )
+#define benchMPMC_ITEMS             40000U
+#define benchUNCONTENDED_OPS        50000U
+#define benchRECORD_SIZE            256U
+#define benchBATCH_ITEMS            32U
+#define benchSWITCH_BATCH           100U
+#define benchISR_ROUNDS             10000U
+#define benchTIMER_PERIOD           ( ( TickType_t ) 10 )
+#define benchTIMER_RUN_TICKS        ( ( TickType_t ) 1000 )
+#define benchMAX_TIMERS             128U
+#define benchMAX_WORKERS            16U
+#define benchMAX_BACKGROUND         128U
+
+/* 用于 ISR 延迟测试的模拟中断号。 */
+#define benchISR_NUMBER             ( ( uint32_t ) 3 )
+
+/* 跟踪数据文件，以及结束时等待节拍中断转存剩余事件的时间。 */
+#define benchTRACE_FILE             "rtos_trace.bin"
+#define benchTRACE_FLUSH_TICKS      ( ( TickType_t ) 20 )
+/*-----------------------------------------------------------*/
+
+typedef enum
+{
+    eBenchNotify = 0,
+    eBenchQueue,
+    eBenchSemaphore,
+    eBenchQueueTimeout,
+    eBenchQueueRendezvous
+} BenchMechanism_t;
+
+/* 会合队列只在 configUSE_QUEUE_HANDOFF 为 1 时可用。 */
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+    #define benchLAST_MECHANISM    eBenchQueueRendezvous
+#else
+    #define benchLAST_MECHANISM    eBenchQueueTimeout
+#endif
+
+typedef struct
+{
+    UBaseType_t uxProducers;
+    UBaseType_t uxConsumers;
+    UBaseType_t uxQueueLength;
+} BenchMpmcConfig_t;
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters );
+static void prvRecordSample( uint64_t ullSample );
+static void prvResetSamples( void );
+static void prvReport( const char * pcName,
+                       uint64_t ullTotalNs,
+                       uint32_t ulOperations );
+static void prvWaitForWorkers( UBaseType_t uxCount );
+static void prvDeleteWorkers( TaskHandle_t * pxHandles,
+                              UBaseType_t uxCount );
+static BaseType_t prvGroupSelected( const char * pcGroup );
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+    static void prvTraceWriterTask( void * pvParameters );
+    static void prvTraceFlush( void );
+#endif
+/*-----------------------------------------------------------*/
+
+/* 样本缓冲区。消费者可能有多个，写入下标用原子操作分配。 */
+static uint64_t ullSamples[ benchMAX_SAMPLES ];
+static volatile uint32_t ulSampleCount = 0;
+
+static TaskHandle_t xControlTask = NULL;
+
+/* 命令行选择的测试组。 */
+static int iSelectedGroups = 0;
+static char ** ppcSelectedGroups = NULL;
+
+/* pingpong 测试使用的对象。 */
+static BenchMechanism_t eMechanism;
+static TaskHandle_t xPingTask = NULL;
+static TaskHandle_t xPongTask = NULL;
+static QueueHandle_t xPingQueue = NULL;
+static QueueHandle_t xPongQueue = NULL;
+
+/* mpmc 测试使用的对象。 */
+static QueueHandle_t xMpmcQueue = NULL;
+#if ( configUSE_MPMC_QUEUES == 1 )
+    static MpmcQueueHandle_t xMpmcLockFreeQueue = NULL;
+#endif
+static uint32_t ulItemsPerProducer;
+static volatile uint32_t ulItemsConsumed;
+static volatile uint64_t ullMpmcEndNs;
+
+/* pingpong 和 isr 测试中由发起方任务测得的总耗时。 */
+static volatile uint64_t ullElapsedNs;
+
+/* timer 测试使用的对象。 */
+static uint64_t ullLastExpiryNs[ benchMAX_TIMERS ];
+
+/* isr 测试使用的对象。 */
+static TaskHandle_t xIsrWaiterTask = NULL;
+static volatile uint64_t ullIsrTriggerNs;
+
+/* 跟踪数据的输出。 */
+#if ( configUSE_TRACE_RECORDER == 1 )
+    static FILE * pxTraceFile = NULL;
+    static TaskHandle_t xTraceWriterTask = NULL;
+    static uint8_t ucTraceChunk[ 4096 ];
+#endif
+/*-----------------------------------------------------------*/
+
+static void prvRecordSample( uint64_t ullSample )
+{
+    uint32_t ulIndex = __atomic_fetch_add( &ulSampleCount, 1U, __ATOMIC_RELAXED );
+
+    if( ulIndex < benchMAX_SAMPLES )
+    {
+        ullSamples[ ulIndex ] = ullSample;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvResetSamples( void )
+{
+    ulSampleCount = 0;
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareSamples( const void * pvA,
+                              const void * pvB )
+{
+    uint64_t ullA = *( const uint64_t * ) pvA;
+    uint64_t ullB = *( const uint64_t * ) pvB;
+
+    return ( ullA > ullB ) - ( ullA < ullB );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvPercentile( uint32_t ulCount,
+                               uint32_t ulPerMille )
+{
+    return ullSamples[ ( uint64_t ) ( ulCount - 1U ) * ulPerMille / 1000U ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( const char * pcName,
+                       uint64_t ullTotalNs,
+                       uint32_t ulOperations )
+{
+    uint32_t ulCount = ulSampleCount;
+    double dOpsPerSecond = 0.0;
+
+    if( ulCount > benchMAX_SAMPLES )
+    {
+        ulCount = benchMAX_SAMPLES;
+    }
+
+    if( ullTotalNs != 0U )
+    {
+        dOpsPerSecond = ( double ) ulOperations * 1e9 / ( double ) ullTotalNs;
+    }
+
+    qsort( ullSamples, ulCount, sizeof( ullSamples[ 0 ] ), prvCompareSamples );
+
+    /* 其它被测任务都已结束，但节拍信号仍可能在 libc 内部触发切换，
+     * 所以在临界区中输出。 */
+    taskENTER_CRITICAL();
+    {
+        if( ulCount == 0U )
+        {
+            printf( "%-36s %8s\n", pcName, "no data" );
+        }
+        else
+        {
+            printf( "%-36s %8u %12.0f %8llu %8llu %8llu %8llu %8llu %8llu\n",
+                    pcName,
+                    ( unsigned ) ulCount,
+                    dOpsPerSecond,
+                    ( unsigned long long ) ullSamples[ 0 ],
+                    ( unsigned long long ) prvPercentile( ulCount, 500U ),
+                    ( unsigned long long ) prvPercentile( ulCount, 900U ),
+                    ( unsigned long long ) prvPercentile( ulCount, 990U ),
+                    ( unsigned long long ) prvPercentile( ulCount, 999U ),
+                    ( unsigned long long ) ullSamples[ ulCount - 1U ] );
+        }
+
+        fflush( stdout );
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitForWorkers( UBaseType_t uxCount )
+{
+    while( uxCount > 0U )
+    {
+        ( void ) ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+        uxCount--;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeleteWorkers( TaskHandle_t * pxHandles,
+                              UBaseType_t uxCount )
+{
+    UBaseType_t ux;
+
+    for( ux = 0; ux < uxCount; ux++ )
+    {
+        if( pxHandles[ ux ] != NULL )
+        {
+            vTaskDelete( pxHandles[ ux ] );
+            pxHandles[ ux ] = NULL;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGroupSelected( const char * pcGroup )
+{
+    int i;
+    BaseType_t xReturn = ( iSelectedGroups == 0 ) ? pdTRUE : pdFALSE;
+
+    for( i = 0; i < iSelectedGroups; i++ )
+    {
+        if( strcmp( ppcSelectedGroups[ i ], pcGroup ) == 0 )
+        {
+            xReturn = pdTRUE;
+        }
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * 背景任务：长时间阻塞在延时列表中，用来增大内核列表的长度。
+ */
+static void prvBackgroundTask( void * pvParameters )
+{
+    TickType_t xDelay = ( TickType_t ) ( uintptr_t ) pvParameters;
+
+    for( ; ; )
+    {
+        vTaskDelay( xDelay );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateBackgroundTasks( TaskHandle_t * pxHandles,
+                                      UBaseType_t uxCount,
+                                      TickType_t xFirstDelay )
+{
+    UBaseType_t ux;
+
+    for( ux = 0; ux < uxCount; ux++ )
+    {
+        /* 唤醒时间各不相同。 */
+        configASSERT( xTaskCreate( prvBackgroundTask, "bg", benchSTACK_SIZE,
+                                   ( void * ) ( uintptr_t ) ( xFirstDelay + ux * 7U ),
+                                   benchBACKGROUND_PRIORITY, &pxHandles[ ux ] ) == pdPASS );
+    }
+
+    /* 让背景任务运行一次，进入阻塞态。 */
+    vTaskDelay( 2 );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * pingpong：低优先级的 ping 任务计时并唤醒高优先级的 pong 任务，
+ * pong 再唤醒 ping 并阻塞，ping 得到回应后结束计时。
+ */
+static void prvPingTask( void * pvParameters )
+{
+    uint32_t ulRound;
+    uint32_t ulValue = 0;
+    uint64_t ullStart;
+    uint64_t ullBegin;
+
+    ( void ) pvParameters;
+
+    ullBegin = ullPortGetTimeNs();
+
+    for( ulRound = 0; ulRound < benchPINGPONG_ROUNDS; ulRound++ )
+    {
+        ullStart = ullPortGetTimeNs();
+
+        switch( eMechanism )
+        {
+            case eBenchNotify:
+                ( void ) xTaskNotifyGive( xPongTask );
+                ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+                break;
+
+            case eBenchQueue:
+            case eBenchQueueRendezvous:
+                ( void ) xQueueSend( xPingQueue, &ulRound, portMAX_DELAY );
+                ( void ) xQueueReceive( xPongQueue, &ulValue, portMAX_DELAY );
+                break;
+
+            case eBenchSemaphore:
+                ( void ) xSemaphoreGive( xPingQueue );
+                ( void ) xSemaphoreTake( xPongQueue, portMAX_DELAY );
+                break;
+
+            case eBenchQueueTimeout:
+                ( void ) xQueueSend( xPingQueue, &ulRound, portMAX_DELAY );
+                ( void ) xQueueReceive( xPongQueue, &ulValue, benchPINGPONG_TIMEOUT );
+                break;
+
+            default:
+                break;
+        }
+
+        prvRecordSample( ullPortGetTimeNs() - ullStart );
+    }
+
+    ullElapsedNs = ullPortGetTimeNs() - ullBegin;
+    ( void ) ulValue;
+
+    xTaskNotifyGive( xControlTask );
+    vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPongTask( void * pvParameters )
+{
+    uint32_t ulValue;
+
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        switch( eMechanism )
+        {
+            case eBenchNotify:
+                ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+                ( void ) xTaskNotifyGive( xPingTask );
+                break;
+
+            case eBenchQueue:
+            case eBenchQueueRendezvous:
+                ( void ) xQueueReceive( xPingQueue, &ulValue, portMAX_DELAY );
+                ( void ) xQueueSend( xPongQueue, &ulValue, portMAX_DELAY );
+                break;
+
+            case eBenchSemaphore:
+                ( void ) xSemaphoreTake( xPingQueue, portMAX_DELAY );
+                ( void ) xSemaphoreGive( xPongQueue );
+                break;
+
+            case eBenchQueueTimeout:
+
+                if( xQueueReceive( xPingQueue, &ulValue, benchPINGPONG_TIMEOUT ) == pdPASS )
+                {
+                    ( void ) xQueueSend( xPongQueue, &ulValue, portMAX_DELAY );
+                }
+
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunPingPong( BenchMechanism_t eWhich,
+                            UBaseType_t uxBackground )
+{
+    static const char * const pcMechanismNames[] = { "notify", "queue", "semaphore", "queue-timeout", "queue-rendezvous" };
+    static TaskHandle_t xBackground[ benchMAX_BACKGROUND ];
+    char cName[ 48 ];
+
+    configASSERT( uxBackground <= benchMAX_BACKGROUND );
+
+    eMechanism = eWhich;
+
+    if( ( eWhich == eBenchQueue ) || ( eWhich == eBenchQueueTimeout ) )
+    {
+        xPingQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+        xPongQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+    }
+    else if( eWhich == eBenchSemaphore )
+    {
+        xPingQueue = xSemaphoreCreateBinary();
+        xPongQueue = xSemaphoreCreateBinary();
+    }
+    else if( eWhich == eBenchQueueRendezvous )
+    {
+        xPingQueue = xQueueCreate( 0, sizeof( uint32_t ) );
+        xPongQueue = xQueueCreate( 0, sizeof( uint32_t ) );
+    }
+
+    /* queue-timeout：背景任务排在 ping/pong 的超时时间之前，它们在测试期间会周期性地醒来；
+     * 其它测试中背景任务在测试期间都不会到期。 */
+    prvCreateBackgroundTasks( xBackground, uxBackground,
+                              ( eWhich == eBenchQueueTimeout ) ? ( TickType_t ) 100 : ( TickType_t ) 100000 );
+    prvResetSamples();
+
+    configASSERT( xTaskCreate( prvPongTask, "pong", benchSTACK_SIZE, NULL, benchHIGH_PRIORITY, &xPongTask ) == pdPASS );
+    configASSERT( xTaskCreate( prvPingTask, "ping", benchSTACK_SIZE, NULL, benchLOW_PRIORITY, &xPingTask ) == pdPASS );
+
+    prvWaitForWorkers( 1 );
+
+    prvDeleteWorkers( &xPingTask, 1 );
+    prvDeleteWorkers( &xPongTask, 1 );
+    prvDeleteWorkers( xBackground, uxBackground );
+
+    if( xPingQueue != NULL )
+    {
+        vQueueDelete( xPingQueue );
+        vQueueDelete( xPongQueue );
+        xPingQueue = NULL;
+        xPongQueue = NULL;
+    }
+
+    ( void ) snprintf( cName, sizeof( cName ), "pingpong/%s bg=%u",
+                       pcMechanismNames[ eWhich ], ( unsigned ) uxBackground );
+    prvReport( cName, ullElapsedNs, benchPINGPONG_ROUNDS );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * mpmc：消息内容就是发送时刻，消费者收到后计算端到端延迟。
+ */
+static void prvProducerTask( void * pvParameters )
+{
+    uint32_t ul;
+    uint64_t ullStamp;
+
+    ( void ) pvParameters;
+
+    for( ul = 0; ul < ulItemsPerProducer; ul++ )
+    {
+        ullStamp = ullPortGetTimeNs();
+
+        #if ( configUSE_MPMC_QUEUES == 1 )
+            if( xMpmcLockFreeQueue != NULL )
+            {
+                ( void ) xMpmcQueueSend( xMpmcLockFreeQueue, &ullStamp, portMAX_DELAY );
+            }
+            else
+        #endif
+        {
+            ( void ) xQueueSend( xMpmcQueue, &ullStamp, portMAX_DELAY );
+        }
+    }
+
+    vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerTask( void * pvParameters )
+{
+    uint32_t ulTotal = ( uint32_t ) ( uintptr_t ) pvParameters;
+    uint64_t ullStamp;
+    uint64_t ullNow;
+
+    for( ; ; )
+    {
+        #if ( configUSE_MPMC_QUEUES == 1 )
+            if( xMpmcLockFreeQueue != NULL )
+            {
+                ( void ) xMpmcQueueReceive( xMpmcLockFreeQueue, &ullStamp, portMAX_DELAY );
+            }
+            else
+        #endif
+        {
+            ( void ) xQueueReceive( xMpmcQueue, &ullStamp, portMAX_DELAY );
+        }
+
+        ullNow = ullPortGetTimeNs();
+        prvRecordSample( ullNow - ullStamp );
+
+        if( ( __atomic_add_fetch( &ulItemsConsumed, 1U, __ATOMIC_RELAXED ) ) == ulTotal )
+        {
+            ullMpmcEndNs = ullNow;
+            xTaskNotifyGive( xControlTask );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunMpmc( const BenchMpmcConfig_t * pxConfig,
+                        BaseType_t xLockFree )
+{
+    TaskHandle_t xWorkers[ benchMAX_WORKERS ] = { NULL };
+    UBaseType_t uxWorkers = 0;
+    UBaseType_t ux;
+    uint32_t ulTotal;
+    uint64_t ullStart;
+    char cName[ 48 ];
+
+    configASSERT( ( pxConfig->uxProducers + pxConfig->uxConsumers ) <= benchMAX_WORKERS );
+
+    ulItemsPerProducer = benchMPMC_ITEMS / ( uint32_t ) pxConfig->uxProducers;
+    ulTotal = ulItemsPerProducer * ( uint32_t ) pxConfig->uxProducers;
+    ulItemsConsumed = 0;
+    #if ( configUSE_MPMC_QUEUES == 1 )
+        if( xLockFree != pdFALSE )
+        {
+            xMpmcLockFreeQueue = xMpmcQueueCreate( pxConfig->uxQueueLength, sizeof( uint64_t ) );
+            configASSERT( xMpmcLockFreeQueue != NULL );
+        }
+        else
+    #endif
+    {
+        xMpmcQueue = xQueueCreate( pxConfig->uxQueueLength, sizeof( uint64_t ) );
+        configASSERT( xMpmcQueue != NULL );
+    }
+
+    prvResetSamples();
+
+    /* 被测任务的优先级都低于控制任务，控制任务阻塞后它们才开始运行。 */
+    for( ux = 0; ux < pxConfig->uxConsumers; ux++ )
+    {
+        configASSERT( xTaskCreate( prvConsumerTask, "cons", benchSTACK_SIZE, ( void * ) ( uintptr_t ) ulTotal,
+                                   benchWORKER_PRIORITY, &xWorkers[ uxWorkers++ ] ) == pdPASS );
+    }
+
+    for( ux = 0; ux < pxConfig->uxProducers; ux++ )
+    {
+        configASSERT( xTaskCreate( prvProducerTask, "prod", benchSTACK_SIZE, NULL,
+                                   benchWORKER_PRIORITY, &xWorkers[ uxWorkers++ ] ) == pdPASS );
+    }
+
+    ullStart = ullPortGetTimeNs();
+    prvWaitForWorkers( 1 );
+
+    prvDeleteWorkers( xWorkers, uxWorkers );
+
+    #if ( configUSE_MPMC_QUEUES == 1 )
+        if( xMpmcLockFreeQueue != NULL )
+        {
+            vMpmcQueueDelete( xMpmcLockFreeQueue );
+            xMpmcLockFreeQueue = NULL;
+        }
+    #endif
+
+    if( xMpmcQueue != NULL )
+    {
+        vQueueDelete( xMpmcQueue );
+        xMpmcQueue = NULL;
+    }
+
+    ( void ) snprintf( cName, sizeof( cName ), "mpmc/%up%uc depth=%u%s",
+                       ( unsigned ) pxConfig->uxProducers, ( unsigned ) pxConfig->uxConsumers,
+                       ( unsigned ) pxConfig->uxQueueLength, ( xLockFree != pdFALSE ) ? " lockfree" : "" );
+    prvReport( cName, ullMpmcEndNs - ullStart, ulTotal );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * uncontended：控制任务自己连续调用，测量不发生阻塞时的单次 API 开销。
+ */
+static void prvRunUncontended( void )
+{
+    SemaphoreHandle_t xMutex;
+    SemaphoreHandle_t xSemaphore;
+    QueueHandle_t xQueue;
+    uint32_t ul;
+    uint32_t ulValue = 0;
+    uint64_t ullStart;
+    uint64_t ullBegin;
+
+    xMutex = xSemaphoreCreateMutex();
+    configASSERT( xMutex != NULL );
+    prvResetSamples();
+    ullBegin = ullPortGetTimeNs();
+
+    for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+    {
+        ullStart = ullPortGetTimeNs();
+        ( void ) xSemaphoreTake( xMutex, portMAX_DELAY );
+        ( void ) xSemaphoreGive( xMutex );
+        prvRecordSample( ullPortGetTimeNs() - ullStart );
+    }
+
+    prvReport( "uncontended/mutex take+give", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+    vSemaphoreDelete( xMutex );
+
+    #if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+    {
+        /* 天花板高于控制任务，每次获取都把控制任务移到更高优先级的就绪列表，释放时移回原来的就绪列表；
+         * 没有更高优先级的就绪任务，释放时不切换任务。 */
+        xMutex = xSemaphoreCreateMutexWithCeiling( benchCONTROL_PRIORITY + 1 );
+        configASSERT( xMutex != NULL );
+        prvResetSamples();
+        ullBegin = ullPortGetTimeNs();
+
+        for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+        {
+            ullStart = ullPortGetTimeNs();
+            ( void ) xSemaphoreTake( xMutex, portMAX_DELAY );
+            ( void ) xSemaphoreGive( xMutex );
+            prvRecordSample( ullPortGetTimeNs() - ullStart );
+        }
+
+        configASSERT( uxTaskPriorityGet( NULL ) == benchCONTROL_PRIORITY );
+        prvReport( "uncontended/ceiling mutex take+give", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+        vSemaphoreDelete( xMutex );
+    }
+    #endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+
+    xSemaphore = xSemaphoreCreateCounting( 8, 0 );
+    configASSERT( xSemaphore != NULL );
+    prvResetSamples();
+    ullBegin = ullPortGetTimeNs();
+
+    for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+    {
+        ullStart = ullPortGetTimeNs();
+        ( void ) xSemaphoreGive( xSemaphore );
+        ( void ) xSemaphoreTake( xSemaphore, 0 );
+        prvRecordSample( ullPortGetTimeNs() - ullStart );
+    }
+
+    prvReport( "uncontended/semaphore give+take", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+    vSemaphoreDelete( xSemaphore );
+
+    xQueue = xQueueCreate( 8, sizeof( uint32_t ) );
+    configASSERT( xQueue != NULL );
+    prvResetSamples();
+    ullBegin = ullPortGetTimeNs();
+
+    for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+    {
+        ullStart = ullPortGetTimeNs();
+        ( void ) xQueueSend( xQueue, &ul, 0 );
+        ( void ) xQueueReceive( xQueue, &ulValue, 0 );
+        prvRecordSample( ullPortGetTimeNs() - ullStart );
+    }
+
+    prvReport( "uncontended/queue send+recv", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+    vQueueDelete( xQueue );
+
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        SpscQueueHandle_t xSpscQueue;
+
+        xSpscQueue = xSpscQueueCreate( 8, sizeof( uint32_t ) );
+        configASSERT( xSpscQueue != NULL );
+        prvResetSamples();
+        ullBegin = ullPortGetTimeNs();
+
+        for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+        {
+            ullStart = ullPortGetTimeNs();
+            ( void ) xSpscQueueSend( xSpscQueue, &ul, 0 );
+            ( void ) xSpscQueueReceive( xSpscQueue, &ulValue, 0 );
+            prvRecordSample( ullPortGetTimeNs() - ullStart );
+        }
+
+        prvReport( "uncontended/spsc send+recv", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+        vSpscQueueDelete( xSpscQueue );
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
+    #if ( configUSE_MPMC_QUEUES == 1 )
+    {
+        MpmcQueueHandle_t xLockFreeQueue;
+
+        xLockFreeQueue = xMpmcQueueCreate( 8, sizeof( uint32_t ) );
+        configASSERT( xLockFreeQueue != NULL );
+        prvResetSamples();
+        ullBegin = ullPortGetTimeNs();
+
+        for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+        {
+            ullStart = ullPortGetTimeNs();
+            ( void ) xMpmcQueueSend( xLockFreeQueue, &ul, 0 );
+            ( void ) xMpmcQueueReceive( xLockFreeQueue, &ulValue, 0 );
+            prvRecordSample( ullPortGetTimeNs() - ullStart );
+        }
+
+        prvReport( "uncontended/mpmc send+recv", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+        vMpmcQueueDelete( xLockFreeQueue );
+    }
+    #endif /* configUSE_MPMC_QUEUES */
+
+    /* 256 字节的记录：复制接口每次发送和接收各 memcpy 一次。 */
+    {
+        static uint8_t ucRecord[ benchRECORD_SIZE ];
+
+        xQueue = xQueueCreate( 8, benchRECORD_SIZE );
+        configASSERT( xQueue != NULL );
+        prvResetSamples();
+        ullBegin = ullPortGetTimeNs();
+
+        for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+        {
+            ullStart = ullPortGetTimeNs();
+            memset( ucRecord, ( int ) ul, sizeof( ucRecord ) );
+            ( void ) xQueueSend( xQueue, ucRecord, 0 );
+            ( void ) xQueueReceive( xQueue, ucRecord, 0 );
+            ulValue += ucRecord[ benchRECORD_SIZE - 1U ];
+            prvRecordSample( ullPortGetTimeNs() - ullStart );
+        }
+
+        prvReport( "uncontended/queue 256B copy", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+        vQueueDelete( xQueue );
+    }
+
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    {
+        uint8_t * pucSlot;
+        const uint8_t * pucItem;
+
+        /* 同样的记录用零拷贝接口在队列存储区中原地填写和读取。 */
+        xQueue = xQueueCreate( 8, benchRECORD_SIZE );
+        configASSERT( xQueue != NULL );
+        prvResetSamples();
+        ullBegin = ullPortGetTimeNs();
+
+        for( ul = 0; ul < benchUNCONTENDED_OPS; ul++ )
+        {
+            ullStart = ullPortGetTimeNs();
+            pucSlot = pvQueueReserveSend( xQueue, 0 );
+            configASSERT( pucSlot != NULL );
+            memset( pucSlot, ( int ) ul, benchRECORD_SIZE );
+            ( void ) xQueueCommitSend( xQueue );
+            pucItem = pvQueueAcquireReceive( xQueue, 0 );
+            configASSERT( pucItem != NULL );
+            ulValue += pucItem[ benchRECORD_SIZE - 1U ];
+            vQueueReleaseReceive( xQueue );
+            prvRecordSample( ullPortGetTimeNs() - ullStart );
+        }
+
+        prvReport( "uncontended/queue 256B zero-copy", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+        vQueueDelete( xQueue );
+    }
+    #endif /* configUSE_QUEUE_ZERO_COPY */
+
+    /* 32 个 4 字节样本：逐个收发与批量收发，每个样本是一整批的耗时。 */
+    {
+        static uint32_t ulBatch[ benchBATCH_ITEMS ];
+        uint32_t ulItem;
+
+        xQueue = xQueueCreate( benchBATCH_ITEMS, sizeof( uint32_t ) );
+        configASSERT( xQueue != NULL );
+        prvResetSamples();
+        ullBegin = ullPortGetTimeNs();
+
+        for( ul = 0; ul < benchUNCONTENDED_OPS / benchBATCH_ITEMS; ul++ )
+        {
+            ullStart = ullPortGetTimeNs();
+
+            for( ulItem = 0; ulItem < benchBATCH_ITEMS; ulItem++ )
+            {
+                ( void ) xQueueSend( xQueue, &ulItem, 0 );
+            }
+
+            for( ulItem = 0; ulItem < benchBATCH_ITEMS; ulItem++ )
+            {
+                ( void ) xQueueReceive( xQueue, &ulBatch[ ulItem ], 0 );
+            }
+
+            prvRecordSample( ullPortGetTimeNs() - ullStart );
+        }
+
+        prvReport( "uncontended/queue 32x single", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+
+        #if ( configUSE_QUEUE_BATCH == 1 )
+        {
+            prvResetSamples();
+            ullBegin = ullPortGetTimeNs();
+
+            for( ul = 0; ul < benchUNCONTENDED_OPS / benchBATCH_ITEMS; ul++ )
+            {
+                ullStart = ullPortGetTimeNs();
+                configASSERT( uxQueueSendMultiple( xQueue, ulBatch, benchBATCH_ITEMS, 0 ) == benchBATCH_ITEMS );
+                configASSERT( uxQueueReceiveMultiple( xQueue, ulBatch, benchBATCH_ITEMS, 0 ) == benchBATCH_ITEMS );
+                prvRecordSample( ullPortGetTimeNs() - ullStart );
+            }
+
+            prvReport( "uncontended/queue 32x batch", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+        }
+        #endif /* configUSE_QUEUE_BATCH */
+
+        vQueueDelete( xQueue );
+    }
+
+    /* 控制任务是自己优先级上唯一就绪的任务，vTaskSwitchContext() 会重新选中它，
+     * 测到的是选择任务和切换时检查（例如 taskCHECK_FOR_STACK_OVERFLOW()）的开销，
+     * 不含主机线程切换。在临界区内调用，期间节拍中断不会让其他任务就绪。 */
+    {
+        uint32_t ulCall;
+
+        #if ( configUSE_TRACE_RECORDER == 1 )
+        {
+            vTaskSuspend( xTraceWriterTask );
+        }
+        #endif
+
+        prvResetSamples();
+        ullBegin = ullPortGetTimeNs();
+
+        for( ul = 0; ul < benchUNCONTENDED_OPS / benchSWITCH_BATCH; ul++ )
+        {
+            taskENTER_CRITICAL();
+            {
+                ullStart = ullPortGetTimeNs();
+
+                for( ulCall = 0; ulCall < benchSWITCH_BATCH; ulCall++ )
+                {
+                    vTaskSwitchContext();
+                }
+
+                prvRecordSample( ullPortGetTimeNs() - ullStart );
+            }
+            taskEXIT_CRITICAL();
+
+            configASSERT( xTaskGetCurrentTaskHandle() == xControlTask );
+        }
+
+        prvReport( "uncontended/100x vTaskSwitchContext", ullPortGetTimeNs() - ullBegin, benchUNCONTENDED_OPS );
+
+        #if ( configUSE_TRACE_RECORDER == 1 )
+        {
+            vTaskResume( xTraceWriterTask );
+        }
+        #endif
+    }
+
+    ( void ) ulValue;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * timer：记录每个定时器相邻两次回调的间隔与设定周期之差。
+ */
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+    uint32_t ulIndex = ( uint32_t ) ( uintptr_t ) pvTimerGetTimerID( xTimer );
+    uint64_t ullNow = ullPortGetTimeNs();
+    uint64_t ullPeriodNs = ( uint64_t ) benchTIMER_PERIOD * ( uint64_t ) portTICK_RATE_MICROSECONDS * 1000U;
+    uint64_t ullInterval;
+
+    if( ullLastExpiryNs[ ulIndex ] != 0U )
+    {
+        ullInterval = ullNow - ullLastExpiryNs[ ulIndex ];
+        prvRecordSample( ( ullInterval > ullPeriodNs ) ? ( ullInterval - ullPeriodNs ) : ( ullPeriodNs - ullInterval ) );
+    }
+
+    ullLastExpiryNs[ ulIndex ] = ullNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunTimers( UBaseType_t uxTimers )
+{
+    static TimerHandle_t xTimers[ benchMAX_TIMERS ];
+    UBaseType_t ux;
+    char cName[ 48 ];
+
+    configASSERT( uxTimers <= benchMAX_TIMERS );
+
+    memset( ullLastExpiryNs, 0, sizeof( ullLastExpiryNs ) );
+    prvResetSamples();
+
+    for( ux = 0; ux < uxTimers; ux++ )
+    {
+        xTimers[ ux ] = xTimerCreate( "bench", benchTIMER_PERIOD, pdTRUE, ( void * ) ( uintptr_t ) ux, prvTimerCallback );
+        configASSERT( xTimers[ ux ] != NULL );
+        configASSERT( xTimerStart( xTimers[ ux ], portMAX_DELAY ) == pdPASS );
+    }
+
+    vTaskDelay( benchTIMER_RUN_TICKS );
+
+    for( ux = 0; ux < uxTimers; ux++ )
+    {
+        configASSERT( xTimerDelete( xTimers[ ux ], portMAX_DELAY ) == pdPASS );
+    }
+
+    /* 等守护任务处理完删除命令，再统计结果。 */
+    vTaskDelay( 2 );
+
+    ( void ) snprintf( cName, sizeof( cName ), "timer/jitter timers=%u", ( unsigned ) uxTimers );
+    prvReport( cName, ( uint64_t ) benchTIMER_RUN_TICKS * portTICK_RATE_MICROSECONDS * 1000U,
+               ( ulSampleCount < benchMAX_SAMPLES ) ? ulSampleCount : benchMAX_SAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * isr：低优先级任务记录时刻并触发模拟中断，中断服务函数唤醒高优先级任务，
+ * 高优先级任务被调度运行时记录延迟。
+ */
+static uint32_t prvIsrHandler( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    vTaskNotifyGiveFromISR( xIsrWaiterTask, &xHigherPriorityTaskWoken );
+
+    return ( uint32_t ) xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static void prvIsrWaiterTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        prvRecordSample( ullPortGetTimeNs() - ullIsrTriggerNs );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvIsrTriggerTask( void * pvParameters )
+{
+    uint32_t ulRound;
+    uint64_t ullBegin;
+
+    ( void ) pvParameters;
+
+    ullBegin = ullPortGetTimeNs();
+
+    for( ulRound = 0; ulRound < benchISR_ROUNDS; ulRound++ )
+    {
+        ullIsrTriggerNs = ullPortGetTimeNs();
+        vPortGenerateSimulatedInterrupt( benchISR_NUMBER );
+    }
+
+    ullElapsedNs = ullPortGetTimeNs() - ullBegin;
+
+    xTaskNotifyGive( xControlTask );
+    vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunIsr( UBaseType_t uxBackground )
+{
+    static TaskHandle_t xBackground[ benchMAX_BACKGROUND ];
+    TaskHandle_t xTrigger = NULL;
+    char cName[ 48 ];
+
+    vPortSetInterruptHandler( benchISR_NUMBER, prvIsrHandler );
+    prvCreateBackgroundTasks( xBackground, uxBackground, ( TickType_t ) 100000 );
+    prvResetSamples();
+
+    configASSERT( xTaskCreate( prvIsrWaiterTask, "isrw", benchSTACK_SIZE, NULL, benchHIGH_PRIORITY, &xIsrWaiterTask ) == pdPASS );
+    configASSERT( xTaskCreate( prvIsrTriggerTask, "isrt", benchSTACK_SIZE, NULL, benchLOW_PRIORITY, &xTrigger ) == pdPASS );
+
+    prvWaitForWorkers( 1 );
+
+    prvDeleteWorkers( &xTrigger, 1 );
+    prvDeleteWorkers( &xIsrWaiterTask, 1 );
+    prvDeleteWorkers( xBackground, uxBackground );
+    vPortSetInterruptHandler( benchISR_NUMBER, NULL );
+
+    ( void ) snprintf( cName, sizeof( cName ), "isr/wake latency bg=%u", ( unsigned ) uxBackground );
+    prvReport( cName, ullElapsedNs, benchISR_ROUNDS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters )
+{
+    static const UBaseType_t uxBackgroundCounts[] = { 0, 32, 128 };
+    static const UBaseType_t uxTimerCounts[] = { 1, 32, 128 };
+    static const BenchMpmcConfig_t xMpmcConfigs[] =
+    {
+        { 1, 1, 1  },
+        { 1, 1, 64 },
+        { 4, 4, 16 },
+        { 8, 2, 64 },
+        { 2, 8, 4  }
+    };
+    size_t x;
+    size_t y;
+
+    ( void ) pvParameters;
+
+    taskENTER_CRITICAL();
+    {
+        printf( "%-36s %8s %12s %8s %8s %8s %8s %8s %8s\n",
+                "benchmark (latency in ns)", "samples", "ops/s", "min", "p50", "p90", "p99", "p99.9", "max" );
+    }
+    taskEXIT_CRITICAL();
+
+    if( prvGroupSelected( "pingpong" ) != pdFALSE )
+    {
+        for( x = 0; x < sizeof( uxBackgroundCounts ) / sizeof( uxBackgroundCounts[ 0 ] ); x++ )
+        {
+            for( y = eBenchNotify; y <= benchLAST_MECHANISM; y++ )
+            {
+                prvRunPingPong( ( BenchMechanism_t ) y, uxBackgroundCounts[ x ] );
+            }
+        }
+    }
+
+    if( prvGroupSelected( "mpmc" ) != pdFALSE )
+    {
+        for( x = 0; x < sizeof( xMpmcConfigs ) / sizeof( xMpmcConfigs[ 0 ] ); x++ )
+        {
+            prvRunMpmc( &xMpmcConfigs[ x ], pdFALSE );
+        }
+
+        #if ( configUSE_MPMC_QUEUES == 1 )
+        {
+            /* 无锁队列的长度至少为 2，跳过深度为 1 的配置。 */
+            for( x = 0; x < sizeof( xMpmcConfigs ) / sizeof( xMpmcConfigs[ 0 ] ); x++ )
+            {
+                if( xMpmcConfigs[ x ].uxQueueLength >= 2U )
+                {
+                    prvRunMpmc( &xMpmcConfigs[ x ], pdTRUE );
+                }
+            }
+        }
+        #endif /* configUSE_MPMC_QUEUES */
+    }
+
+    if( prvGroupSelected( "uncontended" ) != pdFALSE )
+    {
+        prvRunUncontended();
+    }
+
+    if( prvGroupSelected( "timer" ) != pdFALSE )
+    {
+        for( x = 0; x < sizeof( uxTimerCounts ) / sizeof( uxTimerCounts[ 0 ] ); x++ )
+        {
+            prvRunTimers( uxTimerCounts[ x ] );
+        }
+    }
+
+    if( prvGroupSelected( "isr" ) != pdFALSE )
+    {
+        prvRunIsr( 0 );
+        prvRunIsr( 128 );
+    }
+
+    #if ( configUSE_TRACE_RECORDER == 1 )
+    {
+        prvTraceFlush();
+    }
+    #endif
+
+    vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+    static void prvTraceWriterTask( void * pvParameters )
+    {
+        size_t xBytes;
+
+        ( void ) pvParameters;
+
+        for( ; ; )
+        {
+            xBytes = xTraceRecorderRead( ucTraceChunk, sizeof( ucTraceChunk ), pdMS_TO_TICKS( 100 ) );
+
+            if( xBytes > 0U )
+            {
+                taskENTER_CRITICAL();
+                {
+                    ( void ) fwrite( ucTraceChunk, 1, xBytes, pxTraceFile );
+                }
+                taskEXIT_CRITICAL();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTraceFlush( void )
+    {
+        size_t xBytes;
+
+        /* 停止记录后等节拍中断把环形缓冲区转存完，再由本任务读出剩余的数据。 */
+        vTraceRecorderStop();
+        vTaskDelay( benchTRACE_FLUSH_TICKS );
+        vTaskSuspend( xTraceWriterTask );
+
+        do
+        {
+            xBytes = xTraceRecorderRead( ucTraceChunk, sizeof( ucTraceChunk ), 0 );
+
+            taskENTER_CRITICAL();
+            {
+                ( void ) fwrite( ucTraceChunk, 1, xBytes, pxTraceFile );
+            }
+            taskEXIT_CRITICAL();
+        } while( xBytes > 0U );
+
+        taskENTER_CRITICAL();
+        {
+            ( void ) fclose( pxTraceFile );
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TRACE_RECORDER */
+/*-----------------------------------------------------------*/
+
+#if ( configCHECK_FOR_STACK_OVERFLOW > 0 )
+
+    void vApplicationStackOverflowHook( TaskHandle_t xTask,
+                                        char * pcTaskName )
+    {
+        ( void ) xTask;
+
+        fprintf( stderr, "stack overflow: %s\n", pcTaskName );
+        abort();
+    }
+
+#endif /* configCHECK_FOR_STACK_OVERFLOW */
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    iSelectedGroups = argc - 1;
+    ppcSelectedGroups = &argv[ 1 ];
+
+    #if ( configUSE_TRACE_RECORDER == 1 )
+    {
+        /* 写入任务与控制任务同优先级：后者大部分时间阻塞，不会饿死写入任务。 */
+        pxTraceFile = fopen( benchTRACE_FILE, "wb" );
+        configASSERT( pxTraceFile != NULL );
+        configASSERT( xTraceRecorderStart() == pdPASS );
+        xTaskCreate( prvTraceWriterTask, "trace", benchSTACK_SIZE, NULL, benchCONTROL_PRIORITY, &xTraceWriterTask );
+    }
+    #endif
+
+    xTaskCreate( prvControlTask, "ctrl", benchSTACK_SIZE, NULL, benchCONTROL_PRIORITY, &xControlTask );
+
+    vTaskStartScheduler();
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,595 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+* Implementation of functions defined in portable.h for the POSIX port.
+*
+* 每个 FreeRTOS 任务都是一个 pthread 线程，但同一时刻只允许一个线程运行：
+* 线程只有在自己的事件（wait_for_event.h）被置位后才继续执行。
+* 上下文切换 = 置位下一个任务线程的事件 + 当前线程在自己的事件上等待。
+*
+* 中断用信号模拟：
+* - 节拍中断：专门的节拍线程按 configTICK_RATE_HZ 向当前任务线程发送 SIGALRM；
+* - 其它中断：vPortGenerateSimulatedInterrupt() 向当前任务线程发送 SIGUSR1。
+* 屏蔽中断 = 在当前线程中屏蔽上述信号，所以临界区与 CM3 移植的 BASEPRI 语义一致。
+*
+* 编译示例（在“我使用的源码”目录下，FreeRTOSConfig.h 由应用提供）：
+*   gcc -I<FreeRTOSConfig.h 所在目录> -I. -IPosix main.c Posix/port.c Posix/utils/wait_for_event.c \
+*       task.c queue.c List.c timers.c heap_4.c -pthread
+*----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "utils/wait_for_event.h"
+/*-----------------------------------------------------------*/
+
+/* 节拍中断与模拟中断使用的信号。 */
+#define portSIG_TICK         SIGALRM
+#define portSIG_INTERRUPT    SIGUSR1
+
+/* 保存在每个任务栈顶的线程信息。
+ * 主机上真正的上下文由 pthread 自己保存，TCB 的 pxTopOfStack 在这个移植里永远不变，
+ * 所以可以通过 pxTopOfStack 找到这个结构体。 */
+typedef struct THREAD
+{
+    pthread_t pthread;
+    TaskFunction_t pxCode;
+    void * pvParams;
+    volatile BaseType_t xDying; /* 任务已被删除，线程被唤醒后应直接退出。 */
+    struct event * ev;          /* 线程只有在该事件被置位后才会运行。 */
+} Thread_t;
+
+/* TCB 的第一个成员就是 pxTopOfStack，Thread_t 紧挨在它之上。 */
+#define prvGetThreadFromTask( xTask )    ( ( Thread_t * ) ( *( StackType_t ** ) ( xTask ) + 1 ) )
+/*-----------------------------------------------------------*/
+
+/* 临界区嵌套计数。同一时刻只有一个任务线程在运行，所以一个全局变量就够了，
+ * 在 prvSwitchThread() 中随线程切换保存/恢复。 */
+static volatile UBaseType_t uxCriticalNesting;
+
+static sigset_t xAllSignals;                 /* 屏蔽“中断”时使用的信号集。 */
+static sigset_t xSchedulerOriginalSignalMask;
+static pthread_t hMainThread = ( pthread_t ) NULL;
+static pthread_t hTimerTickThread;
+static volatile BaseType_t xTimerTickThreadShouldRun;
+static struct event * pxSchedulerEndEvent = NULL;
+static BaseType_t xSchedulerEnd = pdFALSE;
+static pthread_once_t hSigSetupThread = PTHREAD_ONCE_INIT;
+static uint64_t ullStartTimeNs;
+
+/* 模拟中断。 */
+static uint32_t ( * pvInterruptHandlers[ portMAX_INTERRUPTS ] )( void ) = { NULL };
+static volatile uint32_t ulPendingInterrupts = 0UL;
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignalsAndSchedulerPolicy( void );
+static void prvSetupTimerInterrupt( void );
+static void * prvWaitForStart( void * pvParams );
+static void * prvTimerTickHandler( void * pvParams );
+static void prvSystemTickHandler( int sig );
+static void prvSimulatedInterruptHandler( int sig );
+static void prvSwitchThread( Thread_t * xThreadToResume,
+                             Thread_t * xThreadToSuspend );
+static void prvSuspendSelf( Thread_t * pxThread );
+static void prvResumeThread( Thread_t * xThreadId );
+static void prvFatalError( const char * pcCall,
+                           int iErrno ) __attribute__( ( __noreturn__ ) );
+/*-----------------------------------------------------------*/
+
+static void prvFatalError( const char * pcCall,
+                           int iErrno )
+{
+    fprintf( stderr, "%s: %s\n", pcCall, strerror( iErrno ) );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     StackType_t * pxEndOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    Thread_t * thread;
+    pthread_attr_t xThreadAttributes;
+    size_t ulStackSize;
+    int iRet;
+
+    ( void ) pthread_once( &hSigSetupThread, prvSetupSignalsAndSchedulerPolicy );
+
+    /* 把 Thread_t 放在 FreeRTOS 栈的最高地址处。 */
+    ulStackSize = ( size_t ) ( pxTopOfStack + 1 - pxEndOfStack ) * sizeof( *pxTopOfStack );
+    configASSERT( ulStackSize > sizeof( Thread_t ) );
+    ( void ) ulStackSize;
+
+    thread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+    pxTopOfStack = ( StackType_t * ) thread - 1;
+
+    thread->pxCode = pxCode;
+    thread->pvParams = pvParameters;
+    thread->xDying = pdFALSE;
+    thread->ev = event_create();
+
+    if( thread->ev == NULL )
+    {
+        prvFatalError( "event_create", ENOMEM );
+    }
+
+    /* 线程真正运行的栈由 pthread 分配：configMINIMAL_STACK_SIZE 这样的 MCU 级别
+     * 栈深度不足以运行 glibc，FreeRTOS 的栈只用来存放 Thread_t 和栈水位填充值。 */
+    pthread_attr_init( &xThreadAttributes );
+    iRet = pthread_attr_setstacksize( &xThreadAttributes, PTHREAD_STACK_MIN * 4 );
+
+    if( iRet != 0 )
+    {
+        prvFatalError( "pthread_attr_setstacksize", iRet );
+    }
+
+    /* 在屏蔽信号的状态下创建线程，新线程继承信号屏蔽字，
+     * 在第一次被调度之前不会处理任何“中断”。 */
+    vPortEnterCritical();
+
+    iRet = pthread_create( &thread->pthread, &xThreadAttributes, prvWaitForStart, thread );
+
+    if( iRet != 0 )
+    {
+        prvFatalError( "pthread_create", iRet );
+    }
+
+    vPortExitCritical();
+    pthread_attr_destroy( &xThreadAttributes );
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void prvStartFirstTask( void )
+{
+    Thread_t * pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    /* Start the first task. */
+    prvResumeThread( pxFirstThread );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+    hMainThread = pthread_self();
+    xSchedulerEnd = pdFALSE;
+    pxSchedulerEndEvent = event_create();
+
+    /* 调度器运行期间主线程不处理任何“中断”，只等待 vPortEndScheduler()。 */
+    ( void ) pthread_sigmask( SIG_BLOCK, &xAllSignals, &xSchedulerOriginalSignalMask );
+
+    /* Start the timer that generates the tick ISR. */
+    prvSetupTimerInterrupt();
+
+    /* Initialise the critical nesting count ready for the first task. */
+    uxCriticalNesting = 0;
+
+    /* Start the first task. */
+    prvStartFirstTask();
+
+    /* 主线程在这里等待，直到某个任务调用 vTaskEndScheduler()。 */
+    while( xSchedulerEnd != pdTRUE )
+    {
+        ( void ) event_wait( pxSchedulerEndEvent );
+    }
+
+    /* 节拍线程已停止；其余任务线程都阻塞在各自的事件上，进程退出时由系统回收。 */
+    event_delete( pxSchedulerEndEvent );
+    pxSchedulerEndEvent = NULL;
+
+    /* Restore original signal mask. */
+    ( void ) pthread_sigmask( SIG_SETMASK, &xSchedulerOriginalSignalMask, NULL );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    Thread_t * pxCurrentThread;
+
+    /* Stop the timer tick thread. */
+    xTimerTickThreadShouldRun = pdFALSE;
+    ( void ) pthread_join( hTimerTickThread, NULL );
+
+    /* 通知主线程从 xPortStartScheduler() 返回。 */
+    xSchedulerEnd = pdTRUE;
+    event_signal( pxSchedulerEndEvent );
+
+    /* 调用者是任务线程：永远挂起，不再参与调度。 */
+    if( pthread_equal( pthread_self(), hMainThread ) == 0 )
+    {
+        pxCurrentThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        for( ; ; )
+        {
+            ( void ) event_wait( pxCurrentThread->ev );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    if( uxCriticalNesting == 0 )
+    {
+        vPortDisableInterrupts();
+    }
+
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting );
+    uxCriticalNesting--;
+
+    /* If we have reached 0 then re-enable the interrupts. */
+    if( uxCriticalNesting == 0 )
+    {
+        vPortEnableInterrupts();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+    ( void ) pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+    ( void ) pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldFromISR( void )
+{
+    Thread_t * xThreadToSuspend;
+    Thread_t * xThreadToResume;
+
+    xThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    vTaskSwitchContext();
+
+    xThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+    prvSwitchThread( xThreadToResume, xThreadToSuspend );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    /* 可能在任务中调用，也可能在模拟中断中调用（portYIELD_FROM_ISR），
+     * 两种情况下都在“关中断”的状态下完成切换。 */
+    vPortEnterCritical();
+
+    prvYieldFromISR();
+
+    vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+    int iRet;
+
+    xTimerTickThreadShouldRun = pdTRUE;
+
+    iRet = pthread_create( &hTimerTickThread, NULL, prvTimerTickHandler, NULL );
+
+    if( iRet != 0 )
+    {
+        prvFatalError( "pthread_create", iRet );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void * prvTimerTickHandler( void * pvParams )
+{
+    struct timespec xNextTick;
+
+    ( void ) pvParams;
+
+    /* 节拍线程本身不是 FreeRTOS 任务，绝不能处理“中断”信号。 */
+    ( void ) pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+
+    clock_gettime( CLOCK_MONOTONIC, &xNextTick );
+
+    while( xTimerTickThreadShouldRun != pdFALSE )
+    {
+        /* 使用绝对时间睡眠，避免每个节拍的处理时间累积成漂移。 */
+        xNextTick.tv_nsec += ( long ) portTICK_RATE_MICROSECONDS * 1000L;
+
+        while( xNextTick.tv_nsec >= 1000000000L )
+        {
+            xNextTick.tv_nsec -= 1000000000L;
+            xNextTick.tv_sec++;
+        }
+
+        ( void ) clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &xNextTick, NULL );
+
+        /* 向当前任务线程发送节拍中断。若当前任务在临界区中，信号会挂起到临界区退出时处理。 */
+        ( void ) pthread_kill( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->pthread, portSIG_TICK );
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * 节拍中断服务函数，相当于 CM3 移植中的 xPortSysTickHandler()。
+ */
+static void prvSystemTickHandler( int sig )
+{
+    ( void ) sig;
+
+    /* 信号处理期间信号本来就是屏蔽的，这里只需让嵌套计数与之保持一致，
+     * 防止切换过程中的 vPortExitCritical() 提前打开“中断”。 */
+    uxCriticalNesting++;
+
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        /* A context switch is required. */
+        prvYieldFromISR();
+    }
+
+    uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSimulatedInterruptHandler( int sig )
+{
+    uint32_t ulPending;
+    uint32_t ulInterruptNumber;
+    BaseType_t xSwitchRequired = pdFALSE;
+
+    ( void ) sig;
+
+    uxCriticalNesting++;
+
+    /* 取走全部挂起的中断，按编号从小到大依次处理。 */
+    ulPending = __atomic_exchange_n( &ulPendingInterrupts, 0UL, __ATOMIC_ACQ_REL );
+
+    while( ulPending != 0UL )
+    {
+        ulInterruptNumber = ( uint32_t ) __builtin_ctz( ulPending );
+        ulPending &= ~( 1UL << ulInterruptNumber );
+
+        if( pvInterruptHandlers[ ulInterruptNumber ] != NULL )
+        {
+            if( pvInterruptHandlers[ ulInterruptNumber ]() != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+        }
+    }
+
+    if( xSwitchRequired != pdFALSE )
+    {
+        prvYieldFromISR();
+    }
+
+    uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSetInterruptHandler( uint32_t ulInterruptNumber,
+                               uint32_t ( * pvHandler )( void ) )
+{
+    configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+    pvInterruptHandlers[ ulInterruptNumber ] = pvHandler;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+    configASSERT( ulInterruptNumber < portMAX_INTERRUPTS );
+
+    ( void ) __atomic_fetch_or( &ulPendingInterrupts, 1UL << ulInterruptNumber, __ATOMIC_ACQ_REL );
+
+    /* 和节拍中断一样，总是投递给当前任务的线程。 */
+    ( void ) pthread_kill( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->pthread, portSIG_INTERRUPT );
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void * pxTaskToDelete,
+                       volatile BaseType_t * pxPendYield )
+{
+    Thread_t * pxThread = prvGetThreadFromTask( pxTaskToDelete );
+
+    ( void ) pxPendYield;
+
+    pxThread->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void * pxTaskToDelete )
+{
+    Thread_t * pxThreadToCancel = prvGetThreadFromTask( pxTaskToDelete );
+
+    /* 被删除的线程要么已经退出，要么阻塞在 prvSuspendSelf() 中：
+     * 唤醒它，它看到 xDying 后自行退出，然后回收线程资源。 */
+    pxThreadToCancel->xDying = pdTRUE;
+    event_signal( pxThreadToCancel->ev );
+    ( void ) pthread_join( pxThreadToCancel->pthread, NULL );
+    event_delete( pxThreadToCancel->ev );
+}
+/*-----------------------------------------------------------*/
+
+static void * prvWaitForStart( void * pvParams )
+{
+    Thread_t * pxThread = pvParams;
+
+    prvSuspendSelf( pxThread );
+
+    /* Resumed for the first time, unblocks all signals. */
+    uxCriticalNesting = 0;
+    vPortEnableInterrupts();
+
+    /* Call the task's entry point. */
+    pxThread->pxCode( pxThread->pvParams );
+
+    /* A function that implements a task must not exit or attempt to return to
+     * its caller as there is nothing to return to. If a task wants to exit it
+     * should instead call vTaskDelete( NULL ). Artificially force an assert()
+     * to be triggered if configASSERT() is defined, so application writers can
+     * catch the error. */
+    configASSERT( pdFALSE );
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t * pxThreadToResume,
+                             Thread_t * pxThreadToSuspend )
+{
+    UBaseType_t uxSavedCriticalNesting;
+
+    if( pxThreadToSuspend != pxThreadToResume )
+    {
+        /* 临界区嵌套计数是“每个任务”的，切换前保存在当前线程的栈上，切换回来时恢复。 */
+        uxSavedCriticalNesting = uxCriticalNesting;
+
+        prvResumeThread( pxThreadToResume );
+
+        /* 任务删除了自己：下一个任务已经开始运行，本线程直接退出。 */
+        if( pxThreadToSuspend->xDying != pdFALSE )
+        {
+            pthread_exit( NULL );
+        }
+
+        prvSuspendSelf( pxThreadToSuspend );
+
+        uxCriticalNesting = uxSavedCriticalNesting;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t * pxThread )
+{
+    ( void ) event_wait( pxThread->ev );
+
+    /* 在阻塞期间被其它任务删除了，由 vPortCancelThread() 唤醒后退出。 */
+    if( pxThread->xDying != pdFALSE )
+    {
+        pthread_exit( NULL );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeThread( Thread_t * xThreadId )
+{
+    if( pthread_equal( pthread_self(), xThreadId->pthread ) == 0 )
+    {
+        event_signal( xThreadId->ev );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignalsAndSchedulerPolicy( void )
+{
+    struct sigaction sigtick;
+    struct sigaction sigint;
+    struct timespec xNow;
+    int iRet;
+
+    /* “中断”信号集：节拍中断和模拟中断。 */
+    sigemptyset( &xAllSignals );
+    sigaddset( &xAllSignals, portSIG_TICK );
+    sigaddset( &xAllSignals, portSIG_INTERRUPT );
+
+    /* 中断服务函数运行期间屏蔽所有“中断”，对应 CM3 上 PendSV/SysTick 不嵌套。 */
+    memset( &sigtick, 0, sizeof( sigtick ) );
+    sigtick.sa_flags = 0;
+    sigtick.sa_handler = prvSystemTickHandler;
+    sigtick.sa_mask = xAllSignals;
+
+    iRet = sigaction( portSIG_TICK, &sigtick, NULL );
+
+    if( iRet == -1 )
+    {
+        prvFatalError( "sigaction", errno );
+    }
+
+    memset( &sigint, 0, sizeof( sigint ) );
+    sigint.sa_flags = 0;
+    sigint.sa_handler = prvSimulatedInterruptHandler;
+    sigint.sa_mask = xAllSignals;
+
+    iRet = sigaction( portSIG_INTERRUPT, &sigint, NULL );
+
+    if( iRet == -1 )
+    {
+        prvFatalError( "sigaction", errno );
+    }
+
+    clock_gettime( CLOCK_MONOTONIC, &xNow );
+    ullStartTimeNs = ( uint64_t ) xNow.tv_sec * 1000000000ULL + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortGetTimeNs( void )
+{
+    struct timespec xNow;
+
+    clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL + ( uint64_t ) xNow.tv_nsec ) - ullStartTimeNs;
+}
+/*-----------------------------------------------------------*/
+
+unsigned long ulPortGetRunTime( void )
+{
+    /* 运行时间统计以微秒为单位。 */
+    return ( unsigned long ) ( ullPortGetTimeNs() / 1000ULL );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,239 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#include <limits.h>
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* POSIX（Linux 主机）移植：
+ * 每个任务对应一个 pthread 线程，同一时刻只有当前任务（pxCurrentTCB）的线程在运行，
+ * 其余线程都阻塞在各自的事件上；“关中断”就是在当前线程里屏蔽信号，
+ * 节拍中断和模拟中断则分别用 SIGALRM、SIGUSR1 投递给当前任务的线程。
+ * 这样内核的 task.c、queue.c、timers.c 和 heap_x.c 可以原样在构建服务器上运行和测性能。 */
+
+/* Type definitions. */
+#define portCHAR          char
+#define portFLOAT         float
+#define portDOUBLE        double
+#define portLONG          long
+#define portSHORT         short
+#define portSTACK_TYPE    unsigned long
+#define portBASE_TYPE     long
+#define portPOINTER_SIZE_TYPE    size_t
+
+typedef portSTACK_TYPE   StackType_t;
+typedef long             BaseType_t;
+typedef unsigned long    UBaseType_t;
+
+#if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
+    typedef uint16_t     TickType_t;
+    #define portMAX_DELAY              ( TickType_t ) 0xffff
+#elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_32_BITS )
+    typedef uint32_t     TickType_t;
+    #define portMAX_DELAY              ( TickType_t ) 0xffffffffUL
+
+/* 32 位节拍类型，读取节拍计数不需要临界区保护。 */
+    #define portTICK_TYPE_IS_ATOMIC    1
+#elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_64_BITS )
+    typedef uint64_t     TickType_t;
+    #define portMAX_DELAY              ( TickType_t ) 0xffffffffffffffffULL
+
+/* 只有在 64 位主机上，64 位节拍计数的读写才是一条指令完成的。 */
+    #if ( ULONG_MAX > 0xffffffffUL )
+        #define portTICK_TYPE_IS_ATOMIC    1
+    #endif
+#else
+    #error configTICK_TYPE_WIDTH_IN_BITS set to unsupported tick type width.
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH                   ( -1 )
+#define portHAS_STACK_OVERFLOW_CHECKING    ( 1 )
+#define portTICK_PERIOD_MS                 ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+/* 不能先转换为 TickType_t：16 位节拍类型放不下 1000000。 */
+#define portTICK_RATE_MICROSECONDS         ( ( unsigned long ) 1000000UL / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT                 8
+#define portDONT_DISCARD                   __attribute__( ( used ) )
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities. */
+extern void vPortYield( void );
+
+#define portYIELD()    vPortYield()
+
+#define portEND_SWITCHING_ISR( xSwitchRequired ) \
+    do                                           \
+    {                                            \
+        if( ( xSwitchRequired ) != pdFALSE )     \
+        {                                        \
+            traceISR_EXIT_TO_SCHEDULER();        \
+            vPortYield();                        \
+        }                                        \
+        else                                     \
+        {                                        \
+            traceISR_EXIT();                     \
+        }                                        \
+    } while( 0 )
+#define portYIELD_FROM_ISR( x )    portEND_SWITCHING_ISR( x )
+/*-----------------------------------------------------------*/
+
+/* Critical section management. */
+/* 临界区管理：主机上没有 BASEPRI，屏蔽中断就是在当前线程中屏蔽信号。
+ * 信号处理函数（模拟的 ISR）运行时信号本来就是屏蔽的，所以 FromISR 版本的屏蔽/恢复是空操作。 */
+extern void vPortDisableInterrupts( void );
+extern void vPortEnableInterrupts( void );
+#define portSET_INTERRUPT_MASK_FROM_ISR()         ( 0 )
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    ( void ) ( x )
+#define portDISABLE_INTERRUPTS()                  vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()                   vPortEnableInterrupts()
+
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+
+#define portENTER_CRITICAL()    vPortEnterCritical()
+#define portEXIT_CRITICAL()     vPortExitCritical()
+/*-----------------------------------------------------------*/
+
+/* 任务删除钩子：任务线程不能在别的线程里被直接“释放”，
+ * 需要先标记为正在退出，再由空闲任务在 prvDeleteTCB() 中唤醒并回收（join）该线程。 */
+extern void vPortThreadDying( void * pxTaskToDelete,
+                              volatile BaseType_t * pxPendYield );
+extern void vPortCancelThread( void * pxTaskToDelete );
+#define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxPendYield )    vPortThreadDying( ( pvTaskToDelete ), ( pxPendYield ) )
+#define portCLEAN_UP_TCB( pxTCB )                                  vPortCancelThread( pxTCB )
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site.  These are
+ * not necessary for to use this port.  They are defined so the common demo files
+ * (which build with all the ports) will build. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations. */
+/* 与 CM3 移植的 CLZ 指令等价，这里用编译器内建函数实现。 */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
+#endif
+
+#if configUSE_PORT_OPTIMISED_TASK_SELECTION == 1
+
+/* Check the configuration. */
+    #if ( configMAX_PRIORITIES > 32 )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 difference priorities as tasks that share a priority will time slice.
+    #endif
+
+/* Store/clear the ready priorities in a bit map. */
+    #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+    #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+/*-----------------------------------------------------------*/
+
+    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( 31UL - ( uint32_t ) __builtin_clz( ( uint32_t ) ( uxReadyPriorities ) ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
+/* 运行时间统计：用 CLOCK_MONOTONIC 提供微秒级计数，足够用于回归性能测试。 */
+extern unsigned long ulPortGetRunTime( void );
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    /* 无需配置，单调时钟总是可用。 */
+#define portGET_RUN_TIME_COUNTER_VALUE()            ulPortGetRunTime()
+
+/* 纳秒级时间戳，给基准测试测量延迟用（内核本身不使用）。 */
+extern uint64_t ullPortGetTimeNs( void );
+/*-----------------------------------------------------------*/
+
+/* 模拟中断：与 Win32 移植的接口一致。
+ * vPortSetInterruptHandler() 注册编号为 ulInterruptNumber 的中断服务函数，
+ * vPortGenerateSimulatedInterrupt() 可以在任意线程（包括非 FreeRTOS 线程，
+ * 用来模拟外设）中触发该中断，中断服务函数在当前任务的线程上下文中以“中断”的身份运行。
+ * 服务函数返回 pdTRUE 表示需要进行任务切换（相当于 portYIELD_FROM_ISR( pdTRUE )）。 */
+#define portMAX_INTERRUPTS    ( ( uint32_t ) 32 )
+
+extern void vPortSetInterruptHandler( uint32_t ulInterruptNumber,
+                                      uint32_t ( * pvHandler )( void ) );
+extern void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber );
+/*-----------------------------------------------------------*/
+
+/* Tickless idle/low power functionality. */
+/* 主机移植不支持无节拍空闲模式。 */
+#if ( configUSE_TICKLESS_IDLE != 0 )
+    #error configUSE_TICKLESS_IDLE is not supported by the POSIX port.
+#endif
+/*-----------------------------------------------------------*/
+
+/* portNOP() is not required by this port. */
+#define portNOP()
+
+#define portINLINE              __inline
+
+#ifndef portFORCE_INLINE
+    #define portFORCE_INLINE    inline __attribute__( ( always_inline ) )
+#endif
+
+#define portMEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
+
+/* 无锁数据结构使用的比较交换和完整内存屏障。主机编译器是 GCC，直接使用原子内建函数，
+ * 避免 atomic.h 的实现每次都进出临界区。 */
+#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand ) \
+    ( __sync_bool_compare_and_swap( ( pulDestination ), ( ulComparand ), ( ulExchange ) ) ? pdTRUE : pdFALSE )
+#define portMEMORY_FULL_BARRIER()    __sync_synchronize()
+
+/* 信号量快速路径（configUSE_SEMAPHORE_FAST_PATH）使用的比较交换。主机上 UBaseType_t 和指针是 64 位，
+ * 不能使用 atomic.h 的 32 位实现。 */
+#define portATOMIC_COMPARE_AND_SWAP_UBASE( puxDestination, uxExchange, uxComparand ) \
+    ( __sync_bool_compare_and_swap( ( puxDestination ), ( uxComparand ), ( uxExchange ) ) ? pdTRUE : pdFALSE )
+#define portATOMIC_COMPARE_AND_SWAP_POINTER( ppvDestination, pvExchange, pvComparand ) \
+    ( __sync_bool_compare_and_swap( ( ppvDestination ), ( pvComparand ), ( pvExchange ) ) ? pdTRUE : pdFALSE )
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* PORTMACRO_H */
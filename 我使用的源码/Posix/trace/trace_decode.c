@@ -0,0 +1,640 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+* 内核跟踪记录器（trace_recorder.c）输出的主机端解码程序。
+*
+* 读取 xTraceRecorderRead() 得到的原始数据，输出：
+* - 每个 API 从进入到返回的耗时（包括其中阻塞的时间）的 log2 直方图和最小/平均/最大值；
+* - 每个任务因各种原因阻塞的次数和总时间（从阻塞事件到该任务再次就绪）；
+* - 指定 -t 时输出按核心分组的事件时间线。
+*
+* 编译运行（在“我使用的源码”目录下）：
+*   gcc -O2 -I. -o trace_decode Posix/trace/trace_decode.c
+*   ./trace_decode [-t] trace.bin
+*----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/* 只使用事件码和 API 编号，不需要内核的其它头文件。 */
+#define traceRECORDER_CODES_ONLY
+#include "trace_recorder.h"
+/*-----------------------------------------------------------*/
+
+#define decodeMAX_CORES           16U
+#define decodeMAX_TASKS           1024U
+#define decodeMAX_NESTING         16U
+#define decodeHISTOGRAM_BUCKETS   40U
+#define decodeBLOCK_CAUSES        8U
+
+/* 事件码到阻塞原因下标的转换：BLOCK_DELAY 到 BLOCK_EVENT_GROUP 连续编号。 */
+#define decodeBLOCK_INDEX( ucCode )    ( ( size_t ) ( ( ucCode ) - traceRECORDER_EVENT_BLOCK_DELAY ) )
+/*-----------------------------------------------------------*/
+
+typedef struct
+{
+    uint32_t ulApi;
+    uint64_t ullEnter;
+} DecodeCall_t;
+
+typedef struct
+{
+    uint32_t ulId;
+    char cName[ 64 ];
+    size_t xNameLength;
+    DecodeCall_t xCalls[ decodeMAX_NESTING ]; /* 尚未返回的 API 调用。 */
+    size_t xDepth;
+    int iBlockCause;                          /* 尚未就绪的阻塞原因，-1 表示没有。 */
+    uint64_t ullBlockStart;
+    uint64_t ullBlockCount[ decodeBLOCK_CAUSES ];
+    uint64_t ullBlockTime[ decodeBLOCK_CAUSES ];
+    uint64_t ullSwitchIns;
+} DecodeTask_t;
+
+typedef struct
+{
+    uint32_t ulLastTimestamp;
+    uint64_t ullTime;              /* 展开为 64 位的时间戳。 */
+    int iStarted;
+    DecodeTask_t * pxCurrent;      /* 当前运行的任务。 */
+    DecodeTask_t * pxLastCreated;  /* TASK_NAME 事件归属的任务。 */
+    DecodeCall_t xIsrCalls[ decodeMAX_NESTING ];
+    size_t xIsrCallDepth;
+    size_t xIsrNesting;
+    uint64_t ullDropped;
+} DecodeCore_t;
+
+typedef struct
+{
+    uint64_t ullCount;
+    uint64_t ullTotal;
+    uint64_t ullMin;
+    uint64_t ullMax;
+    uint64_t ullBuckets[ decodeHISTOGRAM_BUCKETS ];
+} DecodeHistogram_t;
+/*-----------------------------------------------------------*/
+
+static const char * const pcApiNames[ traceRECORDER_API_COUNT ] =
+{
+    #define decodeAPI_NAME( xId, xName )    [ xId ] = #xName,
+    traceRECORDER_API_LIST( decodeAPI_NAME )
+    #undef decodeAPI_NAME
+};
+
+static const char * const pcBlockCauses[ decodeBLOCK_CAUSES ] =
+{
+    "delay", "queue-receive", "queue-peek", "queue-send", "stream-receive", "stream-send", "notify", "event-group"
+};
+
+static DecodeCore_t xCores[ decodeMAX_CORES ];
+static DecodeTask_t xTasks[ decodeMAX_TASKS ];
+static size_t xTaskCount = 0;
+static DecodeHistogram_t xHistograms[ traceRECORDER_API_COUNT ];
+static uint32_t ulTimestampHz = 1;
+static int iTimeline = 0;
+/*-----------------------------------------------------------*/
+
+static uint32_t prvReadWord( const uint8_t * pucBytes )
+{
+    return ( uint32_t ) pucBytes[ 0 ] | ( ( uint32_t ) pucBytes[ 1 ] << 8 ) |
+           ( ( uint32_t ) pucBytes[ 2 ] << 16 ) | ( ( uint32_t ) pucBytes[ 3 ] << 24 );
+}
+/*-----------------------------------------------------------*/
+
+static double prvToMicroseconds( uint64_t ullTicks )
+{
+    return ( double ) ullTicks * 1000000.0 / ( double ) ulTimestampHz;
+}
+/*-----------------------------------------------------------*/
+
+static DecodeTask_t * prvFindTask( uint32_t ulId )
+{
+    DecodeTask_t * pxTask = NULL;
+    size_t x;
+
+    /* 任务删除后地址可能被新任务复用，从后往前找到的是最近创建的一个。 */
+    for( x = xTaskCount; x > 0; x-- )
+    {
+        if( xTasks[ x - 1 ].ulId == ulId )
+        {
+            pxTask = &xTasks[ x - 1 ];
+            break;
+        }
+    }
+
+    if( ( pxTask == NULL ) && ( xTaskCount < decodeMAX_TASKS ) )
+    {
+        /* 记录开始之前创建的任务没有名称。 */
+        pxTask = &xTasks[ xTaskCount++ ];
+        memset( pxTask, 0, sizeof( *pxTask ) );
+        pxTask->ulId = ulId;
+        pxTask->iBlockCause = -1;
+        ( void ) snprintf( pxTask->cName, sizeof( pxTask->cName ), "task-%06x", ( unsigned ) ulId );
+    }
+
+    return pxTask;
+}
+/*-----------------------------------------------------------*/
+
+static DecodeTask_t * prvCreateTask( uint32_t ulId )
+{
+    DecodeTask_t * pxTask = NULL;
+
+    if( xTaskCount < decodeMAX_TASKS )
+    {
+        pxTask = &xTasks[ xTaskCount++ ];
+        memset( pxTask, 0, sizeof( *pxTask ) );
+        pxTask->ulId = ulId;
+        pxTask->iBlockCause = -1;
+    }
+
+    return pxTask;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAppendName( DecodeTask_t * pxTask,
+                           uint32_t ulWord0,
+                           uint32_t ulParameter )
+{
+    uint8_t ucChars[ 7 ];
+    size_t x;
+
+    ucChars[ 0 ] = ( uint8_t ) ulWord0;
+    ucChars[ 1 ] = ( uint8_t ) ( ulWord0 >> 8 );
+    ucChars[ 2 ] = ( uint8_t ) ( ulWord0 >> 16 );
+    ucChars[ 3 ] = ( uint8_t ) ( ulWord0 >> 24 );
+    ucChars[ 4 ] = ( uint8_t ) ulParameter;
+    ucChars[ 5 ] = ( uint8_t ) ( ulParameter >> 8 );
+    ucChars[ 6 ] = ( uint8_t ) ( ulParameter >> 16 );
+
+    for( x = 0; ( x < sizeof( ucChars ) ) && ( ucChars[ x ] != 0U ); x++ )
+    {
+        if( pxTask->xNameLength < ( sizeof( pxTask->cName ) - 1U ) )
+        {
+            pxTask->cName[ pxTask->xNameLength++ ] = ( char ) ucChars[ x ];
+            pxTask->cName[ pxTask->xNameLength ] = '\0';
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordLatency( uint32_t ulApi,
+                              uint64_t ullLatency )
+{
+    DecodeHistogram_t * pxHistogram = &xHistograms[ ulApi ];
+    size_t xBucket = 0;
+
+    while( ( xBucket < ( decodeHISTOGRAM_BUCKETS - 1U ) ) && ( ( ullLatency >> xBucket ) > 1U ) )
+    {
+        xBucket++;
+    }
+
+    if( ( pxHistogram->ullCount == 0U ) || ( ullLatency < pxHistogram->ullMin ) )
+    {
+        pxHistogram->ullMin = ullLatency;
+    }
+
+    if( ullLatency > pxHistogram->ullMax )
+    {
+        pxHistogram->ullMax = ullLatency;
+    }
+
+    pxHistogram->ullCount++;
+    pxHistogram->ullTotal += ullLatency;
+    pxHistogram->ullBuckets[ xBucket ]++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvApiEnter( DecodeCore_t * pxCore,
+                         uint32_t ulApi )
+{
+    DecodeCall_t * pxCalls = pxCore->xIsrCalls;
+    size_t * pxDepth = &pxCore->xIsrCallDepth;
+
+    if( ( pxCore->xIsrNesting == 0U ) && ( pxCore->pxCurrent != NULL ) )
+    {
+        pxCalls = pxCore->pxCurrent->xCalls;
+        pxDepth = &pxCore->pxCurrent->xDepth;
+    }
+
+    if( *pxDepth < decodeMAX_NESTING )
+    {
+        pxCalls[ *pxDepth ].ulApi = ulApi;
+        pxCalls[ *pxDepth ].ullEnter = pxCore->ullTime;
+        ( *pxDepth )++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvApiReturn( DecodeCore_t * pxCore,
+                          uint32_t ulApi )
+{
+    DecodeCall_t * pxCalls = pxCore->xIsrCalls;
+    size_t * pxDepth = &pxCore->xIsrCallDepth;
+
+    if( ( pxCore->xIsrNesting == 0U ) && ( pxCore->pxCurrent != NULL ) )
+    {
+        pxCalls = pxCore->pxCurrent->xCalls;
+        pxDepth = &pxCore->pxCurrent->xDepth;
+    }
+
+    /* 丢弃事件或记录开始前已进入的调用会使进入/返回不配对，只统计配对的部分。 */
+    while( *pxDepth > 0U )
+    {
+        ( *pxDepth )--;
+
+        if( pxCalls[ *pxDepth ].ulApi == ulApi )
+        {
+            prvRecordLatency( ulApi, pxCore->ullTime - pxCalls[ *pxDepth ].ullEnter );
+            break;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintEvent( size_t xCore,
+                           uint8_t ucCode,
+                           uint32_t ulParameter,
+                           const DecodeTask_t * pxTask )
+{
+    printf( "%14.3f  core %u  ", prvToMicroseconds( xCores[ xCore ].ullTime ), ( unsigned ) xCore );
+
+    switch( ucCode )
+    {
+        case traceRECORDER_EVENT_TASK_CREATE:
+            printf( "create     %06x\n", ( unsigned ) ulParameter );
+            break;
+
+        case traceRECORDER_EVENT_TASK_DELETE:
+            printf( "delete     %s\n", ( pxTask != NULL ) ? pxTask->cName : "?" );
+            break;
+
+        case traceRECORDER_EVENT_TASK_SWITCHED_IN:
+            printf( "switch-in  %s\n", ( pxTask != NULL ) ? pxTask->cName : "?" );
+            break;
+
+        case traceRECORDER_EVENT_TASK_READY:
+            printf( "ready      %s\n", ( pxTask != NULL ) ? pxTask->cName : "?" );
+            break;
+
+        case traceRECORDER_EVENT_TASK_SUSPEND:
+            printf( "suspend    %s\n", ( pxTask != NULL ) ? pxTask->cName : "?" );
+            break;
+
+        case traceRECORDER_EVENT_QUEUE_CREATE:
+            printf( "queue      %06x\n", ( unsigned ) ulParameter );
+            break;
+
+        case traceRECORDER_EVENT_MUTEX_CREATE:
+            printf( "mutex      %06x\n", ( unsigned ) ulParameter );
+            break;
+
+        case traceRECORDER_EVENT_ISR_ENTER:
+            printf( "isr-enter\n" );
+            break;
+
+        case traceRECORDER_EVENT_ISR_EXIT:
+            printf( "isr-exit\n" );
+            break;
+
+        case traceRECORDER_EVENT_ISR_EXIT_TO_SCHEDULER:
+            printf( "isr-exit   -> scheduler\n" );
+            break;
+
+        case traceRECORDER_EVENT_API_ENTER:
+        case traceRECORDER_EVENT_API_RETURN:
+            printf( "%-10s %s\n", ( ucCode == traceRECORDER_EVENT_API_ENTER ) ? "enter" : "return",
+                    ( ( ulParameter < traceRECORDER_API_COUNT ) && ( pcApiNames[ ulParameter ] != NULL ) ) ? pcApiNames[ ulParameter ] : "?" );
+            break;
+
+        default:
+
+            if( ( ucCode >= traceRECORDER_EVENT_BLOCK_DELAY ) && ( ucCode <= traceRECORDER_EVENT_BLOCK_EVENT_GROUP ) )
+            {
+                printf( "block      %s %06x\n", pcBlockCauses[ decodeBLOCK_INDEX( ucCode ) ], ( unsigned ) ulParameter );
+            }
+            else
+            {
+                printf( "unknown    %02x %06x\n", ( unsigned ) ucCode, ( unsigned ) ulParameter );
+            }
+
+            break;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessEvent( size_t xCoreId,
+                             uint32_t ulWord0,
+                             uint32_t ulWord1 )
+{
+    DecodeCore_t * pxCore = &xCores[ xCoreId ];
+    uint8_t ucCode = ( uint8_t ) ( ulWord1 >> 24 );
+    uint32_t ulParameter = ulWord1 & 0x00FFFFFFUL;
+    DecodeTask_t * pxTask = NULL;
+
+    if( ucCode == traceRECORDER_EVENT_TASK_NAME )
+    {
+        /* 第 0 个字是字符而不是时间戳。 */
+        if( pxCore->pxLastCreated != NULL )
+        {
+            prvAppendName( pxCore->pxLastCreated, ulWord0, ulParameter );
+        }
+
+        return;
+    }
+
+    /* 中断可能在时间戳和占用槽位之间插入更晚的事件，因此按有符号差值展开。 */
+    if( pxCore->iStarted == 0 )
+    {
+        pxCore->iStarted = 1;
+        pxCore->ullTime = ulWord0;
+    }
+    else
+    {
+        pxCore->ullTime += ( uint64_t ) ( int64_t ) ( int32_t ) ( ulWord0 - pxCore->ulLastTimestamp );
+    }
+
+    pxCore->ulLastTimestamp = ulWord0;
+
+    switch( ucCode )
+    {
+        case traceRECORDER_EVENT_TASK_CREATE:
+            pxCore->pxLastCreated = prvCreateTask( ulParameter );
+            break;
+
+        case traceRECORDER_EVENT_TASK_SWITCHED_IN:
+            pxTask = prvFindTask( ulParameter );
+            pxCore->pxCurrent = pxTask;
+
+            if( pxTask != NULL )
+            {
+                pxTask->ullSwitchIns++;
+            }
+
+            break;
+
+        case traceRECORDER_EVENT_TASK_READY:
+            pxTask = prvFindTask( ulParameter );
+
+            if( ( pxTask != NULL ) && ( pxTask->iBlockCause >= 0 ) )
+            {
+                pxTask->ullBlockCount[ pxTask->iBlockCause ]++;
+                pxTask->ullBlockTime[ pxTask->iBlockCause ] += pxCore->ullTime - pxTask->ullBlockStart;
+                pxTask->iBlockCause = -1;
+            }
+
+            break;
+
+        case traceRECORDER_EVENT_TASK_DELETE:
+        case traceRECORDER_EVENT_TASK_SUSPEND:
+            pxTask = prvFindTask( ulParameter );
+
+            if( pxTask != NULL )
+            {
+                pxTask->iBlockCause = -1;
+            }
+
+            break;
+
+        case traceRECORDER_EVENT_ISR_ENTER:
+            pxCore->xIsrNesting++;
+            break;
+
+        case traceRECORDER_EVENT_ISR_EXIT:
+        case traceRECORDER_EVENT_ISR_EXIT_TO_SCHEDULER:
+
+            if( pxCore->xIsrNesting > 0U )
+            {
+                pxCore->xIsrNesting--;
+            }
+
+            break;
+
+        case traceRECORDER_EVENT_API_ENTER:
+
+            if( ulParameter < traceRECORDER_API_COUNT )
+            {
+                prvApiEnter( pxCore, ulParameter );
+            }
+
+            break;
+
+        case traceRECORDER_EVENT_API_RETURN:
+
+            if( ulParameter < traceRECORDER_API_COUNT )
+            {
+                prvApiReturn( pxCore, ulParameter );
+            }
+
+            break;
+
+        default:
+
+            if( ( ucCode >= traceRECORDER_EVENT_BLOCK_DELAY ) && ( ucCode <= traceRECORDER_EVENT_BLOCK_EVENT_GROUP ) &&
+                ( pxCore->pxCurrent != NULL ) )
+            {
+                pxCore->pxCurrent->iBlockCause = ( int ) decodeBLOCK_INDEX( ucCode );
+                pxCore->pxCurrent->ullBlockStart = pxCore->ullTime;
+            }
+
+            break;
+    }
+
+    if( iTimeline != 0 )
+    {
+        prvPrintEvent( xCoreId, ucCode, ulParameter, pxTask );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( uint64_t ullEvents )
+{
+    const DecodeHistogram_t * pxHistogram;
+    const DecodeTask_t * pxTask;
+    uint64_t ullDropped = 0;
+    size_t x;
+    size_t y;
+
+    for( x = 0; x < decodeMAX_CORES; x++ )
+    {
+        ullDropped += xCores[ x ].ullDropped;
+    }
+
+    printf( "\n%llu events, %llu dropped, %u tasks\n", ( unsigned long long ) ullEvents,
+            ( unsigned long long ) ullDropped, ( unsigned ) xTaskCount );
+
+    printf( "\nAPI latency (us, enter to return, including time blocked)\n" );
+    printf( "%-30s %10s %12s %12s %12s\n", "api", "calls", "min", "avg", "max" );
+
+    for( x = 1; x < traceRECORDER_API_COUNT; x++ )
+    {
+        pxHistogram = &xHistograms[ x ];
+
+        if( pxHistogram->ullCount == 0U )
+        {
+            continue;
+        }
+
+        printf( "%-30s %10llu %12.3f %12.3f %12.3f\n", pcApiNames[ x ], ( unsigned long long ) pxHistogram->ullCount,
+                prvToMicroseconds( pxHistogram->ullMin ),
+                prvToMicroseconds( pxHistogram->ullTotal ) / ( double ) pxHistogram->ullCount,
+                prvToMicroseconds( pxHistogram->ullMax ) );
+
+        for( y = 0; y < decodeHISTOGRAM_BUCKETS; y++ )
+        {
+            if( pxHistogram->ullBuckets[ y ] != 0U )
+            {
+                printf( "    < %12.3f %10llu\n", prvToMicroseconds( ( uint64_t ) 2U << y ),
+                        ( unsigned long long ) pxHistogram->ullBuckets[ y ] );
+            }
+        }
+    }
+
+    printf( "\nBlocking (count / total us, block event to ready)\n" );
+
+    for( x = 0; x < xTaskCount; x++ )
+    {
+        pxTask = &xTasks[ x ];
+        printf( "%-20s switch-ins %-8llu", pxTask->cName, ( unsigned long long ) pxTask->ullSwitchIns );
+
+        for( y = 0; y < decodeBLOCK_CAUSES; y++ )
+        {
+            if( pxTask->ullBlockCount[ y ] != 0U )
+            {
+                printf( " %s %llu/%.1f", pcBlockCauses[ y ], ( unsigned long long ) pxTask->ullBlockCount[ y ],
+                        prvToMicroseconds( pxTask->ullBlockTime[ y ] ) );
+            }
+        }
+
+        printf( "\n" );
+    }
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    FILE * pxFile;
+    uint8_t ucBytes[ traceRECORDER_EVENT_BYTES ];
+    uint8_t ucHeader[ traceRECORDER_HEADER_BYTES ];
+    const char * pcPath = NULL;
+    size_t xCore = 0;
+    size_t xCoreCount;
+    uint64_t ullEvents = 0;
+    uint32_t ulWord0;
+    uint32_t ulWord1;
+    int i;
+
+    for( i = 1; i < argc; i++ )
+    {
+        if( strcmp( argv[ i ], "-t" ) == 0 )
+        {
+            iTimeline = 1;
+        }
+        else
+        {
+            pcPath = argv[ i ];
+        }
+    }
+
+    if( pcPath == NULL )
+    {
+        fprintf( stderr, "usage: %s [-t] trace.bin\n", argv[ 0 ] );
+        return 2;
+    }
+
+    pxFile = fopen( pcPath, "rb" );
+
+    if( pxFile == NULL )
+    {
+        perror( pcPath );
+        return 1;
+    }
+
+    if( ( fread( ucHeader, 1, sizeof( ucHeader ), pxFile ) != sizeof( ucHeader ) ) ||
+        ( prvReadWord( &ucHeader[ 0 ] ) != traceRECORDER_MAGIC ) ||
+        ( ( prvReadWord( &ucHeader[ 4 ] ) & 0xFFFFU ) != traceRECORDER_VERSION ) ||
+        ( ucHeader[ 7 ] != traceRECORDER_EVENT_BYTES ) )
+    {
+        fprintf( stderr, "%s: not a version %u trace recorder file\n", pcPath, ( unsigned ) traceRECORDER_VERSION );
+        fclose( pxFile );
+        return 1;
+    }
+
+    xCoreCount = ucHeader[ 6 ];
+    ulTimestampHz = prvReadWord( &ucHeader[ 8 ] );
+
+    if( ( xCoreCount == 0U ) || ( xCoreCount > decodeMAX_CORES ) || ( ulTimestampHz == 0U ) )
+    {
+        fprintf( stderr, "%s: unsupported header (%u cores, %u Hz)\n", pcPath, ( unsigned ) xCoreCount, ( unsigned ) ulTimestampHz );
+        fclose( pxFile );
+        return 1;
+    }
+
+    printf( "%u core(s), timestamp %u Hz, tick %u Hz\n", ( unsigned ) xCoreCount,
+            ( unsigned ) ulTimestampHz, ( unsigned ) prvReadWord( &ucHeader[ 12 ] ) );
+
+    while( fread( ucBytes, 1, sizeof( ucBytes ), pxFile ) == sizeof( ucBytes ) )
+    {
+        ulWord0 = prvReadWord( &ucBytes[ 0 ] );
+        ulWord1 = prvReadWord( &ucBytes[ 4 ] );
+
+        if( ( ulWord1 >> 24 ) == traceRECORDER_EVENT_CORE )
+        {
+            xCore = ulWord1 & 0x00FFFFFFUL;
+
+            if( xCore >= xCoreCount )
+            {
+                fprintf( stderr, "%s: bad core number %u\n", pcPath, ( unsigned ) xCore );
+                break;
+            }
+
+            xCores[ xCore ].ullDropped += ulWord0;
+
+            if( ( ulWord0 != 0U ) && ( iTimeline != 0 ) )
+            {
+                printf( "                core %u  dropped %u events\n", ( unsigned ) xCore, ( unsigned ) ulWord0 );
+            }
+        }
+        else
+        {
+            prvProcessEvent( xCore, ulWord0, ulWord1 );
+            ullEvents++;
+        }
+    }
+
+    fclose( pxFile );
+    prvReport( ullEvents );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
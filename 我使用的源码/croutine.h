@@ -33,7 +33,7 @@
     #error "include FreeRTOS.h must appear in source files before include croutine.h"
 #endif
 
-#include "list.h"
+#include "List.h"
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
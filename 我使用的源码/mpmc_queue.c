@@ -0,0 +1,757 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mpmc_queue.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* 应用程序没有启用 MPMC 队列时整个文件都不参与编译，对应的 #endif 在文件末尾。 */
+#if ( configUSE_MPMC_QUEUES == 1 )
+
+/*
+ * 读写位置的比较交换和完整内存屏障。atomic.h 的实现依靠屏蔽本核中断，只在单核上是原子的，
+ * 因此 SMP 移植层必须在 portmacro.h 中用硬件原子指令提供这两个宏。
+ * portATOMIC_COMPARE_AND_SWAP_U32() 在 *pulDestination 等于 ulComparand 时写入 ulExchange
+ * 并返回 pdTRUE，否则返回 pdFALSE。
+ */
+    #ifndef portATOMIC_COMPARE_AND_SWAP_U32
+        #if ( configNUMBER_OF_CORES > 1 )
+            #error portATOMIC_COMPARE_AND_SWAP_U32 must be defined in portmacro.h to build mpmc_queue.c in SMP FreeRTOS
+        #endif
+
+        #include "atomic.h"
+
+        #define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand ) \
+    ( ( Atomic_CompareAndSwap_u32( ( pulDestination ), ( ulExchange ), ( ulComparand ) ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS ) ? pdTRUE : pdFALSE )
+    #endif
+
+    #ifndef portMEMORY_FULL_BARRIER
+        #if ( configNUMBER_OF_CORES > 1 )
+            #error portMEMORY_FULL_BARRIER must be defined in portmacro.h to build mpmc_queue.c in SMP FreeRTOS
+        #endif
+
+        #define portMEMORY_FULL_BARRIER()    portMEMORY_BARRIER()
+    #endif
+
+/* 与 queue.c 相同：协作式调度器下唤醒高优先级任务不立即切换。 */
+    #if ( configUSE_PREEMPTION == 0 )
+        #define mpmcYIELD_IF_USING_PREEMPTION()
+    #else
+        #if ( configNUMBER_OF_CORES == 1 )
+            #define mpmcYIELD_IF_USING_PREEMPTION()    portYIELD_WITHIN_API()
+        #else
+            #define mpmcYIELD_IF_USING_PREEMPTION()    vTaskYieldWithinAPI()
+        #endif
+    #endif
+
+/* ucFlags 中的标志位。 */
+    #define mpmcFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 1 ) /* 队列使用静态内存创建。 */
+
+/*-----------------------------------------------------------*/
+
+/* MPMC 队列的控制结构。 */
+typedef struct MpmcQueueDef_t
+{
+    volatile uint32_t ulEnqueuePosition;      /* 下一个写位置，写入者用比较交换占用。 */
+    volatile uint32_t ulDequeuePosition;      /* 下一个读位置，读取者用比较交换占用。 */
+    volatile uint32_t * pulSequence;          /* 每个槽位的序号：等于写位置表示空闲，等于写位置 + 1 表示数据已发布。 */
+    uint8_t * pucStorage;                     /* 存放数据项的存储区。 */
+    UBaseType_t uxMask;                       /* 队列长度 - 1，位置与它按位与得到槽位下标。 */
+    UBaseType_t uxItemSize;                   /* 每个数据项的字节数。 */
+    volatile UBaseType_t uxSendersWaiting;    /* 正在阻塞或准备阻塞的写入者数，为 0 时读取者不必进入临界区。 */
+    volatile UBaseType_t uxReceiversWaiting;  /* 正在阻塞或准备阻塞的读取者数，为 0 时写入者不必进入临界区。 */
+    List_t xTasksWaitingToSend;               /* 因队列满而阻塞的任务，按优先级排序。 */
+    List_t xTasksWaitingToReceive;            /* 因队列空而阻塞的任务，按优先级排序。 */
+    uint8_t ucFlags;
+} MpmcQueue_t;
+
+/*
+ * 位置 ulPosition 对应的槽位仍被上一轮的数据项占用时队列满；
+ * 位置 ulPosition 对应的槽位还没有发布数据时队列空。
+ * 两个序号差都按有符号数比较，位置计数回绕后仍然正确。
+ */
+    #define prvMpmcIsFull( pxQueue, ulPosition ) \
+    ( ( ( int32_t ) ( ( pxQueue )->pulSequence[ ( ulPosition ) & ( pxQueue )->uxMask ] - ( ulPosition ) ) < 0 ) ? pdTRUE : pdFALSE )
+
+    #define prvMpmcIsEmpty( pxQueue, ulPosition ) \
+    ( ( ( int32_t ) ( ( pxQueue )->pulSequence[ ( ulPosition ) & ( pxQueue )->uxMask ] - ( ( ulPosition ) + 1U ) ) < 0 ) ? pdTRUE : pdFALSE )
+
+/*
+ * 初始化控制结构和序号数组。
+ */
+static void prvInitialiseNewMpmcQueue( MpmcQueue_t * const pxQueue,
+                                       uint8_t * const pucStorage,
+                                       UBaseType_t uxQueueLength,
+                                       UBaseType_t uxItemSize,
+                                       uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*
+ * 尝试占用一个写位置并发布数据项，队列满时返回 pdFALSE。不进入临界区。
+ */
+static BaseType_t prvMpmcTryEnqueue( MpmcQueue_t * const pxQueue,
+                                     const void * const pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * 尝试占用一个读位置并取出数据项，队列空时返回 pdFALSE。不进入临界区。
+ */
+static BaseType_t prvMpmcTryDequeue( MpmcQueue_t * const pxQueue,
+                                     void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * 在队列满（xWaitToSend 为 pdTRUE）或空时把当前任务挂到对应的事件列表上并阻塞，
+ * 检查和挂起在同一个临界区内完成。返回时任务已被唤醒、超时，或者检查时条件已不成立。
+ */
+static void prvMpmcBlock( MpmcQueue_t * const pxQueue,
+                          BaseType_t xWaitToSend,
+                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * 有等待者时唤醒 pxEventList 中优先级最高的任务。
+ */
+static void prvMpmcWake( volatile UBaseType_t * const puxWaiting,
+                         List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+static void prvMpmcWakeFromISR( volatile UBaseType_t * const puxWaiting,
+                                List_t * const pxEventList,
+                                BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    MpmcQueueHandle_t xMpmcQueueCreate( UBaseType_t uxQueueLength,
+                                        UBaseType_t uxItemSize )
+    {
+        void * pvAllocatedMemory = NULL;
+        size_t xStorageBytes;
+
+        traceENTER_xMpmcQueueCreate( uxQueueLength, uxItemSize );
+
+        configASSERT( uxQueueLength >= ( UBaseType_t ) 2 );
+        configASSERT( ( uxQueueLength & ( uxQueueLength - ( UBaseType_t ) 1 ) ) == ( UBaseType_t ) 0 );
+        configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+        xStorageBytes = mpmcQUEUE_STORAGE_BYTES( uxQueueLength, uxItemSize );
+
+        /* 检查乘法和加法都没有溢出。 */
+        if( ( ( xStorageBytes / ( size_t ) uxQueueLength ) == ( sizeof( uint32_t ) + ( size_t ) uxItemSize ) ) &&
+            ( ( SIZE_MAX - sizeof( MpmcQueue_t ) ) >= xStorageBytes ) )
+        {
+            /* 序号数组紧跟在控制结构之后，数据项在序号数组之后。
+             * sizeof( MpmcQueue_t ) 是 4 的倍数，序号数组自然对齐。 */
+            pvAllocatedMemory = pvPortMalloc( sizeof( MpmcQueue_t ) + xStorageBytes );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pvAllocatedMemory != NULL )
+        {
+            prvInitialiseNewMpmcQueue( ( MpmcQueue_t * ) pvAllocatedMemory,
+                                       ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( MpmcQueue_t ),
+                                       uxQueueLength,
+                                       uxItemSize,
+                                       0 );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xMpmcQueueCreate( pvAllocatedMemory );
+
+        return ( MpmcQueueHandle_t ) pvAllocatedMemory;
+    }
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    MpmcQueueHandle_t xMpmcQueueCreateStatic( UBaseType_t uxQueueLength,
+                                              UBaseType_t uxItemSize,
+                                              uint8_t * const pucQueueStorage,
+                                              StaticMpmcQueue_t * const pxStaticQueue )
+    {
+        MpmcQueue_t * const pxQueue = ( MpmcQueue_t * ) pxStaticQueue;
+        MpmcQueueHandle_t xReturn = NULL;
+
+        traceENTER_xMpmcQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxStaticQueue );
+
+        configASSERT( uxQueueLength >= ( UBaseType_t ) 2 );
+        configASSERT( ( uxQueueLength & ( uxQueueLength - ( UBaseType_t ) 1 ) ) == ( UBaseType_t ) 0 );
+        configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+        configASSERT( pucQueueStorage );
+        configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucQueueStorage ) & ( portPOINTER_SIZE_TYPE ) ( sizeof( uint32_t ) - 1U ) ) == 0U );
+        configASSERT( pxStaticQueue );
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* 检查 StaticMpmcQueue_t 与真实的控制结构大小一致。 */
+            volatile size_t xSize = sizeof( StaticMpmcQueue_t );
+            configASSERT( xSize == sizeof( MpmcQueue_t ) );
+        }
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pucQueueStorage != NULL ) && ( pxStaticQueue != NULL ) )
+        {
+            prvInitialiseNewMpmcQueue( pxQueue,
+                                       pucQueueStorage,
+                                       uxQueueLength,
+                                       uxItemSize,
+                                       mpmcFLAGS_IS_STATICALLY_ALLOCATED );
+            xReturn = ( MpmcQueueHandle_t ) pxQueue;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xMpmcQueueCreateStatic( xReturn );
+
+        return xReturn;
+    }
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vMpmcQueueDelete( MpmcQueueHandle_t xQueue )
+    {
+        MpmcQueue_t * const pxQueue = xQueue;
+
+        traceENTER_vMpmcQueueDelete( xQueue );
+
+        configASSERT( pxQueue );
+        configASSERT( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE );
+        configASSERT( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE );
+
+        if( ( pxQueue->ucFlags & mpmcFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                /* 控制结构和存储区是一次分配的，只需释放一次。 */
+                vPortFree( ( void * ) pxQueue );
+            }
+            #else
+            {
+                /* 不应该走到这里，ucFlags 已被破坏。 */
+                configASSERT( xQueue == ( MpmcQueueHandle_t ) ~0 );
+            }
+            #endif
+        }
+        else
+        {
+            /* 静态内存不能释放，清空结构使之后的误用触发断言。 */
+            ( void ) memset( pxQueue, 0x00, sizeof( MpmcQueue_t ) );
+        }
+
+        traceRETURN_vMpmcQueueDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMpmcQueueSend( MpmcQueueHandle_t xQueue,
+                               const void * const pvItemToQueue,
+                               TickType_t xTicksToWait )
+    {
+        MpmcQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn = errQUEUE_FULL;
+        BaseType_t xTimeOutSet = pdFALSE;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xMpmcQueueSend( xQueue, pvItemToQueue, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvItemToQueue );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            if( prvMpmcTryEnqueue( pxQueue, pvItemToQueue ) != pdFALSE )
+            {
+                prvMpmcWake( &( pxQueue->uxReceiversWaiting ), &( pxQueue->xTasksWaitingToReceive ) );
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+
+            if( xTimeOutSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xTimeOutSet = pdTRUE;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvMpmcBlock( pxQueue, pdTRUE, xTicksToWait );
+        }
+
+        traceRETURN_xMpmcQueueSend( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMpmcQueueSendFromISR( MpmcQueueHandle_t xQueue,
+                                      const void * const pvItemToQueue,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        MpmcQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn;
+
+        traceENTER_xMpmcQueueSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( pvItemToQueue );
+
+        if( prvMpmcTryEnqueue( pxQueue, pvItemToQueue ) != pdFALSE )
+        {
+            prvMpmcWakeFromISR( &( pxQueue->uxReceiversWaiting ), &( pxQueue->xTasksWaitingToReceive ), pxHigherPriorityTaskWoken );
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = errQUEUE_FULL;
+        }
+
+        traceRETURN_xMpmcQueueSendFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMpmcQueueReceive( MpmcQueueHandle_t xQueue,
+                                  void * const pvBuffer,
+                                  TickType_t xTicksToWait )
+    {
+        MpmcQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+        BaseType_t xTimeOutSet = pdFALSE;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xMpmcQueueReceive( xQueue, pvBuffer, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            if( prvMpmcTryDequeue( pxQueue, pvBuffer ) != pdFALSE )
+            {
+                prvMpmcWake( &( pxQueue->uxSendersWaiting ), &( pxQueue->xTasksWaitingToSend ) );
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+
+            if( xTimeOutSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xTimeOutSet = pdTRUE;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvMpmcBlock( pxQueue, pdFALSE, xTicksToWait );
+        }
+
+        traceRETURN_xMpmcQueueReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xMpmcQueueReceiveFromISR( MpmcQueueHandle_t xQueue,
+                                         void * const pvBuffer,
+                                         BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        MpmcQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn;
+
+        traceENTER_xMpmcQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+
+        if( prvMpmcTryDequeue( pxQueue, pvBuffer ) != pdFALSE )
+        {
+            prvMpmcWakeFromISR( &( pxQueue->uxSendersWaiting ), &( pxQueue->xTasksWaitingToSend ), pxHigherPriorityTaskWoken );
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = errQUEUE_EMPTY;
+        }
+
+        traceRETURN_xMpmcQueueReceiveFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxMpmcQueueMessagesWaiting( MpmcQueueHandle_t xQueue )
+    {
+        const MpmcQueue_t * const pxQueue = xQueue;
+        uint32_t ulDequeuePosition;
+        uint32_t ulEnqueuePosition;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxMpmcQueueMessagesWaiting( xQueue );
+
+        configASSERT( pxQueue );
+
+        /* 先读读位置再读写位置，两者之差不会为负；期间可能有读取者前进，
+         * 结果最多按队列长度截断。 */
+        ulDequeuePosition = pxQueue->ulDequeuePosition;
+        portMEMORY_FULL_BARRIER();
+        ulEnqueuePosition = pxQueue->ulEnqueuePosition;
+        uxReturn = ( UBaseType_t ) ( ulEnqueuePosition - ulDequeuePosition );
+
+        if( uxReturn > ( pxQueue->uxMask + ( UBaseType_t ) 1 ) )
+        {
+            uxReturn = pxQueue->uxMask + ( UBaseType_t ) 1;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_uxMpmcQueueMessagesWaiting( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewMpmcQueue( MpmcQueue_t * const pxQueue,
+                                           uint8_t * const pucStorage,
+                                           UBaseType_t uxQueueLength,
+                                           UBaseType_t uxItemSize,
+                                           uint8_t ucFlags )
+    {
+        UBaseType_t ux;
+
+        ( void ) memset( ( void * ) pxQueue, 0x00, sizeof( MpmcQueue_t ) );
+        pxQueue->pulSequence = ( volatile uint32_t * ) pucStorage;
+        pxQueue->pucStorage = pucStorage + ( ( size_t ) uxQueueLength * sizeof( uint32_t ) );
+        pxQueue->uxMask = uxQueueLength - ( UBaseType_t ) 1;
+        pxQueue->uxItemSize = uxItemSize;
+        pxQueue->ucFlags = ucFlags;
+
+        /* 第一轮中位置 n 的槽位空闲，序号等于 n。 */
+        for( ux = 0; ux < uxQueueLength; ux++ )
+        {
+            pxQueue->pulSequence[ ux ] = ( uint32_t ) ux;
+        }
+
+        vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
+        vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+
+        /* 另一个核可能马上开始使用句柄，初始化必须先完成。 */
+        portMEMORY_FULL_BARRIER();
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvMpmcTryEnqueue( MpmcQueue_t * const pxQueue,
+                                         const void * const pvItemToQueue )
+    {
+        uint32_t ulPosition = pxQueue->ulEnqueuePosition;
+        uint32_t ulSequence;
+        int32_t lDifference;
+        BaseType_t xReturn = pdFALSE;
+
+        for( ; ; )
+        {
+            ulSequence = pxQueue->pulSequence[ ulPosition & pxQueue->uxMask ];
+            lDifference = ( int32_t ) ( ulSequence - ulPosition );
+
+            if( lDifference == 0 )
+            {
+                /* 槽位空闲，尝试占用这个写位置。失败说明其它写入者抢先了，用新的写位置重试。 */
+                if( portATOMIC_COMPARE_AND_SWAP_U32( &( pxQueue->ulEnqueuePosition ), ulPosition + 1U, ulPosition ) != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                    break;
+                }
+            }
+            else if( lDifference < 0 )
+            {
+                /* 槽位中还是上一轮的数据项，队列满。 */
+                break;
+            }
+            else
+            {
+                /* 其它写入者已经越过了这个位置。 */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulPosition = pxQueue->ulEnqueuePosition;
+        }
+
+        if( xReturn != pdFALSE )
+        {
+            /* 数据写完后才更新序号发布数据；发布之后才检查等待的读取者，与 prvMpmcBlock()
+             * 中“登记等待者后再检查队列”配对，保证不会漏掉唤醒。 */
+            portMEMORY_FULL_BARRIER();
+            ( void ) memcpy( ( void * ) &( pxQueue->pucStorage[ ( size_t ) ( ulPosition & pxQueue->uxMask ) * pxQueue->uxItemSize ] ),
+                             pvItemToQueue,
+                             ( size_t ) pxQueue->uxItemSize );
+            portMEMORY_FULL_BARRIER();
+            pxQueue->pulSequence[ ulPosition & pxQueue->uxMask ] = ulPosition + 1U;
+            portMEMORY_FULL_BARRIER();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvMpmcTryDequeue( MpmcQueue_t * const pxQueue,
+                                         void * const pvBuffer )
+    {
+        uint32_t ulPosition = pxQueue->ulDequeuePosition;
+        uint32_t ulSequence;
+        int32_t lDifference;
+        BaseType_t xReturn = pdFALSE;
+
+        for( ; ; )
+        {
+            ulSequence = pxQueue->pulSequence[ ulPosition & pxQueue->uxMask ];
+            lDifference = ( int32_t ) ( ulSequence - ( ulPosition + 1U ) );
+
+            if( lDifference == 0 )
+            {
+                /* 数据已发布，尝试占用这个读位置。 */
+                if( portATOMIC_COMPARE_AND_SWAP_U32( &( pxQueue->ulDequeuePosition ), ulPosition + 1U, ulPosition ) != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                    break;
+                }
+            }
+            else if( lDifference < 0 )
+            {
+                /* 这个位置还没有发布数据，队列空。 */
+                break;
+            }
+            else
+            {
+                /* 其它读取者已经越过了这个位置。 */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulPosition = pxQueue->ulDequeuePosition;
+        }
+
+        if( xReturn != pdFALSE )
+        {
+            /* 数据读完后才把槽位交给下一轮的写入者，序号前进一整圈。 */
+            portMEMORY_FULL_BARRIER();
+            ( void ) memcpy( pvBuffer,
+                             ( void * ) &( pxQueue->pucStorage[ ( size_t ) ( ulPosition & pxQueue->uxMask ) * pxQueue->uxItemSize ] ),
+                             ( size_t ) pxQueue->uxItemSize );
+            portMEMORY_FULL_BARRIER();
+            pxQueue->pulSequence[ ulPosition & pxQueue->uxMask ] = ulPosition + ( uint32_t ) pxQueue->uxMask + 1U;
+            portMEMORY_FULL_BARRIER();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMpmcBlock( MpmcQueue_t * const pxQueue,
+                              BaseType_t xWaitToSend,
+                              TickType_t xTicksToWait )
+    {
+        volatile UBaseType_t * const puxWaiting = ( xWaitToSend != pdFALSE ) ? &( pxQueue->uxSendersWaiting ) : &( pxQueue->uxReceiversWaiting );
+        BaseType_t xShouldBlock;
+        BaseType_t xAlreadyYielded;
+
+        /* 与 ulTaskGenericNotifyTake() 相同：挂起调度器，在临界区内原子地检查条件并挂到事件列表上。 */
+        vTaskSuspendAll();
+        {
+            taskENTER_CRITICAL();
+            {
+                /* 先登记等待者再检查队列。对方发布数据或释放槽位之后才读取等待者计数，
+                 * 两边之间都有完整内存屏障，因此至少有一方能看到另一方的修改。 */
+                ( *puxWaiting )++;
+                portMEMORY_FULL_BARRIER();
+
+                if( xWaitToSend != pdFALSE )
+                {
+                    xShouldBlock = prvMpmcIsFull( pxQueue, pxQueue->ulEnqueuePosition );
+                }
+                else
+                {
+                    xShouldBlock = prvMpmcIsEmpty( pxQueue, pxQueue->ulDequeuePosition );
+                }
+
+                if( xShouldBlock != pdFALSE )
+                {
+                    vTaskPlaceOnEventList( ( xWaitToSend != pdFALSE ) ? &( pxQueue->xTasksWaitingToSend ) : &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            ( *puxWaiting )--;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMpmcWake( volatile UBaseType_t * const puxWaiting,
+                             List_t * const pxEventList )
+    {
+        /* 没有等待者是常见情况，不进入临界区。 */
+        if( *puxWaiting != ( UBaseType_t ) 0 )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+                    {
+                        mpmcYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMpmcWakeFromISR( volatile UBaseType_t * const puxWaiting,
+                                    List_t * const pxEventList,
+                                    BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        if( *puxWaiting != ( UBaseType_t ) 0 )
+        {
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+                {
+                    if( ( xTaskRemoveFromEventList( pxEventList ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_MPMC_QUEUES */
@@ -0,0 +1,262 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+/*
+ * 多生产者/多消费者（MPMC）无锁队列，面向 SMP 构建中多个核并行收发的定长数据通道。
+ *
+ * 普通队列的每次收发都要进入 taskENTER_CRITICAL()，在 SMP 上就是获取全局的任务锁和
+ * 中断锁，即使各核操作的是互不相关的队列也会串行化。MPMC 队列为每个槽位保存一个序号
+ * （Vyukov 有界队列）：写入者用一次比较交换占用写位置，复制数据后更新该槽位的序号发布数据；
+ * 读取者同样用一次比较交换占用读位置。队列既不满也不空时收发都不进入临界区。
+ *
+ * 队列满或空需要阻塞时，仍与普通队列一样通过 vTaskPlaceOnEventList() 挂到队列的事件列表上，
+ * 按优先级排队、支持超时；对方发布数据或释放槽位后，只有存在等待者时才进入临界区唤醒。
+ *
+ * 队列长度必须是 2 的幂且不小于 2（长度为 1 时“已发布”和“下一轮空闲”的序号相同，无法区分）。SMP 移植层必须在 portmacro.h 中用硬件原子指令提供
+ * portATOMIC_COMPARE_AND_SWAP_U32() 和 portMEMORY_FULL_BARRIER()；单核上默认使用 atomic.h
+ * 和编译器屏障。
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include mpmc_queue.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * 引用 MPMC 队列的句柄类型。
+ */
+struct MpmcQueueDef_t;
+typedef struct MpmcQueueDef_t * MpmcQueueHandle_t;
+
+/**
+ * 静态创建时存储区需要的字节数：每个槽位一个 32 位序号，后面是数据项。
+ * 存储区必须按 4 字节对齐。
+ */
+#define mpmcQUEUE_STORAGE_BYTES( uxQueueLength, uxItemSize ) \
+    ( ( size_t ) ( uxQueueLength ) * ( sizeof( uint32_t ) + ( size_t ) ( uxItemSize ) ) )
+
+/**
+ * mpmc_queue.h
+ *
+ * @code{c}
+ * MpmcQueueHandle_t xMpmcQueueCreate( UBaseType_t uxQueueLength, UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_MPMC_QUEUES 和 configSUPPORT_DYNAMIC_ALLOCATION
+ * 定义为 1，此函数才会生效。
+ *
+ * 创建一个 MPMC 队列。控制结构、序号数组和存储区通过一次 pvPortMalloc() 分配。
+ *
+ * @param uxQueueLength 队列最多能同时存放的数据项数，必须是不小于 2 的 2 的幂。
+ *
+ * @param uxItemSize 每个数据项的字节数，必须大于 0。
+ *
+ * @return 创建成功返回队列句柄，内存不足返回 NULL。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vAFunction( void )
+ * {
+ *     MpmcQueueHandle_t xWorkQueue;
+ *
+ *     xWorkQueue = xMpmcQueueCreate( 64, sizeof( WorkItem_t ) );
+ *
+ *     if( xWorkQueue != NULL )
+ *     {
+ *         // 队列创建成功，各核上的任务都可以用 xMpmcQueueSend()/xMpmcQueueReceive() 收发。
+ *     }
+ * }
+ * @endcode
+ * \defgroup xMpmcQueueCreate xMpmcQueueCreate
+ * \ingroup MpmcQueueManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    MpmcQueueHandle_t xMpmcQueueCreate( UBaseType_t uxQueueLength,
+                                        UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * mpmc_queue.h
+ *
+ * @code{c}
+ * MpmcQueueHandle_t xMpmcQueueCreateStatic( UBaseType_t uxQueueLength,
+ *                                           UBaseType_t uxItemSize,
+ *                                           uint8_t * pucQueueStorage,
+ *                                           StaticMpmcQueue_t * pxStaticQueue );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_MPMC_QUEUES 和 configSUPPORT_STATIC_ALLOCATION
+ * 定义为 1，此函数才会生效。
+ *
+ * 使用调用者提供的内存创建 MPMC 队列。
+ *
+ * @param uxQueueLength 队列最多能同时存放的数据项数，必须是不小于 2 的 2 的幂。
+ *
+ * @param uxItemSize 每个数据项的字节数，必须大于 0。
+ *
+ * @param pucQueueStorage 按 4 字节对齐的存储区，至少 mpmcQUEUE_STORAGE_BYTES( uxQueueLength, uxItemSize ) 字节。
+ *
+ * @param pxStaticQueue 用来保存队列控制结构的 StaticMpmcQueue_t 变量。
+ *
+ * @return 参数都不为 NULL 时返回队列句柄，否则返回 NULL。
+ *
+ * \defgroup xMpmcQueueCreateStatic xMpmcQueueCreateStatic
+ * \ingroup MpmcQueueManagement
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    MpmcQueueHandle_t xMpmcQueueCreateStatic( UBaseType_t uxQueueLength,
+                                              UBaseType_t uxItemSize,
+                                              uint8_t * const pucQueueStorage,
+                                              StaticMpmcQueue_t * const pxStaticQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * mpmc_queue.h
+ *
+ * @code{c}
+ * void vMpmcQueueDelete( MpmcQueueHandle_t xQueue );
+ * @endcode
+ *
+ * 删除 MPMC 队列。删除时不能有任务阻塞在该队列上，也不能有其它核正在收发。
+ *
+ * @param xQueue 要删除的队列句柄。
+ *
+ * \defgroup vMpmcQueueDelete vMpmcQueueDelete
+ * \ingroup MpmcQueueManagement
+ */
+void vMpmcQueueDelete( MpmcQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * mpmc_queue.h
+ *
+ * @code{c}
+ * BaseType_t xMpmcQueueSend( MpmcQueueHandle_t xQueue, const void * pvItemToQueue, TickType_t xTicksToWait );
+ * BaseType_t xMpmcQueueSendFromISR( MpmcQueueHandle_t xQueue, const void * pvItemToQueue, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * 把一个数据项复制到队尾，任意任务或中断都可以调用。队列未满时不进入临界区，
+ * 只有存在等待数据的任务时才进入临界区唤醒其中优先级最高的一个。
+ *
+ * @param xQueue 目标队列句柄。
+ *
+ * @param pvItemToQueue 指向待发送的数据项，复制 uxItemSize 字节。
+ *
+ * @param xTicksToWait 队列满时的最大阻塞节拍数，规则与 xQueueSend() 相同。
+ *
+ * @param pxHigherPriorityTaskWoken 发送唤醒了比当前任务优先级更高的任务时被设为 pdTRUE。可以为 NULL。
+ *
+ * @return 发送成功返回 pdPASS，队列满（或超时）返回 errQUEUE_FULL。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vDispatcherTask( void * pvParameters )
+ * {
+ *     WorkItem_t xItem;
+ *
+ *     for( ; ; )
+ *     {
+ *         vNextWorkItem( &xItem );
+ *         ( void ) xMpmcQueueSend( xWorkQueue, &xItem, portMAX_DELAY );
+ *     }
+ * }
+ * @endcode
+ * \defgroup xMpmcQueueSend xMpmcQueueSend
+ * \ingroup MpmcQueueManagement
+ */
+BaseType_t xMpmcQueueSend( MpmcQueueHandle_t xQueue,
+                           const void * const pvItemToQueue,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xMpmcQueueSendFromISR( MpmcQueueHandle_t xQueue,
+                                  const void * const pvItemToQueue,
+                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * mpmc_queue.h
+ *
+ * @code{c}
+ * BaseType_t xMpmcQueueReceive( MpmcQueueHandle_t xQueue, void * pvBuffer, TickType_t xTicksToWait );
+ * BaseType_t xMpmcQueueReceiveFromISR( MpmcQueueHandle_t xQueue, void * pvBuffer, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * 从队首取出一个数据项复制到 pvBuffer，任意任务或中断都可以调用。队列非空时不进入临界区，
+ * 只有存在等待空闲槽位的任务时才进入临界区唤醒其中优先级最高的一个。
+ *
+ * @param xQueue 目标队列句柄。
+ *
+ * @param pvBuffer 接收缓冲区，至少 uxItemSize 字节。
+ *
+ * @param xTicksToWait 队列空时的最大阻塞节拍数，规则与 xQueueReceive() 相同。
+ *
+ * @param pxHigherPriorityTaskWoken 接收唤醒了比当前任务优先级更高的任务时被设为 pdTRUE。可以为 NULL。
+ *
+ * @return 接收成功返回 pdPASS，队列空（或超时）返回 errQUEUE_EMPTY。
+ *
+ * \defgroup xMpmcQueueReceive xMpmcQueueReceive
+ * \ingroup MpmcQueueManagement
+ */
+BaseType_t xMpmcQueueReceive( MpmcQueueHandle_t xQueue,
+                              void * const pvBuffer,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xMpmcQueueReceiveFromISR( MpmcQueueHandle_t xQueue,
+                                     void * const pvBuffer,
+                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * mpmc_queue.h
+ *
+ * @code{c}
+ * UBaseType_t uxMpmcQueueMessagesWaiting( MpmcQueueHandle_t xQueue );
+ * @endcode
+ *
+ * 返回队列中已被占用的槽位数（包括正在写入、尚未发布的数据项），只是调用时刻的快照。
+ *
+ * @param xQueue 要查询的队列句柄。
+ *
+ * @return 队列中的数据项数。
+ *
+ * \defgroup uxMpmcQueueMessagesWaiting uxMpmcQueueMessagesWaiting
+ * \ingroup MpmcQueueManagement
+ */
+UBaseType_t uxMpmcQueueMessagesWaiting( MpmcQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( MPMC_QUEUE_H ) */
@@ -76,10 +76,29 @@ typedef struct SemaphoreData
     UBaseType_t uxRecursiveCallCount; /**< 当结构体用作递归互斥锁时，记录递归"获取"互斥锁的次数。 */
 } SemaphoreData_t;
 
+#if ( configUSE_QUEUE_FIXED_SIZE_COPY == 1 )
+
+/* 复制一个数据项的函数，由 prvInitialiseNewQueue() 按数据项大小选定后存入 Queue_t。 */
+    typedef void ( * QueueCopyItemFunction_t )( void * pvDestination,
+                                                const void * pvSource,
+                                                UBaseType_t uxItemSize );
+#endif
+
 /* 信号量实际上不存储或复制数据，因此其项大小为0。 */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH    ( ( UBaseType_t ) 0 )  // 信号量的队列项大小（0，因无需存储数据）
 #define queueMUTEX_GIVE_BLOCK_TIME          ( ( TickType_t ) 0U )  // 释放互斥锁时的阻塞时间（0，即非阻塞）
 
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+
+/* uxCeilingPriority 取该值表示不是优先级天花板互斥量（普通队列、信号量和使用优先级继承的互斥量）。 */
+    #define queueNO_PRIORITY_CEILING    ( ~( ( UBaseType_t ) 0U ) )
+
+/* 是否为优先级天花板互斥量。未启用时恒为假，调用处不必再加条件编译。 */
+    #define queueIS_CEILING_MUTEX( pxQueue )    ( ( pxQueue )->uxCeilingPriority != queueNO_PRIORITY_CEILING )
+#else
+    #define queueIS_CEILING_MUTEX( pxQueue )    ( pdFALSE )
+#endif
+
 #if ( configUSE_PREEMPTION == 0 )
 
 /* 若使用协作式调度器，则不应仅因高优先级任务被唤醒而执行任务切换。 */
@@ -132,6 +151,22 @@ typedef struct QueueDefinition /* 使用旧命名约定是为了避免破坏内
         UBaseType_t uxQueueNumber; /**< 用于跟踪的队列编号。 */
         uint8_t ucQueueType;       /**< 标识队列类型（如普通队列、互斥锁等）。 */
     #endif
+
+    #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+        uint8_t ucZeroCopyState; /**< 零拷贝接口的状态：是否有未提交的发送预留、是否有未释放的接收占用。 */
+    #endif
+
+    #if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+        UBaseType_t uxCeilingPriority; /**< 优先级天花板互斥量的天花板优先级，其它队列为 queueNO_PRIORITY_CEILING。 */
+    #endif
+
+    #if ( configUSE_QUEUE_FIXED_SIZE_COPY == 1 )
+        QueueCopyItemFunction_t pxCopyItem; /**< 复制数据项的函数，复制长度在函数内是编译期常量（其它大小调用 memcpy()）。 */
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xSpinlock; /**< 队列自身的自旋锁，保护队列数据及对事件列表的检查。 */
+    #endif
 } xQUEUE;
 
 /* 上面保留了旧的xQUEUE名称，然后在下面将其重定义为新的Queue_t名称，
@@ -185,11 +220,31 @@ static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * 使用临界区判断队列中是否有空间。
+ * 使用临界区判断队列中是否有空间以 xPosition 方式发送一个项目。
  *
  * @return 如果队列已满则返回 pdTRUE，否则返回 pdFALSE。
  */
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsQueueFull( const Queue_t * pxQueue,
+                                  const BaseType_t xPosition ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+/*
+ * 队列数据临界区的细粒度锁实现，见 queueENTER_CRITICAL()。
+ */
+    static void prvQueueEnterCritical( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static void prvQueueExitCritical( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static UBaseType_t prvQueueEnterCriticalFromISR( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static void prvQueueExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus,
+                                             const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * 在队列临界区内把事件列表中优先级最高的任务移出，返回值与 xTaskRemoveFromEventList() 相同。
+ * 节拍中断只持有内核中断锁就会把超时的任务移出事件列表，所以获取中断锁后要重新检查列表是否为空。
+ */
+    static BaseType_t prvQueueRemoveFromEventList( List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_GRANULAR_LOCKS */
 
 /*
  * 将一个项目复制到队列中，可选择复制到队列头部或队列尾部。
@@ -206,6 +261,116 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,  // 目标队列的
                                   void * const pvBuffer )   // 存储出队项目的缓冲区指针
                                   PRIVILEGED_FUNCTION;      // 标记为特权函数，仅内核可调用
 
+#if ( configUSE_QUEUE_BATCH == 1 )
+
+/*
+ * 把 uxCount 个连续存放的项目复制到队列尾部（最多两次 memcpy，处理环形缓冲区回卷），
+ * 以及从队首复制 uxCount 个项目到连续的缓冲区。调用者保证空间或数据足够。
+ */
+    static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                        const void * pvItemsToQueue,
+                                        const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+    static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                          void * const pvBuffer,
+                                          const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * 从 pxEventList 中最多移除 uxMaxTasks 个任务（一批数据项最多能满足这么多等待者）。
+ * 必须在临界区内调用。
+ *
+ * @return 如果移除的任务中有优先级高于当前任务的，返回 pdTRUE。
+ */
+    static BaseType_t prvUnblockEventListTasks( List_t * const pxEventList,
+                                                UBaseType_t uxMaxTasks ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+
+/*
+ * 与阻塞在 pxEventList 头部、登记了缓冲区的任务直接交换一个数据项，不经过队列存储区：
+ * xCopyToWaiter 为 pdTRUE 时把 pvItem 复制到对方的缓冲区（发送），否则从对方的缓冲区复制到 pvItem
+ * （从会合队列接收）。完成后对方被唤醒，*pxYieldRequired 为 xTaskRemoveFromEventList() 的返回值。
+ * 必须在队列临界区内调用。
+ *
+ * @return 完成交换时返回 pdTRUE；链表为空或头部的任务没有登记缓冲区时返回 pdFALSE，不修改任何状态。
+ */
+    static BaseType_t prvQueueHandOff( const Queue_t * const pxQueue,
+                                       List_t * const pxEventList,
+                                       void * const pvItem,
+                                       const BaseType_t xCopyToWaiter,
+                                       BaseType_t * const pxYieldRequired ) PRIVILEGED_FUNCTION;
+
+/*
+ * pxEventList 头部的任务是否登记了缓冲区，即此时调用 prvQueueHandOff() 能否成功。
+ */
+    static BaseType_t prvQueueHasHandOffWaiter( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_QUEUE_FIXED_SIZE_COPY == 1 )
+
+/*
+ * 按数据项大小复制一个数据项。1、2、4、8、16 字节各有一个复制函数，memcpy() 的长度是常量，
+ * 编译器把它展开成一两条读写指令（用户缓冲区未对齐时也能正确处理）；其它大小调用 memcpy()。
+ * 所有函数的参数相同，以便通过 Queue_t 的 pxCopyItem 调用，常量长度的函数忽略 uxItemSize。
+ */
+    static void prvCopyItem1( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+    static void prvCopyItem2( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+    static void prvCopyItem4( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+    static void prvCopyItem8( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+    static void prvCopyItem16( void * pvDestination,
+                               const void * pvSource,
+                               UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+    static void prvCopyItemAnySize( void * pvDestination,
+                                    const void * pvSource,
+                                    UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * 创建队列时调用一次，返回与 uxItemSize 对应的复制函数。
+ */
+    static QueueCopyItemFunction_t prvSelectCopyItem( UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_SEMAPHORE_FAST_PATH == 1 )
+
+/*
+ * 信号量和互斥量没有竞争时的获取和释放：用比较交换修改 uxMessagesWaiting（互斥量还有 xMutexHolder），
+ * 不进入临界区。只有发现队列被锁定或事件列表上有任务时，才调用 prvSemaphoreWakeWaiter()。
+ *
+ * @return 完成获取或释放时返回 pdTRUE；信号量不可用、已满或需要走完整路径时返回 pdFALSE，不修改任何状态。
+ */
+    static BaseType_t prvSemaphoreTakeFast( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvSemaphoreGiveFast( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * 在临界区外修改计数之后，对方可能已经锁定队列准备阻塞，或者已经阻塞在事件列表上。
+ * 在临界区内按中断中收发的方式处理：队列被锁定时记入 cTxLock/cRxLock，由 prvUnlockQueue() 唤醒，
+ * 否则直接唤醒 xGiven 对应一侧优先级最高的任务。xDisinherit 为 pdTRUE 时同时恢复当前任务的优先级。
+ */
+    static void prvSemaphoreWakeWaiter( Queue_t * const pxQueue,
+                                        const BaseType_t xGiven,
+                                        const BaseType_t xDisinherit ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+
+/*
+ * 互斥量被其它核心上正在运行的任务持有时，带指数退避地自旋等待它释放。每次等待消耗
+ * *puxSpinsLeft 中的一次，同一次 xQueueSemaphoreTake() 调用中多次自旋共用这个预算。
+ *
+ * @return 互斥量已经释放时返回 pdTRUE；持有者不在其它核心上运行或预算用完时返回 pdFALSE，调用方应阻塞。
+ */
+    static BaseType_t prvMutexSpinWait( const Queue_t * const pxQueue,
+                                        UBaseType_t * const puxSpinsLeft ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )  // 仅当启用队列集功能时，编译以下代码
 
 /*
@@ -246,11 +411,38 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
 #endif
 /*-----------------------------------------------------------*/
 
+/*
+ * 保护队列数据的临界区。configUSE_GRANULAR_LOCKS == 1 时普通队列和信号量只获取队列自身的自旋锁，
+ * 互斥量的优先级继承会修改就绪列表，仍然使用内核的全局临界区；否则与 taskENTER_CRITICAL() 等相同。
+ * 临界区内唤醒阻塞任务统一使用 queueREMOVE_FROM_EVENT_LIST()。
+ */
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    #define queueSPINLOCK( pxQueue )                                         ( ( portSPINLOCK_TYPE * ) &( ( pxQueue )->xSpinlock ) )
+    #define queueENTER_CRITICAL( pxQueue )                                   prvQueueEnterCritical( pxQueue )
+    #define queueEXIT_CRITICAL( pxQueue )                                    prvQueueExitCritical( pxQueue )
+    #define queueENTER_CRITICAL_FROM_ISR( pxQueue )                          prvQueueEnterCriticalFromISR( pxQueue )
+    #define queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue )   prvQueueExitCriticalFromISR( uxSavedInterruptStatus, pxQueue )
+    #define queueREMOVE_FROM_EVENT_LIST( pxEventList )                       prvQueueRemoveFromEventList( pxEventList )
+#else
+    #define queueENTER_CRITICAL( pxQueue )                                   taskENTER_CRITICAL()
+    #define queueEXIT_CRITICAL( pxQueue )                                    taskEXIT_CRITICAL()
+    #define queueENTER_CRITICAL_FROM_ISR( pxQueue )                          taskENTER_CRITICAL_FROM_ISR()
+    #define queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue )   taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus )
+    #define queueREMOVE_FROM_EVENT_LIST( pxEventList )                       xTaskRemoveFromEventList( pxEventList )
+#endif /* configUSE_GRANULAR_LOCKS */
+
 /*
  * 用于将队列标记为锁定状态的宏。锁定队列可防止中断服务程序（ISR）
  * 访问队列的事件列表（即阻塞任务列表）。
  */
-#define prvLockQueue( pxQueue )                            \
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+/* 细粒度锁模式下，锁定期间一直持有队列的临界区，由 prvUnlockQueue() 退出。
+ * 其他核心上的收发方无法插在"检查队列状态"与"任务进入事件列表"之间，
+ * 中断也就不需要借助 cTxLock/cRxLock 推迟事件列表的操作，两者始终保持 queueUNLOCKED。 */
+    #define prvLockQueue( pxQueue )    queueENTER_CRITICAL( pxQueue )
+#else
+    #define prvLockQueue( pxQueue )                            \
     taskENTER_CRITICAL();                                  \
     {                                                      \
         if( ( pxQueue )->cRxLock == queueUNLOCKED )        \
@@ -263,6 +455,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
         }                                                  \
     }                                                      \
     taskEXIT_CRITICAL()
+#endif /* configUSE_GRANULAR_LOCKS */
 
 /*
  * 用于增加队列数据结构中 cTxLock 成员（发送锁定计数）的宏。
@@ -271,14 +464,14 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
  */
 #define prvIncrementQueueTxLock( pxQueue, cTxLock )                           \
     do {                                                                      \
-        // 获取当前系统中已创建的任务总数（UBaseType_t 为无符号基础类型，用于计数）
+        /* 获取当前系统中已创建的任务总数（UBaseType_t 为无符号基础类型，用于计数） */ \
         const UBaseType_t uxNumberOfTasks = uxTaskGetNumberOfTasks();         \
-        // 判断当前锁定计数（cTxLock）是否小于系统任务总数
+        /* 判断当前锁定计数（cTxLock）是否小于系统任务总数 */ \
         if( ( UBaseType_t ) ( cTxLock ) < uxNumberOfTasks )                   \
         {                                                                     \
-            // 断言检查：确保当前锁定计数未达到 int8_t 类型的最大值（避免溢出）
+            /* 断言检查：确保当前锁定计数未达到 int8_t 类型的最大值（避免溢出） */ \
             configASSERT( ( cTxLock ) != queueINT8_MAX );                     \
-            // 锁定计数加 1：将 cTxLock 转换为 int8_t 类型后加 1，再赋值给队列的 cTxLock 成员
+            /* 锁定计数加 1：将 cTxLock 转换为 int8_t 类型后加 1，再赋值给队列的 cTxLock 成员 */ \
             ( pxQueue )->cTxLock = ( int8_t ) ( ( cTxLock ) + ( int8_t ) 1 ); \
         }                                                                     \
     } while( 0 )  // do-while(0) 结构确保宏在任何调用场景下都能正确展开（如单独一行、带分号等）
@@ -297,6 +490,96 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
             ( pxQueue )->cRxLock = ( int8_t ) ( ( cRxLock ) + ( int8_t ) 1 ); \
         }                                                                     \
     } while( 0 )
+
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/* ucZeroCopyState 的位：有未提交的 pvQueueReserveSend() 预留 / 有未释放的 pvQueueAcquireReceive() 数据项。 */
+    #define queueZERO_COPY_SEND_RESERVED       ( ( uint8_t ) 0x01U )
+    #define queueZERO_COPY_RECEIVE_ACQUIRED    ( ( uint8_t ) 0x02U )
+
+/* 被预留或被占用的槽既不算消息也不算空闲，最多 2 个。 */
+    #define prvZeroCopyHeldSlots( pxQueue )                                                                           \
+    ( ( UBaseType_t ) ( ( ( ( pxQueue )->ucZeroCopyState & queueZERO_COPY_SEND_RESERVED ) != 0U ) ? 1U : 0U ) +      \
+      ( UBaseType_t ) ( ( ( ( pxQueue )->ucZeroCopyState & queueZERO_COPY_RECEIVE_ACQUIRED ) != 0U ) ? 1U : 0U ) )
+
+/*
+ * 是否可以按 xPosition 发送一个项目：
+ * - 发送预留的槽就是 pcWriteTo，提交前其它发往队尾的项目不能写入；
+ * - 接收占用的槽就是 pcReadFrom，发往队首的项目会写在这里，因此占用期间不能发往队首；
+ * - 覆盖模式写的也是 pcReadFrom（队列长度为 1），只在没有任何预留和占用时允许。
+ */
+    #define prvQueueHasSpace( pxQueue, xPosition )                                                                     \
+    ( ( ( xPosition ) == queueOVERWRITE ) ?                                                                            \
+      ( ( pxQueue )->ucZeroCopyState == 0U ) :                                                                         \
+      ( ( ( ( pxQueue )->uxMessagesWaiting + prvZeroCopyHeldSlots( pxQueue ) ) < ( pxQueue )->uxLength ) &&           \
+        ( ( ( pxQueue )->ucZeroCopyState &                                                                             \
+            ( ( ( xPosition ) == queueSEND_TO_BACK ) ? queueZERO_COPY_SEND_RESERVED : queueZERO_COPY_RECEIVE_ACQUIRED ) ) == 0U ) ) )
+
+/* 占用期间不允许再接收：否则先释放的槽可能让发送方写到仍被占用的槽上。 */
+    #define prvQueueHasData( pxQueue ) \
+    ( ( ( pxQueue )->uxMessagesWaiting > ( UBaseType_t ) 0 ) && ( ( ( pxQueue )->ucZeroCopyState & queueZERO_COPY_RECEIVE_ACQUIRED ) == 0U ) )
+
+#else /* configUSE_QUEUE_ZERO_COPY */
+
+    #define prvZeroCopyHeldSlots( pxQueue )           ( ( UBaseType_t ) 0U )
+    #define prvQueueHasSpace( pxQueue, xPosition )    ( ( ( pxQueue )->uxMessagesWaiting < ( pxQueue )->uxLength ) || ( ( xPosition ) == queueOVERWRITE ) )
+    #define prvQueueHasData( pxQueue )                ( ( pxQueue )->uxMessagesWaiting > ( UBaseType_t ) 0 )
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+
+/* 长度为 0 的会合队列没有存储区，数据项总是在收发双方之间直接复制，因此项目大小不能为 0。 */
+    #define queueLENGTH_IS_VALID( uxQueueLength, uxItemSize )    ( ( ( uxQueueLength ) > ( UBaseType_t ) 0 ) || ( ( uxItemSize ) > ( UBaseType_t ) 0 ) )
+
+/* 只有存储区中没有任何数据项（包括零拷贝接口预留或占用的槽）时才能把新数据项直接交给接收方，
+ * 否则接收方会越过排在前面的数据项。 */
+    #define prvQueueCanHandOff( pxQueue ) \
+    ( ( ( pxQueue )->uxMessagesWaiting == ( UBaseType_t ) 0 ) && ( prvZeroCopyHeldSlots( pxQueue ) == ( UBaseType_t ) 0 ) )
+#else
+    #define queueLENGTH_IS_VALID( uxQueueLength, uxItemSize )    ( ( uxQueueLength ) > ( UBaseType_t ) 0 )
+#endif /* configUSE_QUEUE_HANDOFF */
+
+#if ( configUSE_QUEUE_FIXED_SIZE_COPY == 1 )
+
+/* 复制一个数据项：调用创建队列时按数据项大小选定的复制函数，收发时不再按大小分支。 */
+    #define queueCOPY_ITEM( pxQueue, pvDestination, pvSource )    ( pxQueue )->pxCopyItem( ( pvDestination ), ( pvSource ), ( pxQueue )->uxItemSize )
+#else
+    #define queueCOPY_ITEM( pxQueue, pvDestination, pvSource )    ( void ) memcpy( ( pvDestination ), ( pvSource ), ( size_t ) ( pxQueue )->uxItemSize )
+#endif /* configUSE_QUEUE_FIXED_SIZE_COPY */
+
+#if ( configUSE_SEMAPHORE_FAST_PATH == 1 )
+
+/*
+ * 信号量计数和互斥量持有者的比较交换，*pxDestination 等于 xComparand 时写入 xExchange 并返回 pdTRUE。
+ * 移植层没有提供时使用 atomic.h，它按 32 位操作，要求 UBaseType_t 和指针都是 32 位。
+ * 比较交换必须与中断中的收发互斥，因此不能用普通的读写代替。
+ */
+    #if !defined( portATOMIC_COMPARE_AND_SWAP_UBASE ) || !defined( portATOMIC_COMPARE_AND_SWAP_POINTER )
+        #include "atomic.h"
+    #endif
+
+    #ifndef portATOMIC_COMPARE_AND_SWAP_UBASE
+        #define portATOMIC_COMPARE_AND_SWAP_UBASE( puxDestination, uxExchange, uxComparand ) \
+    ( ( Atomic_CompareAndSwap_u32( ( uint32_t volatile * ) ( puxDestination ), ( uint32_t ) ( uxExchange ), ( uint32_t ) ( uxComparand ) ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS ) ? pdTRUE : pdFALSE )
+    #endif
+
+    #ifndef portATOMIC_COMPARE_AND_SWAP_POINTER
+        #define portATOMIC_COMPARE_AND_SWAP_POINTER( ppvDestination, pvExchange, pvComparand ) \
+    ( ( Atomic_CompareAndSwapPointers_p32( ( void * volatile * ) ( ppvDestination ), ( void * ) ( pvExchange ), ( void * ) ( pvComparand ) ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS ) ? pdTRUE : pdFALSE )
+    #endif
+#endif /* configUSE_SEMAPHORE_FAST_PATH */
+
+#if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+
+/* 自旋等待中每次轮询之间最多执行的等待次数。 */
+    #define queueMUTEX_SPIN_MAX_BACKOFF    ( ( UBaseType_t ) 64 )
+
+/* 自旋等待时执行的指令，告诉处理器当前在忙等待（例如 ARM 的 YIELD、x86 的 PAUSE）。 */
+    #ifndef portSPIN_WAIT_HINT
+        #define portSPIN_WAIT_HINT()    portNOP()
+    #endif
+#endif /* configUSE_ADAPTIVE_MUTEXES */
 /*-----------------------------------------------------------*/
 
 // 通用队列重置函数：将队列恢复到初始状态（清空数据、重置指针、处理阻塞任务）
@@ -315,14 +598,14 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,  // 待重置的队列句
 
     // 合法性校验：满足以下条件才执行重置操作
     if( ( pxQueue != NULL ) &&  // 1. 队列句柄有效
-        ( pxQueue->uxLength >= 1U ) &&  // 2. 队列容量≥1（有效队列）
+        ( queueLENGTH_IS_VALID( pxQueue->uxLength, pxQueue->uxItemSize ) ) &&  // 2. 队列容量≥1（有效队列），或会合队列
         /* 3. 检查“队列容量 × 项目大小”是否溢出：
            SIZE_MAX是系统最大可表示的字节数，若 SIZE_MAX / 容量 ≥ 项目大小，
            则容量×项目大小 ≤ SIZE_MAX，无溢出风险 */
-        ( ( SIZE_MAX / pxQueue->uxLength ) >= pxQueue->uxItemSize ) )
+        ( ( pxQueue->uxLength == 0U ) || ( ( SIZE_MAX / pxQueue->uxLength ) >= pxQueue->uxItemSize ) ) )
     {
         // 进入临界区：禁止中断和任务切换，确保重置操作的原子性（避免多任务/中断干扰）
-        taskENTER_CRITICAL();
+        queueENTER_CRITICAL( pxQueue );
         {
             // 1. 初始化队列存储区末尾指针（pcTail）：指向存储区最后一个字节的下一位（环形缓冲区结束标记）
             pxQueue->u.xQueue.pcTail = pxQueue->pcHead + ( pxQueue->uxLength * pxQueue->uxItemSize );
@@ -334,12 +617,27 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,  // 待重置的队列句
             pxQueue->pcWriteTo = pxQueue->pcHead;
             
             // 4. 重置读取指针：初始读取位置为“存储区末尾前一个项目”（环形缓冲区特性，确保首次读取从pcHead开始）
-            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( pxQueue->uxLength - 1U ) * pxQueue->uxItemSize );
+            if( pxQueue->uxLength > 0U )
+            {
+                pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( pxQueue->uxLength - 1U ) * pxQueue->uxItemSize );
+            }
+            else
+            {
+                /* 会合队列没有存储区，读写指针不会被使用。 */
+                pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+            }
             
             // 5. 重置队列锁定状态：接收和发送方向均设为“未锁定”（queueUNLOCKED = -1）
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_QUEUE_ZERO_COPY == 1 )
+            {
+                /* 重置后原来预留或占用的槽都不再有效。 */
+                pxQueue->ucZeroCopyState = 0U;
+            }
+            #endif
+
             // 分支1：已有队列重置（xNewQueue = pdFALSE）——用于清空已有队列，保留阻塞任务列表逻辑
             if( xNewQueue == pdFALSE )
             {
@@ -349,7 +647,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,  // 待重置的队列句
                 if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
                     // 从“等待发送”列表中移除一个最高优先级任务（唤醒任务）
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                     {
                         // 若唤醒的任务优先级高于当前任务，触发任务切换（抢占式调度器生效）
                         queueYIELD_IF_USING_PREEMPTION();
@@ -373,7 +671,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,  // 待重置的队列句
             }
         }
         // 退出临界区：恢复中断和任务切换
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( pxQueue );
     }
     // 合法性校验失败（如队列无效、容量为0、内存溢出风险），返回失败
     else
@@ -410,13 +708,13 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,  // 待重置的队列句
         configASSERT( pxStaticQueue );  // 断言：确保pxStaticQueue非空（控制结构不可缺）
 
         // 合法性检查：满足以下所有条件才继续初始化
-        if( ( uxQueueLength > ( UBaseType_t ) 0 ) &&  // 1. 队列容量必须大于0（至少能存1个项目）
+        if( ( queueLENGTH_IS_VALID( uxQueueLength, uxItemSize ) ) &&  // 1. 队列容量必须大于0（至少能存1个项目），会合队列除外
             ( pxStaticQueue != NULL ) &&               // 2. 控制结构存储区非空
             /* 3. 数据存储区的合法性：
                - 若项目大小（uxItemSize）不为0（需存储数据），则pucQueueStorage必须非空；
-               - 若项目大小为0（无需存储数据，如信号量），则pucQueueStorage必须为空 */
-            ( !( ( pucQueueStorage != NULL ) && ( uxItemSize == 0U ) ) ) &&
-            ( !( ( pucQueueStorage == NULL ) && ( uxItemSize != 0U ) ) ) )
+               - 若项目大小为0（无需存储数据，如信号量）或队列长度为0（会合队列），则pucQueueStorage必须为空 */
+            ( !( ( pucQueueStorage != NULL ) && ( ( uxItemSize == 0U ) || ( uxQueueLength == 0U ) ) ) ) &&
+            ( !( ( pucQueueStorage == NULL ) && ( uxItemSize != 0U ) && ( uxQueueLength != 0U ) ) ) )
         {
             #if ( configASSERT_DEFINED == 1 )  // 若启用断言功能，执行额外的合法性检查
             {
@@ -549,9 +847,9 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,  // 待重置的队列句
         traceENTER_xQueueGenericCreate( uxQueueLength, uxItemSize, ucQueueType );
 
         // 合法性校验：满足以下所有条件才进行动态内存分配
-        if( ( uxQueueLength > ( UBaseType_t ) 0 ) &&  // 1. 队列容量>0（有效队列）
+        if( ( queueLENGTH_IS_VALID( uxQueueLength, uxItemSize ) ) &&  // 1. 队列容量>0（有效队列），或会合队列
             /* 2. 检查“容量×项目大小”是否溢出：避免计算存储区大小时整数溢出 */
-            ( ( SIZE_MAX / uxQueueLength ) >= uxItemSize ) &&
+            ( ( uxQueueLength == ( UBaseType_t ) 0 ) || ( ( SIZE_MAX / uxQueueLength ) >= uxItemSize ) ) &&
             /* 3. 检查“控制结构大小+存储区大小”是否溢出：确保总内存不超过系统最大可分配字节数 */
             ( ( UBaseType_t ) ( SIZE_MAX - sizeof( Queue_t ) ) >= ( uxQueueLength * uxItemSize ) ) )
         {
@@ -623,8 +921,8 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
      * 此语句用于消除编译器的“未使用参数”警告 */
     ( void ) ucQueueType;
 
-    // 处理“无需存储项目数据”的场景（uxItemSize == 0，如信号量、互斥锁）
-    if( uxItemSize == ( UBaseType_t ) 0 )
+    // 处理“无需存储项目数据”的场景（uxItemSize == 0，如信号量、互斥锁；或 uxQueueLength == 0 的会合队列）
+    if( ( uxItemSize == ( UBaseType_t ) 0 ) || ( uxQueueLength == ( UBaseType_t ) 0 ) )
     {
         /* 此类场景无需为项目分配存储缓冲区，但pcHead不能设为NULL（因NULL用于标识队列是互斥锁）。
          * 因此将pcHead指向队列自身（pxNewQueue），使用一个已知在内存映射内的“无害值”，
@@ -641,6 +939,14 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
     /* 按队列类型定义的规则，初始化队列核心成员 */
     pxNewQueue->uxLength = uxQueueLength;          // 记录队列最大容量
     pxNewQueue->uxItemSize = uxItemSize;          // 记录每个项目的字节数
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+    {
+        // 队列自身的自旋锁必须在第一次进入队列临界区（下面的重置）之前初始化
+        portINIT_SPINLOCK( &( pxNewQueue->xSpinlock ) );
+    }
+    #endif
+
     // 调用通用重置函数，初始化队列的读写指针、项目计数、阻塞列表等（pdTRUE表示“强制重置”，忽略当前状态）
     ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
@@ -658,6 +964,20 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
     }
     #endif /* configUSE_QUEUE_SETS */
 
+    #if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+    {
+        // 天花板由 xQueueCreateMutexWithCeiling() 在创建互斥量后设置
+        pxNewQueue->uxCeilingPriority = queueNO_PRIORITY_CEILING;
+    }
+    #endif
+
+    #if ( configUSE_QUEUE_FIXED_SIZE_COPY == 1 )
+    {
+        // 按数据项大小选定复制函数，之后每次收发直接调用，不再按大小分支
+        pxNewQueue->pxCopyItem = prvSelectCopyItem( uxItemSize );
+    }
+    #endif
+
     // 触发队列创建的跟踪事件，记录队列创建的调试信息（如队列句柄、类型）
     traceQUEUE_CREATE( pxNewQueue );
 }
@@ -764,6 +1084,66 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreateMutexWithCeiling( const UBaseType_t uxCeilingPriority )
+    {
+        QueueHandle_t xNewQueue;
+
+        traceENTER_xQueueCreateMutexWithCeiling( uxCeilingPriority );
+
+        configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        // 按普通互斥量创建（创建时的释放不涉及天花板），再记录天花板优先级
+        xNewQueue = xQueueCreateMutex( queueQUEUE_TYPE_MUTEX );
+
+        if( xNewQueue != NULL )
+        {
+            ( ( Queue_t * ) xNewQueue )->uxCeilingPriority = uxCeilingPriority;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueCreateMutexWithCeiling( xNewQueue );
+
+        return xNewQueue;
+    }
+
+#endif /* ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreateMutexWithCeilingStatic( const UBaseType_t uxCeilingPriority,
+                                                      StaticQueue_t * pxStaticQueue )
+    {
+        QueueHandle_t xNewQueue;
+
+        traceENTER_xQueueCreateMutexWithCeilingStatic( uxCeilingPriority, pxStaticQueue );
+
+        configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        xNewQueue = xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX, pxStaticQueue );
+
+        if( xNewQueue != NULL )
+        {
+            ( ( Queue_t * ) xNewQueue )->uxCeilingPriority = uxCeilingPriority;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueCreateMutexWithCeilingStatic( xNewQueue );
+
+        return xNewQueue;
+    }
+
+#endif /* ( configUSE_PRIORITY_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
 
     TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore )
@@ -780,7 +1160,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
          * calling task is the mutex holder, but not a good way of determining the
          * identity of the mutex holder, as the holder may change between the
          * following critical section exiting and the function returning. */
-        taskENTER_CRITICAL();
+        queueENTER_CRITICAL( pxSemaphore );
         {
             if( pxSemaphore->uxQueueType == queueQUEUE_IS_MUTEX )
             {
@@ -791,7 +1171,7 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,    // 队列
                 pxReturn = NULL;
             }
         }
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( pxSemaphore );
 
         traceRETURN_xQueueGetMutexHolder( pxReturn );
 
@@ -1123,6 +1503,10 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
     TimeOut_t xTimeOut;                  // 超时管理结构体（记录阻塞开始时间，用于判断超时）
     Queue_t * const pxQueue = xQueue;    // 将队列句柄转换为内核内部控制结构指针（Queue_t*）
 
+    #if ( configUSE_QUEUE_HANDOFF == 1 )
+        BaseType_t xHandOffRegistered = pdFALSE; // 上一次阻塞时是否在会合队列上登记了数据项
+    #endif
+
     // 跟踪函数入口：记录发送事件（队列句柄、项目指针、等待时间、入队位置）
     traceENTER_xQueueGenericSend( xQueue, pvItemToQueue, xTicksToWait, xCopyPosition );
 
@@ -1139,16 +1523,83 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
     }
     #endif
 
+    #if ( configUSE_SEMAPHORE_FAST_PATH == 1 )
+    {
+        // 释放信号量或互斥量且没有竞争时，不进入临界区
+        if( ( pxQueue->uxItemSize == ( UBaseType_t ) 0 ) &&
+            ( xCopyPosition == queueSEND_TO_BACK ) &&
+            ( prvSemaphoreGiveFast( pxQueue ) != pdFALSE ) )
+        {
+            traceRETURN_xQueueGenericSend( pdPASS );
+
+            return pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_SEMAPHORE_FAST_PATH */
+
     // 无限循环：直到项目成功入队或等待超时（循环内处理“检查-阻塞-重试”逻辑）
     for( ; ; )
     {
         // 进入临界区：禁止中断和任务切换，确保队列状态检查与修改的原子性
-        taskENTER_CRITICAL();
+        queueENTER_CRITICAL( pxQueue );
         {
+            #if ( configUSE_QUEUE_HANDOFF == 1 )
+            {
+                BaseType_t xHandedOff = pdFALSE;
+
+                if( xHandOffRegistered != pdFALSE )
+                {
+                    /* 上一次阻塞在会合队列上，被唤醒时数据项可能已经被接收方直接取走。 */
+                    xHandOffRegistered = pdFALSE;
+                    xHandedOff = xTaskClearHandOffBuffer();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* 队列为空且有接收方阻塞等待时，直接复制到接收方的缓冲区，不经过队列存储区。 */
+                if( ( xHandedOff == pdFALSE ) && ( prvQueueCanHandOff( pxQueue ) ) )
+                {
+                    xHandedOff = prvQueueHandOff( pxQueue, &( pxQueue->xTasksWaitingToReceive ), ( void * ) pvItemToQueue, pdTRUE, &xYieldRequired );
+
+                    if( xYieldRequired != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xHandedOff != pdFALSE )
+                {
+                    traceQUEUE_SEND( pxQueue );
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    traceRETURN_xQueueGenericSend( pdPASS );
+                    return pdPASS;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_QUEUE_HANDOFF */
+
             /* 检查队列是否有空间（或是否允许覆盖）：
                - 普通模式：队列当前项目数 < 队列容量（uxMessagesWaiting < uxLength）；
                - 覆盖模式：无论队列是否满，都允许覆盖头部项目（仅单项目队列可用）。 */
-            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+            if( prvQueueHasSpace( pxQueue, xCopyPosition ) )
             {
                 // 跟踪“项目成功入队”事件
                 traceQUEUE_SEND( pxQueue );
@@ -1185,7 +1636,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
                         // 若有任务因“队列空”阻塞等待接收数据，唤醒一个最高优先级任务
                         if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
-                            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                            if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
                                 // 唤醒的任务优先级更高，触发任务切换
                                 queueYIELD_IF_USING_PREEMPTION();
@@ -1214,7 +1665,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
                     // 若有任务阻塞等待接收数据，唤醒一个任务
                     if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                         {
                             // 唤醒高优先级任务，触发切换
                             queueYIELD_IF_USING_PREEMPTION();
@@ -1237,7 +1688,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
                 #endif /* configUSE_QUEUE_SETS */
 
                 // 退出临界区
-                taskEXIT_CRITICAL();
+                queueEXIT_CRITICAL( pxQueue );
 
                 // 跟踪函数返回，返回成功
                 traceRETURN_xQueueGenericSend( pdPASS );
@@ -1249,7 +1700,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
                 // 情况1：不阻塞等待（xTicksToWait=0），直接返回失败
                 if( xTicksToWait == ( TickType_t ) 0 )
                 {
-                    taskEXIT_CRITICAL();  // 退出临界区
+                    queueEXIT_CRITICAL( pxQueue );  // 退出临界区
 
                     traceQUEUE_SEND_FAILED( pxQueue );  // 跟踪“发送失败”事件
                     traceRETURN_xQueueGenericSend( errQUEUE_FULL );
@@ -1268,7 +1719,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
             }
         }
         // 退出临界区：允许中断和任务切换（后续处理阻塞逻辑）
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( pxQueue );
 
         /* 临界区已退出，其他任务或中断可操作队列 */
 
@@ -1281,10 +1732,26 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,          // 目标队列句
         if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
         {
             // 超时未发生：检查队列是否仍满（可能在临界区外被其他任务取走数据）
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
             {
                 // 跟踪“任务阻塞等待发送”事件
                 traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+
+                #if ( configUSE_QUEUE_HANDOFF == 1 )
+                {
+                    /* 会合队列没有存储区：数据项留在发送方的缓冲区中，由接收方直接复制。 */
+                    if( pxQueue->uxLength == ( UBaseType_t ) 0 )
+                    {
+                        vTaskSetHandOffBuffer( ( void * ) pvItemToQueue );
+                        xHandOffRegistered = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
                 // 将当前任务加入“等待发送”列表，进入阻塞状态（等待xTicksToWait个节拍）
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 
@@ -1335,6 +1802,10 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
     UBaseType_t uxSavedInterruptStatus;     // 保存的中断状态（用于临界区保护）
     Queue_t * const pxQueue = xQueue;       // 队列句柄转换为内部结构体指针
 
+    #if ( configUSE_QUEUE_HANDOFF == 1 )
+        BaseType_t xYieldRequired = pdFALSE; // 直接交给接收方时，被唤醒的任务是否需要切换
+    #endif
+
     // 跟踪函数进入（调试用）
     traceENTER_xQueueGenericSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken, xCopyPosition );
 
@@ -1365,10 +1836,34 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
     /* coverity[misra_c_2012_directive_4_7_violation] */
     
     // 进入中断安全的临界区（保存中断状态）
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
     {
+        #if ( configUSE_QUEUE_HANDOFF == 1 )
+
+            /* 队列为空且有接收方阻塞等待时直接复制到接收方的缓冲区。队列被锁定时不能访问事件列表，
+             * 仍然写入存储区（会合队列则发送失败），由解锁队列的任务唤醒接收方。 */
+            if( ( pxQueue->cTxLock == queueUNLOCKED ) &&
+                ( prvQueueCanHandOff( pxQueue ) ) &&
+                ( prvQueueHandOff( pxQueue, &( pxQueue->xTasksWaitingToReceive ), ( void * ) pvItemToQueue, pdTRUE, &xYieldRequired ) != pdFALSE ) )
+            {
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+                if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+        #endif /* configUSE_QUEUE_HANDOFF */
+
         // 队列未满 或 处于覆盖模式（允许覆盖已有数据）
-        if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+        if( prvQueueHasSpace( pxQueue, xCopyPosition ) )
         {
             const int8_t cTxLock = pxQueue->cTxLock;              // 队列发送锁状态
             const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;  // 发送前的消息数量
@@ -1424,7 +1919,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                         if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
                             // 移除等待接收队列中的任务并唤醒它
-                            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                            if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
                                 /* 被唤醒的任务优先级更高，记录需要上下文切换 */
                                 if( pxHigherPriorityTaskWoken != NULL )
@@ -1453,7 +1948,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                     if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
                         // 移除等待接收队列中的任务并唤醒它
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                         {
                             /* 被唤醒的任务优先级更高，记录需要上下文切换 */
                             if( pxHigherPriorityTaskWoken != NULL )
@@ -1498,7 +1993,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
         }
     }
     // 退出中断安全的临界区（恢复中断状态）
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
 
     // 跟踪函数返回值（调试用）
     traceRETURN_xQueueGenericSendFromISR( xReturn );
@@ -1552,7 +2047,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
     /* coverity[misra_c_2012_directive_4_7_violation] */
     
     // 进入中断安全的临界区（仅禁用低于“最大系统调用优先级”的中断，保证高优先级中断响应）
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
     {
         // 记录当前信号量的“可用计数”（即队列中已有的“消息数”，对应信号量的计数）
         const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
@@ -1605,7 +2100,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
                         if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                         {
                             // 从等待列表中移除任务并唤醒它（允许任务获取信号量）
-                            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                            if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                             {
                                 /* 被唤醒的任务优先级高于当前运行任务，标记“需上下文切换”。 */
                                 if( pxHigherPriorityTaskWoken != NULL )
@@ -1634,7 +2129,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
                     if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                     {
                         // 从等待列表中移除任务并唤醒它
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                         {
                             /* 被唤醒的任务优先级更高，标记“需上下文切换”。 */
                             if( pxHigherPriorityTaskWoken != NULL )
@@ -1676,7 +2171,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
         }
     }
     // 退出中断安全的临界区，恢复之前保存的中断状态
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
 
     // 跟踪函数返回值（调试用，记录“中断安全的信号量释放操作结束”）
     traceRETURN_xQueueGiveFromISR( xReturn );
@@ -1696,6 +2191,11 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
     TimeOut_t xTimeOut;                  // 超时管理结构体（用于跟踪等待时间）
     Queue_t * const pxQueue = xQueue;    // 将队列句柄转换为内部队列结构体指针
 
+    #if ( configUSE_QUEUE_HANDOFF == 1 )
+        BaseType_t xHandOffRegistered = pdFALSE; // 上一次阻塞时是否登记了接收缓冲区
+        BaseType_t xYieldRequired = pdFALSE;     // 从会合队列接收时，被唤醒的发送方是否需要切换
+    #endif
+
     // 跟踪函数进入（用于调试和跟踪）
     traceENTER_xQueueReceive( xQueue, pvBuffer, xTicksToWait );
 
@@ -1717,28 +2217,78 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
     for( ; ; )
     {
         // 进入临界区（禁用任务调度，保护队列操作）
-        taskENTER_CRITICAL();
+        queueENTER_CRITICAL( pxQueue );
         {
             // 获取当前队列中的消息数量
             const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
-            // 如果队列中有消息（且当前任务是最高优先级访问队列的任务）
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            #if ( configUSE_QUEUE_HANDOFF == 1 )
             {
-                // 数据可用，从队列复制数据到缓冲区
-                prvCopyDataFromQueue( pxQueue, pvBuffer );
-                // 跟踪队列接收操作（调试用）
-                traceQUEUE_RECEIVE( pxQueue );
-                // 消息数量减1（数据已被接收并移除）
-                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+                BaseType_t xHandedOff = pdFALSE;
 
-                // 队列现在有了空间，检查是否有任务在等待发送数据到该队列
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                if( xHandOffRegistered != pdFALSE )
                 {
-                    // 移除等待发送队列中的任务并唤醒它
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-                    {
-                        // 如果被唤醒的任务优先级更高，则触发任务切换
+                    /* 上一次阻塞时登记了 pvBuffer，被唤醒时发送方可能已经把数据项直接复制进来，
+                     * 队列存储区和 uxMessagesWaiting 都没有变化。 */
+                    xHandOffRegistered = pdFALSE;
+                    xHandedOff = xTaskClearHandOffBuffer();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* 会合队列没有存储区，直接从阻塞等待的发送方的缓冲区复制。 */
+                if( ( xHandedOff == pdFALSE ) && ( pxQueue->uxLength == ( UBaseType_t ) 0 ) )
+                {
+                    xHandedOff = prvQueueHandOff( pxQueue, &( pxQueue->xTasksWaitingToSend ), pvBuffer, pdFALSE, &xYieldRequired );
+
+                    if( xYieldRequired != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xHandedOff != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE( pxQueue );
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    traceRETURN_xQueueReceive( pdPASS );
+                    return pdPASS;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_QUEUE_HANDOFF */
+
+            // 如果队列中有消息（且当前任务是最高优先级访问队列的任务）
+            if( prvQueueHasData( pxQueue ) )
+            {
+                // 数据可用，从队列复制数据到缓冲区
+                prvCopyDataFromQueue( pxQueue, pvBuffer );
+                // 跟踪队列接收操作（调试用）
+                traceQUEUE_RECEIVE( pxQueue );
+                // 消息数量减1（数据已被接收并移除）
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+
+                // 队列现在有了空间，检查是否有任务在等待发送数据到该队列
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    // 移除等待发送队列中的任务并唤醒它
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        // 如果被唤醒的任务优先级更高，则触发任务切换
                         queueYIELD_IF_USING_PREEMPTION();
                     }
                     else
@@ -1753,7 +2303,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 }
 
                 // 退出临界区
-                taskEXIT_CRITICAL();
+                queueEXIT_CRITICAL( pxQueue );
 
                 // 跟踪函数返回（调试用）并返回成功
                 traceRETURN_xQueueReceive( pdPASS );
@@ -1765,7 +2315,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 if( xTicksToWait == ( TickType_t ) 0 )
                 {
                     // 退出临界区
-                    taskEXIT_CRITICAL();
+                    queueEXIT_CRITICAL( pxQueue );
 
                     // 跟踪接收失败（调试用）并返回队列空错误
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
@@ -1786,7 +2336,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
             }
         }
         // 退出临界区（允许其他任务/中断访问队列）
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( pxQueue );
 
         // 挂起所有任务调度（准备进入阻塞状态）
         vTaskSuspendAll();
@@ -1801,6 +2351,22 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
             {
                 // 队列为空：将当前任务加入等待接收队列，进入阻塞状态
                 traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );  // 跟踪阻塞操作
+
+                #if ( configUSE_QUEUE_HANDOFF == 1 )
+                {
+                    /* 登记接收缓冲区，发送方可以把数据项直接复制进来。 */
+                    if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+                    {
+                        vTaskSetHandOffBuffer( pvBuffer );
+                        xHandOffRegistered = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
                 // 解锁队列
                 prvUnlockQueue( pxQueue );
@@ -1845,364 +2411,367 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
-// 函数定义：获取信号量（底层实现，对应应用层的xSemaphoreTake()）
-// 参数：
-//   xQueue - 目标信号量句柄（本质是队列句柄，需确保是信号量类型的队列）
-//   xTicksToWait - 信号量不可用时的阻塞等待时间（单位：时钟节拍；portMAX_DELAY表示永久等待）
-// 返回值：
-//   pdPASS - 成功获取信号量（计数减1）
-//   errQUEUE_EMPTY - 信号量不可用（计数为0）且等待超时/无等待时间
-BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
-                                TickType_t xTicksToWait )
-{
-    BaseType_t xEntryTimeSet = pdFALSE;  // 标记“是否已设置超时起始时间”（初始未设置）
-    TimeOut_t xTimeOut;                  // 超时管理结构体（存储超时起始时间、溢出状态等）
-    Queue_t * const pxQueue = xQueue;    // 将信号量句柄强制转换为队列结构体指针（信号量本质是队列）
-
-    // 条件编译：若启用互斥锁功能，需记录“是否触发优先级继承”
-    #if ( configUSE_MUTEXES == 1 )
-        BaseType_t xInheritanceOccurred = pdFALSE;  // 标记“优先级继承是否发生”（初始未发生）
-    #endif
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
 
-    // 跟踪函数进入（调试用，记录“开始获取信号量”）
-    traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait );
+    void * pvQueueReserveSend( QueueHandle_t xQueue,
+                               TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+        void * pvReturn;
 
-    /* 断言1：检查信号量句柄是否有效（非NULL） */
-    configASSERT( ( pxQueue ) );
+        traceENTER_pvQueueReserveSend( xQueue, xTicksToWait );
 
-    /* 断言2：检查当前操作的是“信号量”——信号量的队列元素大小必须为0（无需存储数据） */
-    configASSERT( pxQueue->uxItemSize == 0 );
+        configASSERT( pxQueue );
 
-    /* 断言3：调度器挂起时不能阻塞等待（调度器挂起后无法切换任务，阻塞会导致死锁） */
-    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
-    {
-        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
-    }
-    #endif
+        /* 信号量、互斥量和会合队列没有存储区，不能预留。 */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        configASSERT( pxQueue->uxLength != ( UBaseType_t ) 0U );
 
-    // 无限循环：直到成功获取信号量或等待超时
-    for( ; ; )
-    {
-        // 1. 进入临界区：保护队列状态（避免并发修改消息数、任务等待列表）
-        taskENTER_CRITICAL();
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            /* 信号量本质是“元素大小为0的队列”，队列的“消息数”（uxMessagesWaiting）即信号量的“计数” */
-            const UBaseType_t uxSemaphoreCount = pxQueue->uxMessagesWaiting;
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
 
-            /* 分支1：信号量计数>0（可用），执行获取逻辑 */
-            if( uxSemaphoreCount > ( UBaseType_t ) 0 )
+        /* 与 xQueueGenericSend() 的结构相同，只是成功时不复制数据，
+         * 而是把 pcWriteTo 指向的槽标记为已预留并返回它的地址。 */
+        for( ; ; )
+        {
+            queueENTER_CRITICAL( pxQueue );
             {
-                // 跟踪“成功读取队列”（调试用，信号量获取对应队列读取）
-                traceQUEUE_RECEIVE( pxQueue );
+                if( prvQueueHasSpace( pxQueue, queueSEND_TO_BACK ) )
+                {
+                    /* pcWriteTo 在提交时才前移，预留期间 prvQueueHasSpace() 挡住其它发往队尾的项目，
+                     * 所以这个槽不会被别人写入，接收方也看不到它。 */
+                    pxQueue->ucZeroCopyState |= queueZERO_COPY_SEND_RESERVED;
+                    pvReturn = ( void * ) pxQueue->pcWriteTo;
 
-                /* 信号量计数减1：消息数-1即表示成功获取信号量 */
-                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxSemaphoreCount - ( UBaseType_t ) 1 );
+                    queueEXIT_CRITICAL( pxQueue );
 
-                // 条件编译：若当前是互斥锁（而非普通信号量），需记录持有者信息
-                #if ( configUSE_MUTEXES == 1 )
+                    traceRETURN_pvQueueReserveSend( pvReturn );
+                    return pvReturn;
+                }
+                else
                 {
-                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    if( xTicksToWait == ( TickType_t ) 0 )
                     {
-                        /* 记录互斥锁持有者：
-                         * pvTaskIncrementMutexHeldCount()返回当前任务句柄，并递增任务的“持有互斥锁计数”
-                         * （用于后续优先级继承、防止重复释放等逻辑） */
-                        pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+                        queueEXIT_CRITICAL( pxQueue );
+
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        traceRETURN_pvQueueReserveSend( NULL );
+                        return NULL;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
                     }
                     else
                     {
-                        mtCOVERAGE_TEST_MARKER();  // 覆盖测试标记，无实际逻辑
+                        mtCOVERAGE_TEST_MARKER();
                     }
                 }
-                #endif /* configUSE_MUTEXES */
+            }
+            queueEXIT_CRITICAL( pxQueue );
 
-                /* 检查是否有任务阻塞等待“释放信号量”（即等待发送消息到队列）：
-                 * 信号量获取后计数可能仍有剩余，需唤醒最高优先级的等待释放任务（若存在） */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
                 {
-                    // 从“等待发送列表”中移除最高优先级任务并唤醒
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-                    {
-                        // 若使用抢占式调度，唤醒的任务优先级可能更高，触发任务切换
-                        queueYIELD_IF_USING_PREEMPTION();
-                    }
-                    else
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        taskYIELD_WITHIN_API();
                     }
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
                 }
+            }
+            else
+            {
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
 
-                // 退出临界区
-                taskEXIT_CRITICAL();
+                traceQUEUE_SEND_FAILED( pxQueue );
+                traceRETURN_pvQueueReserveSend( NULL );
+                return NULL;
+            }
+        }
+    }
 
-                // 跟踪函数返回成功（调试用）
-                traceRETURN_xQueueSemaphoreTake( pdPASS );
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
 
-                return pdPASS;  // 成功获取信号量，返回pdPASS
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    BaseType_t xQueueCommitSend( QueueHandle_t xQueue )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueCommitSend( xQueue );
+
+        configASSERT( pxQueue );
+
+        queueENTER_CRITICAL( pxQueue );
+        {
+            /* 必须先用 pvQueueReserveSend() 预留。 */
+            configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_SEND_RESERVED ) != 0U );
+
+            traceQUEUE_SEND( pxQueue );
+
+            /* 数据已经在 pcWriteTo 处，剩下的就是 prvCopyDataToQueue() 中 queueSEND_TO_BACK 分支的指针维护。 */
+            pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_SEND_RESERVED;
+            pxQueue->pcWriteTo += pxQueue->uxItemSize;
+
+            if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+            {
+                pxQueue->pcWriteTo = pxQueue->pcHead;
             }
-            /* 分支2：信号量计数=0（不可用），处理等待逻辑 */
             else
             {
-                /* 子分支2.1：无等待时间（xTicksToWait=0），直接返回失败 */
-                if( xTicksToWait == ( TickType_t ) 0 )
-                {
-                    taskEXIT_CRITICAL();  // 退出临界区
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                    traceQUEUE_RECEIVE_FAILED( pxQueue );  // 跟踪“队列读取失败”（调试用）
-                    traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
+            pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1 );
 
-                    return errQUEUE_EMPTY;  // 信号量不可用，返回失败
+            #if ( configUSE_QUEUE_SETS == 1 )
+            {
+                if( pxQueue->pxQueueSetContainer != NULL )
+                {
+                    if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
-                /* 子分支2.2：有等待时间，但未设置超时起始时间，初始化超时结构体 */
-                else if( xEntryTimeSet == pdFALSE )
+                else if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
-                    vTaskInternalSetTimeOutState( &xTimeOut );  // 记录当前时间为超时起始点
-                    xEntryTimeSet = pdTRUE;  // 标记“超时起始时间已设置”
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();  // 已设置超时时间，无操作
+                    mtCOVERAGE_TEST_MARKER();
                 }
             }
-        }
-        // 退出临界区：此时其他任务/中断可修改信号量状态（如释放信号量）
-        taskEXIT_CRITICAL();
-
-        /* 2. 处理阻塞等待：信号量不可用时，将当前任务加入等待列表并挂起 */
-        // 挂起调度器：避免在“检查超时→加入等待列表”过程中被其他任务抢占
-        vTaskSuspendAll();
-        // 锁定队列：标记队列正被操作，防止并发修改等待列表
-        prvLockQueue( pxQueue );
-
-        /* 检查超时状态：判断当前等待时间是否已过期 */
-        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
-        {
-            /* 子分支1：未超时，且信号量仍不可用（队列空=计数0），将任务加入等待列表 */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            #else /* configUSE_QUEUE_SETS */
             {
-                // 跟踪“任务阻塞等待队列读取”（调试用）
-                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-
-                // 条件编译：若当前是互斥锁，触发优先级继承（关键！防止优先级反转）
-                #if ( configUSE_MUTEXES == 1 )
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
                 {
-                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
                     {
-                        taskENTER_CRITICAL();
-                        {
-                            /* 优先级继承：
-                             * 若当前任务优先级 > 互斥锁持有者优先级，
-                             * 则将持有者优先级临时提升到当前任务优先级，避免优先级反转 */
-                            xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
-                        }
-                        taskEXIT_CRITICAL();
+                        queueYIELD_IF_USING_PREEMPTION();
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
-                #endif /* if ( configUSE_MUTEXES == 1 ) */
-
-                // 将当前任务加入“等待接收列表”（等待信号量可用），并设置阻塞时间
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
-                // 解锁队列：允许其他任务操作队列
-                prvUnlockQueue( pxQueue );
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_QUEUE_SETS */
 
-                /* 恢复调度器：
-                 * 若恢复后需要切换任务（如唤醒了更高优先级任务），则触发任务切换 */
-                if( xTaskResumeAll() == pdFALSE )
+            /* 预留期间发往队尾的任务都被挡住了，若队列还有空闲槽，唤醒其中一个。 */
+            if( ( ( pxQueue->uxMessagesWaiting + prvZeroCopyHeldSlots( pxQueue ) ) < pxQueue->uxLength ) &&
+                ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) )
+            {
+                if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                 {
-                    taskYIELD_WITHIN_API();  // 在API内部触发任务切换
+                    queueYIELD_IF_USING_PREEMPTION();
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-            /* 子分支2：未超时，但信号量已可用（其他任务/中断释放了信号量），重新进入循环尝试获取 */
             else
             {
-                prvUnlockQueue( pxQueue );  // 解锁队列
-                ( void ) xTaskResumeAll();  // 恢复调度器，无任务切换
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        /* 子分支2：等待超时，处理超时逻辑 */
-        else
-        {
-            prvUnlockQueue( pxQueue );  // 解锁队列
-            ( void ) xTaskResumeAll();  // 恢复调度器
+        queueEXIT_CRITICAL( pxQueue );
 
-            /* 检查信号量是否仍不可用（队列空=计数0）：
-             * 若超时后信号量仍不可用，返回失败；否则重新进入循环尝试获取 */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
-            {
-                // 条件编译：若此前触发了优先级继承，超时后需恢复持有者的原始优先级
-                #if ( configUSE_MUTEXES == 1 )
-                {
-                    if( xInheritanceOccurred != pdFALSE )
-                    {
-                        taskENTER_CRITICAL();
-                        {
-                            /* 步骤1：获取等待该互斥锁的最高优先级任务优先级 */
-                            UBaseType_t uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
-
-                            /* 步骤2：恢复互斥锁持有者的原始优先级：
-                             * 将持有者优先级从“继承的高优先级”恢复到“原始优先级”，
-                             * 但不低于“等待队列中最高优先级”（避免后续等待任务仍被阻塞） */
-                            vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
-                        }
-                        taskEXIT_CRITICAL();
-                    }
-                }
-                #endif /* configUSE_MUTEXES */
+        traceRETURN_xQueueCommitSend( pdPASS );
 
-                traceQUEUE_RECEIVE_FAILED( pxQueue );  // 跟踪“队列读取失败”（调试用）
-                traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
-
-                return errQUEUE_EMPTY;  // 超时且信号量仍不可用，返回失败
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();  // 超时后信号量已可用，重新进入循环尝试获取
-            }
-        }
+        return pdPASS;
     }
-}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
 /*-----------------------------------------------------------*/
 
-// 函数定义：从队列中查看数据（不删除数据）
-// 参数：xQueue-队列句柄；pvBuffer-接收数据的缓冲区指针；xTicksToWait-等待超时时间（时钟周期）
-// 返回值：pdPASS表示成功查看数据；errQUEUE_EMPTY表示队列空或超时
-BaseType_t xQueuePeek( QueueHandle_t xQueue,
-                       void * const pvBuffer,
-                       TickType_t xTicksToWait )
-{
-    BaseType_t xEntryTimeSet = pdFALSE;  // 标记是否已设置超时起始时间（初始未设置）
-    TimeOut_t xTimeOut;                  // 超时管理结构体（用于跟踪等待时间）
-    int8_t * pcOriginalReadPosition;     // 保存原始读指针位置（用于查看后恢复）
-    Queue_t * const pxQueue = xQueue;    // 将队列句柄转换为内部队列结构体指针
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
 
-    // 跟踪函数进入（用于调试和跟踪）
-    traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait );
+    const void * pvQueueAcquireReceive( QueueHandle_t xQueue,
+                                        TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+        const void * pvReturn;
 
-    // 断言检查：队列指针不能为空（确保参数有效性）
-    configASSERT( ( pxQueue ) );
+        traceENTER_pvQueueAcquireReceive( xQueue, xTicksToWait );
 
-    // 断言检查：如果队列元素大小不为0，则接收缓冲区不能为NULL
-    // （避免无缓冲区却要复制数据的错误）
-    configASSERT( !( ( ( pvBuffer ) == NULL ) && ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0U ) ) );
+        configASSERT( pxQueue );
 
-    // 断言检查：调度器挂起时不能阻塞等待（防止死锁）
-    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
-    {
-        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
-    }
-    #endif
+        /* 信号量、互斥量和会合队列没有存储区，不能占用。 */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        configASSERT( pxQueue->uxLength != ( UBaseType_t ) 0U );
 
-    // 无限循环：直到成功获取数据或超时退出
-    for( ; ; )
-    {
-        // 进入临界区（禁用任务调度，保护队列操作）
-        taskENTER_CRITICAL();
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            // 获取当前队列中的消息数量
-            const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
 
-            // 如果队列中有消息（且当前任务是最高优先级访问队列的任务）
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+        /* 与 xQueueReceive() 的结构相同，只是成功时不复制数据，而是返回队首数据项的地址。 */
+        for( ; ; )
+        {
+            queueENTER_CRITICAL( pxQueue );
             {
-                // 保存原始读指针位置（因为查看操作不删除数据，后续需要恢复）
-                pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-
-                // 从队列复制数据到缓冲区（内部函数，处理实际数据拷贝）
-                prvCopyDataFromQueue( pxQueue, pvBuffer );
-                // 跟踪队列查看操作（调试用）
-                traceQUEUE_PEEK( pxQueue );
-
-                // 恢复读指针（因为是查看操作，不移动读指针）
-                pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
-
-                // 检查是否有其他任务在等待接收该队列的数据
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( prvQueueHasData( pxQueue ) )
                 {
-                    // 将等待队列中的任务移除并唤醒（因为数据仍在队列中）
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    /* 与 prvCopyDataFromQueue() 一样前移 pcReadFrom，但不复制。
+                     * 数据项出队，但它的槽在释放前仍被占用，队列没有多出空闲槽，
+                     * 所以这里不唤醒等待发送的任务，留到 vQueueReleaseReceive()。 */
+                    pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+
+                    if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
                     {
-                        // 如果被唤醒的任务优先级更高，则触发任务切换
-                        queueYIELD_IF_USING_PREEMPTION();
+                        pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
                     }
                     else
                     {
-                        // 覆盖测试标记（用于代码覆盖率测试）
                         mtCOVERAGE_TEST_MARKER();
                     }
+
+                    pvReturn = ( const void * ) pxQueue->u.xQueue.pcReadFrom;
+                    traceQUEUE_RECEIVE( pxQueue );
+                    pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1 );
+                    pxQueue->ucZeroCopyState |= queueZERO_COPY_RECEIVE_ACQUIRED;
+
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    traceRETURN_pvQueueAcquireReceive( pvReturn );
+                    return pvReturn;
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        queueEXIT_CRITICAL( pxQueue );
+
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        traceRETURN_pvQueueAcquireReceive( NULL );
+                        return NULL;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
+            }
+            queueEXIT_CRITICAL( pxQueue );
 
-                // 退出临界区
-                taskEXIT_CRITICAL();
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-                // 跟踪函数返回（调试用）并返回成功
-                traceRETURN_xQueuePeek( pdPASS );
-                return pdPASS;
-            }
-            else  // 队列为空的情况
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
             {
-                // 如果超时时间为0（不等待），直接退出
-                if( xTicksToWait == ( TickType_t ) 0 )
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
                 {
-                    // 退出临界区
-                    taskEXIT_CRITICAL();
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
 
-                    // 跟踪查看失败（调试用）并返回队列空错误
-                    traceQUEUE_PEEK_FAILED( pxQueue );
-                    traceRETURN_xQueuePeek( errQUEUE_EMPTY );
-                    return errQUEUE_EMPTY;
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
-                // 如果未设置超时起始时间，则初始化超时结构体
-                else if( xEntryTimeSet == pdFALSE )
+                else
                 {
-                    vTaskInternalSetTimeOutState( &xTimeOut );  // 设置超时起始状态
-                    xEntryTimeSet = pdTRUE;  // 标记已设置超时时间
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    traceRETURN_pvQueueAcquireReceive( NULL );
+                    return NULL;
                 }
                 else
                 {
-                    // 已设置超时时间，覆盖测试标记
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
         }
-        // 退出临界区（允许其他任务/中断访问队列）
-        taskEXIT_CRITICAL();
+    }
 
-        // 挂起所有任务调度（准备进入阻塞状态）
-        vTaskSuspendAll();
-        // 锁定队列（防止其他操作干扰）
-        prvLockQueue( pxQueue );
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
 
-        // 检查超时是否已发生（更新剩余等待时间）
-        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+
+    void vQueueReleaseReceive( QueueHandle_t xQueue )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_vQueueReleaseReceive( xQueue );
+
+        configASSERT( pxQueue );
+
+        queueENTER_CRITICAL( pxQueue );
         {
-            // 超时未发生：检查队列是否仍为空
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
-            {
-                // 队列为空：将当前任务加入等待接收队列，进入阻塞状态
-                traceBLOCKING_ON_QUEUE_PEEK( pxQueue );  // 跟踪阻塞操作
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
-                // 解锁队列
-                prvUnlockQueue( pxQueue );
+            /* 必须先用 pvQueueAcquireReceive() 占用。 */
+            configASSERT( ( pxQueue->ucZeroCopyState & queueZERO_COPY_RECEIVE_ACQUIRED ) != 0U );
 
-                // 恢复任务调度，如果需要则触发任务切换
-                if( xTaskResumeAll() == pdFALSE )
+            pxQueue->ucZeroCopyState &= ( uint8_t ) ~queueZERO_COPY_RECEIVE_ACQUIRED;
+
+            /* 释放的槽变为空闲，相当于 xQueueReceive() 中出队后的唤醒。 */
+            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+            {
+                if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
                 {
-                    taskYIELD_WITHIN_API();
+                    queueYIELD_IF_USING_PREEMPTION();
                 }
                 else
                 {
@@ -2211,627 +2780,2218 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
             }
             else
             {
-                // 队列已有数据：不进入阻塞状态，解锁队列并恢复调度，重新尝试获取数据
-                prvUnlockQueue( pxQueue );
-                ( void ) xTaskResumeAll();
+                mtCOVERAGE_TEST_MARKER();
             }
-        }
-        else  // 超时已发生
-        {
-            // 解锁队列并恢复任务调度
-            prvUnlockQueue( pxQueue );
-            ( void ) xTaskResumeAll();
 
-            // 检查队列是否仍为空
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            /* 占用期间其它接收任务都被挡住了，队列中还有数据项时唤醒其中一个。 */
+            if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&
+                ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
             {
-                // 队列仍为空：跟踪失败并返回超时错误
-                traceQUEUE_PEEK_FAILED( pxQueue );
-                traceRETURN_xQueuePeek( errQUEUE_EMPTY );
-                return errQUEUE_EMPTY;
+                if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-    }
-}
-/*-----------------------------------------------------------*/
+        queueEXIT_CRITICAL( pxQueue );
 
-// 函数定义：中断安全版队列读取函数（从队列头部读取数据，支持唤醒等待发送的高优先级任务）
-// 参数：
-//   xQueue - 目标队列句柄（需提前通过xQueueCreate创建）
-//   pvBuffer - 存储读取数据的缓冲区指针（大小需≥队列元素大小）
-//   pxHigherPriorityTaskWoken - 指向“高优先级任务是否被唤醒”标记的指针
-// 返回值：pdPASS表示成功读取数据；pdFAIL表示队列为空，无数据可读
-BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
-                                 void * const pvBuffer,
-                                 BaseType_t * const pxHigherPriorityTaskWoken )
-{
-    BaseType_t xReturn;                     // 函数返回值（pdPASS/pdFAIL）
-    UBaseType_t uxSavedInterruptStatus;     // 保存的中断状态（用于中断安全的临界区保护）
-    Queue_t * const pxQueue = xQueue;       // 将队列句柄转换为内部结构体指针（FreeRTOS队列核心数据结构）
+        traceRETURN_vQueueReleaseReceive();
+    }
 
-    // 跟踪函数进入（调试用，记录“中断安全队列读取操作开始”）
-    traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken );
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
 
-    // 断言检查：队列句柄必须有效（非NULL）
-    configASSERT( pxQueue );
-    // 断言检查：若队列元素大小≠0（需存储实际数据），则缓冲区指针不可为NULL（避免内存访问错误）
-    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+#if ( configUSE_QUEUE_BATCH == 1 )
 
-    /* 支持中断嵌套的RTOS端口有“最大系统调用中断优先级”的概念：
-     * - 高于此优先级的中断会永久使能，即使内核处于临界区，也禁止调用FreeRTOS API；
-     * - 低于/等于此优先级的中断，仅可调用以FromISR结尾的API（如本函数）。
-     * 若开启configASSERT()，当从高于最大系统调用优先级的中断中调用本函数时，
-     * portASSERT_IF_INTERRUPT_PRIORITY_INVALID()会触发断言失败，提示非法调用。
-     * 更多Cortex-M端口细节参考：https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+/* 当前能发往队尾的项目数 / 能接收的项目数（考虑零拷贝接口的预留和占用）。 */
+    #define prvQueueSpacesForBack( pxQueue ) \
+    ( prvQueueHasSpace( ( pxQueue ), queueSEND_TO_BACK ) ? ( ( pxQueue )->uxLength - ( pxQueue )->uxMessagesWaiting - prvZeroCopyHeldSlots( pxQueue ) ) : ( UBaseType_t ) 0U )
+    #define prvQueueItemsAvailable( pxQueue ) \
+    ( prvQueueHasData( pxQueue ) ? ( pxQueue )->uxMessagesWaiting : ( UBaseType_t ) 0U )
 
-    /* MISRA规范参考 4.7.1 [返回值必须被检查] */
-    /* 详细说明：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    
-    // 进入中断安全的临界区：仅禁用低于“最大系统调用优先级”的中断，保证高优先级中断正常响应
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue,
+                                     const void * const pvItemsToQueue,
+                                     const UBaseType_t uxItemCount,
+                                     TickType_t xTicksToWait )
     {
-        // 记录当前队列中的“消息数”（即待读取的数据项数量）
-        const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+        UBaseType_t uxToSend;
 
-        /* 中断环境禁止阻塞，因此先检查队列是否有数据可读（消息数>0） */
-        if( uxMessagesWaiting > ( UBaseType_t ) 0 )  // 队列非空，可读取数据
-        {
-            const int8_t cRxLock = pxQueue->cRxLock;  // 队列的“读取锁定状态”（区分发送锁定cTxLock）
+        traceENTER_uxQueueSendMultiple( xQueue, pvItemsToQueue, uxItemCount, xTicksToWait );
 
-            // 跟踪队列从ISR读取的操作（调试用，记录“成功进入数据读取流程”）
-            traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+        configASSERT( pxQueue );
+        configASSERT( pvItemsToQueue != NULL );
+        configASSERT( uxItemCount > ( UBaseType_t ) 0U );
 
-            // 1. 从队列复制数据到缓冲区：按队列元素大小，将队列头部数据复制到pvBuffer
-            prvCopyDataFromQueue( pxQueue, pvBuffer );
-            // 2. 减少队列消息数：读取成功后，队列中待读取的数据项数量减1（腾出1个空间）
-            pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+        /* 信号量、互斥量和会合队列不能批量发送。 */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        configASSERT( pxQueue->uxLength != ( UBaseType_t ) 0U );
 
-            /* 若队列被“读取锁定”，则不修改任务等待列表（事件列表），
-             * 待队列解锁后，由解锁任务统一处理唤醒逻辑。 */
-            if( cRxLock == queueUNLOCKED )  // 队列未被读取锁定，可正常处理任务唤醒
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /* 与 xQueueGenericSend( queueSEND_TO_BACK ) 的结构相同，只是一次临界区内
+         * 复制尽可能多的项目，并且整批只处理一次等待接收的任务。 */
+        for( ; ; )
+        {
+            queueENTER_CRITICAL( pxQueue );
             {
-                // 检查是否有任务因“队列满”阻塞（等待向队列发送数据）
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                uxToSend = prvQueueSpacesForBack( pxQueue );
+
+                if( uxToSend > ( UBaseType_t ) 0U )
                 {
-                    // 从“等待发送任务列表”中移除任务并唤醒它（该任务现在可向队列发送数据）
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( uxToSend > uxItemCount )
                     {
-                        /* 被唤醒的任务优先级高于当前运行任务（即被中断打断的任务），
-                         * 标记“需要上下文切换”，告知中断服务程序退出前触发切换。 */
-                        if( pxHigherPriorityTaskWoken != NULL )
-                        {
-                            *pxHigherPriorityTaskWoken = pdTRUE;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();  // 覆盖测试标记，无实际业务逻辑
-                        }
+                        uxToSend = uxItemCount;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-                }
+
+                    traceQUEUE_SEND( pxQueue );
+
+                    prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxToSend );
+
+                    #if ( configUSE_QUEUE_SETS == 1 )
+                    {
+                        if( pxQueue->pxQueueSetContainer != NULL )
+                        {
+                            UBaseType_t ux;
+                            BaseType_t xYieldRequired = pdFALSE;
+
+                            /* 队列集中每个项目对应一个句柄，所以要通知 uxToSend 次。 */
+                            for( ux = 0; ux < uxToSend; ux++ )
+                            {
+                                if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                                {
+                                    xYieldRequired = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+
+                            if( xYieldRequired != pdFALSE )
+                            {
+                                queueYIELD_IF_USING_PREEMPTION();
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else if( prvUnblockEventListTasks( &( pxQueue->xTasksWaitingToReceive ), uxToSend ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #else /* configUSE_QUEUE_SETS */
+                    {
+                        if( prvUnblockEventListTasks( &( pxQueue->xTasksWaitingToReceive ), uxToSend ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif /* configUSE_QUEUE_SETS */
+
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    traceRETURN_uxQueueSendMultiple( uxToSend );
+                    return uxToSend;
+                }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        queueEXIT_CRITICAL( pxQueue );
+
+                        traceQUEUE_SEND_FAILED( pxQueue );
+                        traceRETURN_uxQueueSendMultiple( 0 );
+                        return ( UBaseType_t ) 0U;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
             }
-            else  // 队列被读取锁定
+            queueEXIT_CRITICAL( pxQueue );
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
             {
-                /* 增加“读取锁定计数”：告知后续解锁队列的任务，
-                 * “锁定期间有数据被读取，需处理等待发送的任务”。 */
-                prvIncrementQueueRxLock( pxQueue, cRxLock );
+                if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                }
+                else
+                {
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
             }
+            else
+            {
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
 
-            // 数据读取成功，返回pdPASS
-            xReturn = pdPASS;
+                traceQUEUE_SEND_FAILED( pxQueue );
+                traceRETURN_uxQueueSendMultiple( 0 );
+                return ( UBaseType_t ) 0U;
+            }
         }
-        else  // 队列为空，无数据可读取
+    }
+
+#endif /* configUSE_QUEUE_BATCH */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH == 1 )
+
+    UBaseType_t uxQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                            const void * const pvItemsToQueue,
+                                            const UBaseType_t uxItemCount,
+                                            BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxToSend;
+        UBaseType_t uxSavedInterruptStatus;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_uxQueueSendMultipleFromISR( xQueue, pvItemsToQueue, uxItemCount, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( pvItemsToQueue != NULL );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
         {
-            xReturn = pdFAIL;  // 返回pdFAIL表示读取失败
-            traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );  // 跟踪读取失败（调试用）
+            uxToSend = prvQueueSpacesForBack( pxQueue );
+
+            if( uxToSend > uxItemCount )
+            {
+                uxToSend = uxItemCount;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( uxToSend > ( UBaseType_t ) 0U )
+            {
+                int8_t cTxLock = pxQueue->cTxLock;
+                BaseType_t xYieldRequired = pdFALSE;
+                UBaseType_t ux;
+
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+                prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxToSend );
+
+                /* 与 xQueueGenericSendFromISR() 一样，队列被锁定时不动事件列表，
+                 * 只增加锁计数（每个项目一次），由 prvUnlockQueue() 补做唤醒。 */
+                if( cTxLock == queueUNLOCKED )
+                {
+                    #if ( configUSE_QUEUE_SETS == 1 )
+                    {
+                        if( pxQueue->pxQueueSetContainer != NULL )
+                        {
+                            for( ux = 0; ux < uxToSend; ux++ )
+                            {
+                                if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                                {
+                                    xYieldRequired = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                        }
+                        else
+                        {
+                            xYieldRequired = prvUnblockEventListTasks( &( pxQueue->xTasksWaitingToReceive ), uxToSend );
+                        }
+                    }
+                    #else /* configUSE_QUEUE_SETS */
+                    {
+                        xYieldRequired = prvUnblockEventListTasks( &( pxQueue->xTasksWaitingToReceive ), uxToSend );
+                    }
+                    #endif /* configUSE_QUEUE_SETS */
+
+                    if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    for( ux = 0; ux < uxToSend; ux++ )
+                    {
+                        prvIncrementQueueTxLock( pxQueue, cTxLock );
+                        cTxLock = pxQueue->cTxLock;
+                    }
+                }
+            }
+            else
+            {
+                traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+            }
         }
-    }
-    // 退出中断安全的临界区，恢复进入前的中断状态（确保不影响其他中断）
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
 
-    // 跟踪函数返回值（调试用，记录“中断安全队列读取操作结束”）
-    traceRETURN_xQueueReceiveFromISR( xReturn );
+        traceRETURN_uxQueueSendMultipleFromISR( uxToSend );
 
-    return xReturn;
-}
+        return uxToSend;
+    }
+
+#endif /* configUSE_QUEUE_BATCH */
 /*-----------------------------------------------------------*/
 
-// 函数定义：中断服务程序(ISR)中使用的队列查看函数（不删除数据）
-// 参数：xQueue-队列句柄；pvBuffer-接收数据的缓冲区指针
-// 返回值：pdPASS表示成功查看数据；pdFAIL表示失败（通常因为队列空）
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
-                              void * const pvBuffer )
-{
-    BaseType_t xReturn;                     // 函数返回值（成功/失败）
-    UBaseType_t uxSavedInterruptStatus;     // 保存的中断状态（用于退出临界区时恢复）
-    int8_t * pcOriginalReadPosition;        // 保存原始读指针位置（用于查看后恢复）
-    Queue_t * const pxQueue = xQueue;       // 将队列句柄转换为内部队列结构体指针
+#if ( configUSE_QUEUE_BATCH == 1 )
 
-    // 跟踪函数进入（用于调试和跟踪）
-    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+    UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                        void * const pvBuffer,
+                                        const UBaseType_t uxMaxItems,
+                                        TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+        UBaseType_t uxToReceive;
 
-    // 断言检查：队列指针不能为空
-    configASSERT( pxQueue );
-    // 断言检查：如果队列元素大小不为0，则接收缓冲区不能为NULL
-    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-    // 断言检查：不能对信号量使用peek操作（信号量没有数据项）
-    configASSERT( pxQueue->uxItemSize != 0 ); /* 不能查看信号量 */
+        traceENTER_uxQueueReceiveMultiple( xQueue, pvBuffer, uxMaxItems, xTicksToWait );
 
-    /* 支持中断嵌套的RTOS端口有"最大系统调用中断优先级"的概念。
-     * 高于此优先级的中断会始终保持使能，即使RTOS内核处于临界区，
-     * 但这些中断不能调用任何FreeRTOS API函数。
-     * 如果在FreeRTOSConfig.h中定义了configASSERT()，则当从高于
-     * 配置的最大系统调用优先级的中断中调用FreeRTOS API函数时，
-     * portASSERT_IF_INTERRUPT_PRIORITY_INVALID()会导致断言失败。
-     * 只有以FromISR结尾的FreeRTOS函数可以从中断中调用，且这些中断的
-     * 优先级必须小于等于最大系统调用中断优先级。
-     * FreeRTOS维护独立的中断安全API，以确保中断处理尽可能快速简单。
-     * 更多信息（针对Cortex-M）请参考：https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer != NULL );
+        configASSERT( uxMaxItems > ( UBaseType_t ) 0U );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        configASSERT( pxQueue->uxLength != ( UBaseType_t ) 0U );
 
-    /* MISRA规则4.7.1 [返回值必须被检查] */
-    /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    // 进入中断安全的临界区，并保存当前中断状态
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
-    {
-        // 中断中不能阻塞，因此直接检查队列中是否有数据
-        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            // 跟踪ISR中的队列查看操作（调试用）
-            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
 
-            // 保存原始读指针位置（因为是查看操作，不删除数据）
-            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-            // 从队列复制数据到缓冲区
-            prvCopyDataFromQueue( pxQueue, pvBuffer );
-            // 恢复读指针（不移动读指针，数据仍在队列中）
-            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+        /* 与 xQueueReceive() 的结构相同，一次临界区内取出尽可能多的项目，
+         * 整批只处理一次等待发送的任务。 */
+        for( ; ; )
+        {
+            queueENTER_CRITICAL( pxQueue );
+            {
+                uxToReceive = prvQueueItemsAvailable( pxQueue );
 
-            // 标记成功
-            xReturn = pdPASS;
+                if( uxToReceive > ( UBaseType_t ) 0U )
+                {
+                    if( uxToReceive > uxMaxItems )
+                    {
+                        uxToReceive = uxMaxItems;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxToReceive );
+                    traceQUEUE_RECEIVE( pxQueue );
+                    pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - uxToReceive );
+
+                    if( prvUnblockEventListTasks( &( pxQueue->xTasksWaitingToSend ), uxToReceive ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    traceRETURN_uxQueueReceiveMultiple( uxToReceive );
+                    return uxToReceive;
+                }
+                else
+                {
+                    if( xTicksToWait == ( TickType_t ) 0 )
+                    {
+                        queueEXIT_CRITICAL( pxQueue );
+
+                        traceQUEUE_RECEIVE_FAILED( pxQueue );
+                        traceRETURN_uxQueueReceiveMultiple( 0 );
+                        return ( UBaseType_t ) 0U;
+                    }
+                    else if( xEntryTimeSet == pdFALSE )
+                    {
+                        vTaskInternalSetTimeOutState( &xTimeOut );
+                        xEntryTimeSet = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            queueEXIT_CRITICAL( pxQueue );
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    traceRETURN_uxQueueReceiveMultiple( 0 );
+                    return ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+    }
+
+#endif /* configUSE_QUEUE_BATCH */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH == 1 )
+
+    UBaseType_t uxQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                               void * const pvBuffer,
+                                               const UBaseType_t uxMaxItems,
+                                               BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxToReceive;
+        UBaseType_t uxSavedInterruptStatus;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_uxQueueReceiveMultipleFromISR( xQueue, pvBuffer, uxMaxItems, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer != NULL );
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
+        {
+            uxToReceive = prvQueueItemsAvailable( pxQueue );
+
+            if( uxToReceive > uxMaxItems )
+            {
+                uxToReceive = uxMaxItems;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( uxToReceive > ( UBaseType_t ) 0U )
+            {
+                int8_t cRxLock = pxQueue->cRxLock;
+                UBaseType_t ux;
+
+                traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+                prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxToReceive );
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - uxToReceive );
+
+                if( cRxLock == queueUNLOCKED )
+                {
+                    if( ( prvUnblockEventListTasks( &( pxQueue->xTasksWaitingToSend ), uxToReceive ) != pdFALSE ) &&
+                        ( pxHigherPriorityTaskWoken != NULL ) )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    for( ux = 0; ux < uxToReceive; ux++ )
+                    {
+                        prvIncrementQueueRxLock( pxQueue, cRxLock );
+                        cRxLock = pxQueue->cRxLock;
+                    }
+                }
+            }
+            else
+            {
+                traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+            }
+        }
+        queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
+
+        traceRETURN_uxQueueReceiveMultipleFromISR( uxToReceive );
+
+        return uxToReceive;
+    }
+
+#endif /* configUSE_QUEUE_BATCH */
+/*-----------------------------------------------------------*/
+
+// 函数定义：获取信号量（底层实现，对应应用层的xSemaphoreTake()）
+// 参数：
+//   xQueue - 目标信号量句柄（本质是队列句柄，需确保是信号量类型的队列）
+//   xTicksToWait - 信号量不可用时的阻塞等待时间（单位：时钟节拍；portMAX_DELAY表示永久等待）
+// 返回值：
+//   pdPASS - 成功获取信号量（计数减1）
+//   errQUEUE_EMPTY - 信号量不可用（计数为0）且等待超时/无等待时间
+BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
+                                TickType_t xTicksToWait )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;  // 标记“是否已设置超时起始时间”（初始未设置）
+    TimeOut_t xTimeOut;                  // 超时管理结构体（存储超时起始时间、溢出状态等）
+    Queue_t * const pxQueue = xQueue;    // 将信号量句柄强制转换为队列结构体指针（信号量本质是队列）
+
+    // 条件编译：若启用互斥锁功能，需记录“是否触发优先级继承”
+    #if ( configUSE_MUTEXES == 1 )
+        BaseType_t xInheritanceOccurred = pdFALSE;  // 标记“优先级继承是否发生”（初始未发生）
+    #endif
+
+    #if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+        UBaseType_t uxSpinsLeft = configADAPTIVE_MUTEX_SPIN_LIMIT;  // 本次调用剩余的自旋等待次数
+    #endif
+
+    // 跟踪函数进入（调试用，记录“开始获取信号量”）
+    traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait );
+
+    /* 断言1：检查信号量句柄是否有效（非NULL） */
+    configASSERT( ( pxQueue ) );
+
+    /* 断言2：检查当前操作的是“信号量”——信号量的队列元素大小必须为0（无需存储数据） */
+    configASSERT( pxQueue->uxItemSize == 0 );
+
+    /* 断言3：调度器挂起时不能阻塞等待（调度器挂起后无法切换任务，阻塞会导致死锁） */
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    #if ( configUSE_SEMAPHORE_FAST_PATH == 1 )
+    {
+        // 信号量可用且没有竞争时，不进入临界区
+        if( prvSemaphoreTakeFast( pxQueue ) != pdFALSE )
+        {
+            traceRETURN_xQueueSemaphoreTake( pdPASS );
+
+            return pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_SEMAPHORE_FAST_PATH */
+
+    // 无限循环：直到成功获取信号量或等待超时
+    for( ; ; )
+    {
+        // 1. 进入临界区：保护队列状态（避免并发修改消息数、任务等待列表）
+        queueENTER_CRITICAL( pxQueue );
+        {
+            /* 信号量本质是“元素大小为0的队列”，队列的“消息数”（uxMessagesWaiting）即信号量的“计数” */
+            const UBaseType_t uxSemaphoreCount = pxQueue->uxMessagesWaiting;
+
+            /* 分支1：信号量计数>0（可用），执行获取逻辑 */
+            if( uxSemaphoreCount > ( UBaseType_t ) 0 )
+            {
+                // 跟踪“成功读取队列”（调试用，信号量获取对应队列读取）
+                traceQUEUE_RECEIVE( pxQueue );
+
+                /* 信号量计数减1：消息数-1即表示成功获取信号量 */
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxSemaphoreCount - ( UBaseType_t ) 1 );
+
+                // 条件编译：若当前是互斥锁（而非普通信号量），需记录持有者信息
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    {
+                        /* 记录互斥锁持有者：
+                         * pvTaskIncrementMutexHeldCount()返回当前任务句柄，并递增任务的“持有互斥锁计数”
+                         * （用于后续优先级继承、防止重复释放等逻辑） */
+                        pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+
+                        #if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+                        {
+                            // 优先级天花板互斥量：持有者的优先级直接提升到天花板，释放最后一个互斥量时恢复
+                            if( queueIS_CEILING_MUTEX( pxQueue ) != pdFALSE )
+                            {
+                                vTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        #endif
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();  // 覆盖测试标记，无实际逻辑
+                    }
+                }
+                #endif /* configUSE_MUTEXES */
+
+                /* 检查是否有任务阻塞等待“释放信号量”（即等待发送消息到队列）：
+                 * 信号量获取后计数可能仍有剩余，需唤醒最高优先级的等待释放任务（若存在） */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    // 从“等待发送列表”中移除最高优先级任务并唤醒
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        // 若使用抢占式调度，唤醒的任务优先级可能更高，触发任务切换
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                // 退出临界区
+                queueEXIT_CRITICAL( pxQueue );
+
+                // 跟踪函数返回成功（调试用）
+                traceRETURN_xQueueSemaphoreTake( pdPASS );
+
+                return pdPASS;  // 成功获取信号量，返回pdPASS
+            }
+            /* 分支2：信号量计数=0（不可用），处理等待逻辑 */
+            else
+            {
+                /* 子分支2.1：无等待时间（xTicksToWait=0），直接返回失败 */
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    queueEXIT_CRITICAL( pxQueue );  // 退出临界区
+
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );  // 跟踪“队列读取失败”（调试用）
+                    traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
+
+                    return errQUEUE_EMPTY;  // 信号量不可用，返回失败
+                }
+                /* 子分支2.2：有等待时间，但未设置超时起始时间，初始化超时结构体 */
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );  // 记录当前时间为超时起始点
+                    xEntryTimeSet = pdTRUE;  // 标记“超时起始时间已设置”
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();  // 已设置超时时间，无操作
+                }
+            }
+        }
+        // 退出临界区：此时其他任务/中断可修改信号量状态（如释放信号量）
+        queueEXIT_CRITICAL( pxQueue );
+
+        #if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+        {
+            /* 持有者正在其它核心上运行时，临界区通常很快结束，自旋等待比阻塞后再被唤醒便宜。
+             * 互斥量释放后回到循环开头重新获取（超时起始时间已经记录，不会重新开始计时）。 */
+            if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) &&
+                ( prvMutexSpinWait( pxQueue, &uxSpinsLeft ) != pdFALSE ) )
+            {
+                continue;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_ADAPTIVE_MUTEXES */
+
+        /* 2. 处理阻塞等待：信号量不可用时，将当前任务加入等待列表并挂起 */
+        // 挂起调度器：避免在“检查超时→加入等待列表”过程中被其他任务抢占
+        vTaskSuspendAll();
+        // 锁定队列：标记队列正被操作，防止并发修改等待列表
+        prvLockQueue( pxQueue );
+
+        /* 检查超时状态：判断当前等待时间是否已过期 */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            /* 子分支1：未超时，且信号量仍不可用（队列空=计数0），将任务加入等待列表 */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                // 跟踪“任务阻塞等待队列读取”（调试用）
+                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+
+                // 条件编译：若当前是互斥锁，触发优先级继承（关键！防止优先级反转）
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    /* 优先级天花板互斥量的持有者已经运行在天花板优先级，不做优先级继承。 */
+                    if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( queueIS_CEILING_MUTEX( pxQueue ) == pdFALSE ) )
+                    {
+                        queueENTER_CRITICAL( pxQueue );
+                        {
+                            /* 优先级继承：
+                             * 若当前任务优先级 > 互斥锁持有者优先级，
+                             * 则将持有者优先级临时提升到当前任务优先级，避免优先级反转 */
+                            xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
+                        }
+                        queueEXIT_CRITICAL( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* if ( configUSE_MUTEXES == 1 ) */
+
+                // 将当前任务加入“等待接收列表”（等待信号量可用），并设置阻塞时间
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                // 解锁队列：允许其他任务操作队列
+                prvUnlockQueue( pxQueue );
+
+                /* 恢复调度器：
+                 * 若恢复后需要切换任务（如唤醒了更高优先级任务），则触发任务切换 */
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();  // 在API内部触发任务切换
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            /* 子分支2：未超时，但信号量已可用（其他任务/中断释放了信号量），重新进入循环尝试获取 */
+            else
+            {
+                prvUnlockQueue( pxQueue );  // 解锁队列
+                ( void ) xTaskResumeAll();  // 恢复调度器，无任务切换
+            }
+        }
+        /* 子分支2：等待超时，处理超时逻辑 */
+        else
+        {
+            prvUnlockQueue( pxQueue );  // 解锁队列
+            ( void ) xTaskResumeAll();  // 恢复调度器
+
+            /* 检查信号量是否仍不可用（队列空=计数0）：
+             * 若超时后信号量仍不可用，返回失败；否则重新进入循环尝试获取 */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                // 条件编译：若此前触发了优先级继承，超时后需恢复持有者的原始优先级
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    if( xInheritanceOccurred != pdFALSE )
+                    {
+                        queueENTER_CRITICAL( pxQueue );
+                        {
+                            /* 步骤1：获取等待该互斥锁的最高优先级任务优先级 */
+                            UBaseType_t uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
+
+                            /* 步骤2：恢复互斥锁持有者的原始优先级：
+                             * 将持有者优先级从“继承的高优先级”恢复到“原始优先级”，
+                             * 但不低于“等待队列中最高优先级”（避免后续等待任务仍被阻塞） */
+                            vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+                        }
+                        queueEXIT_CRITICAL( pxQueue );
+                    }
+                }
+                #endif /* configUSE_MUTEXES */
+
+                traceQUEUE_RECEIVE_FAILED( pxQueue );  // 跟踪“队列读取失败”（调试用）
+                traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
+
+                return errQUEUE_EMPTY;  // 超时且信号量仍不可用，返回失败
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();  // 超时后信号量已可用，重新进入循环尝试获取
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+// 函数定义：从队列中查看数据（不删除数据）
+// 参数：xQueue-队列句柄；pvBuffer-接收数据的缓冲区指针；xTicksToWait-等待超时时间（时钟周期）
+// 返回值：pdPASS表示成功查看数据；errQUEUE_EMPTY表示队列空或超时
+BaseType_t xQueuePeek( QueueHandle_t xQueue,
+                       void * const pvBuffer,
+                       TickType_t xTicksToWait )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;  // 标记是否已设置超时起始时间（初始未设置）
+    TimeOut_t xTimeOut;                  // 超时管理结构体（用于跟踪等待时间）
+    int8_t * pcOriginalReadPosition;     // 保存原始读指针位置（用于查看后恢复）
+    Queue_t * const pxQueue = xQueue;    // 将队列句柄转换为内部队列结构体指针
+
+    // 跟踪函数进入（用于调试和跟踪）
+    traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait );
+
+    // 断言检查：队列指针不能为空（确保参数有效性）
+    configASSERT( ( pxQueue ) );
+
+    // 断言检查：会合队列没有可以查看的数据项
+    configASSERT( pxQueue->uxLength != ( UBaseType_t ) 0U );
+
+    // 断言检查：如果队列元素大小不为0，则接收缓冲区不能为NULL
+    // （避免无缓冲区却要复制数据的错误）
+    configASSERT( !( ( ( pvBuffer ) == NULL ) && ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+    // 断言检查：调度器挂起时不能阻塞等待（防止死锁）
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    // 无限循环：直到成功获取数据或超时退出
+    for( ; ; )
+    {
+        // 进入临界区（禁用任务调度，保护队列操作）
+        queueENTER_CRITICAL( pxQueue );
+        {
+            // 获取当前队列中的消息数量
+            const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+            // 如果队列中有消息（且当前任务是最高优先级访问队列的任务）
+            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            {
+                // 保存原始读指针位置（因为查看操作不删除数据，后续需要恢复）
+                pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+
+                // 从队列复制数据到缓冲区（内部函数，处理实际数据拷贝）
+                prvCopyDataFromQueue( pxQueue, pvBuffer );
+                // 跟踪队列查看操作（调试用）
+                traceQUEUE_PEEK( pxQueue );
+
+                // 恢复读指针（因为是查看操作，不移动读指针）
+                pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+                // 检查是否有其他任务在等待接收该队列的数据
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                {
+                    // 将等待队列中的任务移除并唤醒（因为数据仍在队列中）
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        // 如果被唤醒的任务优先级更高，则触发任务切换
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        // 覆盖测试标记（用于代码覆盖率测试）
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                // 退出临界区
+                queueEXIT_CRITICAL( pxQueue );
+
+                // 跟踪函数返回（调试用）并返回成功
+                traceRETURN_xQueuePeek( pdPASS );
+                return pdPASS;
+            }
+            else  // 队列为空的情况
+            {
+                // 如果超时时间为0（不等待），直接退出
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    // 退出临界区
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    // 跟踪查看失败（调试用）并返回队列空错误
+                    traceQUEUE_PEEK_FAILED( pxQueue );
+                    traceRETURN_xQueuePeek( errQUEUE_EMPTY );
+                    return errQUEUE_EMPTY;
+                }
+                // 如果未设置超时起始时间，则初始化超时结构体
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );  // 设置超时起始状态
+                    xEntryTimeSet = pdTRUE;  // 标记已设置超时时间
+                }
+                else
+                {
+                    // 已设置超时时间，覆盖测试标记
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        // 退出临界区（允许其他任务/中断访问队列）
+        queueEXIT_CRITICAL( pxQueue );
+
+        // 挂起所有任务调度（准备进入阻塞状态）
+        vTaskSuspendAll();
+        // 锁定队列（防止其他操作干扰）
+        prvLockQueue( pxQueue );
+
+        // 检查超时是否已发生（更新剩余等待时间）
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            // 超时未发生：检查队列是否仍为空
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                // 队列为空：将当前任务加入等待接收队列，进入阻塞状态
+                traceBLOCKING_ON_QUEUE_PEEK( pxQueue );  // 跟踪阻塞操作
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                // 解锁队列
+                prvUnlockQueue( pxQueue );
+
+                // 恢复任务调度，如果需要则触发任务切换
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                // 队列已有数据：不进入阻塞状态，解锁队列并恢复调度，重新尝试获取数据
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else  // 超时已发生
+        {
+            // 解锁队列并恢复任务调度
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            // 检查队列是否仍为空
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                // 队列仍为空：跟踪失败并返回超时错误
+                traceQUEUE_PEEK_FAILED( pxQueue );
+                traceRETURN_xQueuePeek( errQUEUE_EMPTY );
+                return errQUEUE_EMPTY;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+// 函数定义：中断安全版队列读取函数（从队列头部读取数据，支持唤醒等待发送的高优先级任务）
+// 参数：
+//   xQueue - 目标队列句柄（需提前通过xQueueCreate创建）
+//   pvBuffer - 存储读取数据的缓冲区指针（大小需≥队列元素大小）
+//   pxHigherPriorityTaskWoken - 指向“高优先级任务是否被唤醒”标记的指针
+// 返回值：pdPASS表示成功读取数据；pdFAIL表示队列为空，无数据可读
+BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
+                                 void * const pvBuffer,
+                                 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    BaseType_t xReturn;                     // 函数返回值（pdPASS/pdFAIL）
+    UBaseType_t uxSavedInterruptStatus;     // 保存的中断状态（用于中断安全的临界区保护）
+    Queue_t * const pxQueue = xQueue;       // 将队列句柄转换为内部结构体指针（FreeRTOS队列核心数据结构）
+
+    // 跟踪函数进入（调试用，记录“中断安全队列读取操作开始”）
+    traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken );
+
+    // 断言检查：队列句柄必须有效（非NULL）
+    configASSERT( pxQueue );
+    // 断言检查：若队列元素大小≠0（需存储实际数据），则缓冲区指针不可为NULL（避免内存访问错误）
+    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+    /* 支持中断嵌套的RTOS端口有“最大系统调用中断优先级”的概念：
+     * - 高于此优先级的中断会永久使能，即使内核处于临界区，也禁止调用FreeRTOS API；
+     * - 低于/等于此优先级的中断，仅可调用以FromISR结尾的API（如本函数）。
+     * 若开启configASSERT()，当从高于最大系统调用优先级的中断中调用本函数时，
+     * portASSERT_IF_INTERRUPT_PRIORITY_INVALID()会触发断言失败，提示非法调用。
+     * 更多Cortex-M端口细节参考：https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    /* MISRA规范参考 4.7.1 [返回值必须被检查] */
+    /* 详细说明：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    
+    // 进入中断安全的临界区：仅禁用低于“最大系统调用优先级”的中断，保证高优先级中断正常响应
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
+    {
+        // 记录当前队列中的“消息数”（即待读取的数据项数量）
+        const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+        /* 中断环境禁止阻塞，因此先检查队列是否有数据可读（消息数>0） */
+        if( prvQueueHasData( pxQueue ) )  // 队列非空，可读取数据
+        {
+            const int8_t cRxLock = pxQueue->cRxLock;  // 队列的“读取锁定状态”（区分发送锁定cTxLock）
+
+            // 跟踪队列从ISR读取的操作（调试用，记录“成功进入数据读取流程”）
+            traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+            // 1. 从队列复制数据到缓冲区：按队列元素大小，将队列头部数据复制到pvBuffer
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
+            // 2. 减少队列消息数：读取成功后，队列中待读取的数据项数量减1（腾出1个空间）
+            pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+
+            /* 若队列被“读取锁定”，则不修改任务等待列表（事件列表），
+             * 待队列解锁后，由解锁任务统一处理唤醒逻辑。 */
+            if( cRxLock == queueUNLOCKED )  // 队列未被读取锁定，可正常处理任务唤醒
+            {
+                // 检查是否有任务因“队列满”阻塞（等待向队列发送数据）
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    // 从“等待发送任务列表”中移除任务并唤醒它（该任务现在可向队列发送数据）
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        /* 被唤醒的任务优先级高于当前运行任务（即被中断打断的任务），
+                         * 标记“需要上下文切换”，告知中断服务程序退出前触发切换。 */
+                        if( pxHigherPriorityTaskWoken != NULL )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();  // 覆盖测试标记，无实际业务逻辑
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else  // 队列被读取锁定
+            {
+                /* 增加“读取锁定计数”：告知后续解锁队列的任务，
+                 * “锁定期间有数据被读取，需处理等待发送的任务”。 */
+                prvIncrementQueueRxLock( pxQueue, cRxLock );
+            }
+
+            // 数据读取成功，返回pdPASS
+            xReturn = pdPASS;
+        }
+        else  // 队列为空，无数据可读取
+        {
+            xReturn = pdFAIL;  // 返回pdFAIL表示读取失败
+            traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );  // 跟踪读取失败（调试用）
+        }
+    }
+    // 退出中断安全的临界区，恢复进入前的中断状态（确保不影响其他中断）
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
+
+    // 跟踪函数返回值（调试用，记录“中断安全队列读取操作结束”）
+    traceRETURN_xQueueReceiveFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+// 函数定义：中断服务程序(ISR)中使用的队列查看函数（不删除数据）
+// 参数：xQueue-队列句柄；pvBuffer-接收数据的缓冲区指针
+// 返回值：pdPASS表示成功查看数据；pdFAIL表示失败（通常因为队列空）
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
+                              void * const pvBuffer )
+{
+    BaseType_t xReturn;                     // 函数返回值（成功/失败）
+    UBaseType_t uxSavedInterruptStatus;     // 保存的中断状态（用于退出临界区时恢复）
+    int8_t * pcOriginalReadPosition;        // 保存原始读指针位置（用于查看后恢复）
+    Queue_t * const pxQueue = xQueue;       // 将队列句柄转换为内部队列结构体指针
+
+    // 跟踪函数进入（用于调试和跟踪）
+    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+
+    // 断言检查：队列指针不能为空
+    configASSERT( pxQueue );
+    // 断言检查：如果队列元素大小不为0，则接收缓冲区不能为NULL
+    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+    // 断言检查：不能对信号量使用peek操作（信号量没有数据项）
+    configASSERT( pxQueue->uxItemSize != 0 ); /* 不能查看信号量 */
+
+    /* 支持中断嵌套的RTOS端口有"最大系统调用中断优先级"的概念。
+     * 高于此优先级的中断会始终保持使能，即使RTOS内核处于临界区，
+     * 但这些中断不能调用任何FreeRTOS API函数。
+     * 如果在FreeRTOSConfig.h中定义了configASSERT()，则当从高于
+     * 配置的最大系统调用优先级的中断中调用FreeRTOS API函数时，
+     * portASSERT_IF_INTERRUPT_PRIORITY_INVALID()会导致断言失败。
+     * 只有以FromISR结尾的FreeRTOS函数可以从中断中调用，且这些中断的
+     * 优先级必须小于等于最大系统调用中断优先级。
+     * FreeRTOS维护独立的中断安全API，以确保中断处理尽可能快速简单。
+     * 更多信息（针对Cortex-M）请参考：https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    /* MISRA规则4.7.1 [返回值必须被检查] */
+    /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    // 进入中断安全的临界区，并保存当前中断状态
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
+    {
+        // 中断中不能阻塞，因此直接检查队列中是否有数据
+        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        {
+            // 跟踪ISR中的队列查看操作（调试用）
+            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+            // 保存原始读指针位置（因为是查看操作，不删除数据）
+            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+            // 从队列复制数据到缓冲区
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
+            // 恢复读指针（不移动读指针，数据仍在队列中）
+            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+            // 标记成功
+            xReturn = pdPASS;
+        }
+        else
+        {
+            // 队列为空，标记失败
+            xReturn = pdFAIL;
+            // 跟踪ISR中查看队列失败（调试用）
+            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    // 退出中断安全的临界区，恢复之前保存的中断状态
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
+
+    // 跟踪函数返回（调试用）
+    traceRETURN_xQueuePeekFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+
+    traceENTER_uxQueueMessagesWaiting( xQueue );
+
+    configASSERT( xQueue );
+
+    queueENTER_CRITICAL( ( Queue_t * ) xQueue );
+    {
+        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+    }
+    queueEXIT_CRITICAL( ( Queue_t * ) xQueue );
+
+    traceRETURN_uxQueueMessagesWaiting( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueSpacesAvailable( xQueue );
+
+    configASSERT( pxQueue );
+
+    queueENTER_CRITICAL( pxQueue );
+    {
+        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting - prvZeroCopyHeldSlots( pxQueue ) );
+    }
+    queueEXIT_CRITICAL( pxQueue );
+
+    traceRETURN_uxQueueSpacesAvailable( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
+
+    configASSERT( pxQueue );
+    uxReturn = pxQueue->uxMessagesWaiting;
+
+    traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+// 函数定义：删除队列并释放相关内存
+// 参数：xQueue - 待删除队列的句柄
+void vQueueDelete( QueueHandle_t xQueue )
+{
+    // 将队列句柄转换为内部队列结构体指针（便于访问队列的成员变量）
+    Queue_t * const pxQueue = xQueue;
+
+    // 跟踪函数进入（用于调试和代码跟踪，记录“开始删除队列”的操作）
+    traceENTER_vQueueDelete( xQueue );
+
+    // 断言检查：确保传入的队列句柄有效（非NULL），若无效则触发断言（需开启configASSERT）
+    configASSERT( pxQueue );
+    // 跟踪队列删除操作（调试用，记录“正在删除指定队列”的事件）
+    traceQUEUE_DELETE( pxQueue );
+
+    // 若配置了队列注册功能（configQUEUE_REGISTRY_SIZE > 0），先将队列从注册列表中移除
+    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+    {
+        // 调用vQueueUnregisterQueue，取消队列在注册中心的登记（避免后续通过注册名访问已删除的队列）
+        vQueueUnregisterQueue( pxQueue );
+    }
+    #endif
+
+    // 分支1：仅支持动态内存分配，不支持静态分配的场景
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+    {
+        /* 队列只能是动态分配的（因为不支持静态分配），因此直接释放其内存 */
+        // 调用vPortFree（FreeRTOS封装的内存释放函数），释放队列结构体占用的动态内存
+        vPortFree( pxQueue );
+    }
+    // 分支2：同时支持动态和静态内存分配的场景
+    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    {
+        /* 队列可能是静态分配，也可能是动态分配，因此先判断再释放内存 */
+        // 检查队列的“静态分配标记”：ucStaticallyAllocated为pdFALSE表示动态分配
+        if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+        {
+            // 动态分配的队列，调用vPortFree释放内存
+            vPortFree( pxQueue );
+        }
+        else
+        {
+            // 静态分配的队列（内存由用户预先分配，无需FreeRTOS释放），仅作覆盖测试标记
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    // 分支3：仅支持静态内存分配，不支持动态分配的场景
+    #else /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) ) */
+    {
+        /* 队列只能是静态分配的，无需释放内存（内存由用户管理）。
+         * 此处显式使用pxQueue参数，避免编译器报“未使用参数”的警告 */
+        ( void ) pxQueue;
+    }
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+    // 跟踪函数返回（调试用，记录“队列删除操作结束”）
+    traceRETURN_vQueueDelete();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+    {
+        traceENTER_uxQueueGetQueueNumber( xQueue );
+
+        traceRETURN_uxQueueGetQueueNumber( ( ( Queue_t * ) xQueue )->uxQueueNumber );
+
+        return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vQueueSetQueueNumber( QueueHandle_t xQueue,
+                               UBaseType_t uxQueueNumber )
+    {
+        traceENTER_vQueueSetQueueNumber( xQueue, uxQueueNumber );
+
+        ( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+
+        traceRETURN_vQueueSetQueueNumber();
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+    {
+        traceENTER_ucQueueGetQueueType( xQueue );
+
+        traceRETURN_ucQueueGetQueueType( ( ( Queue_t * ) xQueue )->ucQueueType );
+
+        return ( ( Queue_t * ) xQueue )->ucQueueType;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueGetQueueItemSize( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
+{
+    traceENTER_uxQueueGetQueueItemSize( xQueue );
+
+    traceRETURN_uxQueueGetQueueItemSize( ( ( Queue_t * ) xQueue )->uxItemSize );
+
+    return ( ( Queue_t * ) xQueue )->uxItemSize;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
+{
+    traceENTER_uxQueueGetQueueLength( xQueue );
+
+    traceRETURN_uxQueueGetQueueLength( ( ( Queue_t * ) xQueue )->uxLength );
+
+    return ( ( Queue_t * ) xQueue )->uxLength;
+}
+/*-----------------------------------------------------------*/
+
+// 条件编译：仅当启用互斥锁功能（configUSE_MUTEXES == 1）时，才编译该静态函数
+#if ( configUSE_MUTEXES == 1 )
+
+    // 静态函数定义：获取互斥锁等待队列中最高优先级任务的优先级（用于超时后的优先级恢复）
+    // 参数：pxQueue - 指向目标互斥锁对应的队列结构体指针（互斥锁本质是队列）
+    // 返回值：等待该互斥锁的所有任务中，最高优先级的值；若无等待任务，返回空闲任务优先级（tskIDLE_PRIORITY）
+    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks;  // 存储等待任务的最高优先级
+
+        /* 注释：若某任务因等待互斥锁而触发了“优先级继承”（互斥锁持有者优先级被提升），
+         * 但该等待任务最终超时（未获取到互斥锁），则持有者需要“取消优先级继承”（恢复优先级）；
+         * 但恢复后的优先级不能低于“其他仍在等待该互斥锁的任务中的最高优先级”——
+         * 本函数的作用就是获取这个“其他等待任务的最高优先级”，作为持有者恢复优先级的下限。 */
+        if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
+        {
+            /* 若等待列表（xTasksWaitingToReceive）中有任务：
+             * 1. listGET_ITEM_VALUE_OF_HEAD_ENTRY：获取等待列表头部任务的“列表项值”（FreeRTOS中，列表项值存储的是“优先级的反转值”）；
+             * 2. 计算逻辑：最高优先级 = 最大优先级数（configMAX_PRIORITIES） - 列表项值（反转值）；
+             * （注：FreeRTOS列表按“优先级反转值”排序，头部是最高优先级任务，反转是为了让列表按升序存储，简化插入逻辑） */
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( 
+                ( UBaseType_t ) configMAX_PRIORITIES - 
+                ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) ) 
+            );
+        }
+        else
+        {
+            /* 若等待列表中无任务：
+             * 持有者恢复优先级的下限为“空闲任务优先级”（tskIDLE_PRIORITY，通常为0），
+             * 即持有者可直接恢复到自己的原始优先级。 */
+            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        }
+
+        return uxHighestPriorityOfWaitingTasks;  // 返回计算出的“优先级恢复下限”
+    }
+
+#endif /* 结束 configUSE_MUTEXES == 1 的条件编译 */
+/*-----------------------------------------------------------*/
+
+// 静态函数：将数据复制到队列存储区的核心实现，根据入队位置（队首/队尾/覆盖）调整队列指针
+// 仅在临界区内被xQueueGenericSend调用，确保队列状态操作的原子性
+static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,    // 目标队列的内部控制结构指针
+                                      const void * pvItemToQueue,  // 待复制的数据源指针
+                                      const BaseType_t xPosition ) // 入队位置：queueSEND_TO_FRONT/queueSEND_TO_BACK/queueOVERWRITE
+{
+    BaseType_t xReturn = pdFALSE;  // 返回值：仅用于互斥锁场景（优先级继承相关）
+    UBaseType_t uxMessagesWaiting;  // 记录当前队列中的项目数（用于覆盖模式下的计数修正）
+
+    /* 注意：此函数仅在临界区内调用，无需额外加锁 */
+
+    // 保存当前队列的项目数（后续覆盖模式需修正该值）
+    uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+    // 分支1：项目大小为0（uxItemSize=0）——通常用于同步队列/互斥锁（无实际数据存储）
+    if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+    {
+        #if ( configUSE_MUTEXES == 1 )  // 仅启用互斥锁时处理
+        {
+            // 判断队列是否为互斥锁（FreeRTOS中互斥锁基于队列实现，类型为queueQUEUE_IS_MUTEX）
+            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+            {
+                /* 互斥锁释放逻辑：
+                   - 调用xTaskPriorityDisinherit：取消持有任务的优先级继承（若之前因互斥锁提升过优先级）
+                   - 将互斥锁持有者设为NULL：标记互斥锁已释放
+                   - 返回值xReturn：表示是否需要触发任务切换（优先级继承取消后可能需要） */
+                #if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+                    if( queueIS_CEILING_MUTEX( pxQueue ) != pdFALSE )
+                    {
+                        /* 天花板互斥量：恢复优先级后只在有更高优先级的就绪任务时才要求切换 */
+                        xReturn = xTaskPriorityDisinheritCeiling( pxQueue->u.xSemaphore.xMutexHolder );
+                    }
+                    else
+                #endif
+                {
+                    xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+                }
+
+                pxQueue->u.xSemaphore.xMutexHolder = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();  // 覆盖测试标记（非互斥锁场景）
+            }
+        }
+        #endif /* configUSE_MUTEXES */
+    }
+    // 分支2：入队位置为队尾（queueSEND_TO_BACK）——FIFO模式
+    else if( xPosition == queueSEND_TO_BACK )
+    {
+        // 核心操作：将数据源数据复制到队列的“写入指针（pcWriteTo）”位置
+        queueCOPY_ITEM( pxQueue, ( void * ) pxQueue->pcWriteTo, pvItemToQueue );
+        
+        // 更新写入指针：向后偏移一个项目大小（指向下次写入的位置）
+        pxQueue->pcWriteTo += pxQueue->uxItemSize;
+
+        // 边界处理：若写入指针超过队列尾部（pcTail），则回卷到队列头部（pcHead）——循环队列特性
+        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+        {
+            pxQueue->pcWriteTo = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    // 分支3：入队位置为队首（queueSEND_TO_FRONT）或覆盖（queueOVERWRITE）
+    else
+    {
+        // 核心操作：将数据源数据复制到队列的“读取指针（pcReadFrom）”位置
+        // （队首入队/覆盖模式均从读取指针位置写入，因读取指针始终指向队首项目）
+        queueCOPY_ITEM( pxQueue, ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue );
+        
+        // 更新读取指针：向前偏移一个项目大小（指向新的队首位置）
+        pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize; //怎么体现覆盖的呢：覆盖用于队列长度为1的场景
+
+        // 边界处理：若读取指针低于队列头部（pcHead），则回卷到队列尾部前一个项目位置——循环队列特性
+        if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
+        {
+            pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        // 子分支：若为覆盖模式（queueOVERWRITE）——仅单项目队列可用
+        if( xPosition == queueOVERWRITE )
+        {
+            // 若队列中已有项目（uxMessagesWaiting>0），则修正项目计数：
+            // 覆盖模式是“替换”而非“新增”，因此先减1（抵消后续的加1操作），确保计数不变
+            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            {
+                --uxMessagesWaiting;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();  // 队列空时覆盖=新增，无需修正
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();  // 队首入队模式，无需修正计数
+        }
+    }
+
+    // 统一更新队列项目数：无论哪种模式，最终计数=修正后的当前数+1（覆盖模式因提前减1，实际计数不变）
+    pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting + ( UBaseType_t ) 1 );
+
+    return xReturn;  // 仅互斥锁场景有效，其他场景返回pdFALSE（无意义）
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyDataFromQueue( Queue_t * const pxQueue,
+                                  void * const pvBuffer )
+{
+    if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+    {
+        pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+
+        if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+        {
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        queueCOPY_ITEM( pxQueue, ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH == 1 )
+
+    static void prvCopyMultipleToQueue( Queue_t * const pxQueue,
+                                        const void * pvItemsToQueue,
+                                        const UBaseType_t uxCount )
+    {
+        const size_t xItemSize = ( size_t ) pxQueue->uxItemSize;
+        const uint8_t * pucSource = ( const uint8_t * ) pvItemsToQueue;
+        size_t xFirstItems = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo ) / xItemSize;
+
+        /* 第一段写到存储区末尾为止，剩下的回卷到存储区开头。 */
+        if( xFirstItems > ( size_t ) uxCount )
+        {
+            xFirstItems = ( size_t ) uxCount;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) pucSource, xFirstItems * xItemSize );
+        pxQueue->pcWriteTo += xFirstItems * xItemSize;
+
+        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+        {
+            pxQueue->pcWriteTo = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xFirstItems < ( size_t ) uxCount )
+        {
+            const size_t xRemainingBytes = ( ( size_t ) uxCount - xFirstItems ) * xItemSize;
+
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, ( const void * ) &( pucSource[ xFirstItems * xItemSize ] ), xRemainingBytes );
+            pxQueue->pcWriteTo += xRemainingBytes;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + uxCount );
+    }
+
+#endif /* configUSE_QUEUE_BATCH */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH == 1 )
+
+    static void prvCopyMultipleFromQueue( Queue_t * const pxQueue,
+                                          void * const pvBuffer,
+                                          const UBaseType_t uxCount )
+    {
+        const size_t xItemSize = ( size_t ) pxQueue->uxItemSize;
+        uint8_t * const pucDestination = ( uint8_t * ) pvBuffer;
+        int8_t * pcFirst = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+        size_t xFirstItems;
+
+        /* pcReadFrom 指向上一次读出的项目，队首在它后面一个。 */
+        if( pcFirst >= pxQueue->u.xQueue.pcTail )
+        {
+            pcFirst = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xFirstItems = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcFirst ) / xItemSize;
+
+        if( xFirstItems > ( size_t ) uxCount )
+        {
+            xFirstItems = ( size_t ) uxCount;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memcpy( ( void * ) pucDestination, ( const void * ) pcFirst, xFirstItems * xItemSize );
+        pxQueue->u.xQueue.pcReadFrom = pcFirst + ( ( xFirstItems - 1U ) * xItemSize );
+
+        if( xFirstItems < ( size_t ) uxCount )
+        {
+            const size_t xRemainingBytes = ( ( size_t ) uxCount - xFirstItems ) * xItemSize;
+
+            ( void ) memcpy( ( void * ) &( pucDestination[ xFirstItems * xItemSize ] ), ( const void * ) pxQueue->pcHead, xRemainingBytes );
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( xRemainingBytes - xItemSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_QUEUE_BATCH */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_BATCH == 1 )
+
+    static BaseType_t prvUnblockEventListTasks( List_t * const pxEventList,
+                                                UBaseType_t uxMaxTasks )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        while( ( uxMaxTasks > ( UBaseType_t ) 0U ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+        {
+            if( queueREMOVE_FROM_EVENT_LIST( pxEventList ) != pdFALSE )
+            {
+                xHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxMaxTasks--;
+        }
+
+        return xHigherPriorityTaskWoken;
+    }
+
+#endif /* configUSE_QUEUE_BATCH */
+/*-----------------------------------------------------------*/
+
+static void prvUnlockQueue( Queue_t * const pxQueue )
+{
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
+
+    /* The lock counts contains the number of extra data items placed or
+     * removed from the queue while the queue was locked.  When a queue is
+     * locked items can be added or removed, but the event lists cannot be
+     * updated. */
+    queueENTER_CRITICAL( pxQueue );
+    {
+        int8_t cTxLock = pxQueue->cTxLock;
+
+        /* See if data was added to the queue while it was locked. */
+        while( cTxLock > queueLOCKED_UNMODIFIED )
+        {
+            /* Data was posted while the queue was locked.  Are any tasks
+             * blocked waiting for data to become available? */
+            #if ( configUSE_QUEUE_SETS == 1 )
+            {
+                if( pxQueue->pxQueueSetContainer != NULL )
+                {
+                    if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                    {
+                        /* The queue is a member of a queue set, and posting to
+                         * the queue set caused a higher priority task to unblock.
+                         * A context switch is required. */
+                        vTaskMissedYield();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Tasks that are removed from the event list will get
+                     * added to the pending ready list as the scheduler is still
+                     * suspended. */
+                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    {
+                        if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                        {
+                            /* The task waiting has a higher priority so record that a
+                             * context switch is required. */
+                            vTaskMissedYield();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+            }
+            #else /* configUSE_QUEUE_SETS */
+            {
+                /* Tasks that are removed from the event list will get added to
+                 * the pending ready list as the scheduler is still suspended. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                {
+                    if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        /* The task waiting has a higher priority so record that
+                         * a context switch is required. */
+                        vTaskMissedYield();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    break;
+                }
+            }
+            #endif /* configUSE_QUEUE_SETS */
+
+            --cTxLock;
+        }
+
+        pxQueue->cTxLock = queueUNLOCKED;
+    }
+    queueEXIT_CRITICAL( pxQueue );
+
+    /* Do the same for the Rx lock. */
+    queueENTER_CRITICAL( pxQueue );
+    {
+        int8_t cRxLock = pxQueue->cRxLock;
+
+        while( cRxLock > queueLOCKED_UNMODIFIED )
+        {
+            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+            {
+                if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                {
+                    vTaskMissedYield();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                --cRxLock;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        pxQueue->cRxLock = queueUNLOCKED;
+    }
+    queueEXIT_CRITICAL( pxQueue );
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+    {
+        /* 退出 prvLockQueue() 进入的队列临界区。 */
+        queueEXIT_CRITICAL( pxQueue );
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+    static void prvQueueEnterCritical( const Queue_t * const pxQueue )
+    {
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            taskENTER_CRITICAL();
         }
         else
         {
-            // 队列为空，标记失败
-            xReturn = pdFAIL;
-            // 跟踪ISR中查看队列失败（调试用）
-            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+            taskENTER_CRITICAL_OBJECT( queueSPINLOCK( pxQueue ) );
         }
     }
-    // 退出中断安全的临界区，恢复之前保存的中断状态
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
-
-    // 跟踪函数返回（调试用）
-    traceRETURN_xQueuePeekFromISR( xReturn );
-
-    return xReturn;
-}
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-
-    traceENTER_uxQueueMessagesWaiting( xQueue );
-
-    configASSERT( xQueue );
-
-    taskENTER_CRITICAL();
+    static void prvQueueExitCritical( const Queue_t * const pxQueue )
     {
-        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            taskEXIT_CRITICAL_OBJECT( queueSPINLOCK( pxQueue ) );
+        }
     }
-    taskEXIT_CRITICAL();
-
-    traceRETURN_uxQueueMessagesWaiting( uxReturn );
-
-    return uxReturn;
-}
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
+    static UBaseType_t prvQueueEnterCriticalFromISR( const Queue_t * const pxQueue )
+    {
+        UBaseType_t uxSavedInterruptStatus;
 
-    traceENTER_uxQueueSpacesAvailable( xQueue );
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        }
+        else
+        {
+            uxSavedInterruptStatus = taskENTER_CRITICAL_OBJECT_FROM_ISR( queueSPINLOCK( pxQueue ) );
+        }
 
-    configASSERT( pxQueue );
+        return uxSavedInterruptStatus;
+    }
+/*-----------------------------------------------------------*/
 
-    taskENTER_CRITICAL();
+    static void prvQueueExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus,
+                                             const Queue_t * const pxQueue )
     {
-        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            taskEXIT_CRITICAL_OBJECT_FROM_ISR( uxSavedInterruptStatus, queueSPINLOCK( pxQueue ) );
+        }
     }
-    taskEXIT_CRITICAL();
-
-    traceRETURN_uxQueueSpacesAvailable( uxReturn );
-
-    return uxReturn;
-}
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
-
-    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
+    static BaseType_t prvQueueRemoveFromEventList( List_t * const pxEventList )
+    {
+        BaseType_t xReturn = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus;
 
-    configASSERT( pxQueue );
-    uxReturn = pxQueue->uxMessagesWaiting;
+        /* 事件列表和就绪列表属于内核，嵌套获取内核中断锁（互斥量已持有全局临界区时只增加嵌套深度）。 */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+            {
+                xReturn = xTaskRemoveFromEventList( pxEventList );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-    traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn );
+        return xReturn;
+    }
 
-    return uxReturn;
-}
+#endif /* configUSE_GRANULAR_LOCKS */
 /*-----------------------------------------------------------*/
 
-// 函数定义：删除队列并释放相关内存
-// 参数：xQueue - 待删除队列的句柄
-void vQueueDelete( QueueHandle_t xQueue )
-{
-    // 将队列句柄转换为内部队列结构体指针（便于访问队列的成员变量）
-    Queue_t * const pxQueue = xQueue;
+#if ( configUSE_QUEUE_HANDOFF == 1 )
 
-    // 跟踪函数进入（用于调试和代码跟踪，记录“开始删除队列”的操作）
-    traceENTER_vQueueDelete( xQueue );
+    static BaseType_t prvQueueHandOff( const Queue_t * const pxQueue,
+                                       List_t * const pxEventList,
+                                       void * const pvItem,
+                                       const BaseType_t xCopyToWaiter,
+                                       BaseType_t * const pxYieldRequired )
+    {
+        BaseType_t xReturn = pdFALSE;
+        void * pvWaiterBuffer;
 
-    // 断言检查：确保传入的队列句柄有效（非NULL），若无效则触发断言（需开启configASSERT）
-    configASSERT( pxQueue );
-    // 跟踪队列删除操作（调试用，记录“正在删除指定队列”的事件）
-    traceQUEUE_DELETE( pxQueue );
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+            UBaseType_t uxSavedInterruptStatus;
 
-    // 若配置了队列注册功能（configQUEUE_REGISTRY_SIZE > 0），先将队列从注册列表中移除
-    #if ( configQUEUE_REGISTRY_SIZE > 0 )
-    {
-        // 调用vQueueUnregisterQueue，取消队列在注册中心的登记（避免后续通过注册名访问已删除的队列）
-        vQueueUnregisterQueue( pxQueue );
-    }
-    #endif
+            /* 节拍中断只持有内核中断锁就会把超时的任务移出事件列表。查看链表头部、复制和唤醒必须在
+             * 同一次中断锁内完成，否则数据项可能交给已经超时的任务，或者唤醒的是另一个任务。 */
+            uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        #endif
 
-    // 分支1：仅支持动态内存分配，不支持静态分配的场景
-    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
-    {
-        /* 队列只能是动态分配的（因为不支持静态分配），因此直接释放其内存 */
-        // 调用vPortFree（FreeRTOS封装的内存释放函数），释放队列结构体占用的动态内存
-        vPortFree( pxQueue );
-    }
-    // 分支2：同时支持动态和静态内存分配的场景
-    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
-    {
-        /* 队列可能是静态分配，也可能是动态分配，因此先判断再释放内存 */
-        // 检查队列的“静态分配标记”：ucStaticallyAllocated为pdFALSE表示动态分配
-        if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+        pvWaiterBuffer = pvTaskGetEventListHandOffBuffer( pxEventList );
+
+        if( pvWaiterBuffer != NULL )
         {
-            // 动态分配的队列，调用vPortFree释放内存
-            vPortFree( pxQueue );
+            if( xCopyToWaiter != pdFALSE )
+            {
+                queueCOPY_ITEM( pxQueue, pvWaiterBuffer, pvItem );
+            }
+            else
+            {
+                queueCOPY_ITEM( pxQueue, pvItem, pvWaiterBuffer );
+            }
+
+            *pxYieldRequired = xTaskRemoveFromEventListAfterHandOff( pxEventList );
+            xReturn = pdTRUE;
         }
         else
         {
-            // 静态分配的队列（内存由用户预先分配，无需FreeRTOS释放），仅作覆盖测试标记
             mtCOVERAGE_TEST_MARKER();
         }
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        #endif
+
+        return xReturn;
     }
-    // 分支3：仅支持静态内存分配，不支持动态分配的场景
-    #else /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) ) */
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvQueueHasHandOffWaiter( const List_t * const pxEventList )
     {
-        /* 队列只能是静态分配的，无需释放内存（内存由用户管理）。
-         * 此处显式使用pxQueue参数，避免编译器报“未使用参数”的警告 */
-        ( void ) pxQueue;
-    }
-    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+        BaseType_t xReturn;
 
-    // 跟踪函数返回（调试用，记录“队列删除操作结束”）
-    traceRETURN_vQueueDelete();
-}
-/*-----------------------------------------------------------*/
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+            UBaseType_t uxSavedInterruptStatus;
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+            uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        #endif
 
-    UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
-    {
-        traceENTER_uxQueueGetQueueNumber( xQueue );
+        if( pvTaskGetEventListHandOffBuffer( pxEventList ) != NULL )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
 
-        traceRETURN_uxQueueGetQueueNumber( ( ( Queue_t * ) xQueue )->uxQueueNumber );
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        #endif
 
-        return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+        return xReturn;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_QUEUE_HANDOFF */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_QUEUE_FIXED_SIZE_COPY == 1 )
 
-    void vQueueSetQueueNumber( QueueHandle_t xQueue,
-                               UBaseType_t uxQueueNumber )
+    static void prvCopyItem1( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize )
     {
-        traceENTER_vQueueSetQueueNumber( xQueue, uxQueueNumber );
-
-        ( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
-
-        traceRETURN_vQueueSetQueueNumber();
+        ( void ) uxItemSize;
+        ( void ) memcpy( pvDestination, pvSource, 1U );
     }
-
-#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-    uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+    static void prvCopyItem2( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize )
     {
-        traceENTER_ucQueueGetQueueType( xQueue );
-
-        traceRETURN_ucQueueGetQueueType( ( ( Queue_t * ) xQueue )->ucQueueType );
-
-        return ( ( Queue_t * ) xQueue )->ucQueueType;
+        ( void ) uxItemSize;
+        ( void ) memcpy( pvDestination, pvSource, 2U );
     }
+/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TRACE_FACILITY */
+    static void prvCopyItem4( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize )
+    {
+        ( void ) uxItemSize;
+        ( void ) memcpy( pvDestination, pvSource, 4U );
+    }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueGetQueueItemSize( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
-{
-    traceENTER_uxQueueGetQueueItemSize( xQueue );
+    static void prvCopyItem8( void * pvDestination,
+                              const void * pvSource,
+                              UBaseType_t uxItemSize )
+    {
+        ( void ) uxItemSize;
+        ( void ) memcpy( pvDestination, pvSource, 8U );
+    }
+/*-----------------------------------------------------------*/
 
-    traceRETURN_uxQueueGetQueueItemSize( ( ( Queue_t * ) xQueue )->uxItemSize );
+    static void prvCopyItem16( void * pvDestination,
+                               const void * pvSource,
+                               UBaseType_t uxItemSize )
+    {
+        ( void ) uxItemSize;
+        ( void ) memcpy( pvDestination, pvSource, 16U );
+    }
+/*-----------------------------------------------------------*/
 
-    return ( ( Queue_t * ) xQueue )->uxItemSize;
-}
+    static void prvCopyItemAnySize( void * pvDestination,
+                                    const void * pvSource,
+                                    UBaseType_t uxItemSize )
+    {
+        ( void ) memcpy( pvDestination, pvSource, ( size_t ) uxItemSize );
+    }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
-{
-    traceENTER_uxQueueGetQueueLength( xQueue );
+    static QueueCopyItemFunction_t prvSelectCopyItem( UBaseType_t uxItemSize )
+    {
+        QueueCopyItemFunction_t pxCopyItem;
 
-    traceRETURN_uxQueueGetQueueLength( ( ( Queue_t * ) xQueue )->uxLength );
+        switch( uxItemSize )
+        {
+            case ( UBaseType_t ) 1:
+                pxCopyItem = prvCopyItem1;
+                break;
 
-    return ( ( Queue_t * ) xQueue )->uxLength;
-}
-/*-----------------------------------------------------------*/
+            case ( UBaseType_t ) 2:
+                pxCopyItem = prvCopyItem2;
+                break;
 
-// 条件编译：仅当启用互斥锁功能（configUSE_MUTEXES == 1）时，才编译该静态函数
-#if ( configUSE_MUTEXES == 1 )
+            case ( UBaseType_t ) 4:
+                pxCopyItem = prvCopyItem4;
+                break;
 
-    // 静态函数定义：获取互斥锁等待队列中最高优先级任务的优先级（用于超时后的优先级恢复）
-    // 参数：pxQueue - 指向目标互斥锁对应的队列结构体指针（互斥锁本质是队列）
-    // 返回值：等待该互斥锁的所有任务中，最高优先级的值；若无等待任务，返回空闲任务优先级（tskIDLE_PRIORITY）
-    static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
-    {
-        UBaseType_t uxHighestPriorityOfWaitingTasks;  // 存储等待任务的最高优先级
+            case ( UBaseType_t ) 8:
+                pxCopyItem = prvCopyItem8;
+                break;
 
-        /* 注释：若某任务因等待互斥锁而触发了“优先级继承”（互斥锁持有者优先级被提升），
-         * 但该等待任务最终超时（未获取到互斥锁），则持有者需要“取消优先级继承”（恢复优先级）；
-         * 但恢复后的优先级不能低于“其他仍在等待该互斥锁的任务中的最高优先级”——
-         * 本函数的作用就是获取这个“其他等待任务的最高优先级”，作为持有者恢复优先级的下限。 */
-        if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
-        {
-            /* 若等待列表（xTasksWaitingToReceive）中有任务：
-             * 1. listGET_ITEM_VALUE_OF_HEAD_ENTRY：获取等待列表头部任务的“列表项值”（FreeRTOS中，列表项值存储的是“优先级的反转值”）；
-             * 2. 计算逻辑：最高优先级 = 最大优先级数（configMAX_PRIORITIES） - 列表项值（反转值）；
-             * （注：FreeRTOS列表按“优先级反转值”排序，头部是最高优先级任务，反转是为了让列表按升序存储，简化插入逻辑） */
-            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( 
-                ( UBaseType_t ) configMAX_PRIORITIES - 
-                ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) ) 
-            );
-        }
-        else
-        {
-            /* 若等待列表中无任务：
-             * 持有者恢复优先级的下限为“空闲任务优先级”（tskIDLE_PRIORITY，通常为0），
-             * 即持有者可直接恢复到自己的原始优先级。 */
-            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+            case ( UBaseType_t ) 16:
+                pxCopyItem = prvCopyItem16;
+                break;
+
+            default:
+                /* 信号量和互斥量（大小为 0）不复制数据项，同样使用通用的复制函数。 */
+                pxCopyItem = prvCopyItemAnySize;
+                break;
         }
 
-        return uxHighestPriorityOfWaitingTasks;  // 返回计算出的“优先级恢复下限”
+        return pxCopyItem;
     }
 
-#endif /* 结束 configUSE_MUTEXES == 1 的条件编译 */
+#endif /* configUSE_QUEUE_FIXED_SIZE_COPY */
 /*-----------------------------------------------------------*/
+#if ( configUSE_SEMAPHORE_FAST_PATH == 1 )
+
+    static BaseType_t prvSemaphoreTakeFast( Queue_t * const pxQueue )
+    {
+        UBaseType_t uxSemaphoreCount;
+        BaseType_t xReturn = pdFALSE;
+
+        #if ( configUSE_MUTEXES == 1 )
+            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+            {
+                TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+
+                /* 先占用持有者，再把计数从 1 改为 0：两步之间被抢占时，阻塞在互斥量上的任务已经能看到
+                 * 持有者，优先级继承照常进行。优先级天花板互斥量获取时要修改就绪列表，走临界区。 */
+                if( ( queueIS_CEILING_MUTEX( pxQueue ) == pdFALSE ) &&
+                    ( pxQueue->u.xSemaphore.xMutexHolder == NULL ) &&
+                    ( portATOMIC_COMPARE_AND_SWAP_POINTER( &( pxQueue->u.xSemaphore.xMutexHolder ), xCurrentTask, NULL ) != pdFALSE ) )
+                {
+                    if( portATOMIC_COMPARE_AND_SWAP_UBASE( &( pxQueue->uxMessagesWaiting ), ( UBaseType_t ) 0, ( UBaseType_t ) 1 ) != pdFALSE )
+                    {
+                        /* 两步之间互斥量可能被别的任务获取又释放，释放时清除了持有者；计数为 0 期间
+                         * 只有持有者会写 xMutexHolder，因此直接重新写入。 */
+                        traceQUEUE_RECEIVE( pxQueue );
+                        pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+                        xReturn = pdTRUE;
+                    }
+                    else
+                    {
+                        /* 互斥量已被别的任务获取。持有者若已被对方改写，比较交换失败，什么也不做。 */
+                        ( void ) portATOMIC_COMPARE_AND_SWAP_POINTER( &( pxQueue->u.xSemaphore.xMutexHolder ), NULL, xCurrentTask );
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+        #endif /* configUSE_MUTEXES */
+        {
+            uxSemaphoreCount = pxQueue->uxMessagesWaiting;
 
-// 静态函数：将数据复制到队列存储区的核心实现，根据入队位置（队首/队尾/覆盖）调整队列指针
-// 仅在临界区内被xQueueGenericSend调用，确保队列状态操作的原子性
-static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,    // 目标队列的内部控制结构指针
-                                      const void * pvItemToQueue,  // 待复制的数据源指针
-                                      const BaseType_t xPosition ) // 入队位置：queueSEND_TO_FRONT/queueSEND_TO_BACK/queueOVERWRITE
-{
-    BaseType_t xReturn = pdFALSE;  // 返回值：仅用于互斥锁场景（优先级继承相关）
-    UBaseType_t uxMessagesWaiting;  // 记录当前队列中的项目数（用于覆盖模式下的计数修正）
+            while( uxSemaphoreCount > ( UBaseType_t ) 0 )
+            {
+                if( portATOMIC_COMPARE_AND_SWAP_UBASE( &( pxQueue->uxMessagesWaiting ), uxSemaphoreCount - ( UBaseType_t ) 1, uxSemaphoreCount ) != pdFALSE )
+                {
+                    traceQUEUE_RECEIVE( pxQueue );
+                    xReturn = pdTRUE;
+                    break;
+                }
 
-    /* 注意：此函数仅在临界区内调用，无需额外加锁 */
+                /* 中断或其它任务同时修改了计数，用新的值重试。 */
+                uxSemaphoreCount = pxQueue->uxMessagesWaiting;
+            }
 
-    // 保存当前队列的项目数（后续覆盖模式需修正该值）
-    uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+            /* 准备阻塞的释放方先锁定队列再检查计数，这里先修改计数再检查锁和事件列表，
+             * 两边至少有一方能看到对方，不会漏掉唤醒。 */
+            portMEMORY_BARRIER();
 
-    // 分支1：项目大小为0（uxItemSize=0）——通常用于同步队列/互斥锁（无实际数据存储）
-    if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
-    {
-        #if ( configUSE_MUTEXES == 1 )  // 仅启用互斥锁时处理
-        {
-            // 判断队列是否为互斥锁（FreeRTOS中互斥锁基于队列实现，类型为queueQUEUE_IS_MUTEX）
-            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+            if( ( xReturn != pdFALSE ) &&
+                ( ( pxQueue->cRxLock != queueUNLOCKED ) || ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) ) )
             {
-                /* 互斥锁释放逻辑：
-                   - 调用xTaskPriorityDisinherit：取消持有任务的优先级继承（若之前因互斥锁提升过优先级）
-                   - 将互斥锁持有者设为NULL：标记互斥锁已释放
-                   - 返回值xReturn：表示是否需要触发任务切换（优先级继承取消后可能需要） */
-                xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
-                pxQueue->u.xSemaphore.xMutexHolder = NULL;
+                prvSemaphoreWakeWaiter( pxQueue, pdFALSE, pdFALSE );
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();  // 覆盖测试标记（非互斥锁场景）
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        #endif /* configUSE_MUTEXES */
-    }
-    // 分支2：入队位置为队尾（queueSEND_TO_BACK）——FIFO模式
-    else if( xPosition == queueSEND_TO_BACK )
-    {
-        // 核心操作：将数据源数据复制到队列的“写入指针（pcWriteTo）”位置
-        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
-        
-        // 更新写入指针：向后偏移一个项目大小（指向下次写入的位置）
-        pxQueue->pcWriteTo += pxQueue->uxItemSize;
 
-        // 边界处理：若写入指针超过队列尾部（pcTail），则回卷到队列头部（pcHead）——循环队列特性
-        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
-        {
-            pxQueue->pcWriteTo = pxQueue->pcHead;
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+        return xReturn;
     }
-    // 分支3：入队位置为队首（queueSEND_TO_FRONT）或覆盖（queueOVERWRITE）
-    else
-    {
-        // 核心操作：将数据源数据复制到队列的“读取指针（pcReadFrom）”位置
-        // （队首入队/覆盖模式均从读取指针位置写入，因读取指针始终指向队首项目）
-        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
-        
-        // 更新读取指针：向前偏移一个项目大小（指向新的队首位置）
-        pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize; //怎么体现覆盖的呢：覆盖用于队列长度为1的场景
+/*-----------------------------------------------------------*/
 
-        // 边界处理：若读取指针低于队列头部（pcHead），则回卷到队列尾部前一个项目位置——循环队列特性
-        if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
-        {
-            pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+    static BaseType_t prvSemaphoreGiveFast( Queue_t * const pxQueue )
+    {
+        UBaseType_t uxSemaphoreCount;
+        BaseType_t xDisinherit = pdFALSE;
+        BaseType_t xReturn = pdFALSE;
 
-        // 子分支：若为覆盖模式（queueOVERWRITE）——仅单项目队列可用
-        if( xPosition == queueOVERWRITE )
-        {
-            // 若队列中已有项目（uxMessagesWaiting>0），则修正项目计数：
-            // 覆盖模式是“替换”而非“新增”，因此先减1（抵消后续的加1操作），确保计数不变
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+        #if ( configUSE_QUEUE_SETS == 1 )
+            if( pxQueue->pxQueueSetContainer != NULL )
             {
-                --uxMessagesWaiting;
+                /* 需要通知队列集，走完整路径。 */
+                mtCOVERAGE_TEST_MARKER();
             }
             else
+        #endif /* configUSE_QUEUE_SETS */
+        #if ( configUSE_MUTEXES == 1 )
+            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
             {
-                mtCOVERAGE_TEST_MARKER();  // 队列空时覆盖=新增，无需修正
+                TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+
+                /* 不是持有者释放（或调度器启动之前）时走完整路径，由它断言和处理。
+                 * 先把计数改为 1，再清除持有者：中间被抢占时，其它任务在临界区内看到计数为 1
+                 * 就会获取互斥量并写入自己为持有者，下面清除持有者的比较交换随之失败。 */
+                if( ( xCurrentTask != NULL ) &&
+                    ( pxQueue->u.xSemaphore.xMutexHolder == xCurrentTask ) &&
+                    ( portATOMIC_COMPARE_AND_SWAP_UBASE( &( pxQueue->uxMessagesWaiting ), ( UBaseType_t ) 1, ( UBaseType_t ) 0 ) != pdFALSE ) )
+                {
+                    traceQUEUE_SEND( pxQueue );
+                    ( void ) portATOMIC_COMPARE_AND_SWAP_POINTER( &( pxQueue->u.xSemaphore.xMutexHolder ), NULL, xCurrentTask );
+
+                    if( xTaskDecrementMutexHeldCount() == pdFALSE )
+                    {
+                        xDisinherit = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
-        }
-        else
+            else
+        #endif /* configUSE_MUTEXES */
         {
-            mtCOVERAGE_TEST_MARKER();  // 队首入队模式，无需修正计数
-        }
-    }
+            uxSemaphoreCount = pxQueue->uxMessagesWaiting;
 
-    // 统一更新队列项目数：无论哪种模式，最终计数=修正后的当前数+1（覆盖模式因提前减1，实际计数不变）
-    pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting + ( UBaseType_t ) 1 );
+            while( uxSemaphoreCount < pxQueue->uxLength )
+            {
+                if( portATOMIC_COMPARE_AND_SWAP_UBASE( &( pxQueue->uxMessagesWaiting ), uxSemaphoreCount + ( UBaseType_t ) 1, uxSemaphoreCount ) != pdFALSE )
+                {
+                    traceQUEUE_SEND( pxQueue );
+                    xReturn = pdTRUE;
+                    break;
+                }
 
-    return xReturn;  // 仅互斥锁场景有效，其他场景返回pdFALSE（无意义）
-}
-/*-----------------------------------------------------------*/
+                uxSemaphoreCount = pxQueue->uxMessagesWaiting;
+            }
+        }
 
-static void prvCopyDataFromQueue( Queue_t * const pxQueue,
-                                  void * const pvBuffer )
-{
-    if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
-    {
-        pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+        /* 与 prvSemaphoreTakeFast() 相同：先修改计数，再检查准备阻塞或已经阻塞的获取方。 */
+        portMEMORY_BARRIER();
 
-        if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+        if( ( xReturn != pdFALSE ) &&
+            ( ( xDisinherit != pdFALSE ) ||
+              ( pxQueue->cTxLock != queueUNLOCKED ) ||
+              ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) ) )
         {
-            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+            prvSemaphoreWakeWaiter( pxQueue, pdTRUE, xDisinherit );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
+        return xReturn;
     }
-}
 /*-----------------------------------------------------------*/
 
-static void prvUnlockQueue( Queue_t * const pxQueue )
-{
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
-
-    /* The lock counts contains the number of extra data items placed or
-     * removed from the queue while the queue was locked.  When a queue is
-     * locked items can be added or removed, but the event lists cannot be
-     * updated. */
-    taskENTER_CRITICAL();
+    static void prvSemaphoreWakeWaiter( Queue_t * const pxQueue,
+                                        const BaseType_t xGiven,
+                                        const BaseType_t xDisinherit )
     {
-        int8_t cTxLock = pxQueue->cTxLock;
+        BaseType_t xYieldRequired = pdFALSE;
+        List_t * const pxEventList = ( xGiven != pdFALSE ) ? &( pxQueue->xTasksWaitingToReceive ) : &( pxQueue->xTasksWaitingToSend );
+        int8_t cTxLock;
+        int8_t cRxLock;
 
-        /* See if data was added to the queue while it was locked. */
-        while( cTxLock > queueLOCKED_UNMODIFIED )
+        queueENTER_CRITICAL( pxQueue );
         {
-            /* Data was posted while the queue was locked.  Are any tasks
-             * blocked waiting for data to become available? */
-            #if ( configUSE_QUEUE_SETS == 1 )
-            {
-                if( pxQueue->pxQueueSetContainer != NULL )
+            #if ( configUSE_MUTEXES == 1 )
+                if( xDisinherit != pdFALSE )
                 {
-                    if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
-                    {
-                        /* The queue is a member of a queue set, and posting to
-                         * the queue set caused a higher priority task to unblock.
-                         * A context switch is required. */
-                        vTaskMissedYield();
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
-                else
-                {
-                    /* Tasks that are removed from the event list will get
-                     * added to the pending ready list as the scheduler is still
-                     * suspended. */
-                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-                    {
-                        if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    #if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+                        if( queueIS_CEILING_MUTEX( pxQueue ) != pdFALSE )
                         {
-                            /* The task waiting has a higher priority so record that a
-                             * context switch is required. */
-                            vTaskMissedYield();
+                            xYieldRequired = xTaskPriorityDisinheritCeiling( xTaskGetCurrentTaskHandle() );
                         }
                         else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                    }
-                    else
+                    #endif
                     {
-                        break;
+                        xYieldRequired = xTaskPriorityDisinherit( xTaskGetCurrentTaskHandle() );
                     }
                 }
-            }
-            #else /* configUSE_QUEUE_SETS */
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            #else
+                ( void ) xDisinherit;
+            #endif
+
+            cTxLock = pxQueue->cTxLock;
+            cRxLock = pxQueue->cRxLock;
+
+            if( ( ( xGiven != pdFALSE ) ? cTxLock : cRxLock ) == queueUNLOCKED )
             {
-                /* Tasks that are removed from the event list will get added to
-                 * the pending ready list as the scheduler is still suspended. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    if( queueREMOVE_FROM_EVENT_LIST( pxEventList ) != pdFALSE )
                     {
-                        /* The task waiting has a higher priority so record that
-                         * a context switch is required. */
-                        vTaskMissedYield();
+                        xYieldRequired = pdTRUE;
                     }
                     else
                     {
@@ -2840,66 +5000,112 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
                 }
                 else
                 {
-                    break;
+                    mtCOVERAGE_TEST_MARKER();
                 }
             }
-            #endif /* configUSE_QUEUE_SETS */
+            else if( xGiven != pdFALSE )
+            {
+                prvIncrementQueueTxLock( pxQueue, cTxLock );
+            }
+            else
+            {
+                prvIncrementQueueRxLock( pxQueue, cRxLock );
+            }
 
-            --cTxLock;
+            if( xYieldRequired != pdFALSE )
+            {
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-
-        pxQueue->cTxLock = queueUNLOCKED;
+        queueEXIT_CRITICAL( pxQueue );
     }
-    taskEXIT_CRITICAL();
 
-    /* Do the same for the Rx lock. */
-    taskENTER_CRITICAL();
+#endif /* configUSE_SEMAPHORE_FAST_PATH */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+
+    static BaseType_t prvMutexSpinWait( const Queue_t * const pxQueue,
+                                        UBaseType_t * const puxSpinsLeft )
     {
-        int8_t cRxLock = pxQueue->cRxLock;
+        UBaseType_t uxBackoff = ( UBaseType_t ) 1;
+        UBaseType_t uxWait;
+        TaskHandle_t xHolder;
+        BaseType_t xReturn = pdFALSE;
 
-        while( cRxLock > queueLOCKED_UNMODIFIED )
+        while( *puxSpinsLeft > ( UBaseType_t ) 0 )
         {
-            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+            if( pxQueue->uxMessagesWaiting != ( UBaseType_t ) 0 )
             {
-                if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-                {
-                    vTaskMissedYield();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                xReturn = pdTRUE;
+                break;
+            }
 
-                --cRxLock;
+            /* 持有者为 NULL 说明另一个核心正在获取或释放，继续等待；持有者被抢占、阻塞，
+             * 或者就是当前任务（递归获取非递归互斥量）时，自旋等不到释放。 */
+            xHolder = *( ( TaskHandle_t volatile * ) &( pxQueue->u.xSemaphore.xMutexHolder ) );
+
+            if( ( xHolder != NULL ) && ( xTaskIsRunningOnOtherCore( xHolder ) == pdFALSE ) )
+            {
+                break;
             }
             else
             {
-                break;
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* 两次轮询之间的等待按指数增长，减少对互斥量所在缓存行的争用。 */
+            for( uxWait = uxBackoff; ( uxWait > ( UBaseType_t ) 0 ) && ( *puxSpinsLeft > ( UBaseType_t ) 0 ); uxWait-- )
+            {
+                portSPIN_WAIT_HINT();
+                ( *puxSpinsLeft )--;
+            }
+
+            if( uxBackoff < queueMUTEX_SPIN_MAX_BACKOFF )
+            {
+                uxBackoff <<= 1;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
         }
 
-        pxQueue->cRxLock = queueUNLOCKED;
+        return xReturn;
     }
-    taskEXIT_CRITICAL();
-}
+
+#endif /* configUSE_ADAPTIVE_MUTEXES */
 /*-----------------------------------------------------------*/
 
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
 {
     BaseType_t xReturn;
 
-    taskENTER_CRITICAL();
+    queueENTER_CRITICAL( pxQueue );
     {
-        if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+        if( prvQueueHasData( pxQueue ) )
         {
-            xReturn = pdTRUE;
+            xReturn = pdFALSE;
         }
+
+        #if ( configUSE_QUEUE_HANDOFF == 1 )
+            else if( ( pxQueue->uxLength == ( UBaseType_t ) 0 ) &&
+                     ( prvQueueHasHandOffWaiter( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE ) )
+            {
+                /* 会合队列上有发送方在等待，可以直接取走它的数据项。 */
+                xReturn = pdFALSE;
+            }
+        #endif
         else
         {
-            xReturn = pdFALSE;
+            xReturn = pdTRUE;
         }
     }
-    taskEXIT_CRITICAL();
+    queueEXIT_CRITICAL( pxQueue );
 
     return xReturn;
 }
@@ -2932,25 +5138,34 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
 // 静态函数：判断队列是否已满
 // 参数：pxQueue - 指向要检查的队列控制结构体的指针
 // 返回值：pdTRUE表示队列已满，pdFALSE表示队列未满
-static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
+static BaseType_t prvIsQueueFull( const Queue_t * pxQueue,
+                                  const BaseType_t xPosition )
 {
     BaseType_t xReturn;  // 用于存储判断结果
 
     // 进入临界区，确保对队列状态的检查是原子操作
-    taskENTER_CRITICAL();
+    queueENTER_CRITICAL( pxQueue );
     {
-        // 核心判断逻辑：当前队列中的消息数是否等于队列的最大长度
-        if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+        // 核心判断逻辑：是否还有可用的槽（零拷贝接口预留或占用的槽不可用）
+        if( prvQueueHasSpace( pxQueue, xPosition ) )
         {
-            xReturn = pdTRUE;  // 消息数等于最大长度，队列已满
+            xReturn = pdFALSE;  // 还有可用的槽，队列未满
         }
+
+        #if ( configUSE_QUEUE_HANDOFF == 1 )
+            else if( ( prvQueueCanHandOff( pxQueue ) ) &&
+                     ( prvQueueHasHandOffWaiter( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE ) )
+            {
+                xReturn = pdFALSE;  // 没有可用的槽（会合队列），但可以直接交给等待的接收方
+            }
+        #endif
         else
         {
-            xReturn = pdFALSE;  // 消息数小于最大长度，队列未满
+            xReturn = pdTRUE;  // 没有可用的槽，队列已满
         }
     }
     // 退出临界区，恢复中断和任务调度
-    taskEXIT_CRITICAL();
+    queueEXIT_CRITICAL( pxQueue );
 
     return xReturn;  // 返回判断结果
 }
@@ -2996,7 +5211,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
          * between the check to see if the queue is full and blocking on the queue. */
         portDISABLE_INTERRUPTS();
         {
-            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
             {
                 /* The queue is full - do we want to block or just leave without
                  * posting? */
@@ -3458,9 +5673,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         traceRETURN_vQueueWaitForMessageRestricted();
     }
 
-#endif /* 结束 configUSE_TIMERS == 1 的条件编译 */
-
-#endif /* configUSE_TIMERS */
+#endif /* configUSE_TIMERS */ /* 结束 configUSE_TIMERS == 1 的条件编译 */
 /*-----------------------------------------------------------*/
 
 #if ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
@@ -3503,6 +5716,11 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
                  * items in the queue/semaphore. */
                 xReturn = pdFAIL;
             }
+            else if( ( ( Queue_t * ) xQueueOrSemaphore )->uxLength == ( UBaseType_t ) 0 )
+            {
+                /* 会合队列中的数据项从不进入存储区，无法通知队列集。 */
+                xReturn = pdFAIL;
+            }
             else
             {
                 ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
@@ -93,7 +93,9 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;  // 队列集成员
  *
  * 更多信息：https://www.FreeRTOS.org/Embedded-RTOS-Queues.html
  *
- * @param uxQueueLength 队列可以容纳的最大项目数量。
+ * @param uxQueueLength 队列可以容纳的最大项目数量。configUSE_QUEUE_HANDOFF 为 1 时可以为 0，
+ * 创建没有存储区的会合队列：xQueueSend() 阻塞到有任务在 xQueueReceive() 中取走数据项为止，
+ * xQueueReceive() 阻塞到有任务发送为止，数据项直接从发送方的缓冲区复制到接收方的缓冲区。
  *
  * @param uxItemSize 队列中每个项目所需的字节数。项目通过复制方式入队，而非引用，
  * 因此这是每个入队项目将要复制的字节数。队列中的每个项目必须具有相同的大小。
@@ -158,14 +160,16 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;  // 队列集成员
  *
  * 更多参考：https://www.FreeRTOS.org/Embedded-RTOS-Queues.html
  *
- * @param uxQueueLength 队列可容纳的最大项目数量（队列深度）。
+ * @param uxQueueLength 队列可容纳的最大项目数量（队列深度）。configUSE_QUEUE_HANDOFF 为 1 时
+ * 可以为 0，创建会合队列（见 xQueueCreate()）。
  *
  * @param uxItemSize 队列中每个项目所需的字节数。项目通过“复制”方式入队（而非引用），
  * 因此该参数表示每个入队项目需要复制的字节数。队列中所有项目的大小必须一致。
  *
  * @param pucQueueStorage 若 uxItemSize 不为 0（即队列需存储实际数据），则该参数必须指向
  * 一个 uint8_t 类型数组，数组大小至少为 (uxQueueLength * uxItemSize) 字节（确保能容纳
- * 队列最大容量的所有项目）；若 uxItemSize 为 0（如队列仅用作同步，无需存储数据），则该参数可设为 NULL。
+ * 队列最大容量的所有项目）；若 uxItemSize 为 0（如队列仅用作同步，无需存储数据）或 uxQueueLength 为 0
+ * （会合队列），则该参数必须设为 NULL。
  *
  * @param pxQueueBuffer 必须指向一个 StaticQueue_t 类型的变量，该变量将用于存储队列的数据结构
  * （如队列长度、项目大小、阻塞任务列表等控制信息）。
@@ -706,6 +710,169 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                           void * const pvBuffer,
                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue.h
+ * @code{c}
+ * void * pvQueueReserveSend( QueueHandle_t xQueue, TickType_t xTicksToWait );
+ * BaseType_t xQueueCommitSend( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_QUEUE_ZERO_COPY 定义为 1，这两个函数才会生效。
+ *
+ * 零拷贝发送：pvQueueReserveSend() 在队列尾部预留一个槽并返回它在队列存储区中的地址，
+ * 调用者直接在这块内存中填写数据项（uxItemSize 字节），然后调用 xQueueCommitSend()
+ * 把它提交到队尾，效果与 xQueueSendToBack() 相同，但省去了一次 memcpy。
+ *
+ * 同一个队列同一时刻只能有一个未提交的预留：预留期间其它任务的 xQueueSendToBack()、
+ * pvQueueReserveSend() 等发送操作都视为队列已满，按各自的 xTicksToWait 阻塞，
+ * 直到预留被提交。因此预留和提交之间应尽量短，且不能阻塞。接收方不受影响，
+ * 可以继续读取已提交的数据项。预留只能由同一个任务提交。
+ *
+ * 只能用于 uxItemSize 不为 0 的普通队列，不能用于信号量、互斥量和队列集，不能在中断中调用。
+ *
+ * @param xQueue 目标队列句柄。
+ *
+ * @param xTicksToWait 队列没有空闲槽（或已有其它任务的预留）时的最大阻塞节拍数，规则与 xQueueSend() 相同。
+ *
+ * @return pvQueueReserveSend() 返回预留槽的地址，超时返回 NULL。
+ * xQueueCommitSend() 总是返回 pdPASS。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vTelemetryTask( void * pvParameters )
+ * {
+ *     TelemetryRecord_t * pxRecord;
+ *
+ *     for( ; ; )
+ *     {
+ *         pxRecord = pvQueueReserveSend( xTelemetryQueue, portMAX_DELAY );
+ *         vFillRecord( pxRecord );
+ *         ( void ) xQueueCommitSend( xTelemetryQueue );
+ *     }
+ * }
+ * @endcode
+ * \defgroup pvQueueReserveSend pvQueueReserveSend
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    void * pvQueueReserveSend( QueueHandle_t xQueue,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    BaseType_t xQueueCommitSend( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue.h
+ * @code{c}
+ * UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue, const void * pvItemsToQueue, UBaseType_t uxItemCount, TickType_t xTicksToWait );
+ * UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue, void * pvBuffer, UBaseType_t uxMaxItems, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_QUEUE_BATCH 定义为 1，这两个函数才会生效。
+ *
+ * 批量收发：在一次临界区内把最多 uxItemCount 个项目发送到队尾，或从队首接收最多 uxMaxItems 个项目，
+ * 顺序与逐个调用 xQueueSendToBack()/xQueueReceive() 相同。一批项目最多只唤醒与项目数相同个数的等待任务，
+ * 通常只有一个等待者，因此整批只唤醒一次。
+ *
+ * 队列没有空间（或没有数据）时按 xTicksToWait 阻塞，直到至少能移动一个项目；之后移动当前能移动的全部项目
+ * （不超过请求的数量）并立即返回，不会为了凑齐整批继续等待。需要全部发送完时，按返回值循环调用。
+ *
+ * 只能用于 uxItemSize 不为 0 的普通队列，不能用于信号量和互斥量，不能在中断中调用（中断中使用 FromISR 版本）。
+ *
+ * @param xQueue 目标队列句柄。
+ *
+ * @param pvItemsToQueue 连续存放的待发送项目，每个 uxItemSize 字节。
+ *
+ * @param uxItemCount 待发送的项目数，必须大于 0。
+ *
+ * @param pvBuffer 接收缓冲区，至少能存放 uxMaxItems 个项目。
+ *
+ * @param uxMaxItems 最多接收的项目数，必须大于 0。
+ *
+ * @param xTicksToWait 一个项目都不能移动时的最大阻塞节拍数，规则与 xQueueSend()/xQueueReceive() 相同。
+ *
+ * @return 实际发送或接收的项目数，超时返回 0。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vSamplerTask( void * pvParameters )
+ * {
+ *     uint16_t usSamples[ 32 ];
+ *     UBaseType_t uxSent;
+ *
+ *     for( ; ; )
+ *     {
+ *         vReadSamples( usSamples, 32 );
+ *
+ *         for( uxSent = 0; uxSent < 32; )
+ *         {
+ *             uxSent += uxQueueSendMultiple( xSampleQueue, &usSamples[ uxSent ], 32 - uxSent, portMAX_DELAY );
+ *         }
+ *     }
+ * }
+ * @endcode
+ * \defgroup uxQueueSendMultiple uxQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCH == 1 )
+    UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue,
+                                     const void * const pvItemsToQueue,
+                                     const UBaseType_t uxItemCount,
+                                     TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                        void * const pvBuffer,
+                                        const UBaseType_t uxMaxItems,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue.h
+ * @code{c}
+ * const void * pvQueueAcquireReceive( QueueHandle_t xQueue, TickType_t xTicksToWait );
+ * void vQueueReleaseReceive( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_QUEUE_ZERO_COPY 定义为 1，这两个函数才会生效。
+ *
+ * 零拷贝接收：pvQueueAcquireReceive() 从队首取出一个数据项，但不复制，而是返回它在
+ * 队列存储区中的地址。数据项此时已不计入 uxQueueMessagesWaiting()，但它占用的槽在
+ * vQueueReleaseReceive() 之前不会被发送方覆盖，调用者可以原地读取（或修改）它。
+ *
+ * 同一个队列同一时刻只能有一个未释放的数据项：占用期间其它任务的 xQueueReceive()、
+ * pvQueueAcquireReceive() 都视为队列为空并按各自的 xTicksToWait 阻塞，
+ * xQueueSendToFront() 和 xQueueOverwrite() 视为队列已满；xQueueSendToBack() 和 xQueuePeek()
+ * 不受影响。数据项只能由取得它的任务释放。
+ *
+ * 只能用于 uxItemSize 不为 0 的普通队列，不能用于信号量、互斥量和队列集，不能在中断中调用。
+ *
+ * @param xQueue 目标队列句柄。
+ *
+ * @param xTicksToWait 队列为空（或已有其它任务占用数据项）时的最大阻塞节拍数，规则与 xQueueReceive() 相同。
+ *
+ * @return pvQueueAcquireReceive() 返回数据项的地址，超时返回 NULL。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vLoggerTask( void * pvParameters )
+ * {
+ *     const TelemetryRecord_t * pxRecord;
+ *
+ *     for( ; ; )
+ *     {
+ *         pxRecord = pvQueueAcquireReceive( xTelemetryQueue, portMAX_DELAY );
+ *         vLogRecord( pxRecord );
+ *         vQueueReleaseReceive( xTelemetryQueue );
+ *     }
+ * }
+ * @endcode
+ * \defgroup pvQueueAcquireReceive pvQueueAcquireReceive
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_ZERO_COPY == 1 )
+    const void * pvQueueAcquireReceive( QueueHandle_t xQueue,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    void vQueueReleaseReceive( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * queue.h  // 该函数声明所在的头文件名称
  * @code{c}  // Doxygen文档标记，指定后续代码块为C语言语法
@@ -1267,6 +1434,35 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
                                  void * const pvBuffer,
                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue.h
+ * @code{c}
+ * UBaseType_t uxQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * pvItemsToQueue, UBaseType_t uxItemCount, BaseType_t * pxHigherPriorityTaskWoken );
+ * UBaseType_t uxQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * pvBuffer, UBaseType_t uxMaxItems, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_QUEUE_BATCH 定义为 1，这两个函数才会生效。
+ *
+ * uxQueueSendMultiple()/uxQueueReceiveMultiple() 的中断安全版本：不阻塞，移动当前能移动的项目（可能为 0 个）。
+ * 唤醒了优先级高于被中断任务的任务时，把 *pxHigherPriorityTaskWoken 设为 pdTRUE，
+ * 中断退出前应据此请求上下文切换。
+ *
+ * @return 实际发送或接收的项目数。
+ *
+ * \defgroup uxQueueSendMultipleFromISR uxQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_QUEUE_BATCH == 1 )
+    UBaseType_t uxQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                            const void * const pvItemsToQueue,
+                                            const UBaseType_t uxItemCount,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                               void * const pvBuffer,
+                                               const UBaseType_t uxMaxItems,
+                                               BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * 用于查询队列状态的工具函数，支持在中断服务程序（ISR）中安全使用。
  * 这些工具函数仅应在以下场景中调用：
@@ -1371,6 +1567,18 @@ QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION
                                            StaticQueue_t * pxStaticQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+// 优先级天花板互斥量的底层创建函数，由 xSemaphoreCreateMutexWithCeiling() 等宏调用
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        QueueHandle_t xQueueCreateMutexWithCeiling( const UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+    #endif
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        QueueHandle_t xQueueCreateMutexWithCeilingStatic( const UBaseType_t uxCeilingPriority,
+                                                          StaticQueue_t * pxStaticQueue ) PRIVILEGED_FUNCTION;
+    #endif
+#endif
+
 // 条件编译2：仅当支持计数信号量（configUSE_COUNTING_SEMAPHORES == 1）时编译
 #if ( configUSE_COUNTING_SEMAPHORES == 1 )
     // 函数声明3：创建计数信号量（底层实现，基于队列）
@@ -95,9 +95,9 @@ typedef QueueHandle_t SemaphoreHandle_t;
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )  // 仅当启用动态内存分配时有效
     #define vSemaphoreCreateBinary( xSemaphore )                                                                                     \
     do {                                                                                                                             \
-        // 1. 创建一个长度为1、元素大小为0的二进制信号量队列
+        /* 1. 创建一个长度为1、元素大小为0的二进制信号量队列 */ \
         ( xSemaphore ) = xQueueGenericCreate( ( UBaseType_t ) 1, semSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_BINARY_SEMAPHORE ); \
-        // 2. 若创建成功，立即给出信号量（初始化为“可获取”状态）
+        /* 2. 若创建成功，立即给出信号量（初始化为“可获取”状态） */ \
         if( ( xSemaphore ) != NULL )                                                                                                 \
         {                                                                                                                            \
             ( void ) xSemaphoreGive( ( xSemaphore ) );                                                                               \
@@ -158,9 +158,9 @@ typedef QueueHandle_t SemaphoreHandle_t;
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )  // 仅当启用动态内存分配时，该宏才有效
     // 宏定义：通过调用通用队列创建函数，配置为二进制信号量的特性
     #define xSemaphoreCreateBinary()    xQueueGenericCreate( \
-        ( UBaseType_t ) 1,                  // 队列长度=1（二进制信号量仅支持0/1状态） \
-        semSEMAPHORE_QUEUE_ITEM_LENGTH,     // 元素大小=0（信号量无需存储实际数据） \
-        queueQUEUE_TYPE_BINARY_SEMAPHORE    // 队列类型=二进制信号量（底层标记用途） \
+        ( UBaseType_t ) 1,                  /* 队列长度=1（二进制信号量仅支持0/1状态） */ \
+        semSEMAPHORE_QUEUE_ITEM_LENGTH,     /* 元素大小=0（信号量无需存储实际数据） */ \
+        queueQUEUE_TYPE_BINARY_SEMAPHORE    /* 队列类型=二进制信号量（底层标记用途） */ \
     )
 #endif
 
@@ -215,11 +215,11 @@ typedef QueueHandle_t SemaphoreHandle_t;
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )  // 仅当启用静态内存分配时有效
     // 宏定义：通过静态队列创建函数，配置为二进制信号量特性
     #define xSemaphoreCreateBinaryStatic( pxStaticSemaphore )    xQueueGenericCreateStatic( \
-        ( UBaseType_t ) 1,                  // 队列长度=1（二进制信号量特性） \
-        semSEMAPHORE_QUEUE_ITEM_LENGTH,     // 元素大小=0（无需存储数据） \
-        NULL,                               // 数据缓冲区=NULL（元素大小为0，无需缓冲区） \
-        ( pxStaticSemaphore ),              // 静态内存块（存储信号量控制结构） \
-        queueQUEUE_TYPE_BINARY_SEMAPHORE    // 队列类型=二进制信号量 \
+        ( UBaseType_t ) 1,                  /* 队列长度=1（二进制信号量特性） */ \
+        semSEMAPHORE_QUEUE_ITEM_LENGTH,     /* 元素大小=0（无需存储数据） */ \
+        NULL,                               /* 数据缓冲区=NULL（元素大小为0，无需缓冲区） */ \
+        ( pxStaticSemaphore ),              /* 静态内存块（存储信号量控制结构） */ \
+        queueQUEUE_TYPE_BINARY_SEMAPHORE    /* 队列类型=二进制信号量 */ \
     )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
@@ -429,10 +429,10 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 // 宏定义：将信号量释放操作映射到底层通用队列发送函数
 #define xSemaphoreGive( xSemaphore )    xQueueGenericSend( \
-    ( QueueHandle_t ) ( xSemaphore ),  // 信号量句柄强制转为队列句柄（信号量本质是队列） \
-    NULL,                              // 数据缓冲区=NULL（信号量无需存储数据） \
-    semGIVE_BLOCK_TIME,                // 阻塞时间=0（释放信号量永不阻塞） \
-    queueSEND_TO_BACK                  // 发送位置=队列尾部（无实际意义，因无数据） \
+    ( QueueHandle_t ) ( xSemaphore ),  /* 信号量句柄强制转为队列句柄（信号量本质是队列） */ \
+    NULL,                              /* 数据缓冲区=NULL（信号量无需存储数据） */ \
+    semGIVE_BLOCK_TIME,                /* 阻塞时间=0（释放信号量永不阻塞） */ \
+    queueSEND_TO_BACK                  /* 发送位置=队列尾部（无实际意义，因无数据） */ \
 )
 
 /**
@@ -599,8 +599,8 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 // 宏定义：将中断中释放信号量的操作，映射到底层中断队列释放函数
 #define xSemaphoreGiveFromISR( xSemaphore, pxHigherPriorityTaskWoken )    xQueueGiveFromISR( \
-    ( QueueHandle_t ) ( xSemaphore ),  // 信号量句柄强制转为队列句柄（信号量本质是队列） \
-    ( pxHigherPriorityTaskWoken )      // 传递“高优先级任务唤醒标记”指针 \
+    ( QueueHandle_t ) ( xSemaphore ),  /* 信号量句柄强制转为队列句柄（信号量本质是队列） */ \
+    ( pxHigherPriorityTaskWoken )      /* 传递“高优先级任务唤醒标记”指针 */ \
 )
 
 /**
@@ -634,9 +634,9 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 // 宏定义：将中断中获取信号量的操作，映射到底层中断队列接收函数
 #define xSemaphoreTakeFromISR( xSemaphore, pxHigherPriorityTaskWoken )    xQueueReceiveFromISR(  \
-    ( QueueHandle_t ) ( xSemaphore ),  \// 信号量句柄强制转为队列句柄 
-    NULL,                              \// 数据缓冲区=NULL（信号量无需存储数据） 
-    ( pxHigherPriorityTaskWoken )      \// 传递“高优先级任务唤醒标记”指针 
+    ( QueueHandle_t ) ( xSemaphore ),  /* 信号量句柄强制转为队列句柄 */ \
+    NULL,                              /* 数据缓冲区=NULL（信号量无需存储数据） */ \
+    ( pxHigherPriorityTaskWoken )      /* 传递“高优先级任务唤醒标记”指针 */ \
 )
 
 /**
@@ -738,6 +738,56 @@ typedef QueueHandle_t SemaphoreHandle_t;
     #define xSemaphoreCreateMutexStatic( pxMutexBuffer )    xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX, ( pxMutexBuffer ) )
 #endif
 
+/**
+ * semphr.h
+ * @code{c}
+ * SemaphoreHandle_t xSemaphoreCreateMutexWithCeiling( UBaseType_t uxCeilingPriority );
+ * SemaphoreHandle_t xSemaphoreCreateMutexWithCeilingStatic( UBaseType_t uxCeilingPriority, StaticSemaphore_t *pxMutexBuffer );
+ * @endcode
+ *
+ * 创建一个“优先级天花板互斥锁”（立即天花板协议），返回其句柄。用法与 xSemaphoreCreateMutex()/
+ * xSemaphoreCreateMutexStatic() 创建的互斥锁相同，使用 xSemaphoreTake() 和 xSemaphoreGive() 操作，禁止在中断中使用。
+ *
+ * 与普通互斥锁的区别：
+ * - 任务获取成功时，优先级直接提升到 uxCeilingPriority（已经不低于天花板时不变），
+ *   不必等到更高优先级的任务阻塞在互斥锁上才做优先级继承；
+ * - 阻塞在该互斥锁上的任务不做优先级继承，也就不会出现继承链（链式阻塞）；
+ * - 与普通互斥锁一样，任务释放它持有的最后一个互斥锁时优先级恢复为基础优先级。
+ *
+ * uxCeilingPriority 应不低于所有会获取该互斥锁的任务的优先级，且必须小于 configMAX_PRIORITIES。
+ * 只有把同一组锁的天花板都按这一规则设置，才能保证每个任务最多被阻塞一个临界区的时间。
+ *
+ * 需要将 configUSE_PRIORITY_CEILING_MUTEXES 设为 1。
+ *
+ * @参数 uxCeilingPriority：天花板优先级。
+ * @参数 pxMutexBuffer：静态版本用于存储互斥锁数据结构的 StaticSemaphore_t 变量。
+ *
+ * @返回值：成功返回互斥锁句柄；动态版本堆内存不足时返回 NULL。
+ *
+ * 使用示例：
+ * @code{c}
+ * // 电机控制任务（优先级 4）和参数更新任务（优先级 2）共享 xMotorParams
+ * SemaphoreHandle_t xMotorLock = xSemaphoreCreateMutexWithCeiling( 4 );
+ *
+ * if( xSemaphoreTake( xMotorLock, portMAX_DELAY ) == pdTRUE )
+ * {
+ *     // 此处以优先级 4 运行，其它使用 xMotorLock 的任务不会抢占
+ *     xSemaphoreGive( xMotorLock );
+ * }
+ * @endcode
+ * \defgroup xSemaphoreCreateMutexWithCeiling xSemaphoreCreateMutexWithCeiling
+ * \ingroup Semaphores
+ */
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        #define xSemaphoreCreateMutexWithCeiling( uxCeilingPriority )    xQueueCreateMutexWithCeiling( ( uxCeilingPriority ) )
+    #endif
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        #define xSemaphoreCreateMutexWithCeilingStatic( uxCeilingPriority, pxMutexBuffer )    xQueueCreateMutexWithCeilingStatic( ( uxCeilingPriority ), ( pxMutexBuffer ) )
+    #endif
+#endif
+
 
 /**
  * semphr.h
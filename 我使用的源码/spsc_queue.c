@@ -0,0 +1,621 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "spsc_queue.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* 应用程序没有启用 SPSC 队列时整个文件都不参与编译，对应的 #endif 在文件末尾。 */
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to build spsc_queue.c
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build spsc_queue.c
+    #endif
+
+    #if ( configSPSC_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+        #error configSPSC_NOTIFY_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #endif
+
+/* 阻塞等待使用的任务通知索引。应用不能在阻塞于 SPSC 队列的任务上使用该索引，
+ * 否则应用的通知会被当作队列唤醒消耗掉，队列的唤醒也会满足无关的等待。 */
+    #define spscNOTIFICATION_INDEX             ( ( UBaseType_t ) configSPSC_NOTIFY_INDEX )
+
+/* ucFlags 中的标志位。 */
+    #define spscFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 1 ) /* 队列使用静态内存创建。 */
+
+/*-----------------------------------------------------------*/
+
+/* SPSC 队列的控制结构。 */
+typedef struct SpscQueueDef_t
+{
+    volatile UBaseType_t uxHead;                 /* 下一个要读出的槽位，只由读取者修改。 */
+    volatile UBaseType_t uxTail;                 /* 下一个要写入的槽位，只由写入者修改。 */
+    UBaseType_t uxSlots;                         /* 存储区的槽位数，比队列长度多 1，头尾相等表示空。 */
+    UBaseType_t uxItemSize;                      /* 每个数据项的字节数。 */
+    volatile TaskHandle_t xTaskWaitingToReceive; /* 等待数据的读取者，没有时为 NULL。 */
+    volatile TaskHandle_t xTaskWaitingToSend;    /* 等待空闲槽位的写入者，没有时为 NULL。 */
+    uint8_t * pucStorage;                        /* 存放数据项的存储区。 */
+    uint8_t ucFlags;
+} SpscQueue_t;
+
+/*
+ * 索引在存储区中前进一个槽位，到末尾时回绕。用比较代替取模，避免除法。
+ */
+    #define prvSpscNextIndex( pxQueue, uxIndex ) \
+    ( ( ( ( uxIndex ) + ( UBaseType_t ) 1 ) == ( pxQueue )->uxSlots ) ? ( UBaseType_t ) 0 : ( ( uxIndex ) + ( UBaseType_t ) 1 ) )
+
+/*
+ * 初始化控制结构。
+ */
+static void prvInitialiseNewSpscQueue( SpscQueue_t * const pxQueue,
+                                       uint8_t * const pucStorage,
+                                       UBaseType_t uxQueueLength,
+                                       UBaseType_t uxItemSize,
+                                       uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*
+ * 写入者尝试复制一个数据项到队尾，队列满时返回 pdFALSE。不进入临界区。
+ */
+static BaseType_t prvSpscTryWrite( SpscQueue_t * const pxQueue,
+                                   const void * const pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * 读取者尝试从队首复制出一个数据项，队列空时返回 pdFALSE。不进入临界区。
+ */
+static BaseType_t prvSpscTryRead( SpscQueue_t * const pxQueue,
+                                  void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * 在 *pxTaskWaiting 不为 NULL 时通知该任务并清空等待者。
+ */
+static void prvSpscNotifyWaiting( volatile TaskHandle_t * const pxTaskWaiting ) PRIVILEGED_FUNCTION;
+static void prvSpscNotifyWaitingFromISR( volatile TaskHandle_t * const pxTaskWaiting,
+                                         BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxQueueLength,
+                                        UBaseType_t uxItemSize )
+    {
+        void * pvAllocatedMemory = NULL;
+        size_t xStorageBytes;
+
+        traceENTER_xSpscQueueCreate( uxQueueLength, uxItemSize );
+
+        configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+        configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+        xStorageBytes = spscQUEUE_STORAGE_BYTES( uxQueueLength, uxItemSize );
+
+        /* 检查槽位数加 1 和乘法都没有溢出。 */
+        if( ( ( ( size_t ) uxQueueLength + ( size_t ) 1 ) > ( size_t ) uxQueueLength ) &&
+            ( ( xStorageBytes / ( size_t ) uxItemSize ) == ( ( size_t ) uxQueueLength + ( size_t ) 1 ) ) &&
+            ( ( SIZE_MAX - sizeof( SpscQueue_t ) ) >= xStorageBytes ) )
+        {
+            /* 控制结构和存储区一次分配，存储区紧跟在控制结构之后。 */
+            pvAllocatedMemory = pvPortMalloc( sizeof( SpscQueue_t ) + xStorageBytes );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pvAllocatedMemory != NULL )
+        {
+            prvInitialiseNewSpscQueue( ( SpscQueue_t * ) pvAllocatedMemory,
+                                       ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( SpscQueue_t ),
+                                       uxQueueLength,
+                                       uxItemSize,
+                                       0 );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xSpscQueueCreate( pvAllocatedMemory );
+
+        return ( SpscQueueHandle_t ) pvAllocatedMemory;
+    }
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    SpscQueueHandle_t xSpscQueueCreateStatic( UBaseType_t uxQueueLength,
+                                              UBaseType_t uxItemSize,
+                                              uint8_t * const pucQueueStorage,
+                                              StaticSpscQueue_t * const pxStaticQueue )
+    {
+        SpscQueue_t * const pxQueue = ( SpscQueue_t * ) pxStaticQueue;
+        SpscQueueHandle_t xReturn = NULL;
+
+        traceENTER_xSpscQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxStaticQueue );
+
+        configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+        configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+        configASSERT( pucQueueStorage );
+        configASSERT( pxStaticQueue );
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* 检查 StaticSpscQueue_t 与真实的控制结构大小一致。 */
+            volatile size_t xSize = sizeof( StaticSpscQueue_t );
+            configASSERT( xSize == sizeof( SpscQueue_t ) );
+        }
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pucQueueStorage != NULL ) && ( pxStaticQueue != NULL ) )
+        {
+            prvInitialiseNewSpscQueue( pxQueue,
+                                       pucQueueStorage,
+                                       uxQueueLength,
+                                       uxItemSize,
+                                       spscFLAGS_IS_STATICALLY_ALLOCATED );
+            xReturn = ( SpscQueueHandle_t ) pxQueue;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xSpscQueueCreateStatic( xReturn );
+
+        return xReturn;
+    }
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vSpscQueueDelete( SpscQueueHandle_t xQueue )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+
+        traceENTER_vSpscQueueDelete( xQueue );
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->xTaskWaitingToReceive == NULL );
+        configASSERT( pxQueue->xTaskWaitingToSend == NULL );
+
+        if( ( pxQueue->ucFlags & spscFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                /* 控制结构和存储区是一次分配的，只需释放一次。 */
+                vPortFree( ( void * ) pxQueue );
+            }
+            #else
+            {
+                /* 不应该走到这里，ucFlags 已被破坏。 */
+                configASSERT( xQueue == ( SpscQueueHandle_t ) ~0 );
+            }
+            #endif
+        }
+        else
+        {
+            /* 静态内存不能释放，清空结构使之后的误用触发断言。 */
+            ( void ) memset( pxQueue, 0x00, sizeof( SpscQueue_t ) );
+        }
+
+        traceRETURN_vSpscQueueDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue,
+                               const void * const pvItemToQueue,
+                               TickType_t xTicksToWait )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn = errQUEUE_FULL;
+        BaseType_t xTimeOutSet = pdFALSE;
+        BaseType_t xMustBlock;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xSpscQueueSend( xQueue, pvItemToQueue, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvItemToQueue );
+
+        for( ; ; )
+        {
+            if( prvSpscTryWrite( pxQueue, pvItemToQueue ) != pdFALSE )
+            {
+                prvSpscNotifyWaiting( &( pxQueue->xTaskWaitingToReceive ) );
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+
+            if( xTimeOutSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xTimeOutSet = pdTRUE;
+            }
+
+            /* 检查队列是否仍然满和登记等待者必须是原子的，否则读取者可能在两者之间
+             * 取走数据却看不到等待者。 */
+            taskENTER_CRITICAL();
+            {
+                xMustBlock = ( prvSpscNextIndex( pxQueue, pxQueue->uxTail ) == pxQueue->uxHead ) ? pdTRUE : pdFALSE;
+
+                if( xMustBlock != pdFALSE )
+                {
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, spscNOTIFICATION_INDEX );
+
+                    /* 只能有一个写入者。 */
+                    configASSERT( pxQueue->xTaskWaitingToSend == NULL );
+                    pxQueue->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xMustBlock != pdFALSE )
+            {
+                ( void ) xTaskNotifyWaitIndexed( spscNOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxQueue->xTaskWaitingToSend = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* 超时后再尝试一次写入，然后返回。 */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_xSpscQueueSend( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+                                      const void * const pvItemToQueue,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn;
+
+        traceENTER_xSpscQueueSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( pvItemToQueue );
+
+        if( prvSpscTryWrite( pxQueue, pvItemToQueue ) != pdFALSE )
+        {
+            prvSpscNotifyWaitingFromISR( &( pxQueue->xTaskWaitingToReceive ), pxHigherPriorityTaskWoken );
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = errQUEUE_FULL;
+        }
+
+        traceRETURN_xSpscQueueSendFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+                                  void * const pvBuffer,
+                                  TickType_t xTicksToWait )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+        BaseType_t xTimeOutSet = pdFALSE;
+        BaseType_t xMustBlock;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xSpscQueueReceive( xQueue, pvBuffer, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+
+        for( ; ; )
+        {
+            if( prvSpscTryRead( pxQueue, pvBuffer ) != pdFALSE )
+            {
+                prvSpscNotifyWaiting( &( pxQueue->xTaskWaitingToSend ) );
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                break;
+            }
+
+            if( xTimeOutSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xTimeOutSet = pdTRUE;
+            }
+
+            /* 检查队列是否仍然空和登记等待者必须是原子的。 */
+            taskENTER_CRITICAL();
+            {
+                xMustBlock = ( pxQueue->uxHead == pxQueue->uxTail ) ? pdTRUE : pdFALSE;
+
+                if( xMustBlock != pdFALSE )
+                {
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, spscNOTIFICATION_INDEX );
+
+                    /* 只能有一个读取者。 */
+                    configASSERT( pxQueue->xTaskWaitingToReceive == NULL );
+                    pxQueue->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xMustBlock != pdFALSE )
+            {
+                ( void ) xTaskNotifyWaitIndexed( spscNOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                pxQueue->xTaskWaitingToReceive = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* 超时后再尝试一次读取，然后返回。 */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                xTicksToWait = ( TickType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_xSpscQueueReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSpscQueueReceiveFromISR( SpscQueueHandle_t xQueue,
+                                         void * const pvBuffer,
+                                         BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        SpscQueue_t * const pxQueue = xQueue;
+        BaseType_t xReturn;
+
+        traceENTER_xSpscQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+
+        if( prvSpscTryRead( pxQueue, pvBuffer ) != pdFALSE )
+        {
+            prvSpscNotifyWaitingFromISR( &( pxQueue->xTaskWaitingToSend ), pxHigherPriorityTaskWoken );
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = errQUEUE_EMPTY;
+        }
+
+        traceRETURN_xSpscQueueReceiveFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxSpscQueueMessagesWaiting( SpscQueueHandle_t xQueue )
+    {
+        const SpscQueue_t * const pxQueue = xQueue;
+        UBaseType_t uxHead;
+        UBaseType_t uxTail;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxSpscQueueMessagesWaiting( xQueue );
+
+        configASSERT( pxQueue );
+
+        uxHead = pxQueue->uxHead;
+        uxTail = pxQueue->uxTail;
+
+        if( uxTail >= uxHead )
+        {
+            uxReturn = uxTail - uxHead;
+        }
+        else
+        {
+            uxReturn = ( pxQueue->uxSlots - uxHead ) + uxTail;
+        }
+
+        traceRETURN_uxSpscQueueMessagesWaiting( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewSpscQueue( SpscQueue_t * const pxQueue,
+                                           uint8_t * const pucStorage,
+                                           UBaseType_t uxQueueLength,
+                                           UBaseType_t uxItemSize,
+                                           uint8_t ucFlags )
+    {
+        ( void ) memset( ( void * ) pxQueue, 0x00, sizeof( SpscQueue_t ) );
+        pxQueue->uxSlots = uxQueueLength + ( UBaseType_t ) 1;
+        pxQueue->uxItemSize = uxItemSize;
+        pxQueue->pucStorage = pucStorage;
+        pxQueue->ucFlags = ucFlags;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvSpscTryWrite( SpscQueue_t * const pxQueue,
+                                       const void * const pvItemToQueue )
+    {
+        const UBaseType_t uxTail = pxQueue->uxTail;
+        const UBaseType_t uxNextTail = prvSpscNextIndex( pxQueue, uxTail );
+        BaseType_t xReturn;
+
+        if( uxNextTail != pxQueue->uxHead )
+        {
+            /* 读取者发布新的读索引之前已经读完了这个槽位，读索引之后才能写入槽位。 */
+            portMEMORY_BARRIER();
+            ( void ) memcpy( ( void * ) &( pxQueue->pucStorage[ uxTail * pxQueue->uxItemSize ] ), pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+
+            /* 数据写完后才发布写索引，读取者看到新的写索引时数据一定已经就绪。
+             * 发布之后才读取等待者，与读取者在临界区中“检查为空再登记等待者”配对，
+             * 保证不会漏掉唤醒。 */
+            portMEMORY_BARRIER();
+            pxQueue->uxTail = uxNextTail;
+            portMEMORY_BARRIER();
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvSpscTryRead( SpscQueue_t * const pxQueue,
+                                      void * const pvBuffer )
+    {
+        const UBaseType_t uxHead = pxQueue->uxHead;
+        BaseType_t xReturn;
+
+        if( uxHead != pxQueue->uxTail )
+        {
+            /* 先看到写索引，再读取槽位中的数据。 */
+            portMEMORY_BARRIER();
+            ( void ) memcpy( pvBuffer, ( void * ) &( pxQueue->pucStorage[ uxHead * pxQueue->uxItemSize ] ), ( size_t ) pxQueue->uxItemSize );
+
+            /* 数据读完后才释放槽位，释放之后才读取等待的写入者。 */
+            portMEMORY_BARRIER();
+            pxQueue->uxHead = prvSpscNextIndex( pxQueue, uxHead );
+            portMEMORY_BARRIER();
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSpscNotifyWaiting( volatile TaskHandle_t * const pxTaskWaiting )
+    {
+        /* 没有等待者是常见情况，不挂起调度器也不进入临界区。 */
+        if( *pxTaskWaiting != NULL )
+        {
+            vTaskSuspendAll();
+            {
+                if( *pxTaskWaiting != NULL )
+                {
+                    ( void ) xTaskNotifyIndexed( *pxTaskWaiting, spscNOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction );
+                    *pxTaskWaiting = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSpscNotifyWaitingFromISR( volatile TaskHandle_t * const pxTaskWaiting,
+                                             BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        if( *pxTaskWaiting != NULL )
+        {
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                if( *pxTaskWaiting != NULL )
+                {
+                    ( void ) xTaskNotifyIndexedFromISR( *pxTaskWaiting, spscNOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+                    *pxTaskWaiting = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_SPSC_QUEUES */
@@ -0,0 +1,299 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+/*
+ * 单生产者/单消费者（SPSC）无锁队列，面向中断到任务（或任务到任务）的定长数据通道。
+ *
+ * 与普通队列一样按定长数据项复制传递，但和流缓冲区一样假设只有一个写入者和一个读取者：
+ * 写入者只修改写索引，读取者只修改读索引，双方都不需要进入临界区。只有当对方
+ * 正阻塞等待时，才进入临界区用直达任务通知唤醒它，因此中断里的发送在常见情况下
+ * 只是一次复制和一次索引写入。
+ *
+ * ***注意***：与流缓冲区相同，不允许有多个不同的写入者或多个不同的读取者。
+ * 阻塞使用任务通知数组中的 configSPSC_NOTIFY_INDEX 索引（默认是最后一个），使用 SPSC 队列的任务
+ * 不能再用这个索引收发其它通知（xTaskNotifyGiveIndexed()、ulTaskNotifyTakeIndexed() 等）。
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES 为 1 时它与 xTaskNotifyGive()/ulTaskNotifyTake() 使用的
+ * 索引 0 重合，此时应把该配置设为至少 2。
+ *
+ * 目前只支持单核（configNUMBER_OF_CORES == 1）：索引的发布只依赖编译器屏障
+ * portMEMORY_BARRIER()，它对同一核上的任务与中断足够，但不能保证核间的可见顺序。
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include spsc_queue.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * 引用 SPSC 队列的句柄类型。
+ */
+struct SpscQueueDef_t;
+typedef struct SpscQueueDef_t * SpscQueueHandle_t;
+
+/**
+ * 静态创建时存储区需要的字节数。为了不用计数器区分“满”和“空”，存储区比
+ * uxQueueLength 多一个数据项，队列中最多同时存放 uxQueueLength 个数据项。
+ */
+#define spscQUEUE_STORAGE_BYTES( uxQueueLength, uxItemSize )    ( ( ( size_t ) ( uxQueueLength ) + ( size_t ) 1 ) * ( size_t ) ( uxItemSize ) )
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxQueueLength, UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_SPSC_QUEUES 和 configSUPPORT_DYNAMIC_ALLOCATION
+ * 定义为 1，此函数才会生效。
+ *
+ * 创建一个 SPSC 队列。控制结构和存储区通过一次 pvPortMalloc() 分配。
+ *
+ * @param uxQueueLength 队列最多能同时存放的数据项数，必须大于 0。
+ *
+ * @param uxItemSize 每个数据项的字节数，必须大于 0。
+ *
+ * @return 创建成功返回队列句柄，内存不足返回 NULL。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vAFunction( void )
+ * {
+ *     SpscQueueHandle_t xRxQueue;
+ *
+ *     xRxQueue = xSpscQueueCreate( 64, sizeof( uint8_t ) );
+ *
+ *     if( xRxQueue != NULL )
+ *     {
+ *         // 队列创建成功，串口中断用 xSpscQueueSendFromISR() 写入，处理任务用 xSpscQueueReceive() 读出。
+ *     }
+ * }
+ * @endcode
+ * \defgroup xSpscQueueCreate xSpscQueueCreate
+ * \ingroup SpscQueueManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    SpscQueueHandle_t xSpscQueueCreate( UBaseType_t uxQueueLength,
+                                        UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * SpscQueueHandle_t xSpscQueueCreateStatic( UBaseType_t uxQueueLength,
+ *                                           UBaseType_t uxItemSize,
+ *                                           uint8_t * pucQueueStorage,
+ *                                           StaticSpscQueue_t * pxStaticQueue );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_SPSC_QUEUES 和 configSUPPORT_STATIC_ALLOCATION
+ * 定义为 1，此函数才会生效。
+ *
+ * 使用调用者提供的内存创建 SPSC 队列。
+ *
+ * @param uxQueueLength 队列最多能同时存放的数据项数，必须大于 0。
+ *
+ * @param uxItemSize 每个数据项的字节数，必须大于 0。
+ *
+ * @param pucQueueStorage 存储区，至少 spscQUEUE_STORAGE_BYTES( uxQueueLength, uxItemSize ) 字节。
+ *
+ * @param pxStaticQueue 用来保存队列控制结构的 StaticSpscQueue_t 变量。
+ *
+ * @return 参数都不为 NULL 时返回队列句柄，否则返回 NULL。
+ *
+ * 使用示例：
+ * @code{c}
+ * #define rxLENGTH    64
+ *
+ * static uint8_t ucRxStorage[ spscQUEUE_STORAGE_BYTES( rxLENGTH, sizeof( uint8_t ) ) ];
+ * static StaticSpscQueue_t xRxQueueStruct;
+ *
+ * void vAFunction( void )
+ * {
+ *     SpscQueueHandle_t xRxQueue;
+ *
+ *     xRxQueue = xSpscQueueCreateStatic( rxLENGTH, sizeof( uint8_t ), ucRxStorage, &xRxQueueStruct );
+ * }
+ * @endcode
+ * \defgroup xSpscQueueCreateStatic xSpscQueueCreateStatic
+ * \ingroup SpscQueueManagement
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    SpscQueueHandle_t xSpscQueueCreateStatic( UBaseType_t uxQueueLength,
+                                              UBaseType_t uxItemSize,
+                                              uint8_t * const pucQueueStorage,
+                                              StaticSpscQueue_t * const pxStaticQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * void vSpscQueueDelete( SpscQueueHandle_t xQueue );
+ * @endcode
+ *
+ * 删除 SPSC 队列。动态创建的队列会释放内存；静态创建的队列只是不再使用，内存由调用者回收。
+ * 删除时不能有任务阻塞在该队列上。
+ *
+ * @param xQueue 要删除的队列句柄。
+ *
+ * \defgroup vSpscQueueDelete vSpscQueueDelete
+ * \ingroup SpscQueueManagement
+ */
+void vSpscQueueDelete( SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue, const void * pvItemToQueue, TickType_t xTicksToWait );
+ * BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue, const void * pvItemToQueue, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * 把一个数据项复制到队尾。只能由唯一的写入者调用：任务中用 xSpscQueueSend()，
+ * 中断中用 xSpscQueueSendFromISR()。
+ *
+ * 队列未满时不进入临界区；只有读取者正阻塞等待数据时，才用任务通知唤醒它。
+ *
+ * @param xQueue 目标队列句柄。
+ *
+ * @param pvItemToQueue 指向待发送的数据项，复制 uxItemSize 字节。
+ *
+ * @param xTicksToWait 队列满时的最大阻塞节拍数，规则与 xQueueSend() 相同。
+ *
+ * @param pxHigherPriorityTaskWoken 发送唤醒了比当前任务优先级更高的读取者时被设为 pdTRUE，
+ * 中断退出前应据此请求上下文切换。可以为 NULL。
+ *
+ * @return 发送成功返回 pdPASS，队列满（或超时）返回 errQUEUE_FULL。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vUartRxISR( void )
+ * {
+ *     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *     uint8_t ucByte = UART_DATA_REGISTER;
+ *
+ *     ( void ) xSpscQueueSendFromISR( xRxQueue, &ucByte, &xHigherPriorityTaskWoken );
+ *
+ *     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ * \defgroup xSpscQueueSend xSpscQueueSend
+ * \ingroup SpscQueueManagement
+ */
+BaseType_t xSpscQueueSend( SpscQueueHandle_t xQueue,
+                           const void * const pvItemToQueue,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xSpscQueueSendFromISR( SpscQueueHandle_t xQueue,
+                                  const void * const pvItemToQueue,
+                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue, void * pvBuffer, TickType_t xTicksToWait );
+ * BaseType_t xSpscQueueReceiveFromISR( SpscQueueHandle_t xQueue, void * pvBuffer, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * 从队首取出一个数据项复制到 pvBuffer。只能由唯一的读取者调用：任务中用 xSpscQueueReceive()，
+ * 中断中用 xSpscQueueReceiveFromISR()。
+ *
+ * 队列非空时不进入临界区；只有写入者正因队列满而阻塞时，才用任务通知唤醒它。
+ *
+ * @param xQueue 目标队列句柄。
+ *
+ * @param pvBuffer 接收缓冲区，至少 uxItemSize 字节。
+ *
+ * @param xTicksToWait 队列空时的最大阻塞节拍数，规则与 xQueueReceive() 相同。
+ *
+ * @param pxHigherPriorityTaskWoken 接收唤醒了比当前任务优先级更高的写入者时被设为 pdTRUE。可以为 NULL。
+ *
+ * @return 接收成功返回 pdPASS，队列空（或超时）返回 errQUEUE_EMPTY。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vUartTask( void * pvParameters )
+ * {
+ *     uint8_t ucByte;
+ *
+ *     for( ; ; )
+ *     {
+ *         if( xSpscQueueReceive( xRxQueue, &ucByte, portMAX_DELAY ) == pdPASS )
+ *         {
+ *             vProcessByte( ucByte );
+ *         }
+ *     }
+ * }
+ * @endcode
+ * \defgroup xSpscQueueReceive xSpscQueueReceive
+ * \ingroup SpscQueueManagement
+ */
+BaseType_t xSpscQueueReceive( SpscQueueHandle_t xQueue,
+                              void * const pvBuffer,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xSpscQueueReceiveFromISR( SpscQueueHandle_t xQueue,
+                                     void * const pvBuffer,
+                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * spsc_queue.h
+ *
+ * @code{c}
+ * UBaseType_t uxSpscQueueMessagesWaiting( SpscQueueHandle_t xQueue );
+ * @endcode
+ *
+ * 返回队列中的数据项数。写入者和读取者可能同时在修改索引，因此结果只是调用时刻的快照：
+ * 写入者调用时可能偏大（读取者刚取走数据），读取者调用时可能偏小（写入者刚写入数据）。
+ * 可以在任务和中断中调用。
+ *
+ * @param xQueue 要查询的队列句柄。
+ *
+ * @return 队列中的数据项数。
+ *
+ * \defgroup uxSpscQueueMessagesWaiting uxSpscQueueMessagesWaiting
+ * \ingroup SpscQueueManagement
+ */
+UBaseType_t uxSpscQueueMessagesWaiting( SpscQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( SPSC_QUEUE_H ) */
@@ -81,7 +81,7 @@
 #endif /* configCHECK_FOR_STACK_OVERFLOW == 1 */
 /*-----------------------------------------------------------*/
 
-#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) && ( portSTACK_GROWTH < 0 ) )
+#if ( ( configCHECK_FOR_STACK_OVERFLOW == 2 ) && ( portSTACK_GROWTH < 0 ) )
 
     #define taskCHECK_FOR_STACK_OVERFLOW()                                                      \
     do {                                                                                        \
@@ -101,7 +101,7 @@
 #endif /* #if( configCHECK_FOR_STACK_OVERFLOW > 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) && ( portSTACK_GROWTH > 0 ) )
+#if ( ( configCHECK_FOR_STACK_OVERFLOW == 2 ) && ( portSTACK_GROWTH > 0 ) )
 
     #define taskCHECK_FOR_STACK_OVERFLOW()                                                                                                \
     do {                                                                                                                                  \
@@ -126,6 +126,39 @@
 #endif /* #if( configCHECK_FOR_STACK_OVERFLOW > 1 ) */
 /*-----------------------------------------------------------*/
 
+#if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+
+/*
+ * 栈最深端 16 字节是保护区，创建任务时填充为 tskSTACK_FILL_BYTE，其中最靠近栈顶的一个字
+ * （溢出时最先被改写）换成每个任务不同的随机金丝雀值。每次切换只比较这一个字；
+ * 整个保护区由 xTaskIncrementTick() 每 configSTACK_OVERFLOW_DEEP_CHECK_PERIOD 个节拍
+ * 轮流检查一个任务，不占用切换时间。
+ */
+    #define taskSTACK_GUARD_WORDS    ( ( 16U + sizeof( StackType_t ) - 1U ) / sizeof( StackType_t ) )
+
+    #if ( portSTACK_GROWTH < 0 )
+        #define taskSTACK_GUARD_START( pxTCB )        ( ( pxTCB )->pxStack )
+        #define taskSTACK_CANARY_LOCATION( pxTCB )    ( ( pxTCB )->pxStack + ( taskSTACK_GUARD_WORDS - 1U ) )
+    #else
+        #define taskSTACK_GUARD_START( pxTCB )        ( ( pxTCB )->pxEndOfStack - ( taskSTACK_GUARD_WORDS - 1U ) )
+        #define taskSTACK_CANARY_LOCATION( pxTCB )    ( ( pxTCB )->pxEndOfStack - ( taskSTACK_GUARD_WORDS - 1U ) )
+    #endif
+
+    #define taskCHECK_FOR_STACK_OVERFLOW()                                                        \
+    do {                                                                                          \
+        TCB_t * const pxCheckedTCB = pxCurrentTCB;                                                \
+                                                                                                  \
+        /* Has the canary at the top of the guard region been written over? */                   \
+        if( *taskSTACK_CANARY_LOCATION( pxCheckedTCB ) != pxCheckedTCB->xStackCanary )            \
+        {                                                                                         \
+            char * pcOverflowTaskName = pxCheckedTCB->pcTaskName;                                 \
+            vApplicationStackOverflowHook( ( TaskHandle_t ) pxCheckedTCB, pcOverflowTaskName );   \
+        }                                                                                         \
+    } while( 0 )
+
+#endif /* configCHECK_FOR_STACK_OVERFLOW == 3 */
+/*-----------------------------------------------------------*/
+
 /* Remove stack overflow macro if not being used. */
 #ifndef taskCHECK_FOR_STACK_OVERFLOW
     #define taskCHECK_FOR_STACK_OVERFLOW()
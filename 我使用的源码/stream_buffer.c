@@ -58,6 +58,116 @@
  * configUSE_STREAM_BUFFERS is set to 1 in FreeRTOSConfig.h. */
 #if ( configUSE_STREAM_BUFFERS == 1 )
 
+/* Critical sections protecting the state of a single stream buffer.  When
+ * configUSE_GRANULAR_LOCKS is 1 only the spinlock of the stream buffer is taken,
+ * so the kernel task lock must not be taken from inside these sections. */
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        #define sbENTER_CRITICAL( pxStreamBuffer )                                 taskENTER_CRITICAL_OBJECT( &( ( pxStreamBuffer )->xSpinlock ) )
+        #define sbEXIT_CRITICAL( pxStreamBuffer )                                  taskEXIT_CRITICAL_OBJECT( &( ( pxStreamBuffer )->xSpinlock ) )
+        #define sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer )                        taskENTER_CRITICAL_OBJECT_FROM_ISR( &( ( pxStreamBuffer )->xSpinlock ) )
+        #define sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer ) taskEXIT_CRITICAL_OBJECT_FROM_ISR( uxSavedInterruptStatus, &( ( pxStreamBuffer )->xSpinlock ) )
+    #else
+        #define sbENTER_CRITICAL( pxStreamBuffer )                                 taskENTER_CRITICAL()
+        #define sbEXIT_CRITICAL( pxStreamBuffer )                                  taskEXIT_CRITICAL()
+        #define sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer )                        taskENTER_CRITICAL_FROM_ISR()
+        #define sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer ) taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus )
+    #endif /* configUSE_GRANULAR_LOCKS */
+
+/* With configUSE_GRANULAR_LOCKS set to 1 the default notification macros take
+ * the waiting task handle out of the stream buffer under the stream buffer's
+ * own spinlock, and the task-level versions send the notification after the
+ * spinlock is released rather than from inside a scheduler suspension. */
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        #ifndef sbRECEIVE_COMPLETED
+            #define sbRECEIVE_COMPLETED( pxStreamBuffer )                                 \
+    do                                                                                    \
+    {                                                                                     \
+        TaskHandle_t xTaskToNotify;                                                       \
+                                                                                          \
+        sbENTER_CRITICAL( pxStreamBuffer );                                               \
+        {                                                                                 \
+            xTaskToNotify = ( pxStreamBuffer )->xTaskWaitingToSend;                       \
+            ( pxStreamBuffer )->xTaskWaitingToSend = NULL;                                \
+        }                                                                                 \
+        sbEXIT_CRITICAL( pxStreamBuffer );                                                \
+                                                                                          \
+        if( xTaskToNotify != NULL )                                                       \
+        {                                                                                 \
+            ( void ) xTaskNotifyIndexed( xTaskToNotify,                                   \
+                                         ( pxStreamBuffer )->uxNotificationIndex,         \
+                                         ( uint32_t ) 0,                                  \
+                                         eNoAction );                                     \
+        }                                                                                 \
+    } while( 0 )
+        #endif /* sbRECEIVE_COMPLETED */
+
+        #ifndef sbRECEIVE_COMPLETED_FROM_ISR
+            #define sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer,                                \
+                                                  pxHigherPriorityTaskWoken )                    \
+    do {                                                                                         \
+        UBaseType_t uxSavedInterruptStatus;                                                      \
+                                                                                                 \
+        uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );                    \
+        {                                                                                        \
+            if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )                                 \
+            {                                                                                    \
+                ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,      \
+                                                    ( pxStreamBuffer )->uxNotificationIndex,     \
+                                                    ( uint32_t ) 0,                              \
+                                                    eNoAction,                                   \
+                                                    ( pxHigherPriorityTaskWoken ) );             \
+                ( pxStreamBuffer )->xTaskWaitingToSend = NULL;                                   \
+            }                                                                                    \
+        }                                                                                        \
+        sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );                      \
+    } while( 0 )
+        #endif /* sbRECEIVE_COMPLETED_FROM_ISR */
+
+        #ifndef sbSEND_COMPLETED
+            #define sbSEND_COMPLETED( pxStreamBuffer )                                    \
+    do                                                                                    \
+    {                                                                                     \
+        TaskHandle_t xTaskToNotify;                                                       \
+                                                                                          \
+        sbENTER_CRITICAL( pxStreamBuffer );                                               \
+        {                                                                                 \
+            xTaskToNotify = ( pxStreamBuffer )->xTaskWaitingToReceive;                    \
+            ( pxStreamBuffer )->xTaskWaitingToReceive = NULL;                             \
+        }                                                                                 \
+        sbEXIT_CRITICAL( pxStreamBuffer );                                                \
+                                                                                          \
+        if( xTaskToNotify != NULL )                                                       \
+        {                                                                                 \
+            ( void ) xTaskNotifyIndexed( xTaskToNotify,                                   \
+                                         ( pxStreamBuffer )->uxNotificationIndex,         \
+                                         ( uint32_t ) 0,                                  \
+                                         eNoAction );                                     \
+        }                                                                                 \
+    } while( 0 )
+        #endif /* sbSEND_COMPLETED */
+
+        #ifndef sbSEND_COMPLETE_FROM_ISR
+            #define sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )       \
+    do {                                                                                         \
+        UBaseType_t uxSavedInterruptStatus;                                                      \
+                                                                                                 \
+        uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );                    \
+        {                                                                                        \
+            if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )                              \
+            {                                                                                    \
+                ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,   \
+                                                    ( pxStreamBuffer )->uxNotificationIndex,     \
+                                                    ( uint32_t ) 0,                              \
+                                                    eNoAction,                                   \
+                                                    ( pxHigherPriorityTaskWoken ) );             \
+                ( pxStreamBuffer )->xTaskWaitingToReceive = NULL;                                \
+            }                                                                                    \
+        }                                                                                        \
+        sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );                      \
+    } while( 0 )
+        #endif /* sbSEND_COMPLETE_FROM_ISR */
+    #endif /* configUSE_GRANULAR_LOCKS */
+
 /* If the user has not provided application specific Rx notification macros,
  * or #defined the notification macros away, then provide default implementations
  * that uses task notifications. */
@@ -249,6 +359,10 @@ typedef struct StreamBufferDef_t
         StreamBufferCallbackFunction_t pxReceiveCompletedCallback; /* Optional callback called on receive complete.  sbRECEIVE_COMPLETED is called if this is NULL. */
     #endif
     UBaseType_t uxNotificationIndex;                               /* The index we are using for notification, by default tskDEFAULT_INDEX_TO_NOTIFY. */
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xSpinlock; /* Protects the stream buffer state. Must remain the last member, see prvInitialiseNewStreamBuffer(). */
+    #endif
 } StreamBuffer_t;
 
 /*
@@ -405,6 +519,12 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           pxSendCompletedCallback,
                                           pxReceiveCompletedCallback );
 
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                portINIT_SPINLOCK( &( ( ( StreamBuffer_t * ) pvAllocatedMemory )->xSpinlock ) );
+            }
+            #endif
+
             traceSTREAM_BUFFER_CREATE( ( ( StreamBuffer_t * ) pvAllocatedMemory ), xStreamBufferType );
         }
         else
@@ -495,6 +615,12 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           pxSendCompletedCallback,
                                           pxReceiveCompletedCallback );
 
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                portINIT_SPINLOCK( &( pxStreamBuffer->xSpinlock ) );
+            }
+            #endif
+
             /* Remember this was statically allocated in case it is ever deleted
              * again. */
             pxStreamBuffer->ucFlags |= sbFLAGS_IS_STATICALLY_ALLOCATED;
@@ -614,7 +740,7 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
     #endif
 
     /* Can only reset a message buffer if there are no tasks blocked on it. */
-    taskENTER_CRITICAL();
+    sbENTER_CRITICAL( pxStreamBuffer );
     {
         if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
         {
@@ -644,7 +770,7 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
             xReturn = pdPASS;
         }
     }
-    taskEXIT_CRITICAL();
+    sbEXIT_CRITICAL( pxStreamBuffer );
 
     traceRETURN_xStreamBufferReset( xReturn );
 
@@ -679,7 +805,7 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
     {
         if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
         {
@@ -709,7 +835,7 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
             xReturn = pdPASS;
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
 
     traceRETURN_xStreamBufferResetFromISR( xReturn );
 
@@ -870,16 +996,30 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
 
         do
         {
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                /* The kernel task lock cannot be taken while holding the
+                 * stream buffer spinlock, so clear the notification state
+                 * before checking for space.  A notification sent after this
+                 * point still wakes the task below. */
+                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+            }
+            #endif
+
             /* Wait until the required number of bytes are free in the message
              * buffer. */
-            taskENTER_CRITICAL();
+            sbENTER_CRITICAL( pxStreamBuffer );
             {
                 xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
 
                 if( xSpace < xRequiredSpace )
                 {
-                    /* Clear notification state as going to wait for space. */
-                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                    #if ( configUSE_GRANULAR_LOCKS == 0 )
+                    {
+                        /* Clear notification state as going to wait for space. */
+                        ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                    }
+                    #endif
 
                     /* Should only be one writer. */
                     configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
@@ -887,11 +1027,11 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
                 }
                 else
                 {
-                    taskEXIT_CRITICAL();
+                    sbEXIT_CRITICAL( pxStreamBuffer );
                     break;
                 }
             }
-            taskEXIT_CRITICAL();
+            sbEXIT_CRITICAL( pxStreamBuffer );
 
             traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
             ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
@@ -1085,9 +1225,19 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
 
     if( xTicksToWait != ( TickType_t ) 0 )
     {
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            /* The kernel task lock cannot be taken while holding the stream
+             * buffer spinlock, so clear the notification state before checking
+             * for data.  A notification sent after this point still wakes the
+             * task below. */
+            ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+        }
+        #endif
+
         /* Checking if there is data and clearing the notification state must be
          * performed atomically. */
-        taskENTER_CRITICAL();
+        sbENTER_CRITICAL( pxStreamBuffer );
         {
             xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
 
@@ -1100,8 +1250,12 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
              * for the buffer.*/
             if( xBytesAvailable <= xBytesToStoreMessageLength )
             {
-                /* Clear notification state as going to wait for data. */
-                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                #if ( configUSE_GRANULAR_LOCKS == 0 )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                }
+                #endif
 
                 /* Should only be one reader. */
                 configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
@@ -1112,7 +1266,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
                 mtCOVERAGE_TEST_MARKER();
             }
         }
-        taskEXIT_CRITICAL();
+        sbEXIT_CRITICAL( pxStreamBuffer );
 
         if( xBytesAvailable <= xBytesToStoreMessageLength )
         {
@@ -1409,7 +1563,7 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
     {
         if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
         {
@@ -1426,7 +1580,7 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
             xReturn = pdFALSE;
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
 
     traceRETURN_xStreamBufferSendCompletedFromISR( xReturn );
 
@@ -1448,7 +1602,7 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
     {
         if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )
         {
@@ -1465,7 +1619,7 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
             xReturn = pdFALSE;
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
 
     traceRETURN_xStreamBufferReceiveCompletedFromISR( xReturn );
 
@@ -1605,7 +1759,18 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
     }
     #endif
 
-    ( void ) memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+    {
+        /* xStreamBufferReset() calls this function while holding the spinlock,
+         * so leave the spinlock (the last member) untouched.  It is initialised
+         * once when the stream buffer is created. */
+        ( void ) memset( ( void * ) pxStreamBuffer, 0x00, offsetof( StreamBuffer_t, xSpinlock ) );
+    }
+    #else
+    {
+        ( void ) memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+    }
+    #endif
     pxStreamBuffer->pucBuffer = pucBuffer;
     pxStreamBuffer->xLength = xBufferSizeBytes;
     pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
@@ -60,7 +60,8 @@
         #define taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB ) \
     do {                                                        \
     /* 若当前运行任务的优先级低于被唤醒任务（pxTCB）的优先级，触发任务切换 */ \
-        if( pxCurrentTCB->uxPriority < ( pxTCB )->uxPriority )  \
+        if( ( pxCurrentTCB->uxPriority < ( pxTCB )->uxPriority ) || \
+            ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )               \
         {                                                       \
             portYIELD_WITHIN_API(); /* 触发切换，让高优先级任务抢占运行 */\
         }                                                       \
@@ -74,7 +75,6 @@
 
 /* 让此任务正在运行的核心执行任务切换（yield）。 */
     #define taskYIELD_TASK_CORE_IF_USING_PREEMPTION( pxTCB )    prvYieldCore( ( pxTCB )->xTaskRunState )
-/
 /* 若存在正在运行的任务优先级低于此任务，则为该任务触发切换。 */
     #define taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB )     prvYieldForTask( pxTCB )
 
@@ -90,6 +90,9 @@
 /*任务创建时用于填充任务栈的值。这一值纯粹用于检查任务的高水位线（栈使用峰值）。*/
 #define tskSTACK_FILL_BYTE                        ( 0xa5U )
 
+/* 每个字节都是 tskSTACK_FILL_BYTE 的栈字，用于按字检查栈。 */
+#define taskSTACK_FILL_WORD                       ( ( StackType_t ) ( ( ( StackType_t ) ~( StackType_t ) 0U / ( StackType_t ) 0xFFU ) * ( StackType_t ) tskSTACK_FILL_BYTE ) )
+
 /* 用于记录任务的栈和 TCB（任务控制块）分配方式的位定义。 */
 #define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB    ( ( uint8_t ) 0 ) // 栈和 TCB 均为动态分配
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY        ( ( uint8_t ) 1 ) // 仅栈为静态分配，TCB 为动态分配
@@ -100,12 +103,51 @@
 //configUSE_TRACE_FACILITY == 1	启用跟踪功能（用于生成系统运行轨迹，如任务切换、API 调用记录）
 //INCLUDE_uxTaskGetStackHighWaterMark == 1	启用 “获取栈高水位线” 函数（uxTaskGetStackHighWaterMark()）
 //INCLUDE_uxTaskGetStackHighWaterMark2 == 1	启用 “增强版栈高水位线” 函数（uxTaskGetStackHighWaterMark2()）
-#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) || ( configSTACK_WATERMARK_SCAN_WORDS > 0 ) )
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    1 // 启用栈填充
 #else
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    0 // 禁用栈填充
 #endif
 
+/* 分段读取任务状态、空闲任务的栈扫描和栈保护区的轮流检查都需要按创建顺序遍历所有任务。 */
+#if ( ( configUSE_TASK_SNAPSHOT == 1 ) || ( configSTACK_WATERMARK_SCAN_WORDS > 0 ) || ( configCHECK_FOR_STACK_OVERFLOW == 3 ) )
+    #define taskTRACK_ALL_TASKS    1
+#else
+    #define taskTRACK_ALL_TASKS    0
+#endif
+
+#if ( configUSE_STACK_WATERMARK == 1 )
+
+/* 任务切换出去时 pxTopOfStack 就是它的栈指针，比记录的更深时更新记录。 */
+    #if ( portSTACK_GROWTH < 0 )
+        #define taskRECORD_STACK_WATERMARK( pxTCB )                                   \
+    do {                                                                              \
+        if( ( StackType_t * ) ( pxTCB )->pxTopOfStack < ( pxTCB )->pxStackWatermark ) \
+        {                                                                             \
+            ( pxTCB )->pxStackWatermark = ( StackType_t * ) ( pxTCB )->pxTopOfStack;  \
+        }                                                                             \
+    } while( 0 )
+    #else
+        #define taskRECORD_STACK_WATERMARK( pxTCB )                                   \
+    do {                                                                              \
+        if( ( StackType_t * ) ( pxTCB )->pxTopOfStack > ( pxTCB )->pxStackWatermark ) \
+        {                                                                             \
+            ( pxTCB )->pxStackWatermark = ( StackType_t * ) ( pxTCB )->pxTopOfStack;  \
+        }                                                                             \
+    } while( 0 )
+    #endif
+
+/* 空闲任务从栈的最深端开始扫描。taskSTACK_IS_DEEPER() 判断栈位置 pxA 是否比 pxB 更深。 */
+    #if ( portSTACK_GROWTH < 0 )
+        #define taskSTACK_SCAN_START( pxTCB )      ( ( pxTCB )->pxStack )
+        #define taskSTACK_IS_DEEPER( pxA, pxB )    ( ( pxA ) < ( pxB ) )
+    #else
+        #define taskSTACK_SCAN_START( pxTCB )      ( ( pxTCB )->pxEndOfStack )
+        #define taskSTACK_IS_DEEPER( pxA, pxB )    ( ( pxA ) > ( pxB ) )
+    #endif
+
+#endif /* configUSE_STACK_WATERMARK */
+
 //这些宏被 vListTask 函数用于标识任务所处的状态（以字符形式展示）
 #define tskRUNNING_CHAR      ( 'X' )// 表示任务处于运行状态
 #define tskBLOCKED_CHAR      ( 'B' )// 表示任务处于阻塞状态
@@ -125,7 +167,172 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
-#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* 截止时间 xA 是否早于 xB。按回绕后的差值比较，两者相差不超过 portMAX_DELAY 的一半时结果正确。 */
+    #define taskEDF_DEADLINE_BEFORE( xA, xB )    ( ( TickType_t ) ( ( xA ) - ( xB ) ) > ( portMAX_DELAY >> 1 ) )
+
+/* pxTCB 是否属于 EDF 调度类（声明了截止时间）。 */
+    #define taskEDF_HAS_DEADLINE( pxTCB )        ( ( pxTCB )->xEdfRelativeDeadline != ( TickType_t ) 0 )
+
+/* 就绪的 pxTCB 与当前任务同在 EDF 优先级，并且截止时间更早，需要抢占当前任务。 */
+    #define taskEDF_SHOULD_PREEMPT( pxTCB )                                                             \
+    ( ( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&                                \
+      ( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&                             \
+      ( taskEDF_HAS_DEADLINE( pxTCB ) ) &&                                                              \
+      ( ( !taskEDF_HAS_DEADLINE( pxCurrentTCB ) ) ||                                                    \
+        ( taskEDF_DEADLINE_BEFORE( ( pxTCB )->xEdfAbsoluteDeadline, pxCurrentTCB->xEdfAbsoluteDeadline ) ) ) )
+
+/* EDF 优先级的就绪链表按截止时间排序：链表头有截止时间时直接选择链表头，
+ * 否则链表中只剩没有截止时间的任务，与其它优先级一样轮流执行。 */
+    #define taskSELECT_FROM_READY_LIST( uxTopPriority )                                                   \
+    do {                                                                                                  \
+        TCB_t * const pxHeadTCB = listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ uxTopPriority ] ) ); \
+                                                                                                          \
+        if( ( ( uxTopPriority ) == ( UBaseType_t ) configEDF_PRIORITY ) && ( taskEDF_HAS_DEADLINE( pxHeadTCB ) ) ) \
+        {                                                                                                 \
+            pxCurrentTCB = pxHeadTCB;                                                                     \
+        }                                                                                                 \
+        else                                                                                              \
+        {                                                                                                 \
+            listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );         \
+        }                                                                                                 \
+    } while( 0 )
+
+/* 放入就绪链表：EDF 优先级按截止时间有序插入，其它优先级插入到末尾。 */
+    #define taskINSERT_INTO_READY_LIST( pxTCB )                                                                  \
+    do {                                                                                                         \
+        if( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )                                        \
+        {                                                                                                        \
+            prvAddTaskToEdfReadyList( pxTCB );                                                                   \
+        }                                                                                                        \
+        else                                                                                                     \
+        {                                                                                                        \
+            listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) );   \
+        }                                                                                                        \
+    } while( 0 )
+#else
+    #define taskEDF_SHOULD_PREEMPT( pxTCB )                ( pdFALSE )
+    #define taskSELECT_FROM_READY_LIST( uxTopPriority )    listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) )
+    #define taskINSERT_INTO_READY_LIST( pxTCB )            listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) )
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+/* TCB 中 ucBudgetState 的取值。 */
+    #define taskBUDGET_AVAILABLE                      ( ( uint8_t ) 0 ) /* 本周期预算未用完（或没有设置预算）。 */
+    #define taskBUDGET_DEMOTED                        ( ( uint8_t ) 1 ) /* 预算用完，已降到 uxBudgetDemotedPriority。 */
+    #define taskBUDGET_THROTTLED                      ( ( uint8_t ) 2 ) /* 预算用完，不能再运行，被选中时移入 xBudgetThrottledList。 */
+
+/* 节拍 xNow 是否已经到达 xTime。按回绕后的差值比较，两者相差不超过 portMAX_DELAY 的一半时结果正确。 */
+    #define taskBUDGET_TIME_REACHED( xNow, xTime )    ( ( TickType_t ) ( ( xNow ) - ( xTime ) ) <= ( portMAX_DELAY >> 1 ) )
+
+/* 从节拍 xNow 往后还有多少个节拍不会到达 xTime。 */
+    #define taskBUDGET_TICKS_BEFORE( xNow, xTime ) \
+    ( taskBUDGET_TIME_REACHED( ( xNow ), ( xTime ) ) ? ( TickType_t ) 0 : ( TickType_t ) ( ( xTime ) - ( xNow ) - ( TickType_t ) 1 ) )
+
+#endif /* configUSE_TASK_BUDGETS */
+
+#if ( configUSE_TASK_POOL == 1 )
+
+/* 对象池的规格数：TCB 一种，栈 configTASK_POOL_STACK_CLASSES 种。 */
+    #define taskPOOL_CLASSES             ( ( UBaseType_t ) configTASK_POOL_STACK_CLASSES + 1U )
+    #define taskPOOL_TCB_CLASS           ( ( uint8_t ) 0 )
+    #define taskPOOL_NOT_POOLED          ( ( uint8_t ) 0xFF )
+
+/* 规格 ucClass（大于 0）的栈深度。 */
+    #define taskPOOL_STACK_DEPTH( ucClass )    ( ( size_t ) configTASK_POOL_MIN_STACK_DEPTH << ( ( ucClass ) - 1U ) )
+
+/* 对象大小向上取整到 portBYTE_ALIGNMENT，保证一块 slab 中的每个对象都满足对齐要求。 */
+    #define taskPOOL_ALIGN( xSize )      ( ( ( xSize ) + ( size_t ) portBYTE_ALIGNMENT - 1U ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+#endif /* configUSE_TASK_POOL */
+
+#if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+
+/* 发布与读取节拍计数时使用的屏障。单核上写入方是节拍中断，与读取方在同一核心，只需阻止编译器重排。 */
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define taskTICK_COUNT_BARRIER()    portMEMORY_BARRIER()
+    #else
+        #define taskTICK_COUNT_BARRIER()    portMEMORY_FULL_BARRIER()
+    #endif
+
+/* 修改 xTickCount 或 xNumOfOverflows 之后调用，调用时不能被另一个写入方打断（节拍中断或临界区中）。 */
+    #define taskPUBLISH_TICK_COUNT()    prvPublishTickCount()
+#else
+    #define taskPUBLISH_TICK_COUNT()
+#endif /* configUSE_TICK_COUNT_SEQLOCK */
+
+/* 32 位位图中最高、最低置位位的序号（ulBits 不能为 0），用于就绪优先级位图和时间轮的位图。
+ * GCC/Clang 使用内建函数（通常编译为 CLZ/CTZ 指令），其它编译器使用可移植的 C 实现。 */
+#if ( configUSE_READY_PRIORITY_BITMAP == 1 ) || ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    #if defined( __GNUC__ ) && ( __SIZEOF_INT__ >= 4 )
+        #define taskHIGHEST_SET_BIT( ulBits )    ( ( UBaseType_t ) ( 31U - ( UBaseType_t ) __builtin_clz( ( unsigned int ) ( ulBits ) ) ) )
+        #define taskLOWEST_SET_BIT( ulBits )     ( ( UBaseType_t ) __builtin_ctz( ( unsigned int ) ( ulBits ) ) )
+    #else
+        #define taskUSE_GENERIC_BIT_SCAN         1
+        #define taskHIGHEST_SET_BIT( ulBits )    prvHighestSetBit( ulBits )
+        #define taskLOWEST_SET_BIT( ulBits )     prvLowestSetBit( ulBits )
+    #endif
+#endif
+
+#if ( configUSE_READY_PRIORITY_BITMAP == 1 )
+
+/* 两级就绪优先级位图：ulReadyPriorityGroupMap 的第 g 位表示第 g 组（优先级 32g ~ 32g+31）中有就绪任务，
+ * ulReadyPriorityMap[ g ] 的第 n 位表示优先级 32g+n 的就绪链表非空。
+ * 置位/清零的时机与移植优化的任务选择方法相同，uxTopReadyPriority 仍按通用方法维护，
+ * 供 prvGetExpectedIdleTime() 使用。 */
+    #define taskREADY_PRIORITY_GROUPS    ( ( ( UBaseType_t ) configMAX_PRIORITIES + 31U ) >> 5 )
+
+    #define taskRECORD_READY_PRIORITY( uxPriority )                                              \
+    do {                                                                                         \
+        ulReadyPriorityMap[ ( uxPriority ) >> 5 ] |= ( uint32_t ) 1U << ( ( uxPriority ) & 31U ); \
+        ulReadyPriorityGroupMap |= ( uint32_t ) 1U << ( ( uxPriority ) >> 5 );                   \
+                                                                                                 \
+        if( ( uxPriority ) > uxTopReadyPriority )                                                \
+        {                                                                                        \
+            uxTopReadyPriority = ( uxPriority );                                                 \
+        }                                                                                        \
+    } while( 0 ) /* taskRECORD_READY_PRIORITY */
+
+/*-----------------------------------------------------------*/
+
+    #define taskSELECT_HIGHEST_PRIORITY_TASK()                                                  \
+    do {                                                                                        \
+        UBaseType_t uxTopGroup;                                                                 \
+        UBaseType_t uxTopPriority;                                                              \
+                                                                                                \
+        /* 先找最高的非空组，再在组内找最高的就绪优先级。 */                                     \
+        configASSERT( ulReadyPriorityGroupMap != 0U );                                          \
+        uxTopGroup = taskHIGHEST_SET_BIT( ulReadyPriorityGroupMap );                            \
+        uxTopPriority = ( uxTopGroup << 5 ) + taskHIGHEST_SET_BIT( ulReadyPriorityMap[ uxTopGroup ] ); \
+        configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 ); \
+        taskSELECT_FROM_READY_LIST( uxTopPriority );                                            \
+        uxTopReadyPriority = uxTopPriority;                                                     \
+    } while( 0 ) /* taskSELECT_HIGHEST_PRIORITY_TASK */
+
+/*-----------------------------------------------------------*/
+
+/* 与移植优化的方法一样，调用者保证优先级为 uxPriority 的就绪链表已经为空。 */
+    #define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )                             \
+    do {                                                                                           \
+        ulReadyPriorityMap[ ( uxPriority ) >> 5 ] &= ~( ( uint32_t ) 1U << ( ( uxPriority ) & 31U ) ); \
+                                                                                                   \
+        if( ulReadyPriorityMap[ ( uxPriority ) >> 5 ] == 0U )                                      \
+        {                                                                                          \
+            ulReadyPriorityGroupMap &= ~( ( uint32_t ) 1U << ( ( uxPriority ) >> 5 ) );            \
+        }                                                                                          \
+    } while( 0 )
+
+    #define taskRESET_READY_PRIORITY( uxPriority )                                                     \
+    do {                                                                                               \
+        if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == ( UBaseType_t ) 0 ) \
+        {                                                                                              \
+            portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );                        \
+        }                                                                                              \
+    } while( 0 )
+
+#elif ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* 若 configUSE_PORT_OPTIMISED_TASK_SELECTION 为 0，则任务选择将以通用方式执行，
  * 不针对任何特定的微控制器架构架构进行优化。 */
@@ -154,8 +361,8 @@
         }                                                                                \
                                                                                          \
         /* listGET_OWNER_OF_NEXT_ENTRY 遍历链表，因此相同优先级的任务
-         * 可以平等共享处理器时间。 */   
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) ); \
+         * 可以平等共享处理器时间。 */ \
+        taskSELECT_FROM_READY_LIST( uxTopPriority );                                          \
         uxTopReadyPriority = uxTopPriority;                                                   \
     } while( 0 ) /* taskSELECT_HIGHEST_PRIORITY_TASK */
     #else /* if ( configNUMBER_OF_CORES == 1 ) */
@@ -189,7 +396,7 @@
         /* Find the highest priority list that contains ready tasks. */                         \
         portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );                          \
         configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 ); \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );   \
+        taskSELECT_FROM_READY_LIST( uxTopPriority );                                            \
     } while( 0 )
 
 /*-----------------------------------------------------------*/
@@ -225,18 +432,54 @@
         prvResetNextTaskUnblockTime();                /*重置下一次唤醒时间 */       \
     } while( 0 )
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/* 两级时间轮。把节拍计数按 taskWHEEL_SLOTS 个节拍划分为“段”：
+ * - xDelayedTaskWheel[ 0 ]（节拍轮）：每个槽对应当前段内的一个节拍；
+ * - xDelayedTaskWheel[ 1 ]（段轮）：每个槽对应之后 1 ~ ( taskWHEEL_SLOTS - 1 ) 个段中的一段，
+ *   到达该段的起点时，槽中的任务按唤醒时间分散到节拍轮；
+ * - 更远的任务仍按唤醒时间有序地放在 pxDelayedTaskList/pxOverflowDelayedTaskList 中，
+ *   进入段轮的范围后再移入时间轮。
+ * 时间轮的范围是 taskWHEEL_SLOTS * taskWHEEL_SLOTS 个节拍（configDELAYED_TASK_WHEEL_BITS 为 8 时
+ * 是 65536 个节拍，1kHz 节拍下约 65 秒）。超时比这更长的任务插入时仍要遍历有序链表，
+ * 这是时间轮有意保留的范围限制：需要 O(1) 插入的超时应在范围之内，否则加大 configDELAYED_TASK_WHEEL_BITS。 */
+    #define taskWHEEL_SLOTS        ( ( TickType_t ) ( ( TickType_t ) 1U << configDELAYED_TASK_WHEEL_BITS ) )
+    #define taskWHEEL_SLOT_MASK    ( ( TickType_t ) ( taskWHEEL_SLOTS - ( TickType_t ) 1U ) )
+
+/* 每一级的非空槽位图由若干个 32 位字组成，第 w 个字的第 n 位对应 32w+n 号槽。槽数小于 32 时只有一个字，
+ * 超出槽数的位始终为 0。 */
+    #define taskWHEEL_MAP_WORDS    ( ( ( UBaseType_t ) taskWHEEL_SLOTS + 31U ) >> 5 )
+
+    #define taskWHEEL_MAP_SET( uxLevel, xSlot ) \
+    ( ulDelayedTaskWheelMap[ ( uxLevel ) ][ ( xSlot ) >> 5 ] |= ( uint32_t ) 1U << ( ( xSlot ) & 31U ) )
+
+    #define taskWHEEL_MAP_CLEAR( uxLevel, xSlot ) \
+    ( ulDelayedTaskWheelMap[ ( uxLevel ) ][ ( xSlot ) >> 5 ] &= ~( ( uint32_t ) 1U << ( ( xSlot ) & 31U ) ) )
+
+/* 节拍计数所在的段号，以及从 xFrom 所在段到 xTo 所在段的段数（考虑节拍计数回绕）。 */
+    #define taskWHEEL_SEGMENT( xTime )                     ( ( TickType_t ) ( ( TickType_t ) ( xTime ) >> configDELAYED_TASK_WHEEL_BITS ) )
+    #define taskWHEEL_SEGMENT_DISTANCE( xTo, xFrom )       ( ( TickType_t ) ( ( taskWHEEL_SEGMENT( xTo ) - taskWHEEL_SEGMENT( xFrom ) ) & taskWHEEL_SEGMENT( portMAX_DELAY ) ) )
+
+/* 任务的状态链表项是否挂在时间轮的某个槽上（即任务处于超时阻塞状态）。 */
+    #define taskLIST_IS_DELAYED_WHEEL_SLOT( pxList )                  \
+    ( ( ( pxList ) >= &( xDelayedTaskWheel[ 0 ][ 0 ] ) ) &&            \
+      ( ( pxList ) <= &( xDelayedTaskWheel[ 1 ][ taskWHEEL_SLOT_MASK ] ) ) )
+#else
+    #define taskLIST_IS_DELAYED_WHEEL_SLOT( pxList )    ( pdFALSE )
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 /*-----------------------------------------------------------*/
 
 /* 将 pxTCB 所代表的任务放入该任务对应的就绪链表中。插入到链表的末尾。 */
 #define prvAddTaskToReadyList( pxTCB )                                     \
     do {                                                                   \
         traceMOVED_TASK_TO_READY_STATE( pxTCB );                           \
-        /* 调试跟踪宏（仅在启用 configUSE_TRACE_FACILITY 时有效），记录 “任务进入就绪状态” 的事件，用于调试工具（如可视化调度器）展示状态变化。*/
+        /* 调试跟踪宏（仅在启用 configUSE_TRACE_FACILITY 时有效），记录 “任务进入就绪状态” 的事件，用于调试工具（如可视化调度器）展示状态变化。*/ \
         taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                \
-        /* 更新最高就绪优先级 */
-        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) );   /* 插入任务到就绪链表 */                                              \
+        /* 更新最高就绪优先级 */ \
+        taskINSERT_INTO_READY_LIST( pxTCB );   /* 插入任务到就绪链表 */                        \
         tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                      \
-        /*跟踪任务进入就绪状态后*/
+        /*跟踪任务进入就绪状态后*/ \
     } while( 0 )
 /*-----------------------------------------------------------*/
 
@@ -413,6 +656,49 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iTaskErrno;
     #endif
+
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xEdfPeriod;           /**< vTaskSetDeadline() 声明的周期，xTaskDelayUntil() 用它检查调用者传入的周期。 */
+        TickType_t xEdfRelativeDeadline; /**< 相对截止时间，为 0 表示任务不属于 EDF 调度类。 */
+        TickType_t xEdfAbsoluteDeadline; /**< 当前周期的绝对截止时间，EDF 优先级的就绪链表按它排序。 */
+    #endif
+
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        ListItem_t xBudgetListItem;          /**< 预算用完后挂在 xBudgetExhaustedList 中，等待补充。 */
+        TickType_t xBudget;                  /**< 每个补充周期内可以运行的节拍数，为 0 表示不限制。 */
+        TickType_t xBudgetPeriod;            /**< 补充周期（节拍数）。 */
+        TickType_t xBudgetRemaining;         /**< 本周期剩余的预算。 */
+        TickType_t xBudgetReplenishTime;     /**< 本周期结束、补充预算的时间。 */
+        UBaseType_t uxBudgetNormalPriority;  /**< 降级前的基础优先级，补充预算后恢复。 */
+        UBaseType_t uxBudgetDemotedPriority; /**< 预算用完后降到的优先级。 */
+        uint8_t ucBudgetAction;              /**< 预算用完后的处理方式（eBudgetAction）。 */
+        uint8_t ucBudgetState;               /**< taskBUDGET_AVAILABLE、taskBUDGET_DEMOTED 或 taskBUDGET_THROTTLED。 */
+    #endif
+
+    #if ( taskTRACK_ALL_TASKS == 1 )
+        ListItem_t xAllTasksListItem; /**< 挂在 xAllTasksList 中，供分段读取任务状态和空闲任务的栈扫描使用。 */
+    #endif
+
+    #if ( configUSE_STACK_WATERMARK == 1 )
+        StackType_t * pxStackWatermark; /**< 已知用到过的最深栈位置，剩余栈空间由它直接算出。 */
+    #endif
+
+    #if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+        StackType_t xStackCanary; /**< 写在栈保护区中的随机值，每次切换时比较。 */
+    #endif
+
+    #if ( configUSE_TASK_POOL == 1 )
+        uint8_t ucStackPoolClass; /**< 栈所属的对象池规格，taskPOOL_NOT_POOLED 表示栈直接从堆分配。 */
+    #endif
+
+    #if ( configUSE_TASK_NAME_INDEX == 1 )
+        struct tskTaskControlBlock * pxNextInNameIndex; /**< 名称索引中同一个桶的下一个任务。 */
+        uint32_t ulNameHash;                            /**< pcTaskName 的散列值，创建任务时计算一次。 */
+    #endif
+
+    #if ( configUSE_QUEUE_HANDOFF == 1 )
+        void * volatile pvHandOffBuffer; /**< 阻塞在队列上时登记的数据项缓冲区，对方直接复制后清为 NULL。 */
+    #endif
 } tskTCB;
 
 /* 上面保留了旧的tskTCB名称，然后在下面将其重定义为新的TCB_t名称，
@@ -446,6 +732,10 @@ PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /**< Po
 /**< 指向当前正在使用的延迟任务链表。 */
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /**< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
  /**< 指向当前用于存放已溢出当前节拍计数的任务的延迟任务链表。 */
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    PRIVILEGED_DATA static List_t xDelayedTaskWheel[ 2 ][ taskWHEEL_SLOTS ]; /**< 时间轮的节拍轮和段轮，槽内任务无序。 */
+    PRIVILEGED_DATA static uint32_t ulDelayedTaskWheelMap[ 2 ][ taskWHEEL_MAP_WORDS ]; /**< 时间轮的非空槽位图。任务因事件离开槽时不清除，由 prvDelayedWheelFindSlot() 惰性清除。 */
+#endif
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 /**< 调度器挂起时被就绪的任务。它们将在调度器恢复时移至就绪链表。 */
 
@@ -463,6 +753,55 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Ta
 	/**< 当前处于挂起状态的任务链表。 */
 #endif
 
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+    PRIVILEGED_DATA static List_t xBudgetExhaustedList;                                /**< 本周期预算已用完的任务（通过 xBudgetListItem 链接，无序）。 */
+    PRIVILEGED_DATA static List_t xBudgetThrottledList;                                /**< 因预算用完而挂起的任务（通过 xStateListItem 链接）。 */
+    PRIVILEGED_DATA static TickType_t xNextBudgetReplenishTime = ( TickType_t ) 0U; /**< xBudgetExhaustedList 中最早的补充时间。 */
+
+#endif
+
+#if ( configUSE_TASK_POOL == 1 )
+
+/* 任务对象池中的一种规格。空闲对象的第一个字指向下一个空闲对象。 */
+    typedef struct TaskPoolClass
+    {
+        void * pvFreeList;       /**< 空闲对象链表。 */
+        UBaseType_t uxObjects;   /**< 已从堆分配的对象数。 */
+        UBaseType_t uxInUse;     /**< 正被任务使用的对象数。 */
+        UBaseType_t uxHighWater; /**< uxInUse 的历史最大值。 */
+    } TaskPoolClass_t;
+
+    PRIVILEGED_DATA static TaskPoolClass_t xTaskPool[ taskPOOL_CLASSES ]; /**< 第 0 项是 TCB，之后是各栈规格。 */
+
+#endif
+
+#if ( configUSE_TASK_NAME_INDEX == 1 )
+
+    PRIVILEGED_DATA static TCB_t * pxTaskNameIndex[ configTASK_NAME_INDEX_BUCKETS ]; /**< 按名称散列的未删除任务，桶内通过 pxNextInNameIndex 链接。 */
+
+#endif
+
+#if ( taskTRACK_ALL_TASKS == 1 )
+
+    PRIVILEGED_DATA static List_t xAllTasksList; /**< 所有未删除的任务，按创建顺序通过 xAllTasksListItem 链接，与 uxTaskNumber 在同一临界区内修改。 */
+
+#endif
+
+#if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+
+    PRIVILEGED_DATA static uint32_t ulStackCanarySeed = 0x2545F491UL; /**< 没有定义 configSTACK_CANARY_RANDOM() 时生成金丝雀值的 xorshift 状态。 */
+    PRIVILEGED_DATA static TCB_t * pxStackGuardTCB = NULL;             /**< 节拍中断下一次检查保护区的任务，为 NULL 时从 xAllTasksList 的第一个任务开始。 */
+
+#endif
+
+#if ( configSTACK_WATERMARK_SCAN_WORDS > 0 )
+
+    PRIVILEGED_DATA static TCB_t * pxStackScanTCB = NULL;           /**< 空闲任务正在扫描的任务，为 NULL 时从 xAllTasksList 的第一个任务开始。 */
+    PRIVILEGED_DATA static StackType_t * pxStackScanPosition = NULL; /**< 下一个要检查的栈字，从栈的最深端向记录的位置推进。 */
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
  * the errno of the currently running task. */
 /* 全局 POSIX 标准 errno。其值会在上下文切换时更新，以匹配当前运行任务的 errno。 */
@@ -478,14 +817,34 @@ PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINI
 /*记录系统从启动到当前的总节拍数（每触发一次 SysTick 中断，此值递增 1）*/
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
 /*记录系统中最高优先级的就绪任务优先级*/
+#if ( configUSE_READY_PRIORITY_BITMAP == 1 )
+    PRIVILEGED_DATA static uint32_t ulReadyPriorityGroupMap = 0U;                              /**< 就绪优先级位图的第一级，每一位对应一组（32 个）优先级。 */
+    PRIVILEGED_DATA static uint32_t ulReadyPriorityMap[ taskREADY_PRIORITY_GROUPS ] = { 0U }; /**< 就绪优先级位图的第二级。 */
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
 /*标记调度器的运行状态。*/
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
 /*记录 xTickCount 的溢出次数。*/
 PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUMBER_OF_CORES ] = { pdFALSE };
 /*记录每个核心上 “是否有任务切换请求（Yield）挂起”*/
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    PRIVILEGED_DATA static volatile UBaseType_t uxObjectCriticalNesting[ configNUMBER_OF_CORES ] = { 0U };
+    /*每个核心上对象临界区的嵌套深度。大于 0 时保持中断屏蔽，任务切换推迟到最外层对象临界区退出时执行。*/
+    #define taskOBJECT_CRITICAL_NESTING()    ( uxObjectCriticalNesting[ portGET_CORE_ID() ] )
+#else
+    #define taskOBJECT_CRITICAL_NESTING()    ( 0U )
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows = ( BaseType_t ) 0;
 /*暂存 “在临界区或调度器挂起期间应递增的节拍数”。*/
+#if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+    PRIVILEGED_DATA static volatile TimeOut_t xTickCountSnapshots[ 2 ] =
+    {
+        { ( BaseType_t ) 0, ( TickType_t ) configINITIAL_TICK_COUNT },
+        { ( BaseType_t ) 0, ( TickType_t ) configINITIAL_TICK_COUNT }
+    };
+    PRIVILEGED_DATA static volatile UBaseType_t uxTickCountSequence = ( UBaseType_t ) 0U;
+    /*节拍计数和溢出次数的双缓冲发布值：写入方写序号加 1 对应的缓冲区再递增序号，读取方按序号读，不需要屏蔽中断。*/
+#endif
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber = ( UBaseType_t ) 0U;
 /*为每个新创建的任务分配唯一序号（任务创建时自动递增）*/
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
@@ -677,6 +1036,65 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 
 #endif
 
+/*
+ * 任务名称索引的内部函数：prvTaskNameHash() 计算名称的散列值，
+ * prvTaskNameIndexInsert()/prvTaskNameIndexRemove() 在临界区内把任务加入或移出索引。
+ */
+#if ( configUSE_TASK_NAME_INDEX == 1 )
+
+    static uint32_t prvTaskNameHash( const char * pcName ) PRIVILEGED_FUNCTION;
+
+    static void prvTaskNameIndexInsert( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvTaskNameIndexRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * 任务对象池的内部函数：
+ * prvTaskPoolStackClass() 返回能容纳 uxStackDepth 的最小栈规格，超过最大规格时返回 taskPOOL_NOT_POOLED；
+ * prvTaskPoolGrow() 从堆分配一块含 uxObjects 个对象的 slab 并放入空闲链表；
+ * prvTaskPoolTake()/prvTaskPoolGive() 在空闲链表中取还一个对象，池空时先扩充一块 slab；
+ * prvTaskPoolFree() 把已删除任务的 TCB 和栈还给各自的池。
+ */
+#if ( configUSE_TASK_POOL == 1 )
+
+    static uint8_t prvTaskPoolStackClass( configSTACK_DEPTH_TYPE uxStackDepth ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvTaskPoolGrow( uint8_t ucClass,
+                                       UBaseType_t uxObjects ) PRIVILEGED_FUNCTION;
+
+    static void * prvTaskPoolTake( uint8_t ucClass ) PRIVILEGED_FUNCTION;
+
+    static void prvTaskPoolGive( uint8_t ucClass,
+                                 void * pvObject ) PRIVILEGED_FUNCTION;
+
+    static void prvTaskPoolFree( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * 把游标指回 xAllTasksList 中的第一个任务，并记录当前的 uxTaskNumber。
+ * 调用时任务链表不能被修改（临界区内或调度器挂起）。
+ */
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+
+    static void prvTaskSnapshotRewind( TaskSnapshot_t * pxSnapshot ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * 供 vTaskListTasks() 和 vTaskGetRunTimeStatistics() 使用：与 uxTaskGetSystemState() 的结果相同，
+ * 但每次挂起调度器只读取 configTASK_SNAPSHOT_CHUNK_LENGTH 个任务。
+ */
+#if ( ( configUSE_TASK_SNAPSHOT == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    static UBaseType_t prvGetSystemStateInChunks( TaskStatus_t * const pxTaskStatusArray,
+                                                  const UBaseType_t uxArraySize,
+                                                  configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Searches pxList for a task with name pcNameToQuery - returning a handle to
  * the task if it is found, or NULL if the task is not found.
@@ -685,7 +1103,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  * 在 pxList 链表中搜索名称为 pcNameToQuery 的任务——如果找到则返回该任务的句柄，
  * 如果未找到则返回 NULL。
  */
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_INDEX == 0 ) )
 
     static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
                                                      const char pcNameToQuery[] ) PRIVILEGED_FUNCTION;
@@ -701,12 +1119,44 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  * 当任务创建时，任务的栈会被填充一个已知值。
  * 此函数通过判断栈中剩余多少原始预设值，来确定任务栈的"高水位线"（即栈的最小剩余空间）。
  */
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) && ( configUSE_STACK_WATERMARK == 0 ) )
 
     static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
 
 #endif
 
+/*
+ * configCHECK_FOR_STACK_OVERFLOW 为 3 时使用：prvStackCanaryValue() 为新任务生成金丝雀值，
+ * prvCheckNextStackGuard() 由 xTaskIncrementTick() 调用，检查下一个任务的保护区中
+ * 除金丝雀以外的字是否仍为填充值。
+ */
+#if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+
+    static StackType_t prvStackCanaryValue( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvCheckNextStackGuard( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * 由 pxStackWatermark 直接算出剩余栈空间（字数），代替 prvTaskCheckFreeStackSpace()。
+ */
+#if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) && ( configUSE_STACK_WATERMARK == 1 ) )
+
+    static configSTACK_DEPTH_TYPE prvTaskGetWatermarkFreeStackSpace( const TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * 由空闲任务调用：在临界区内接着上次的位置检查最多 configSTACK_WATERMARK_SCAN_WORDS 个栈字，
+ * 从栈的最深端找到第一个不是填充值的字时更新该任务的 pxStackWatermark，然后转到下一个任务。
+ */
+#if ( configSTACK_WATERMARK_SCAN_WORDS > 0 )
+
+    static void prvStackWatermarkScanStep( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Return the amount of time, in ticks, that will pass before the kernel will
  * next move a task from the Blocked state to the Running state.
@@ -737,6 +1187,72 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 /*将 xNextTaskUnblockTime 设置为下一个阻塞状态任务退出阻塞状态的时间*/
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * 由 xTaskResumeAll() 调用：补上调度器挂起期间积累的 xTicks 个节拍，返回 pdTRUE 表示需要任务切换。
+ * 两个事件之间的节拍直接累加到 xTickCount 上，只有事件所在的节拍才调用 xTaskIncrementTick()，
+ * 开销与到期的唤醒时间点的个数成正比，而与节拍数无关。
+ */
+static BaseType_t prvAdvancePendedTicks( TickType_t xTicks ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+
+/*
+ * 把当前的 xTickCount 和 xNumOfOverflows 写入空闲的缓冲区，再递增序号使其生效。
+ */
+    static void prvPublishTickCount( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * 不屏蔽中断读取最近一次发布的节拍计数和溢出次数。读取期间有新的值发布时重读；
+ * 打断了发布过程的中断读到的是上一次发布的值，不需要等待。
+ */
+    static void prvReadTickCount( TimeOut_t * const pxTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if defined( taskUSE_GENERIC_BIT_SCAN )
+
+/*
+ * 没有 CLZ/CTZ 内建函数时，求 32 位位图中最高、最低置位位的序号。
+ */
+    #if ( configUSE_READY_PRIORITY_BITMAP == 1 )
+        static UBaseType_t prvHighestSetBit( uint32_t ulBits ) PRIVILEGED_FUNCTION;
+    #endif
+
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        static UBaseType_t prvLowestSetBit( uint32_t ulBits ) PRIVILEGED_FUNCTION;
+    #endif
+
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/*
+ * 把状态链表项的值（唤醒时间）相对当前节拍计数放入节拍轮、段轮或远期延迟链表，
+ * 必要时提前 xNextTaskUnblockTime。
+ */
+    static void prvDelayedWheelInsert( ListItem_t * const pxStateListItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * 由 prvAddCurrentTaskToDelayedList() 调用，把当前任务放入时间轮。
+ */
+    static void prvAddCurrentTaskToDelayedWheel( TickType_t xTimeToWake ) PRIVILEGED_FUNCTION;
+
+/*
+ * 由 xTaskIncrementTick() 调用：把进入范围的远期任务移入时间轮，在段的起点展开段轮，
+ * 返回当前节拍对应的节拍轮槽（槽中的任务都在这一拍到期）。
+ */
+    static List_t * prvDelayedWheelAdvance( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * 从第 xLevel 级的 xFrom 槽开始（循环）查找前 xCount 个槽中第一个非空槽，
+ * 返回它相对 xFrom 的偏移，没有则返回 portMAX_DELAY。
+ */
+    static TickType_t prvDelayedWheelFindSlot( UBaseType_t uxLevel,
+                                               TickType_t xFrom,
+                                               TickType_t xCount ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
 /*
@@ -770,6 +1286,46 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 /*在新任务被创建和初始化后调用，用于将任务置于调度器的控制之下。*/
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/*
+ * 把任务按绝对截止时间插入 configEDF_PRIORITY 的就绪链表：有截止时间的任务按截止时间升序排列
+ * （相同时先到的在前），没有截止时间的任务排在最后。
+ */
+    static void prvAddTaskToEdfReadyList( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+/*
+ * 把任务的基础优先级改为 uxNewPriority，与 vTaskPrioritySet() 的处理相同（继承得到的更高优先级保持不变），
+ * 但不请求任务切换，可以在节拍中断中调用。
+ */
+    static void prvBudgetSetPriority( TCB_t * pxTCB,
+                                      UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * 补充任务的预算，撤销预算用完时的降级或挂起。
+ * 返回 pdTRUE 表示任务恢复就绪后优先级高于当前任务，需要任务切换。
+ */
+    static BaseType_t prvBudgetReplenish( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * 由 xTaskIncrementTick() 调用：补充到期的任务，并把这个节拍计入当前任务的预算。
+ * 返回 pdTRUE 表示需要任务切换。
+ */
+    static BaseType_t prvBudgetTick( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * 由 prvAdvancePendedTicks() 调用：计算 xConstTickCount 之后最多有多少个节拍（不超过 xTicksToSkip）
+ * 不会触发预算的补充或耗尽，并把这些节拍一次计入当前任务的预算。返回可以跳过的节拍数。
+ */
+    static TickType_t prvBudgetSkipTicks( const TickType_t xConstTickCount,
+                                          TickType_t xTicksToSkip ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Create a task with static buffer for both TCB and stack. Returns a handle to
  * the task if it is created successfully. Otherwise, returns NULL.
@@ -1377,7 +1933,6 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
         return pxNewTCB;  // 返回新任务的TCB指针（失败则为NULL）
     }
 /*-----------------------------------------------------------*/
-#endif /* configSUPPORT_STATIC_ALLOCATION == 1 */
 
     TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
                                     const char * const pcName,
@@ -1704,7 +2259,55 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
         /* 如果栈是向上增长的，则先分配TCB再分配栈，避免栈溢出覆盖TCB；
          * 如果栈是向下增长的，则先分配栈再分配TCB，同样避免栈溢出问题 */
-        #if ( portSTACK_GROWTH > 0 )  // 栈向上增长（从低地址到高地址）
+        #if ( configUSE_TASK_POOL == 1 )
+        {
+            /* TCB 和栈来自不同的 slab，不再相邻，不必考虑分配顺序。 */
+            const uint8_t ucStackClass = prvTaskPoolStackClass( uxStackDepth );
+            StackType_t * pxStack;
+
+            if( ucStackClass != taskPOOL_NOT_POOLED )
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxStack = ( StackType_t * ) prvTaskPoolTake( ucStackClass );
+            }
+            else
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) );
+            }
+
+            if( pxStack != NULL )
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxNewTCB = ( TCB_t * ) prvTaskPoolTake( taskPOOL_TCB_CLASS );
+
+                if( pxNewTCB != NULL )
+                {
+                    ( void ) memset( ( void * ) pxNewTCB, 0x00, sizeof( TCB_t ) );
+                    pxNewTCB->pxStack = pxStack;
+                    pxNewTCB->ucStackPoolClass = ucStackClass;
+                }
+                else if( ucStackClass != taskPOOL_NOT_POOLED )
+                {
+                    prvTaskPoolGive( ucStackClass, pxStack );
+                }
+                else
+                {
+                    vPortFreeStack( pxStack );
+                }
+            }
+            else
+            {
+                pxNewTCB = NULL;
+            }
+        }
+        #elif ( portSTACK_GROWTH > 0 )  // 栈向上增长（从低地址到高地址）
         {
             /* 为TCB分配内存。内存来源取决于端口malloc函数的实现以及是否使用静态分配 */
             /* MISRA规则11.5.1相关注释（关于malloc内存分配） */
@@ -1783,7 +2386,6 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
         return pxNewTCB;  // 返回新任务的TCB指针（失败则返回NULL）
     }
 /*-----------------------------------------------------------*/
-#endif /* configSUPPORT_DYNAMIC_ALLOCATION == 1 */
 
     BaseType_t xTaskCreate( TaskFunction_t pxTaskCode,
                             const char * const pcName,
@@ -1944,6 +2546,15 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     #endif /* portSTACK_GROWTH */
 
 
+    #if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+    {
+        /* 保护区已经填充为 tskSTACK_FILL_BYTE，只需写入金丝雀。 */
+        pxNewTCB->xStackCanary = prvStackCanaryValue( pxNewTCB );
+        *taskSTACK_CANARY_LOCATION( pxNewTCB ) = pxNewTCB->xStackCanary;
+    }
+    #endif
+
+
     // ===================== 模块4：任务名称写入TCB =====================
     if( pcName != NULL )  // 任务名称不为空
     {
@@ -1971,6 +2582,13 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         mtCOVERAGE_TEST_MARKER();
     }
 
+    #if ( configUSE_TASK_NAME_INDEX == 1 )
+    {
+        /* 在临界区外计算，加入索引时只需链接。 */
+        pxNewTCB->ulNameHash = prvTaskNameHash( &( pxNewTCB->pcTaskName[ 0 ] ) );
+    }
+    #endif
+
 
     // ===================== 模块5：任务优先级配置 =====================
     // 断言：确保任务优先级不超过系统最大支持优先级（避免数组越界）
@@ -2013,6 +2631,20 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                             ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority );
     listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
 
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        vListInitialiseItem( &( pxNewTCB->xBudgetListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTCB->xBudgetListItem ), pxNewTCB );
+    }
+    #endif
+
+    #if ( taskTRACK_ALL_TASKS == 1 )
+    {
+        vListInitialiseItem( &( pxNewTCB->xAllTasksListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTCB->xAllTasksListItem ), pxNewTCB );
+    }
+    #endif
+
 
     // ===================== 模块7：MPU内存区域配置（仅启用MPU时生效） =====================
     #if ( portUSING_MPU_WRAPPERS == 1 )
@@ -2109,6 +2741,13 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     }
     #endif /* portUSING_MPU_WRAPPERS */
 
+    #if ( configUSE_STACK_WATERMARK == 1 )
+    {
+        /* 初始上下文已经占用了栈顶到 pxTopOfStack 之间的空间。 */
+        pxNewTCB->pxStackWatermark = ( StackType_t * ) pxNewTCB->pxTopOfStack;
+    }
+    #endif
+
 
     // ===================== 模块10：多核系统任务状态初始化 =====================
     #if ( configNUMBER_OF_CORES > 1 )  // 多核处理器环境
@@ -2209,6 +2848,19 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         // 任务编号自增（用于标识任务创建顺序）
         uxTaskNumber++;
 
+        #if ( taskTRACK_ALL_TASKS == 1 )
+        {
+            /* 分段读取任务状态和栈扫描时按创建顺序遍历。 */
+            vListInsertEnd( &xAllTasksList, &( pxNewTCB->xAllTasksListItem ) );
+        }
+        #endif
+
+        #if ( configUSE_TASK_NAME_INDEX == 1 )
+        {
+            prvTaskNameIndexInsert( pxNewTCB );
+        }
+        #endif
+
         // 如果启用了跟踪功能（configUSE_TRACE_FACILITY宏定义为1）
         #if ( configUSE_TRACE_FACILITY == 1 )
         {
@@ -2278,6 +2930,19 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
             uxTaskNumber++;
 
+            #if ( taskTRACK_ALL_TASKS == 1 )
+            {
+                /* 分段读取任务状态和栈扫描时按创建顺序遍历。 */
+                vListInsertEnd( &xAllTasksList, &( pxNewTCB->xAllTasksListItem ) );
+            }
+            #endif
+
+            #if ( configUSE_TASK_NAME_INDEX == 1 )
+            {
+                prvTaskNameIndexInsert( pxNewTCB );
+            }
+            #endif
+
             #if ( configUSE_TRACE_FACILITY == 1 )
             {
                 /* Add a counter into the TCB for tracing only. */
@@ -2308,6 +2973,356 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+    static void prvAddTaskToEdfReadyList( TCB_t * pxTCB )
+    {
+        List_t * const pxReadyList = &( pxReadyTasksLists[ configEDF_PRIORITY ] );
+        ListItem_t * const pxNewListItem = &( pxTCB->xStateListItem );
+        ListItem_t * pxIterator;
+        const TCB_t * pxOtherTCB;
+
+        /* 找到第一个应排在 pxTCB 之后的任务。没有截止时间的任务直接走到链表尾。
+         * 就绪链表中的任务数很少，而且只有 EDF 优先级需要有序插入。 */
+        for( pxIterator = listGET_HEAD_ENTRY( pxReadyList );
+             pxIterator != ( ListItem_t * ) listGET_END_MARKER( pxReadyList );
+             pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            pxOtherTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+            if( ( taskEDF_HAS_DEADLINE( pxTCB ) ) &&
+                ( ( !taskEDF_HAS_DEADLINE( pxOtherTCB ) ) ||
+                  ( taskEDF_DEADLINE_BEFORE( pxTCB->xEdfAbsoluteDeadline, pxOtherTCB->xEdfAbsoluteDeadline ) ) ) )
+            {
+                break;
+            }
+        }
+
+        /* 插入到 pxIterator 之前。 */
+        pxNewListItem->pxNext = pxIterator;
+        pxNewListItem->pxPrevious = pxIterator->pxPrevious;
+        pxIterator->pxPrevious->pxNext = pxNewListItem;
+        pxIterator->pxPrevious = pxNewListItem;
+        pxNewListItem->pxContainer = pxReadyList;
+
+        ( pxReadyList->uxNumberOfItems ) = ( UBaseType_t ) ( pxReadyList->uxNumberOfItems + 1U );
+    }
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+    static void prvBudgetSetPriority( TCB_t * pxTCB,
+                                      UBaseType_t uxNewPriority )
+    {
+        const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+        #if ( configUSE_MUTEXES == 1 )
+        {
+            if( ( pxTCB->uxBasePriority == pxTCB->uxPriority ) || ( uxNewPriority > pxTCB->uxPriority ) )
+            {
+                pxTCB->uxPriority = uxNewPriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->uxBasePriority = uxNewPriority;
+        }
+        #else
+        {
+            pxTCB->uxPriority = uxNewPriority;
+        }
+        #endif
+
+        if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0U ) )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ( pxTCB->uxPriority != uxPriorityUsedOnEntry ) &&
+            ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvAddTaskToReadyList( pxTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvBudgetReplenish( TCB_t * pxTCB )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+        UBaseType_t uxBasePriority;
+
+        if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+        {
+            ( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pxTCB->ucBudgetState == taskBUDGET_DEMOTED )
+        {
+            #if ( configUSE_MUTEXES == 1 )
+                uxBasePriority = pxTCB->uxBasePriority;
+            #else
+                uxBasePriority = pxTCB->uxPriority;
+            #endif
+
+            /* 降级期间优先级被 vTaskPrioritySet() 改过时以新设置的优先级为准。 */
+            if( uxBasePriority == pxTCB->uxBudgetDemotedPriority )
+            {
+                prvBudgetSetPriority( pxTCB, pxTCB->uxBudgetNormalPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( pxTCB->ucBudgetState == taskBUDGET_THROTTLED )
+        {
+            /* 任务被选中运行前就阻塞或挂起了，还没有移入 xBudgetThrottledList 时只需要清除状态。 */
+            if( listIS_CONTAINED_WITHIN( &xBudgetThrottledList, &( pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                prvAddTaskToReadyList( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxTCB->ucBudgetState = taskBUDGET_AVAILABLE;
+        pxTCB->xBudgetRemaining = pxTCB->xBudget;
+
+        traceTASK_BUDGET_REPLENISHED( pxTCB );
+
+        if( ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) &&
+            ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) )
+        {
+            xYieldRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xYieldRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvBudgetTick( const TickType_t xConstTickCount )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* 1. 补充到期的任务。预算用完的任务通常很少，链表不排序，
+         *    只在最早的补充时间到达时遍历一次并重新计算下一个补充时间。 */
+        if( ( listLIST_IS_EMPTY( &xBudgetExhaustedList ) == pdFALSE ) &&
+            ( taskBUDGET_TIME_REACHED( xConstTickCount, xNextBudgetReplenishTime ) ) )
+        {
+            const ListItem_t * const pxEndMarker = listGET_END_MARKER( &xBudgetExhaustedList );
+            ListItem_t * pxIterator = listGET_HEAD_ENTRY( &xBudgetExhaustedList );
+            ListItem_t * pxNextItem;
+            TCB_t * pxExhaustedTCB;
+            TickType_t xNextReplenishTime = xConstTickCount + ( portMAX_DELAY >> 1 );
+
+            while( pxIterator != pxEndMarker )
+            {
+                pxNextItem = listGET_NEXT( pxIterator );
+                pxExhaustedTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+                if( taskBUDGET_TIME_REACHED( xConstTickCount, pxExhaustedTCB->xBudgetReplenishTime ) )
+                {
+                    pxExhaustedTCB->xBudgetReplenishTime += pxExhaustedTCB->xBudgetPeriod;
+
+                    if( taskBUDGET_TIME_REACHED( xConstTickCount, pxExhaustedTCB->xBudgetReplenishTime ) )
+                    {
+                        pxExhaustedTCB->xBudgetReplenishTime = xConstTickCount + pxExhaustedTCB->xBudgetPeriod;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( prvBudgetReplenish( pxExhaustedTCB ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( ( TickType_t ) ( pxExhaustedTCB->xBudgetReplenishTime - xConstTickCount ) < ( TickType_t ) ( xNextReplenishTime - xConstTickCount ) )
+                {
+                    xNextReplenishTime = pxExhaustedTCB->xBudgetReplenishTime;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxIterator = pxNextItem;
+            }
+
+            xNextBudgetReplenishTime = xNextReplenishTime;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* 2. 把这个节拍计入当前任务的预算。预算未用完的任务在运行时才按周期补充。 */
+        if( ( pxTCB->xBudget != ( TickType_t ) 0 ) && ( pxTCB->ucBudgetState == taskBUDGET_AVAILABLE ) )
+        {
+            if( taskBUDGET_TIME_REACHED( xConstTickCount, pxTCB->xBudgetReplenishTime ) )
+            {
+                pxTCB->xBudgetRemaining = pxTCB->xBudget;
+                pxTCB->xBudgetReplenishTime += pxTCB->xBudgetPeriod;
+
+                if( taskBUDGET_TIME_REACHED( xConstTickCount, pxTCB->xBudgetReplenishTime ) )
+                {
+                    pxTCB->xBudgetReplenishTime = xConstTickCount + pxTCB->xBudgetPeriod;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->xBudgetRemaining--;
+
+            if( pxTCB->xBudgetRemaining == ( TickType_t ) 0 )
+            {
+                traceTASK_BUDGET_EXHAUSTED( pxTCB );
+
+                if( ( listLIST_IS_EMPTY( &xBudgetExhaustedList ) != pdFALSE ) ||
+                    ( ( TickType_t ) ( pxTCB->xBudgetReplenishTime - xConstTickCount ) < ( TickType_t ) ( xNextBudgetReplenishTime - xConstTickCount ) ) )
+                {
+                    xNextBudgetReplenishTime = pxTCB->xBudgetReplenishTime;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                listINSERT_END( &xBudgetExhaustedList, &( pxTCB->xBudgetListItem ) );
+
+                if( pxTCB->ucBudgetAction == ( uint8_t ) eBudgetDemote )
+                {
+                    pxTCB->ucBudgetState = taskBUDGET_DEMOTED;
+
+                    #if ( configUSE_MUTEXES == 1 )
+                        pxTCB->uxBudgetNormalPriority = pxTCB->uxBasePriority;
+                    #else
+                        pxTCB->uxBudgetNormalPriority = pxTCB->uxPriority;
+                    #endif
+
+                    prvBudgetSetPriority( pxTCB, pxTCB->uxBudgetDemotedPriority );
+                }
+                else
+                {
+                    /* 任务仍在就绪链表中，由 vTaskSwitchContext() 把它移入 xBudgetThrottledList。 */
+                    pxTCB->ucBudgetState = taskBUDGET_THROTTLED;
+                }
+
+                xSwitchRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvBudgetSkipTicks( const TickType_t xConstTickCount,
+                                          TickType_t xTicksToSkip )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        TickType_t xLimit;
+
+        /* 不能跨过最早的补充时间，补充由 prvBudgetTick() 在那一拍处理。 */
+        if( listLIST_IS_EMPTY( &xBudgetExhaustedList ) == pdFALSE )
+        {
+            xLimit = taskBUDGET_TICKS_BEFORE( xConstTickCount, xNextBudgetReplenishTime );
+
+            if( xLimit < xTicksToSkip )
+            {
+                xTicksToSkip = xLimit;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* 当前任务的预算：不能跨过它的补充时间，也不能跨过预算用完的那一拍。 */
+        if( ( pxTCB->xBudget != ( TickType_t ) 0 ) && ( pxTCB->ucBudgetState == taskBUDGET_AVAILABLE ) )
+        {
+            xLimit = taskBUDGET_TICKS_BEFORE( xConstTickCount, pxTCB->xBudgetReplenishTime );
+
+            if( xLimit < xTicksToSkip )
+            {
+                xTicksToSkip = xLimit;
+            }
+
+            xLimit = ( pxTCB->xBudgetRemaining > ( TickType_t ) 0 ) ? ( TickType_t ) ( pxTCB->xBudgetRemaining - ( TickType_t ) 1 ) : ( TickType_t ) 0;
+
+            if( xLimit < xTicksToSkip )
+            {
+                xTicksToSkip = xLimit;
+            }
+
+            pxTCB->xBudgetRemaining -= xTicksToSkip;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xTicksToSkip;
+    }
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
     static size_t prvSnprintfReturnValueToCharsWritten( int iSnprintfReturnValue,
@@ -2382,11 +3397,66 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            /* 步骤3：递增任务编号（uxTaskNumber）
-             * 作用：让内核感知调试器需要重新生成任务链表，确保调试信息实时性
+            #if ( configUSE_TASK_BUDGETS == 1 )
+            {
+                // 预算已用完的任务还要从等待补充的链表中移除
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            /* 步骤3：递增任务编号（uxTaskNumber）
+             * 作用：让内核感知调试器需要重新生成任务链表，确保调试信息实时性
              * 需在portPRE_TASK_DELETE_HOOK前执行，因Windows移植中该钩子不会返回 */
             uxTaskNumber++;
 
+            #if ( taskTRACK_ALL_TASKS == 1 )
+            {
+                /* 与 uxTaskNumber 同时修改：游标中的任务编号不变时，它指向的任务一定还没有被删除。 */
+                ( void ) uxListRemove( &( pxTCB->xAllTasksListItem ) );
+            }
+            #endif
+
+            #if ( configSTACK_WATERMARK_SCAN_WORDS > 0 )
+            {
+                if( pxStackScanTCB == pxTCB )
+                {
+                    /* 正在扫描的任务被删除，下次从第一个任务重新开始。 */
+                    pxStackScanTCB = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+            {
+                if( pxStackGuardTCB == pxTCB )
+                {
+                    pxStackGuardTCB = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_TASK_NAME_INDEX == 1 )
+            {
+                /* 等待空闲任务回收的任务不再能按名称找到。 */
+                prvTaskNameIndexRemove( pxTCB );
+            }
+            #endif
+
             /* 步骤4：读取任务运行状态（使用临时变量确保符合MISRA C 2012 Rule 13.5）
              * MISRA要求：volatile变量的读取需有明确序列点，避免编译器优化导致的读取异常 */
             xTaskIsRunningOrYielding = taskTASK_IS_RUNNING_OR_SCHEDULED_TO_YIELD( pxTCB );
@@ -2544,6 +3614,44 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             /* 更新“上一次唤醒时间”为本次目标唤醒时间（供下次调用使用） */
             *pxPreviousWakeTime = xTimeToWake;
 
+            #if ( configUSE_EDF_SCHEDULING == 1 )
+            {
+                /* EDF 任务：本周期的工作已完成，下一个周期在 xTimeToWake 释放。 */
+                if( taskEDF_HAS_DEADLINE( pxCurrentTCB ) )
+                {
+                    /* 截止时间按声明的周期计算，任务必须按同一个周期释放，否则截止时间与实际的周期脱节。 */
+                    configASSERT( xTimeIncrement == pxCurrentTCB->xEdfPeriod );
+
+                    if( taskEDF_DEADLINE_BEFORE( pxCurrentTCB->xEdfAbsoluteDeadline, xConstTickCount ) )
+                    {
+                        traceTASK_DEADLINE_MISSED( pxCurrentTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxCurrentTCB->xEdfAbsoluteDeadline = xTimeToWake + pxCurrentTCB->xEdfRelativeDeadline;
+
+                    /* 下一个周期已经释放（不需要阻塞）时，当前任务还在就绪链表中，
+                     * 按新的截止时间重新排序，后面的 taskYIELD_WITHIN_API() 会重新选择任务。 */
+                    if( ( xShouldDelay == pdFALSE ) && ( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) )
+                    {
+                        listREMOVE_ITEM( &( pxCurrentTCB->xStateListItem ) );
+                        prvAddTaskToEdfReadyList( pxCurrentTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_EDF_SCHEDULING */
+
             // 若需要阻塞，将当前任务加入延迟链表
             if( xShouldDelay != pdFALSE )
             {
@@ -2675,7 +3783,8 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                  * item is currently placed on. */
                 eReturn = eReady;
             }
-            else if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            else if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) ||
+                     ( taskLIST_IS_DELAYED_WHEEL_SLOT( pxStateList ) ) )
             {
                 /* The task being queried is referenced from one of the Blocked
                  * lists. */
@@ -2726,6 +3835,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 }
             #endif /* if ( INCLUDE_vTaskSuspend == 1 ) */
 
+            #if ( configUSE_TASK_BUDGETS == 1 )
+                else if( pxStateList == &xBudgetThrottledList )
+                {
+                    /* 任务因预算用完被挂起，补充预算后自动恢复。 */
+                    eReturn = eSuspended;
+                }
+            #endif
+
             #if ( INCLUDE_vTaskDelete == 1 )
                 // 检查任务是否在等待终止链表中或不在任何链表中
                 else if( ( pxStateList == &xTasksWaitingTermination ) || ( pxStateList == NULL ) )
@@ -3615,7 +4732,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     {
                         /* Ready lists can be accessed so move the task from the
                          * suspended list to the ready list directly. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )
                         {
                             xYieldRequired = pdTRUE;
 
@@ -3896,6 +5013,7 @@ void vTaskStartScheduler( void )
         xNextTaskUnblockTime = portMAX_DELAY;  // 初始化“下一个任务解阻塞时间”为最大值（表示暂无任务延迟）
         xSchedulerRunning = pdTRUE;            // 标记“调度器已启动”
         xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;  // 初始化Tick计数器（默认0，即系统启动时刻）
+        taskPUBLISH_TICK_COUNT();
 
         /* 若启用“任务运行时统计”（configGENERATE_RUN_TIME_STATS == 1）：
          * 此宏用于配置硬件定时器/计数器，作为运行时统计的时间基准
@@ -4188,7 +5306,7 @@ BaseType_t xTaskResumeAll( void )
                         #if ( configNUMBER_OF_CORES == 1 )
                         {
                             /* 若恢复的任务优先级 > 当前运行任务的优先级，需标记“待切换” */
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )
                             {
                                 xYieldPendings[ xCoreID ] = pdTRUE;  // 标记当前核心需要任务切换
                             }
@@ -4220,28 +5338,24 @@ BaseType_t xTaskResumeAll( void )
                     {
                         TickType_t xPendedCounts = xPendedTicks; /* 复制积累的Tick数（避免volatile变量多次读取） */
 
-                        // 若存在积累的Tick，逐个处理
+                        // 若存在积累的Tick，批量处理
                         if( xPendedCounts > ( TickType_t ) 0U )
                         {
-                            do
+                            /* 由prvAdvancePendedTicks()一次补上所有积累的Tick：
+                             * - 没有任务到期的Tick直接累加到系统Tick计数上；
+                             * - 到期任务、计数回绕所在的Tick仍由xTaskIncrementTick()处理；
+                             * - 返回pdTRUE表示需要触发任务切换（如高优先级任务被唤醒）。
+                             * 处理期间xPendedTicks保持非0，与逐个处理时一样不会调用Tick钩子函数。 */
+                            if( prvAdvancePendedTicks( xPendedCounts ) != pdFALSE )
                             {
-                                /* 调用xTaskIncrementTick()处理单个Tick：
-                                 * - 更新系统Tick计数；
-                                 * - 检查延迟任务是否超时，超时则唤醒；
-                                 * - 返回pdTRUE表示需要触发任务切换（如高优先级任务被唤醒）。 */
-                                if( xTaskIncrementTick() != pdFALSE )
-                                {
-                                    /* 注释说明：多核场景下，xTaskIncrementTick()会中断其他核心；
-                                     * 标记当前核心需要任务切换。 */
-                                    xYieldPendings[ xCoreID ] = pdTRUE;
-                                }
-                                else
-                                {
-                                    mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（无需切换时执行）
-                                }
-
-                                xPendedCounts--;  // 处理完一个Tick，计数减1
-                            } while( xPendedCounts > ( TickType_t ) 0U );
+                                /* 注释说明：多核场景下，xTaskIncrementTick()会中断其他核心；
+                                 * 标记当前核心需要任务切换。 */
+                                xYieldPendings[ xCoreID ] = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（无需切换时执行）
+                            }
 
                             xPendedTicks = 0;  // 重置积累的Tick数
                         }
@@ -4288,19 +5402,141 @@ BaseType_t xTaskResumeAll( void )
 }
 /*-----------------------------------------------------------*/
 
+static BaseType_t prvAdvancePendedTicks( TickType_t xTicks )
+{
+    BaseType_t xSwitchRequired = pdFALSE;
+    TickType_t xTicksToSkip;
+    TickType_t xLimit;
+
+    /* 调用者已挂起过调度器并处于临界区中，xTickCount 不会被节拍中断修改。 */
+    configASSERT( uxSchedulerSuspended == ( UBaseType_t ) 0U );
+
+    while( xTicks > ( TickType_t ) 0U )
+    {
+        /* 最后一个节拍总是交给 xTaskIncrementTick()，时间片轮转等每拍的检查仍会进行一次。 */
+        xTicksToSkip = xTicks - ( TickType_t ) 1U;
+
+        /* 不能跨过 xNextTaskUnblockTime：到期的任务要在唤醒时间那一拍被处理。
+         * 使用时间轮时 xNextTaskUnblockTime 也不会晚于时间轮下一次需要处理的节拍，
+         * 与 vTaskStepTick() 的前提相同。 */
+        xLimit = ( xNextTaskUnblockTime > xTickCount ) ? ( TickType_t ) ( xNextTaskUnblockTime - xTickCount - ( TickType_t ) 1U ) : ( TickType_t ) 0U;
+
+        if( xLimit < xTicksToSkip )
+        {
+            xTicksToSkip = xLimit;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* 也不能跨过回绕：回绕的那一拍要切换延迟链表。 */
+        xLimit = ( TickType_t ) ( portMAX_DELAY - xTickCount );
+
+        if( xLimit < xTicksToSkip )
+        {
+            xTicksToSkip = xLimit;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configUSE_TASK_BUDGETS == 1 )
+        {
+            /* 预算的补充和耗尽也要在对应的节拍处理，跳过的节拍计入当前任务的预算。 */
+            xTicksToSkip = prvBudgetSkipTicks( xTickCount, xTicksToSkip );
+        }
+        #endif
+
+        if( xTicksToSkip > ( TickType_t ) 0U )
+        {
+            xTickCount += xTicksToSkip;
+            taskPUBLISH_TICK_COUNT();
+            xTicks -= xTicksToSkip;
+            traceINCREASE_TICK_COUNT( xTicksToSkip );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* 处理事件所在的节拍（或最后一个节拍）。 */
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            xSwitchRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xTicks--;
+    }
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+
+    static void prvPublishTickCount( void )
+    {
+        const UBaseType_t uxNextSequence = uxTickCountSequence + ( UBaseType_t ) 1U;
+        volatile TimeOut_t * const pxSnapshot = &( xTickCountSnapshots[ uxNextSequence & ( UBaseType_t ) 1U ] );
+
+        /* 写入的是读取方当前不会使用的缓冲区，写完之后才递增序号。 */
+        pxSnapshot->xOverflowCount = xNumOfOverflows;
+        pxSnapshot->xTimeOnEntering = xTickCount;
+        taskTICK_COUNT_BARRIER();
+        uxTickCountSequence = uxNextSequence;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvReadTickCount( TimeOut_t * const pxTickCount )
+    {
+        UBaseType_t uxSequence;
+
+        do
+        {
+            uxSequence = uxTickCountSequence;
+            taskTICK_COUNT_BARRIER();
+
+            pxTickCount->xOverflowCount = xTickCountSnapshots[ uxSequence & ( UBaseType_t ) 1U ].xOverflowCount;
+            pxTickCount->xTimeOnEntering = xTickCountSnapshots[ uxSequence & ( UBaseType_t ) 1U ].xTimeOnEntering;
+
+            /* 序号没有变化说明读取期间没有新的值发布，缓冲区没有被改写。 */
+            taskTICK_COUNT_BARRIER();
+        } while( uxSequence != uxTickCountSequence );
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TICK_COUNT_SEQLOCK */
+
 TickType_t xTaskGetTickCount( void )
 {
     TickType_t xTicks;
 
     traceENTER_xTaskGetTickCount();
 
-    /* Critical section required if running on a 16 bit processor. */
-    /* 如果运行在16位处理器上，需要临界区保护 */
-    portTICK_TYPE_ENTER_CRITICAL();
+    #if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+    {
+        TimeOut_t xTickCountNow;
+
+        prvReadTickCount( &xTickCountNow );
+        xTicks = xTickCountNow.xTimeOnEntering;
+    }
+    #else
     {
-        xTicks = xTickCount;
+        /* Critical section required if running on a 16 bit processor. */
+        /* 如果运行在16位处理器上，需要临界区保护 */
+        portTICK_TYPE_ENTER_CRITICAL();
+        {
+            xTicks = xTickCount;
+        }
+        portTICK_TYPE_EXIT_CRITICAL();
     }
-    portTICK_TYPE_EXIT_CRITICAL();
+    #endif /* configUSE_TICK_COUNT_SEQLOCK */
 
     traceRETURN_xTaskGetTickCount( xTicks );
 
@@ -4311,7 +5547,10 @@ TickType_t xTaskGetTickCount( void )
 TickType_t xTaskGetTickCountFromISR( void )
 {
     TickType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
+
+    #if ( configUSE_TICK_COUNT_SEQLOCK == 0 )
+        UBaseType_t uxSavedInterruptStatus;
+    #endif
 
     traceENTER_xTaskGetTickCountFromISR();
 
@@ -4331,11 +5570,22 @@ TickType_t xTaskGetTickCountFromISR( void )
      * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
     portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-    uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+    #if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+    {
+        TimeOut_t xTickCountNow;
+
+        prvReadTickCount( &xTickCountNow );
+        xReturn = xTickCountNow.xTimeOnEntering;
+    }
+    #else
     {
-        xReturn = xTickCount;
+        uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xReturn = xTickCount;
+        }
+        portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
     }
-    portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    #endif /* configUSE_TICK_COUNT_SEQLOCK */
 
     traceRETURN_xTaskGetTickCountFromISR( xReturn );
 
@@ -4373,7 +5623,58 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
 }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( configUSE_TASK_NAME_INDEX == 1 )
+
+    static uint32_t prvTaskNameHash( const char * pcName )
+    {
+        /* FNV-1a，最多处理 configMAX_TASK_NAME_LEN 个字符，与名称被截断的长度一致。 */
+        uint32_t ulHash = 2166136261UL;
+        UBaseType_t x;
+
+        for( x = ( UBaseType_t ) 0; ( x < ( UBaseType_t ) configMAX_TASK_NAME_LEN ) && ( pcName[ x ] != ( char ) 0x00 ); x++ )
+        {
+            ulHash ^= ( uint32_t ) ( uint8_t ) pcName[ x ];
+            ulHash *= 16777619UL;
+        }
+
+        return ulHash;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTaskNameIndexInsert( TCB_t * pxTCB )
+    {
+        TCB_t ** const ppxBucket = &( pxTaskNameIndex[ pxTCB->ulNameHash & ( configTASK_NAME_INDEX_BUCKETS - 1U ) ] );
+
+        /* 调用者已进入临界区。 */
+        pxTCB->pxNextInNameIndex = *ppxBucket;
+        *ppxBucket = pxTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTaskNameIndexRemove( TCB_t * pxTCB )
+    {
+        TCB_t ** ppxLink = &( pxTaskNameIndex[ pxTCB->ulNameHash & ( configTASK_NAME_INDEX_BUCKETS - 1U ) ] );
+
+        /* 调用者已进入临界区。 */
+        while( ( *ppxLink != NULL ) && ( *ppxLink != pxTCB ) )
+        {
+            ppxLink = &( ( *ppxLink )->pxNextInNameIndex );
+        }
+
+        if( *ppxLink != NULL )
+        {
+            *ppxLink = pxTCB->pxNextInNameIndex;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_TASK_NAME_INDEX */
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_INDEX == 0 ) )
     static TCB_t * prvSearchForNameWithinSingleList( List_t * pxList,
                                                      const char pcNameToQuery[] )
     {
@@ -4442,14 +5743,13 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
         return pxReturn;
     }
 
-#endif /* INCLUDE_xTaskGetHandle */
+#endif /* ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_INDEX == 0 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_xTaskGetHandle == 1 )
 
     TaskHandle_t xTaskGetHandle( const char * pcNameToQuery )
     {
-        UBaseType_t uxQueue = configMAX_PRIORITIES; // 初始化优先级队列索引为最大优先级
         TCB_t * pxTCB;
 
         traceENTER_xTaskGetHandle( pcNameToQuery );
@@ -4457,59 +5757,99 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
         /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
         configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
 
-        vTaskSuspendAll();
+        #if ( configUSE_TASK_NAME_INDEX == 1 )
         {
-            /* Search the ready lists. */
-            do
-            {
-                uxQueue--; // 从最高优先级开始，依次降低优先级
-                // 在当前优先级的就绪链表中搜索指定名称的任务
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+            const uint32_t ulHash = prvTaskNameHash( pcNameToQuery );
 
-                if( pxTCB != NULL )
+            /* 只查找一个桶，临界区的长度取决于桶内的任务数，不需要挂起调度器。 */
+            taskENTER_CRITICAL();
+            {
+                for( pxTCB = pxTaskNameIndex[ ulHash & ( configTASK_NAME_INDEX_BUCKETS - 1U ) ]; pxTCB != NULL; pxTCB = pxTCB->pxNextInNameIndex )
                 {
-                    /* Found the handle. */
-                    break;
+                    if( ( pxTCB->ulNameHash == ulHash ) &&
+                        ( strncmp( pxTCB->pcTaskName, pcNameToQuery, ( size_t ) configMAX_TASK_NAME_LEN ) == 0 ) )
+                    {
+                        break;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
-            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY );  // 直到搜索到空闲优先级
-
-            /* Search the delayed lists. */
-            // 如果在就绪链表中未找到
-            if( pxTCB == NULL )
-            {
-                /* 搜索延迟链表 */
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
             }
+            taskEXIT_CRITICAL();
+        }
+        #else /* configUSE_TASK_NAME_INDEX */
+        {
+            UBaseType_t uxQueue = configMAX_PRIORITIES; // 初始化优先级队列索引为最大优先级
 
-            if( pxTCB == NULL )
+            vTaskSuspendAll();
             {
-                // 在溢出延迟任务链表中搜索
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
-            }
+                /* Search the ready lists. */
+                do
+                {
+                    uxQueue--; // 从最高优先级开始，依次降低优先级
+                    // 在当前优先级的就绪链表中搜索指定名称的任务
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
 
-            #if ( INCLUDE_vTaskSuspend == 1 )
-            {
+                    if( pxTCB != NULL )
+                    {
+                        /* Found the handle. */
+                        break;
+                    }
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY );  // 直到搜索到空闲优先级
+
+                /* Search the delayed lists. */
+                // 如果在就绪链表中未找到
                 if( pxTCB == NULL )
                 {
-                    /* Search the suspended list. */
-                    /* 搜索挂起链表 */
-                    pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                    /* 搜索延迟链表 */
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
                 }
-            }
-            #endif
 
-            #if ( INCLUDE_vTaskDelete == 1 )
-            {
                 if( pxTCB == NULL )
                 {
-                    /* Search the deleted list. */
-                    /* 搜索已删除任务链表 */
-                    pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                    // 在溢出延迟任务链表中搜索
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                }
+
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    UBaseType_t uxSlot;
+
+                    /* 搜索时间轮的各个槽 */
+                    for( uxSlot = 0; ( uxSlot < ( UBaseType_t ) ( 2U * taskWHEEL_SLOTS ) ) && ( pxTCB == NULL ); uxSlot++ )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheel[ uxSlot / taskWHEEL_SLOTS ][ uxSlot % taskWHEEL_SLOTS ] ), pcNameToQuery );
+                    }
+                }
+                #endif /* configUSE_DELAYED_TASK_WHEEL */
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the suspended list. */
+                        /* 搜索挂起链表 */
+                        pxTCB = prvSearchForNameWithinSingleList( &xSuspendedTaskList, pcNameToQuery );
+                    }
+                }
+                #endif
+
+                #if ( INCLUDE_vTaskDelete == 1 )
+                {
+                    if( pxTCB == NULL )
+                    {
+                        /* Search the deleted list. */
+                        /* 搜索已删除任务链表 */
+                        pxTCB = prvSearchForNameWithinSingleList( &xTasksWaitingTermination, pcNameToQuery );
+                    }
                 }
+                #endif
             }
-            #endif
+            ( void ) xTaskResumeAll();
         }
-        ( void ) xTaskResumeAll();
+        #endif /* configUSE_TASK_NAME_INDEX */
 
         traceRETURN_xTaskGetHandle( pxTCB );
 
@@ -4614,6 +5954,17 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked ) );
                 uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked ) );
 
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    UBaseType_t uxSlot;
+
+                    for( uxSlot = 0; uxSlot < ( UBaseType_t ) ( 2U * taskWHEEL_SLOTS ); uxSlot++ )
+                    {
+                        uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxSlot / taskWHEEL_SLOTS ][ uxSlot % taskWHEEL_SLOTS ] ), eBlocked ) );
+                    }
+                }
+                #endif /* configUSE_DELAYED_TASK_WHEEL */
+
                 #if ( INCLUDE_vTaskDelete == 1 )
                 {
                     /* Fill in an TaskStatus_t structure with information on
@@ -4630,6 +5981,13 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 }
                 #endif
 
+                #if ( configUSE_TASK_BUDGETS == 1 )
+                {
+                    /* 因预算用完而挂起的任务。 */
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xBudgetThrottledList, eSuspended ) );
+                }
+                #endif
+
                 #if ( configGENERATE_RUN_TIME_STATS == 1 )
                 {
                     if( pulTotalRunTime != NULL )
@@ -4665,2015 +6023,3472 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
 #endif /* configUSE_TRACE_FACILITY */
 /*----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+#if ( configUSE_TASK_SNAPSHOT == 1 )
 
-    #if ( configNUMBER_OF_CORES == 1 )
-        TaskHandle_t xTaskGetIdleTaskHandle( void )
-        {
-            traceENTER_xTaskGetIdleTaskHandle();
+    static void prvTaskSnapshotRewind( TaskSnapshot_t * pxSnapshot )
+    {
+        pxSnapshot->uxTaskNumber = uxTaskNumber;
 
-            /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-             * started, then xIdleTaskHandles will be NULL. */
-            configASSERT( ( xIdleTaskHandles[ 0 ] != NULL ) );
+        /* 创建第一个任务之前 xAllTasksList 还没有初始化，但静态变量清零后长度同样为 0。 */
+        if( listLIST_IS_EMPTY( &xAllTasksList ) == pdFALSE )
+        {
+            pxSnapshot->pvNextTask = listGET_OWNER_OF_HEAD_ENTRY( &xAllTasksList );
+        }
+        else
+        {
+            pxSnapshot->pvNextTask = NULL;
+        }
+    }
+/*----------------------------------------------------------*/
 
-            traceRETURN_xTaskGetIdleTaskHandle( xIdleTaskHandles[ 0 ] );
+    void vTaskSnapshotBegin( TaskSnapshot_t * pxSnapshot )
+    {
+        traceENTER_vTaskSnapshotBegin( pxSnapshot );
 
-            return xIdleTaskHandles[ 0 ];
+        configASSERT( pxSnapshot );
+
+        taskENTER_CRITICAL();
+        {
+            prvTaskSnapshotRewind( pxSnapshot );
         }
-    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+        taskEXIT_CRITICAL();
 
-    TaskHandle_t xTaskGetIdleTaskHandleForCore( BaseType_t xCoreID )
+        pxSnapshot->ulTotalRunTime = 0;
+
+        traceRETURN_vTaskSnapshotBegin();
+    }
+/*----------------------------------------------------------*/
+
+    eTaskSnapshotStatus eTaskSnapshotRead( TaskSnapshot_t * pxSnapshot,
+                                           TaskStatus_t * const pxTaskStatusArray,
+                                           const UBaseType_t uxArraySize,
+                                           UBaseType_t * const puxCount )
     {
-        traceENTER_xTaskGetIdleTaskHandleForCore( xCoreID );
+        TCB_t * pxTCB;
+        UBaseType_t uxTask = 0;
+        eTaskSnapshotStatus eReturn;
 
-        /* Ensure the core ID is valid. */
-        configASSERT( taskVALID_CORE_ID( xCoreID ) == pdTRUE );
+        traceENTER_eTaskSnapshotRead( pxSnapshot, pxTaskStatusArray, uxArraySize, puxCount );
 
-        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-         * started, then xIdleTaskHandles will be NULL. */
-        configASSERT( ( xIdleTaskHandles[ xCoreID ] != NULL ) );
+        configASSERT( pxSnapshot );
+        configASSERT( puxCount );
 
-        traceRETURN_xTaskGetIdleTaskHandleForCore( xIdleTaskHandles[ xCoreID ] );
+        vTaskSuspendAll();
+        {
+            if( pxSnapshot->uxTaskNumber != uxTaskNumber )
+            {
+                /* 游标指向的任务可能已被删除：从头开始。 */
+                prvTaskSnapshotRewind( pxSnapshot );
+                eReturn = eTaskSnapshotChanged;
+            }
+            else
+            {
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxTCB = pxSnapshot->pvNextTask;
 
-        return xIdleTaskHandles[ xCoreID ];
+                while( ( pxTCB != NULL ) && ( uxTask < uxArraySize ) )
+                {
+                    vTaskGetInfo( ( TaskHandle_t ) pxTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eInvalid );
+                    uxTask++;
+
+                    if( listGET_NEXT( &( pxTCB->xAllTasksListItem ) ) != listGET_END_MARKER( &xAllTasksList ) )
+                    {
+                        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                        /* coverity[misra_c_2012_rule_11_5_violation] */
+                        pxTCB = listGET_LIST_ITEM_OWNER( listGET_NEXT( &( pxTCB->xAllTasksListItem ) ) );
+                    }
+                    else
+                    {
+                        pxTCB = NULL;
+                    }
+                }
+
+                pxSnapshot->pvNextTask = pxTCB;
+                eReturn = ( pxTCB == NULL ) ? eTaskSnapshotComplete : eTaskSnapshotMore;
+            }
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ( pxSnapshot->ulTotalRunTime ) );
+                #else
+                    pxSnapshot->ulTotalRunTime = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+            }
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        *puxCount = uxTask;
+
+        traceRETURN_eTaskSnapshotRead( eReturn );
+
+        return eReturn;
     }
 
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+#endif /* configUSE_TASK_SNAPSHOT */
 /*----------------------------------------------------------*/
 
-/* 条件编译应使用不等于0，而非等于1。
- * 这是为了确保当用户定义的低功耗模式实现要求configUSE_TICKLESS_IDLE
- * 设置为1以外的值时，vTaskStepTick()仍然可用。 */
-#if ( configUSE_TICKLESS_IDLE != 0 ) // 如果启用了无滴答低功耗模式（无论具体值是多少）
+#if ( ( configUSE_TASK_SNAPSHOT == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
-    // 用于在低功耗模式后调整系统滴答计数
-    void vTaskStepTick( TickType_t xTicksToJump )
+    static UBaseType_t prvGetSystemStateInChunks( TaskStatus_t * const pxTaskStatusArray,
+                                                  const UBaseType_t uxArraySize,
+                                                  configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
     {
-        TickType_t xUpdatedTickCount; // 声明变量用于存储更新后的滴答计数
-
-        traceENTER_vTaskStepTick( xTicksToJump );
+        TaskSnapshot_t xSnapshot;
+        UBaseType_t uxTask = 0, uxCount, uxChunk;
+        eTaskSnapshotStatus eStatus = eTaskSnapshotMore;
 
-        /* 在滴答被抑制的时间段后修正滴答计数值。
-         * 注意：这不会为每个步进的滴答调用滴答钩子函数。 */
-        xUpdatedTickCount = xTickCount + xTicksToJump;
-        configASSERT( xUpdatedTickCount <= xNextTaskUnblockTime );
+        vTaskSnapshotBegin( &xSnapshot );
 
-        // 如果更新后的滴答计数等于下一个任务解除阻塞的时间
-        if( xUpdatedTickCount == xNextTaskUnblockTime )
+        /* 数组放满时停止，与 uxTaskGetSystemState() 一样调用者按读到的数量输出。 */
+        while( ( eStatus != eTaskSnapshotComplete ) && ( uxTask < uxArraySize ) )
         {
-            /* 安排xTickCount在调度器恢复时，在xTaskIncrementTick()中达到xNextTaskUnblockTime。
-             * 这确保所有延迟任务在正确的时间恢复。 */
-            configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
-            configASSERT( xTicksToJump != ( TickType_t ) 0 );
+            uxChunk = uxArraySize - uxTask;
 
-            /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
-            taskENTER_CRITICAL();
+            if( uxChunk > ( UBaseType_t ) configTASK_SNAPSHOT_CHUNK_LENGTH )
             {
-                xPendedTicks++;
+                uxChunk = ( UBaseType_t ) configTASK_SNAPSHOT_CHUNK_LENGTH;
+            }
+
+            eStatus = eTaskSnapshotRead( &xSnapshot, &( pxTaskStatusArray[ uxTask ] ), uxChunk, &uxCount );
+
+            if( eStatus == eTaskSnapshotChanged )
+            {
+                uxTask = 0;
+            }
+            else
+            {
+                uxTask += uxCount;
             }
-            taskEXIT_CRITICAL();
-            xTicksToJump--;
         }
-        else
+
+        if( pulTotalRunTime != NULL )
         {
-            mtCOVERAGE_TEST_MARKER();
+            *pulTotalRunTime = xSnapshot.ulTotalRunTime;
         }
 
-        xTickCount += xTicksToJump;
-
-        traceINCREASE_TICK_COUNT( xTicksToJump );
-        traceRETURN_vTaskStepTick();
+        return uxTask;
     }
 
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* ( ( configUSE_TASK_SNAPSHOT == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
 /*----------------------------------------------------------*/
 
-// 用于快速追赶指定数量的系统滴答，返回是否发生了任务切换
-BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
-{
-    BaseType_t xYieldOccurred;
+#if ( configUSE_TASK_POOL == 1 )
 
-    traceENTER_xTaskCatchUpTicks( xTicksToCatchUp );
+    static size_t prvTaskPoolObjectSize( uint8_t ucClass )
+    {
+        size_t xSize;
 
-    configASSERT( uxSchedulerSuspended == ( UBaseType_t ) 0U );
+        if( ucClass == taskPOOL_TCB_CLASS )
+        {
+            xSize = sizeof( TCB_t );
+        }
+        else
+        {
+            xSize = taskPOOL_STACK_DEPTH( ucClass ) * sizeof( StackType_t );
+        }
 
-    /* 使用xPendedTicks来模拟在调度器挂起时发生了xTicksToCatchUp个滴答，
-     * 这样这些滴答将在xTaskResumeAll()中被处理 */
-    vTaskSuspendAll();
+        return taskPOOL_ALIGN( xSize );
+    }
+/*----------------------------------------------------------*/
 
-    /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
-    taskENTER_CRITICAL();
+    static uint8_t prvTaskPoolStackClass( configSTACK_DEPTH_TYPE uxStackDepth )
     {
-        xPendedTicks += xTicksToCatchUp;  // 将需要追赶的滴答数添加到挂起滴答计数中
-    }
-    taskEXIT_CRITICAL();
-    xYieldOccurred = xTaskResumeAll(); // 恢复任务调度，并获取是否发生了任务切换的结果
+        uint8_t ucClass;
 
-    traceRETURN_xTaskCatchUpTicks( xYieldOccurred );
+        for( ucClass = 1U; ucClass < ( uint8_t ) taskPOOL_CLASSES; ucClass++ )
+        {
+            if( ( size_t ) uxStackDepth <= taskPOOL_STACK_DEPTH( ucClass ) )
+            {
+                break;
+            }
+        }
 
-    return xYieldOccurred;
-}
-/*----------------------------------------------------------*/
+        if( ucClass == ( uint8_t ) taskPOOL_CLASSES )
+        {
+            /* 比最大规格还深的栈不进池，直接从堆分配。 */
+            ucClass = taskPOOL_NOT_POOLED;
+        }
 
-#if ( INCLUDE_xTaskAbortDelay == 1 ) // 仅当启用"任务延迟中止"功能时编译该函数
+        return ucClass;
+    }
+/*----------------------------------------------------------*/
 
-    // 中止指定任务的延迟状态（将阻塞中的任务强制唤醒），返回操作结果
-    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+    static BaseType_t prvTaskPoolGrow( uint8_t ucClass,
+                                       UBaseType_t uxObjects )
     {
-        TCB_t * pxTCB = xTask;
-        BaseType_t xReturn;
+        const size_t xObjectSize = prvTaskPoolObjectSize( ucClass );
+        uint8_t * pucSlab = NULL;
+        UBaseType_t uxObject;
+        BaseType_t xReturn = pdFAIL;
 
-        traceENTER_xTaskAbortDelay( xTask );
-
-        configASSERT( pxTCB );
+        if( ( uxObjects > 0U ) && ( ( size_t ) uxObjects <= ( ( ( size_t ) ~( ( size_t ) 0U ) ) / xObjectSize ) ) )
+        {
+            /* 在临界区外分配，堆的耗时不计入关中断时间。slab 从不归还给堆。 */
+            if( ucClass == taskPOOL_TCB_CLASS )
+            {
+                pucSlab = ( uint8_t * ) pvPortMalloc( xObjectSize * ( size_t ) uxObjects );
+            }
+            else
+            {
+                pucSlab = ( uint8_t * ) pvPortMallocStack( xObjectSize * ( size_t ) uxObjects );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        vTaskSuspendAll();
+        if( pucSlab != NULL )
         {
-            /* 只有当任务确实处于"阻塞状态（Blocked）"时，才能强制将其从阻塞状态移除 */
-            if( eTaskGetState( xTask ) == eBlocked )
+            taskENTER_CRITICAL();
             {
-                xReturn = pdPASS;
+                /* 空闲对象的第一个字保存下一个空闲对象的地址。 */
+                for( uxObject = 0; uxObject < uxObjects; uxObject++ )
+                {
+                    *( ( void ** ) pucSlab ) = xTaskPool[ ucClass ].pvFreeList;
+                    xTaskPool[ ucClass ].pvFreeList = ( void * ) pucSlab;
+                    pucSlab += xObjectSize;
+                }
 
-                /* 从阻塞链表中移除该任务的状态链表项。
-                 * 由于调度器已挂起，中断不会修改xStateListItem（状态链表项仅调度器操作） */
-                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                xTaskPool[ ucClass ].uxObjects += uxObjects;
+            }
+            taskEXIT_CRITICAL();
 
-                 /* 任务是否同时在等待某个事件？（如信号量、事件组等）
-                 * 如果是，还需将其从事件链表中移除。
-                 * 注意：即使调度器挂起，中断仍可能操作事件链表项，因此需要临界区保护 */
-                taskENTER_CRITICAL();
+            xReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*----------------------------------------------------------*/
+
+    static void * prvTaskPoolTake( uint8_t ucClass )
+    {
+        TaskPoolClass_t * const pxClass = &( xTaskPool[ ucClass ] );
+        void * pvObject = NULL;
+        BaseType_t xAttempt;
+
+        /* 第一次取不到时扩充一块 slab 再取一次。扩充是在临界区外完成的，
+         * 期间其他任务可能把新对象取走，此时按分配失败处理。 */
+        for( xAttempt = 0; ( xAttempt < 2 ) && ( pvObject == NULL ); xAttempt++ )
+        {
+            taskENTER_CRITICAL();
+            {
+                pvObject = pxClass->pvFreeList;
+
+                if( pvObject != NULL )
                 {
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                    {
-                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+                    pxClass->pvFreeList = *( ( void ** ) pvObject );
+                    pxClass->uxInUse++;
 
-                        /* 设置延迟中止标记：告知任务"已被强制唤醒"，
-                         * 避免任务唤醒后重新评估延迟时间并再次进入阻塞状态 */
-                        pxTCB->ucDelayAborted = ( uint8_t ) pdTRUE;
+                    if( pxClass->uxInUse > pxClass->uxHighWater )
+                    {
+                        pxClass->uxHighWater = pxClass->uxInUse;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
-                taskEXIT_CRITICAL();
-
-                /* 将被强制唤醒的任务添加到对应的就绪链表中，使其进入就绪状态 */
-                prvAddTaskToReadyList( pxTCB );
-
-                /* 若禁用抢占式调度（configUSE_PREEMPTION=0），被唤醒的任务不会立即触发上下文切换，
-                 * 需等待当前任务主动放弃CPU */
-                #if ( configUSE_PREEMPTION == 1 )
+                else
                 {
-                    #if ( configNUMBER_OF_CORES == 1 )
-                    {
-                        /* 抢占式调度启用时，仅当被唤醒任务的优先级高于当前运行任务，才需要触发上下文切换 */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-                        {
-                            /* 将"任务切换请求"挂起，待调度器恢复后执行切换。
-                             * xYieldPendings[0]：单内核下的切换请求标志（多内核时为数组，对应每个核心） */
-                            xYieldPendings[ 0 ] = pdTRUE;
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                    }
-                    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
-                    {
-                        taskENTER_CRITICAL();
-                        {
-                            prvYieldForTask( pxTCB );
-                        }
-                        taskEXIT_CRITICAL();
-                    }
-                    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+                    mtCOVERAGE_TEST_MARKER();
                 }
-                #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+            }
+            taskEXIT_CRITICAL();
+
+            if( ( pvObject == NULL ) && ( xAttempt == 0 ) )
+            {
+                ( void ) prvTaskPoolGrow( ucClass, ( UBaseType_t ) configTASK_POOL_SLAB_OBJECTS );
             }
             else
             {
-                xReturn = pdFAIL;
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        ( void ) xTaskResumeAll();
-
-        traceRETURN_xTaskAbortDelay( xReturn );
 
-        return xReturn;
+        return pvObject;
     }
+/*----------------------------------------------------------*/
 
-#endif /* INCLUDE_xTaskAbortDelay */
+    static void prvTaskPoolGive( uint8_t ucClass,
+                                 void * pvObject )
+    {
+        taskENTER_CRITICAL();
+        {
+            *( ( void ** ) pvObject ) = xTaskPool[ ucClass ].pvFreeList;
+            xTaskPool[ ucClass ].pvFreeList = pvObject;
+            xTaskPool[ ucClass ].uxInUse--;
+        }
+        taskEXIT_CRITICAL();
+    }
 /*----------------------------------------------------------*/
 
-// 系统滴答计数递增函数，返回是否需要触发上下文切换（pdTRUE=需要切换，pdFALSE=无需切换）
-BaseType_t xTaskIncrementTick( void )
-{
-    TCB_t * pxTCB;  // 指向任务控制块（TCB）的指针，用于处理超时任务
-    TickType_t xItemValue;  // 存储任务的唤醒时间（从任务状态链表项中获取）
-    BaseType_t xSwitchRequired = pdFALSE;  // 返回值：标记是否需要触发任务切换
-
-    // 多核+抢占式调度场景：存储每个核心是否需要触发切换的标记
-    #if ( configUSE_PREEMPTION == 1 ) && ( configNUMBER_OF_CORES > 1 )
-    BaseType_t xYieldRequiredForCore[ configNUMBER_OF_CORES ] = { pdFALSE };
-    #endif /* ( configUSE_PREEMPTION == 1 ) && ( configNUMBER_OF_CORES > 1 ) */
-
-    traceENTER_xTaskIncrementTick();  // 调试跟踪：函数入口
-
-    /* 注释说明：
-     * 1. 此函数由移植层的滴答中断服务程序（ISR）调用（每次滴答中断触发一次）；
-     * 2. 作用是：递增系统滴答计数，检查是否有任务因超时需从阻塞态唤醒。 */
-    traceTASK_INCREMENT_TICK( xTickCount );  // 调试跟踪：记录当前滴答计数
-
-    /* 注释说明：
-     * 1. 每次滴答中断都需递增系统滴答计数；
-     * 2. 仅核心0负责递增全局滴答计数（xTickCount）；
-     * 3. 若调度器已挂起（uxSchedulerSuspended > 0），则不递增xTickCount，而是递增挂起滴答计数（xPendedTicks）；
-     * 4. 挂起的滴答会在调度器恢复（xTaskResumeAll）时由调用恢复函数的核心统一处理。 */
-    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )  // 调度器未挂起：正常处理滴答
+    static void prvTaskPoolFree( TCB_t * pxTCB )
     {
-        /* 小优化：将“当前滴答+1”的结果存入常量，避免后续代码重复计算 */
-        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
-
-        /* 1. 递增全局滴答计数（xTickCount）；
-         * 2. 若计数回绕到0（如32位TickType_t从0xFFFFFFFF变为0），需切换延迟任务链表，
-         *    避免回绕后唤醒逻辑错误（通过taskSWITCH_DELAYED_LISTS()实现）。 */
-        xTickCount = xConstTickCount;
-
-        if( xConstTickCount == ( TickType_t ) 0U )  // 滴答计数回绕
+        if( pxTCB->ucStackPoolClass != taskPOOL_NOT_POOLED )
         {
-            // 切换延迟链表：将pxDelayedTaskList（当前延迟链表）与pxOverflowDelayedTaskList（溢出延迟链表）互换
-            taskSWITCH_DELAYED_LISTS();
+            prvTaskPoolGive( pxTCB->ucStackPoolClass, pxTCB->pxStack );
         }
         else
         {
-            mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（未回绕时执行）
+            vPortFreeStack( pxTCB->pxStack );
         }
 
-        /* 检查当前滴答是否达到“下一个任务解阻塞时间”（xNextTaskUnblockTime）：
-         * 若达到，说明有延迟任务超时，需唤醒并移到就绪链表；
-         * 延迟链表中的任务按唤醒时间升序排列，一旦遇到未超时任务，后续任务均未超时，可终止遍历。 */
-        if( xConstTickCount >= xNextTaskUnblockTime )
-        {
-            for( ; ; )  // 无限循环，直到无超时任务或延迟链表为空
-            {
-                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )  // 延迟链表为空
-                {
-                    /* 无延迟任务，将xNextTaskUnblockTime设为最大值（portMAX_DELAY），
-                     * 确保下次滴答中断时，无需进入此遍历逻辑（优化性能） */
-                    xNextTaskUnblockTime = portMAX_DELAY;
-                    break;  // 退出循环
-                }
-                else  // 延迟链表非空，处理头部任务（唤醒时间最早的任务）
-                {
-                    /* 获取延迟链表头部任务的TCB（listGET_OWNER_OF_HEAD_ENTRY返回链表项的所有者，即TCB） */
-                    /* MISRA规则兼容注释：空指针赋值相关说明，详见链接 */
-                    /* coverity[misra_c_2012_rule_11_5_violation] */
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-                    // 获取该任务的唤醒时间（存储在任务状态链表项xStateListItem的value字段中）
-                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
-
-                    if( xConstTickCount < xItemValue )  // 当前滴答＜任务唤醒时间（任务未超时）
-                    {
-                        /* 将此任务的唤醒时间设为“下一个解阻塞时间”，下次滴答直接判断此时间即可 */
-                        xNextTaskUnblockTime = xItemValue;
-                        break;  // 退出循环（后续任务唤醒时间更晚，无需处理）
-                    }
-                    else  // 任务已超时，需从阻塞态唤醒
-                    {
-                        mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（任务超时）
-                    }
-
-                    // 步骤1：从延迟链表中移除任务的状态链表项（解除阻塞态关联）
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-
-                    // 步骤2：若任务同时在等待事件（如信号量、事件组），还需从事件链表中移除其事件链表项
-                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                    {
-                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（未等待事件）
-                    }
+        prvTaskPoolGive( taskPOOL_TCB_CLASS, pxTCB );
+    }
+/*----------------------------------------------------------*/
 
-                    // 步骤3：将任务加入就绪链表（根据优先级放入对应的pxReadyTasksLists链表）
-                    prvAddTaskToReadyList( pxTCB );
+    BaseType_t xTaskPoolReserve( configSTACK_DEPTH_TYPE uxStackDepth,
+                                 UBaseType_t uxCount )
+    {
+        const uint8_t ucStackClass = prvTaskPoolStackClass( uxStackDepth );
+        uint8_t ucClass;
+        UBaseType_t uxFree;
+        BaseType_t xReturn = pdPASS;
 
-                    /* 若启用抢占式调度，判断是否需要触发任务切换：
-                     * 仅当被唤醒任务优先级＞当前运行任务优先级时，才需要切换（同等优先级通过时间切片处理） */
-                    #if ( configUSE_PREEMPTION == 1 )
-                    {
-                        #if ( configNUMBER_OF_CORES == 1 )  // 单核场景
-                        {
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-                            {
-                                xSwitchRequired = pdTRUE;  // 标记需要切换
-                            }
-                            else
-                            {
-                                mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（优先级不高）
-                            }
-                        }
-                        #else  // 多核场景：调用prvYieldForTask判断是否需要触发对应核心的切换
-                        {
-                            prvYieldForTask( pxTCB );
-                        }
-                        #endif /* configNUMBER_OF_CORES == 1 */
-                    }
-                    #endif /* configUSE_PREEMPTION == 1 */
-                }
-            }
-        }
+        traceENTER_xTaskPoolReserve( uxStackDepth, uxCount );
 
-        /* 若启用“抢占式调度+时间切片”：
-         * 同等优先级的任务会按滴答间隔轮流占用CPU（时间切片），每次滴答后需检查是否需要切换到同优先级其他任务 */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        /* 过深的栈不进池，只能预留 TCB。 */
+        for( ucClass = taskPOOL_TCB_CLASS; ( ucClass != taskPOOL_NOT_POOLED ) && ( xReturn == pdPASS ); )
         {
-            #if ( configNUMBER_OF_CORES == 1 )  // 单核场景
-            {
-                // 若当前优先级的就绪链表中任务数＞1（存在同优先级其他任务）
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > 1U )
-                {
-                    xSwitchRequired = pdTRUE;  // 标记需要切换（触发时间切片）
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（无同优先级任务）
-                }
-            }
-            #else  // 多核场景：遍历每个核心，检查是否有同优先级任务需时间切片
+            taskENTER_CRITICAL();
             {
-                BaseType_t xCoreID;
-
-                for( xCoreID = 0; xCoreID < ( ( BaseType_t ) configNUMBER_OF_CORES ); xCoreID++ )
-                {
-                    // 检查当前核心运行任务的优先级链表中，任务数是否＞1
-                    if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ) ) > 1U )
-                    {
-                        xYieldRequiredForCore[ xCoreID ] = pdTRUE;  // 标记该核心需要切换
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
+                uxFree = xTaskPool[ ucClass ].uxObjects - xTaskPool[ ucClass ].uxInUse;
             }
-            #endif /* configNUMBER_OF_CORES == 1 */
-        }
-        #endif /* ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) */
+            taskEXIT_CRITICAL();
 
-        /* 若启用滴答钩子函数（configUSE_TICK_HOOK == 1）：
-         * 调用用户实现的vApplicationTickHook()，用于执行周期性任务（如系统监控、数据采样）；
-         * 仅当无挂起滴答（xPendedTicks == 0）时调用，避免钩子函数在调度器不稳定状态下执行。 */
-        #if ( configUSE_TICK_HOOK == 1 )
-        {
-            if( xPendedTicks == ( TickType_t ) 0 )
+            if( uxFree < uxCount )
             {
-                vApplicationTickHook();
+                xReturn = prvTaskPoolGrow( ucClass, uxCount - uxFree );
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
+
+            ucClass = ( ucClass == taskPOOL_TCB_CLASS ) ? ucStackClass : taskPOOL_NOT_POOLED;
         }
-        #endif /* configUSE_TICK_HOOK */
 
-        /* 抢占式调度场景：汇总所有需要切换的标记，最终决定是否触发切换 */
-        #if ( configUSE_PREEMPTION == 1 )
+        if( xReturn != pdPASS )
         {
-            #if ( configNUMBER_OF_CORES == 1 )  // 单核场景
-            {
-                // 若存在挂起的切换请求（xYieldPendings[0]，如xTaskResume触发的切换）
-                if( xYieldPendings[ 0 ] != pdFALSE )
-                {
-                    xSwitchRequired = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            #else  // 多核场景：遍历每个核心，处理切换请求
-            {
-                BaseType_t xCoreID, xCurrentCoreID;
-                xCurrentCoreID = ( BaseType_t ) portGET_CORE_ID();  // 获取当前执行此函数的核心ID
-
-                for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
-                {
-                    // 若启用“任务抢占禁用”，需先检查当前核心任务是否允许抢占
-                    #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
-                        if( pxCurrentTCBs[ xCoreID ]->xPreemptionDisable == pdFALSE )
-                    #endif
-                    {
-                        // 若该核心有“时间切片切换需求”或“挂起切换请求”
-                        if( ( xYieldRequiredForCore[ xCoreID ] != pdFALSE ) || ( xYieldPendings[ xCoreID ] != pdFALSE ) )
-                        {
-                            if( xCoreID == xCurrentCoreID )  // 若为当前核心，标记需要切换
-                            {
-                                xSwitchRequired = pdTRUE;
-                            }
-                            else  // 若为其他核心，触发该核心的切换（prvYieldCore）
-                            {
-                                prvYieldCore( xCoreID );
-                            }
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                    }
-                }
-            }
-            #endif /* configNUMBER_OF_CORES == 1 */
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
         }
-        #endif /* configUSE_PREEMPTION == 1 */
-    }
-    else  // 调度器已挂起：不处理任务唤醒，仅递增挂起滴答计数
-    {
-        xPendedTicks += 1U;  // 挂起滴答计数递增，待调度器恢复后统一处理
-
-        /* 即使调度器挂起，滴答钩子函数仍需按固定间隔调用（用户可能依赖其周期性执行） */
-        #if ( configUSE_TICK_HOOK == 1 )
+        else
         {
-            vApplicationTickHook();
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif
-    }
-
-    traceRETURN_xTaskIncrementTick( xSwitchRequired );  // 调试跟踪：函数返回，携带切换需求标记
 
-    return xSwitchRequired;  // 返回结果：pdTRUE=需要触发任务切换，pdFALSE=无需切换
-}
-/*-----------------------------------------------------------*/
+        traceRETURN_xTaskPoolReserve( xReturn );
 
-// 仅当启用"应用任务标签"功能时编译该函数
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+        return xReturn;
+    }
+/*----------------------------------------------------------*/
 
-    // 为任务设置"应用标签"（本质是一个钩子函数指针），用于自定义任务标识或回调关联
-    // 参数1：xTask - 目标任务句柄（NULL表示当前调用任务）
-    // 参数2：pxHookFunction - 要设置的标签（函数指针类型，可存储任务标识或回调逻辑）
-    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
-                                     TaskHookFunction_t pxHookFunction )
+    UBaseType_t uxTaskPoolGetStats( TaskPoolStats_t * const pxStatsArray,
+                                    const UBaseType_t uxArraySize )
     {
-        TCB_t * xTCB;
+        UBaseType_t uxClass;
+        UBaseType_t uxClasses;
 
-        traceENTER_vTaskSetApplicationTaskTag( xTask, pxHookFunction );
+        traceENTER_uxTaskPoolGetStats( pxStatsArray, uxArraySize );
 
-        /* If xTask is NULL then it is the task hook of the calling task that is
-         * getting set. */
-        if( xTask == NULL )
+        uxClasses = ( uxArraySize < taskPOOL_CLASSES ) ? uxArraySize : taskPOOL_CLASSES;
+
+        if( uxClasses > 0U )
         {
-            xTCB = ( TCB_t * ) pxCurrentTCB;
+            configASSERT( pxStatsArray );
+
+            taskENTER_CRITICAL();
+            {
+                for( uxClass = 0; uxClass < uxClasses; uxClass++ )
+                {
+                    /* TCB 池的栈深度记为 0。 */
+                    pxStatsArray[ uxClass ].uxStackDepth = ( uxClass == 0U ) ? ( configSTACK_DEPTH_TYPE ) 0 :
+                                                           ( configSTACK_DEPTH_TYPE ) taskPOOL_STACK_DEPTH( uxClass );
+                    pxStatsArray[ uxClass ].uxObjects = xTaskPool[ uxClass ].uxObjects;
+                    pxStatsArray[ uxClass ].uxInUse = xTaskPool[ uxClass ].uxInUse;
+                    pxStatsArray[ uxClass ].uxHighWater = xTaskPool[ uxClass ].uxHighWater;
+                }
+            }
+            taskEXIT_CRITICAL();
         }
         else
         {
-            xTCB = xTask;
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        taskENTER_CRITICAL();
-        {
-            xTCB->pxTaskTag = pxHookFunction;
-        }
-        taskEXIT_CRITICAL();
+        traceRETURN_uxTaskPoolGetStats( uxClasses );
 
-        traceRETURN_vTaskSetApplicationTaskTag();
+        return uxClasses;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+#endif /* configUSE_TASK_POOL */
+/*----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
-    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
-    {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
+    #if ( configNUMBER_OF_CORES == 1 )
+        TaskHandle_t xTaskGetIdleTaskHandle( void )
+        {
+            traceENTER_xTaskGetIdleTaskHandle();
 
-        traceENTER_xTaskGetApplicationTaskTag( xTask );
+            /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+             * started, then xIdleTaskHandles will be NULL. */
+            configASSERT( ( xIdleTaskHandles[ 0 ] != NULL ) );
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+            traceRETURN_xTaskGetIdleTaskHandle( xIdleTaskHandles[ 0 ] );
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        taskENTER_CRITICAL();
-        {
-            xReturn = pxTCB->pxTaskTag;
+            return xIdleTaskHandles[ 0 ];
         }
-        taskEXIT_CRITICAL();
+    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
-        traceRETURN_xTaskGetApplicationTaskTag( xReturn );
+    TaskHandle_t xTaskGetIdleTaskHandleForCore( BaseType_t xCoreID )
+    {
+        traceENTER_xTaskGetIdleTaskHandleForCore( xCoreID );
 
-        return xReturn;
+        /* Ensure the core ID is valid. */
+        configASSERT( taskVALID_CORE_ID( xCoreID ) == pdTRUE );
+
+        /* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+         * started, then xIdleTaskHandles will be NULL. */
+        configASSERT( ( xIdleTaskHandles[ xCoreID ] != NULL ) );
+
+        traceRETURN_xTaskGetIdleTaskHandleForCore( xIdleTaskHandles[ xCoreID ] );
+
+        return xIdleTaskHandles[ xCoreID ];
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+/*----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+/* 条件编译应使用不等于0，而非等于1。
+ * 这是为了确保当用户定义的低功耗模式实现要求configUSE_TICKLESS_IDLE
+ * 设置为1以外的值时，vTaskStepTick()仍然可用。 */
+#if ( configUSE_TICKLESS_IDLE != 0 ) // 如果启用了无滴答低功耗模式（无论具体值是多少）
 
-    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    // 用于在低功耗模式后调整系统滴答计数
+    void vTaskStepTick( TickType_t xTicksToJump )
     {
-        TCB_t * pxTCB;
-        TaskHookFunction_t xReturn;
-        UBaseType_t uxSavedInterruptStatus;
+        TickType_t xUpdatedTickCount; // 声明变量用于存储更新后的滴答计数
 
-        traceENTER_xTaskGetApplicationTaskTagFromISR( xTask );
+        traceENTER_vTaskStepTick( xTicksToJump );
 
-        /* If xTask is NULL then set the calling task's hook. */
-        pxTCB = prvGetTCBFromHandle( xTask );
+        /* 在滴答被抑制的时间段后修正滴答计数值。
+         * 注意：这不会为每个步进的滴答调用滴答钩子函数。 */
+        xUpdatedTickCount = xTickCount + xTicksToJump;
+        configASSERT( xUpdatedTickCount <= xNextTaskUnblockTime );
 
-        /* Save the hook function in the TCB.  A critical section is required as
-         * the value can be accessed from an interrupt. */
-        /* MISRA Ref 4.7.1 [Return value shall be checked] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-        /* coverity[misra_c_2012_directive_4_7_violation] */
-        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        // 如果更新后的滴答计数等于下一个任务解除阻塞的时间
+        if( xUpdatedTickCount == xNextTaskUnblockTime )
         {
-            xReturn = pxTCB->pxTaskTag;
+            /* 安排xTickCount在调度器恢复时，在xTaskIncrementTick()中达到xNextTaskUnblockTime。
+             * 这确保所有延迟任务在正确的时间恢复。 */
+            configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
+            configASSERT( xTicksToJump != ( TickType_t ) 0 );
+
+            /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
+            taskENTER_CRITICAL();
+            {
+                xPendedTicks++;
+            }
+            taskEXIT_CRITICAL();
+            xTicksToJump--;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-        traceRETURN_xTaskGetApplicationTaskTagFromISR( xReturn );
+        xTickCount += xTicksToJump;
+        taskPUBLISH_TICK_COUNT();
 
-        return xReturn;
+        traceINCREASE_TICK_COUNT( xTicksToJump );
+        traceRETURN_vTaskStepTick();
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+// 用于快速追赶指定数量的系统滴答，返回是否发生了任务切换
+BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
+{
+    BaseType_t xYieldOccurred;
 
-    // 调用指定任务的应用钩子函数（即通过vTaskSetApplicationTaskTag设置的任务标签）
-    // 参数1：xTask - 目标任务句柄（NULL表示当前调用任务）
-    // 参数2：pvParameter - 传递给钩子函数的参数
-    // 返回值：钩子函数的返回值（若钩子不存在则返回pdFAIL）
-    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
-                                             void * pvParameter )
+    traceENTER_xTaskCatchUpTicks( xTicksToCatchUp );
+
+    configASSERT( uxSchedulerSuspended == ( UBaseType_t ) 0U );
+
+    /* 使用xPendedTicks来模拟在调度器挂起时发生了xTicksToCatchUp个滴答，
+     * 这样这些滴答将在xTaskResumeAll()中被处理 */
+    vTaskSuspendAll();
+
+    /* Prevent the tick interrupt modifying xPendedTicks simultaneously. */
+    taskENTER_CRITICAL();
     {
-        TCB_t * xTCB;
+        xPendedTicks += xTicksToCatchUp;  // 将需要追赶的滴答数添加到挂起滴答计数中
+    }
+    taskEXIT_CRITICAL();
+    xYieldOccurred = xTaskResumeAll(); // 恢复任务调度，并获取是否发生了任务切换的结果
+
+    traceRETURN_xTaskCatchUpTicks( xYieldOccurred );
+
+    return xYieldOccurred;
+}
+/*----------------------------------------------------------*/
+
+#if ( INCLUDE_xTaskAbortDelay == 1 ) // 仅当启用"任务延迟中止"功能时编译该函数
+
+    // 中止指定任务的延迟状态（将阻塞中的任务强制唤醒），返回操作结果
+    BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB = xTask;
         BaseType_t xReturn;
 
-        traceENTER_xTaskCallApplicationTaskHook( xTask, pvParameter );
+        traceENTER_xTaskAbortDelay( xTask );
 
-        /* If xTask is NULL then we are calling our own task hook. */
-        if( xTask == NULL )
-        {
-            xTCB = pxCurrentTCB;
-        }
-        else
-        {
-            xTCB = xTask;
-        }
+        configASSERT( pxTCB );
 
-        if( xTCB->pxTaskTag != NULL )
-        {
-            xReturn = xTCB->pxTaskTag( pvParameter );
-        }
-        else
+        vTaskSuspendAll();
         {
-            xReturn = pdFAIL;
+            /* 只有当任务确实处于"阻塞状态（Blocked）"时，才能强制将其从阻塞状态移除 */
+            if( eTaskGetState( xTask ) == eBlocked )
+            {
+                xReturn = pdPASS;
+
+                /* 从阻塞链表中移除该任务的状态链表项。
+                 * 由于调度器已挂起，中断不会修改xStateListItem（状态链表项仅调度器操作） */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+                 /* 任务是否同时在等待某个事件？（如信号量、事件组等）
+                 * 如果是，还需将其从事件链表中移除。
+                 * 注意：即使调度器挂起，中断仍可能操作事件链表项，因此需要临界区保护 */
+                taskENTER_CRITICAL();
+                {
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+
+                        /* 设置延迟中止标记：告知任务"已被强制唤醒"，
+                         * 避免任务唤醒后重新评估延迟时间并再次进入阻塞状态 */
+                        pxTCB->ucDelayAborted = ( uint8_t ) pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                /* 将被强制唤醒的任务添加到对应的就绪链表中，使其进入就绪状态 */
+                prvAddTaskToReadyList( pxTCB );
+
+                /* 若禁用抢占式调度（configUSE_PREEMPTION=0），被唤醒的任务不会立即触发上下文切换，
+                 * 需等待当前任务主动放弃CPU */
+                #if ( configUSE_PREEMPTION == 1 )
+                {
+                    #if ( configNUMBER_OF_CORES == 1 )
+                    {
+                        /* 抢占式调度启用时，仅当被唤醒任务的优先级高于当前运行任务，才需要触发上下文切换 */
+                        if( ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )
+                        {
+                            /* 将"任务切换请求"挂起，待调度器恢复后执行切换。
+                             * xYieldPendings[0]：单内核下的切换请求标志（多内核时为数组，对应每个核心） */
+                            xYieldPendings[ 0 ] = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            prvYieldForTask( pxTCB );
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+                }
+                #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
         }
+        ( void ) xTaskResumeAll();
 
-        traceRETURN_xTaskCallApplicationTaskHook( xReturn );
+        traceRETURN_xTaskAbortDelay( xReturn );
 
         return xReturn;
     }
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+#endif /* INCLUDE_xTaskAbortDelay */
+/*----------------------------------------------------------*/
 
-#if ( configNUMBER_OF_CORES == 1 )
-    void vTaskSwitchContext( void )
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+    void vTaskSetDeadline( TaskHandle_t xTask,
+                           TickType_t xPeriod,
+                           TickType_t xRelativeDeadline )
     {
-        traceENTER_vTaskSwitchContext();
+        TCB_t * pxTCB;
 
-        if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
+        traceENTER_vTaskSetDeadline( xTask, xPeriod, xRelativeDeadline );
+
+        /* 隐式截止时间：相对截止时间等于周期。 */
+        if( xRelativeDeadline == ( TickType_t ) 0 )
         {
-            /* 调度器当前被挂起 - 不允许上下文切换 */
-            xYieldPendings[ 0 ] = pdTRUE; // 标记挂起的切换请求（单内核核心ID为0）
+            xRelativeDeadline = xPeriod;
         }
-        else
+
+        configASSERT( xRelativeDeadline <= xPeriod );
+        configASSERT( xRelativeDeadline <= ( portMAX_DELAY >> 1 ) );
+
+        taskENTER_CRITICAL();
         {
-            xYieldPendings[ 0 ] = pdFALSE;
-            traceTASK_SWITCHED_OUT();
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-            #if ( configGENERATE_RUN_TIME_STATS == 1 ) // 若启用运行时间统计
+            pxTCB->xEdfPeriod = xPeriod;
+            pxTCB->xEdfRelativeDeadline = xRelativeDeadline;
+            pxTCB->xEdfAbsoluteDeadline = xTickCount + xRelativeDeadline;
+
+            /* 任务已在 EDF 优先级的就绪链表中时按新的截止时间重新排序，
+             * 可能需要让出处理器给截止时间更早的任务。 */
+            if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_PRIORITY ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
             {
-                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                    // 使用替代方法获取运行时间计数器值
-                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ 0 ] );
-                #else
-                    // 获取当前运行时间计数器值（单内核索引为0）
-                    ulTotalRunTime[ 0 ] = portGET_RUN_TIME_COUNTER_VALUE();
-                #endif
+                listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                prvAddTaskToEdfReadyList( pxTCB );
 
-                /* 将当前任务的运行时间累加到其总运行时间中。
-                 * 任务开始运行的时间存储在ulTaskSwitchedInTime中。
-                 * 注意：此处没有溢出保护，因此计数仅在计时器溢出前有效。
-                 * 对负值的检查是为了保护可疑的运行时统计计数器实现（由应用程序提供）。 */
-                if( ulTotalRunTime[ 0 ] > ulTaskSwitchedInTime[ 0 ] )
+                if( xSchedulerRunning != pdFALSE )
                 {
-                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+                    taskYIELD_WITHIN_API();
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
-
-                ulTaskSwitchedInTime[ 0 ] = ulTotalRunTime[ 0 ];
             }
-            #endif /* configGENERATE_RUN_TIME_STATS */
-
-            /* 检查堆栈溢出（如果已配置） */
-            taskCHECK_FOR_STACK_OVERFLOW();
-
-            /* 在当前运行任务被切换出前，保存其errno值 */
-            #if ( configUSE_POSIX_ERRNO == 1 )
+            else
             {
-                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+                mtCOVERAGE_TEST_MARKER();
             }
-            #endif
+        }
+        taskEXIT_CRITICAL();
 
-            /* 使用通用C代码或端口优化的汇编代码选择下一个要运行的任务 */
-            /* MISRA参考 11.5.3 [空指针赋值] */
-            /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-            /* coverity[misra_c_2012_rule_11_5_violation] */
-            taskSELECT_HIGHEST_PRIORITY_TASK(); // 选择最高优先级的就绪任务
-            traceTASK_SWITCHED_IN();
+        traceRETURN_vTaskSetDeadline();
+    }
+/*-----------------------------------------------------------*/
 
-            /* 用于在切换任务后注入端口特定行为的宏，
-             * 例如设置堆栈结束监视点或重新配置MPU */
-            portTASK_SWITCH_HOOK( pxCurrentTCB );
+    TickType_t xTaskGetDeadline( TaskHandle_t xTask )
+    {
+        const TCB_t * pxTCB;
+        TickType_t xReturn;
 
-            /* 新任务切换进入后，更新全局errno */
-            #if ( configUSE_POSIX_ERRNO == 1 )
-            {
-                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
-            }
-            #endif
+        traceENTER_xTaskGetDeadline( xTask );
 
-            #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )  // 若启用C运行时TLS支持
-            {
-                /* 将C运行时的TLS块切换为指向该任务特定的TLS块 */
-                configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
-            }
-            #endif
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            xReturn = taskEDF_HAS_DEADLINE( pxTCB ) ? pxTCB->xEdfAbsoluteDeadline : portMAX_DELAY;
         }
+        taskEXIT_CRITICAL();
 
-        traceRETURN_vTaskSwitchContext();
+        traceRETURN_xTaskGetDeadline( xReturn );
+
+        return xReturn;
     }
-#else /* if ( configNUMBER_OF_CORES == 1 ) */
-    void vTaskSwitchContext( BaseType_t xCoreID )
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+    void vTaskSetBudget( TaskHandle_t xTask,
+                         TickType_t xBudget,
+                         TickType_t xPeriod,
+                         eBudgetAction eAction,
+                         UBaseType_t uxDemotedPriority )
     {
-        traceENTER_vTaskSwitchContext();
+        TCB_t * pxTCB;
+        BaseType_t xYieldRequired = pdFALSE;
 
-        /* Acquire both locks:
-         * - The ISR lock protects the ready list from simultaneous access by
-         *   both other ISRs and tasks.
-         * - We also take the task lock to pause here in case another core has
-         *   suspended the scheduler. We don't want to simply set xYieldPending
-         *   and move on if another core suspended the scheduler. We should only
-         *   do that if the current core has suspended the scheduler. */
+        traceENTER_vTaskSetBudget( xTask, xBudget, xPeriod, eAction, uxDemotedPriority );
 
-        portGET_TASK_LOCK(); /* Must always acquire the task lock first. */
-        portGET_ISR_LOCK();
+        configASSERT( xBudget <= xPeriod );
+        configASSERT( xPeriod <= ( portMAX_DELAY >> 1 ) );
+        configASSERT( uxDemotedPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        taskENTER_CRITICAL();
         {
-            /* vTaskSwitchContext() must never be called from within a critical section.
-             * This is not necessarily true for single core FreeRTOS, but it is for this
-             * SMP port. */
-            configASSERT( portGET_CRITICAL_NESTING_COUNT() == 0 );
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-            if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
+            /* 空闲任务必须始终可以运行。 */
+            configASSERT( ( eAction == eBudgetDemote ) || ( pxTCB != xIdleTaskHandles[ 0 ] ) );
+
+            /* 先撤销上一次预算用完时的降级或挂起。 */
+            if( pxTCB->ucBudgetState != taskBUDGET_AVAILABLE )
             {
-                /* The scheduler is currently suspended - do not allow a context
-                 * switch. */
-                xYieldPendings[ xCoreID ] = pdTRUE;
+                xYieldRequired = prvBudgetReplenish( pxTCB );
             }
             else
             {
-                xYieldPendings[ xCoreID ] = pdFALSE;
-                traceTASK_SWITCHED_OUT();
-
-                #if ( configGENERATE_RUN_TIME_STATS == 1 )
-                {
-                    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-                        portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ xCoreID ] );
-                    #else
-                        ulTotalRunTime[ xCoreID ] = portGET_RUN_TIME_COUNTER_VALUE();
-                    #endif
-
-                    /* Add the amount of time the task has been running to the
-                     * accumulated time so far.  The time the task started running was
-                     * stored in ulTaskSwitchedInTime.  Note that there is no overflow
-                     * protection here so count values are only valid until the timer
-                     * overflows.  The guard against negative values is to protect
-                     * against suspect run time stat counter implementations - which
-                     * are provided by the application, not the kernel. */
-                    if( ulTotalRunTime[ xCoreID ] > ulTaskSwitchedInTime[ xCoreID ] )
-                    {
-                        pxCurrentTCBs[ xCoreID ]->ulRunTimeCounter += ( ulTotalRunTime[ xCoreID ] - ulTaskSwitchedInTime[ xCoreID ] );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                    ulTaskSwitchedInTime[ xCoreID ] = ulTotalRunTime[ xCoreID ];
-                }
-                #endif /* configGENERATE_RUN_TIME_STATS */
+            pxTCB->xBudget = xBudget;
+            pxTCB->xBudgetPeriod = xPeriod;
+            pxTCB->xBudgetRemaining = xBudget;
+            pxTCB->xBudgetReplenishTime = xTickCount + xPeriod;
+            pxTCB->uxBudgetDemotedPriority = uxDemotedPriority;
+            pxTCB->ucBudgetAction = ( uint8_t ) eAction;
 
-                /* Check for stack overflow, if configured. */
-                taskCHECK_FOR_STACK_OVERFLOW();
+            if( ( xYieldRequired != pdFALSE ) && ( xSchedulerRunning != pdFALSE ) )
+            {
+                taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
 
-                /* Before the currently running task is switched out, save its errno. */
-                #if ( configUSE_POSIX_ERRNO == 1 )
-                {
-                    pxCurrentTCBs[ xCoreID ]->iTaskErrno = FreeRTOS_errno;
-                }
-                #endif
+        traceRETURN_vTaskSetBudget();
+    }
+/*-----------------------------------------------------------*/
 
-                /* Select a new task to run. */
-                taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID );
-                traceTASK_SWITCHED_IN();
+    TickType_t xTaskGetBudgetRemaining( TaskHandle_t xTask )
+    {
+        const TCB_t * pxTCB;
+        TickType_t xReturn;
 
-                /* Macro to inject port specific behaviour immediately after
-                 * switching tasks, such as setting an end of stack watchpoint
-                 * or reconfiguring the MPU. */
-                portTASK_SWITCH_HOOK( pxCurrentTCBs[ portGET_CORE_ID() ] );
+        traceENTER_xTaskGetBudgetRemaining( xTask );
 
-                /* After the new task is switched in, update the global errno. */
-                #if ( configUSE_POSIX_ERRNO == 1 )
-                {
-                    FreeRTOS_errno = pxCurrentTCBs[ xCoreID ]->iTaskErrno;
-                }
-                #endif
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
 
-                #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
-                {
-                    /* Switch C-Runtime's TLS Block to point to the TLS
-                     * Block specific to this task. */
-                    configSET_TLS_BLOCK( pxCurrentTCBs[ xCoreID ]->xTLSBlock );
-                }
-                #endif
+            if( pxTCB->xBudget == ( TickType_t ) 0 )
+            {
+                xReturn = portMAX_DELAY;
+            }
+            else if( ( pxTCB->ucBudgetState == taskBUDGET_AVAILABLE ) &&
+                     ( taskBUDGET_TIME_REACHED( xTickCount, pxTCB->xBudgetReplenishTime ) ) )
+            {
+                /* 本周期已经结束，下次运行时才会补充。 */
+                xReturn = pxTCB->xBudget;
+            }
+            else
+            {
+                xReturn = pxTCB->xBudgetRemaining;
             }
         }
-        portRELEASE_ISR_LOCK();
-        portRELEASE_TASK_LOCK();
+        taskEXIT_CRITICAL();
 
-        traceRETURN_vTaskSwitchContext();
+        traceRETURN_xTaskGetBudgetRemaining( xReturn );
+
+        return xReturn;
     }
-#endif /* if ( configNUMBER_OF_CORES > 1 ) */
-/*-----------------------------------------------------------*/
 
-// 将当前任务放入事件链表（等待事件发生），并设置等待超时时间
-void vTaskPlaceOnEventList( List_t * const pxEventList,
-                            const TickType_t xTicksToWait )
-{
-    traceENTER_vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+#endif /* configUSE_TASK_BUDGETS */
+/*----------------------------------------------------------*/
 
-    configASSERT( pxEventList );
+// 系统滴答计数递增函数，返回是否需要触发上下文切换（pdTRUE=需要切换，pdFALSE=无需切换）
+BaseType_t xTaskIncrementTick( void )
+{
+    TCB_t * pxTCB;  // 指向任务控制块（TCB）的指针，用于处理超时任务
+    TickType_t xItemValue;  // 存储任务的唤醒时间（从任务状态链表项中获取）
+    BaseType_t xSwitchRequired = pdFALSE;  // 返回值：标记是否需要触发任务切换
 
-    /* 调用此函数时必须满足：
-     * 1. 调度器已挂起（vTaskSuspendAll()之后）
-     * 2. 正在访问的队列已加锁（防止并发修改） */
+    // 多核+抢占式调度场景：存储每个核心是否需要触发切换的标记
+    #if ( configUSE_PREEMPTION == 1 ) && ( configNUMBER_OF_CORES > 1 )
+    BaseType_t xYieldRequiredForCore[ configNUMBER_OF_CORES ] = { pdFALSE };
+    #endif /* ( configUSE_PREEMPTION == 1 ) && ( configNUMBER_OF_CORES > 1 ) */
 
-    /* 将当前任务TCB的事件链表项放入指定的事件链表中。
-     * 链表按优先级排序，因此最高优先级的任务会最先被事件唤醒。
-     *
-     * 注意：链表按ListItem_t.xItemValue的升序排列。
-     * 通常，TCB的链表项xItemValue值定义为：
-     *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
-     * 因此，事件链表实际按优先级降序排列（高优先级任务排在前）。
-     *
-     * 包含事件链表的队列已加锁，防止中断同时访问。 */
-    // 将当前任务的事件链表项插入事件链表（按优先级排序）
-    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+    traceENTER_xTaskIncrementTick();  // 调试跟踪：函数入口
 
-    // 将当前任务添加到延迟链表，设置超时时间（xTicksToWait）
-    // 第二个参数pdTRUE表示：若超时，需从事件链表中移除任务
-    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+    /* 注释说明：
+     * 1. 此函数由移植层的滴答中断服务程序（ISR）调用（每次滴答中断触发一次）；
+     * 2. 作用是：递增系统滴答计数，检查是否有任务因超时需从阻塞态唤醒。 */
+    traceTASK_INCREMENT_TICK( xTickCount );  // 调试跟踪：记录当前滴答计数
 
-    traceRETURN_vTaskPlaceOnEventList();
-}
-/*-----------------------------------------------------------*/
+    /* 注释说明：
+     * 1. 每次滴答中断都需递增系统滴答计数；
+     * 2. 仅核心0负责递增全局滴答计数（xTickCount）；
+     * 3. 若调度器已挂起（uxSchedulerSuspended > 0），则不递增xTickCount，而是递增挂起滴答计数（xPendedTicks）；
+     * 4. 挂起的滴答会在调度器恢复（xTaskResumeAll）时由调用恢复函数的核心统一处理。 */
+    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )  // 调度器未挂起：正常处理滴答
+    {
+        /* 小优化：将“当前滴答+1”的结果存入常量，避免后续代码重复计算 */
+        const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
 
-// 将当前任务放入"无序事件链表"，并指定链表项值和等待超时时间
-void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
-                                     const TickType_t xItemValue,
-                                     const TickType_t xTicksToWait )
-{
-    traceENTER_vTaskPlaceOnUnorderedEventList( pxEventList, xItemValue, xTicksToWait );
+        /* 1. 递增全局滴答计数（xTickCount）；
+         * 2. 若计数回绕到0（如32位TickType_t从0xFFFFFFFF变为0），需切换延迟任务链表，
+         *    避免回绕后唤醒逻辑错误（通过taskSWITCH_DELAYED_LISTS()实现）。 */
+        xTickCount = xConstTickCount;
 
-    configASSERT( pxEventList );
+        if( xConstTickCount == ( TickType_t ) 0U )  // 滴答计数回绕
+        {
+            // 切换延迟链表：将pxDelayedTaskList（当前延迟链表）与pxOverflowDelayedTaskList（溢出延迟链表）互换
+            taskSWITCH_DELAYED_LISTS();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（未回绕时执行）
+        }
 
-    /* 调用此函数时必须已挂起调度器。该函数由事件组（event groups）实现使用 */
-    configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
+        /* 回绕时与新的溢出次数一起发布，读取方不会看到回绕后的节拍计数配旧的溢出次数。 */
+        taskPUBLISH_TICK_COUNT();
 
-    /* 将项值存储到事件链表项中。
-     * 此处访问事件链表项是安全的，因为中断不会访问非阻塞状态任务的事件链表项 */
-    // 设置事件链表项的值，附加"正在使用"标记（避免与未使用项混淆）
-    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+        /* 检查当前滴答是否达到“下一个任务解阻塞时间”（xNextTaskUnblockTime）：
+         * 若达到，说明有延迟任务超时，需唤醒并移到就绪链表；
+         * 延迟链表中的任务按唤醒时间升序排列，一旦遇到未超时任务，后续任务均未超时，可终止遍历。 */
+        if( xConstTickCount >= xNextTaskUnblockTime )
+        {
+            /* 使用时间轮时，只需处理当前节拍对应的槽：槽中任务的唤醒时间都等于当前节拍，
+             * 下面“未超时”的判断不会成立，槽处理完后再重新计算xNextTaskUnblockTime。
+             * 指针与 pxDelayedTaskList 一样声明为 volatile：configUSE_MINI_LIST_ITEM 为 1 时，
+             * listREMOVE_ITEM() 通过 ListItem_t 修改的链表尾（MiniListItem_t）可能被编译器按严格别名规则缓存，
+             * 每次循环重新读取指针可以避免这一点。 */
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                List_t * volatile const pxExpiredList = prvDelayedWheelAdvance( xConstTickCount );
+            #else
+                List_t * volatile const pxExpiredList = pxDelayedTaskList;
+            #endif
 
-    /* 将TCB的事件链表项放入对应事件链表的末尾。
-     * 此处访问事件链表是安全的，因为它属于事件组实现——
+            for( ; ; )  // 无限循环，直到无超时任务或延迟链表为空
+            {
+                if( listLIST_IS_EMPTY( pxExpiredList ) != pdFALSE )  // 延迟链表为空
+                {
+                    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                    {
+                        prvResetNextTaskUnblockTime();
+                    }
+                    #else
+                    {
+                        /* 无延迟任务，将xNextTaskUnblockTime设为最大值（portMAX_DELAY），
+                         * 确保下次滴答中断时，无需进入此遍历逻辑（优化性能） */
+                        xNextTaskUnblockTime = portMAX_DELAY;
+                    }
+                    #endif
+                    break;  // 退出循环
+                }
+                else  // 延迟链表非空，处理头部任务（唤醒时间最早的任务）
+                {
+                    /* 获取延迟链表头部任务的TCB（listGET_OWNER_OF_HEAD_ENTRY返回链表项的所有者，即TCB） */
+                    /* MISRA规则兼容注释：空指针赋值相关说明，详见链接 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxExpiredList );
+                    // 获取该任务的唤醒时间（存储在任务状态链表项xStateListItem的value字段中）
+                    xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+                    if( xConstTickCount < xItemValue )  // 当前滴答＜任务唤醒时间（任务未超时）
+                    {
+                        /* 将此任务的唤醒时间设为“下一个解阻塞时间”，下次滴答直接判断此时间即可 */
+                        xNextTaskUnblockTime = xItemValue;
+                        break;  // 退出循环（后续任务唤醒时间更晚，无需处理）
+                    }
+                    else  // 任务已超时，需从阻塞态唤醒
+                    {
+                        mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（任务超时）
+                    }
+
+                    // 步骤1：从延迟链表中移除任务的状态链表项（解除阻塞态关联）
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+                    // 步骤2：若任务同时在等待事件（如信号量、事件组），还需从事件链表中移除其事件链表项
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（未等待事件）
+                    }
+
+                    // 步骤3：将任务加入就绪链表（根据优先级放入对应的pxReadyTasksLists链表）
+                    prvAddTaskToReadyList( pxTCB );
+
+                    /* 若启用抢占式调度，判断是否需要触发任务切换：
+                     * 仅当被唤醒任务优先级＞当前运行任务优先级时，才需要切换（同等优先级通过时间切片处理） */
+                    #if ( configUSE_PREEMPTION == 1 )
+                    {
+                        #if ( configNUMBER_OF_CORES == 1 )  // 单核场景
+                        {
+                            if( ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )
+                            {
+                                xSwitchRequired = pdTRUE;  // 标记需要切换
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（优先级不高）
+                            }
+                        }
+                        #else  // 多核场景：调用prvYieldForTask判断是否需要触发对应核心的切换
+                        {
+                            prvYieldForTask( pxTCB );
+                        }
+                        #endif /* configNUMBER_OF_CORES == 1 */
+                    }
+                    #endif /* configUSE_PREEMPTION == 1 */
+                }
+            }
+        }
+
+        /* 任务 CPU 预算：补充到期的任务，并把这个节拍计入当前任务的预算。 */
+        #if ( configUSE_TASK_BUDGETS == 1 )
+        {
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                if( prvBudgetTick( xConstTickCount ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else
+            {
+                ( void ) prvBudgetTick( xConstTickCount );
+            }
+            #endif
+        }
+        #endif /* configUSE_TASK_BUDGETS */
+
+        /* 若启用“抢占式调度+时间切片”：
+         * 同等优先级的任务会按滴答间隔轮流占用CPU（时间切片），每次滴答后需检查是否需要切换到同优先级其他任务 */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        {
+            #if ( configNUMBER_OF_CORES == 1 )  // 单核场景
+            {
+                // 若当前优先级的就绪链表中任务数＞1（存在同优先级其他任务）
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > 1U )
+                {
+                    xSwitchRequired = pdTRUE;  // 标记需要切换（触发时间切片）
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();  // 覆盖率测试标记（无同优先级任务）
+                }
+            }
+            #else  // 多核场景：遍历每个核心，检查是否有同优先级任务需时间切片
+            {
+                BaseType_t xCoreID;
+
+                for( xCoreID = 0; xCoreID < ( ( BaseType_t ) configNUMBER_OF_CORES ); xCoreID++ )
+                {
+                    // 检查当前核心运行任务的优先级链表中，任务数是否＞1
+                    if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ) ) > 1U )
+                    {
+                        xYieldRequiredForCore[ xCoreID ] = pdTRUE;  // 标记该核心需要切换
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            #endif /* configNUMBER_OF_CORES == 1 */
+        }
+        #endif /* ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) */
+
+        #if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+        {
+            if( ( xConstTickCount % ( TickType_t ) configSTACK_OVERFLOW_DEEP_CHECK_PERIOD ) == ( TickType_t ) 0 )
+            {
+                prvCheckNextStackGuard();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        /* 若启用滴答钩子函数（configUSE_TICK_HOOK == 1）：
+         * 调用用户实现的vApplicationTickHook()，用于执行周期性任务（如系统监控、数据采样）；
+         * 仅当无挂起滴答（xPendedTicks == 0）时调用，避免钩子函数在调度器不稳定状态下执行。 */
+        #if ( configUSE_TICK_HOOK == 1 )
+        {
+            if( xPendedTicks == ( TickType_t ) 0 )
+            {
+                vApplicationTickHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TICK_HOOK */
+
+        /* 抢占式调度场景：汇总所有需要切换的标记，最终决定是否触发切换 */
+        #if ( configUSE_PREEMPTION == 1 )
+        {
+            #if ( configNUMBER_OF_CORES == 1 )  // 单核场景
+            {
+                // 若存在挂起的切换请求（xYieldPendings[0]，如xTaskResume触发的切换）
+                if( xYieldPendings[ 0 ] != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else  // 多核场景：遍历每个核心，处理切换请求
+            {
+                BaseType_t xCoreID, xCurrentCoreID;
+                xCurrentCoreID = ( BaseType_t ) portGET_CORE_ID();  // 获取当前执行此函数的核心ID
+
+                for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                {
+                    // 若启用“任务抢占禁用”，需先检查当前核心任务是否允许抢占
+                    #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
+                        if( pxCurrentTCBs[ xCoreID ]->xPreemptionDisable == pdFALSE )
+                    #endif
+                    {
+                        // 若该核心有“时间切片切换需求”或“挂起切换请求”
+                        if( ( xYieldRequiredForCore[ xCoreID ] != pdFALSE ) || ( xYieldPendings[ xCoreID ] != pdFALSE ) )
+                        {
+                            if( xCoreID == xCurrentCoreID )  // 若为当前核心，标记需要切换
+                            {
+                                xSwitchRequired = pdTRUE;
+                            }
+                            else  // 若为其他核心，触发该核心的切换（prvYieldCore）
+                            {
+                                prvYieldCore( xCoreID );
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+            }
+            #endif /* configNUMBER_OF_CORES == 1 */
+        }
+        #endif /* configUSE_PREEMPTION == 1 */
+    }
+    else  // 调度器已挂起：不处理任务唤醒，仅递增挂起滴答计数
+    {
+        xPendedTicks += 1U;  // 挂起滴答计数递增，待调度器恢复后统一处理
+
+        /* 即使调度器挂起，滴答钩子函数仍需按固定间隔调用（用户可能依赖其周期性执行） */
+        #if ( configUSE_TICK_HOOK == 1 )
+        {
+            vApplicationTickHook();
+        }
+        #endif
+    }
+
+    traceRETURN_xTaskIncrementTick( xSwitchRequired );  // 调试跟踪：函数返回，携带切换需求标记
+
+    return xSwitchRequired;  // 返回结果：pdTRUE=需要触发任务切换，pdFALSE=无需切换
+}
+/*-----------------------------------------------------------*/
+
+// 仅当启用"应用任务标签"功能时编译该函数
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    // 为任务设置"应用标签"（本质是一个钩子函数指针），用于自定义任务标识或回调关联
+    // 参数1：xTask - 目标任务句柄（NULL表示当前调用任务）
+    // 参数2：pxHookFunction - 要设置的标签（函数指针类型，可存储任务标识或回调逻辑）
+    void vTaskSetApplicationTaskTag( TaskHandle_t xTask,
+                                     TaskHookFunction_t pxHookFunction )
+    {
+        TCB_t * xTCB;
+
+        traceENTER_vTaskSetApplicationTaskTag( xTask, pxHookFunction );
+
+        /* If xTask is NULL then it is the task hook of the calling task that is
+         * getting set. */
+        if( xTask == NULL )
+        {
+            xTCB = ( TCB_t * ) pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xTCB->pxTaskTag = pxHookFunction;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskSetApplicationTaskTag();
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+
+        traceENTER_xTaskGetApplicationTaskTag( xTask );
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        taskENTER_CRITICAL();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xTaskGetApplicationTaskTag( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        TaskHookFunction_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_xTaskGetApplicationTaskTagFromISR( xTask );
+
+        /* If xTask is NULL then set the calling task's hook. */
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        /* Save the hook function in the TCB.  A critical section is required as
+         * the value can be accessed from an interrupt. */
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            xReturn = pxTCB->pxTaskTag;
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xTaskGetApplicationTaskTagFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+    // 调用指定任务的应用钩子函数（即通过vTaskSetApplicationTaskTag设置的任务标签）
+    // 参数1：xTask - 目标任务句柄（NULL表示当前调用任务）
+    // 参数2：pvParameter - 传递给钩子函数的参数
+    // 返回值：钩子函数的返回值（若钩子不存在则返回pdFAIL）
+    BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask,
+                                             void * pvParameter )
+    {
+        TCB_t * xTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskCallApplicationTaskHook( xTask, pvParameter );
+
+        /* If xTask is NULL then we are calling our own task hook. */
+        if( xTask == NULL )
+        {
+            xTCB = pxCurrentTCB;
+        }
+        else
+        {
+            xTCB = xTask;
+        }
+
+        if( xTCB->pxTaskTag != NULL )
+        {
+            xReturn = xTCB->pxTaskTag( pvParameter );
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xTaskCallApplicationTaskHook( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES == 1 )
+    void vTaskSwitchContext( void )
+    {
+        traceENTER_vTaskSwitchContext();
+
+        if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
+        {
+            /* 调度器当前被挂起 - 不允许上下文切换 */
+            xYieldPendings[ 0 ] = pdTRUE; // 标记挂起的切换请求（单内核核心ID为0）
+        }
+        else
+        {
+            xYieldPendings[ 0 ] = pdFALSE;
+            traceTASK_SWITCHED_OUT();
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 ) // 若启用运行时间统计
+            {
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    // 使用替代方法获取运行时间计数器值
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ 0 ] );
+                #else
+                    // 获取当前运行时间计数器值（单内核索引为0）
+                    ulTotalRunTime[ 0 ] = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+
+                /* 将当前任务的运行时间累加到其总运行时间中。
+                 * 任务开始运行的时间存储在ulTaskSwitchedInTime中。
+                 * 注意：此处没有溢出保护，因此计数仅在计时器溢出前有效。
+                 * 对负值的检查是为了保护可疑的运行时统计计数器实现（由应用程序提供）。 */
+                if( ulTotalRunTime[ 0 ] > ulTaskSwitchedInTime[ 0 ] )
+                {
+                    pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime[ 0 ] - ulTaskSwitchedInTime[ 0 ] );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ulTaskSwitchedInTime[ 0 ] = ulTotalRunTime[ 0 ];
+            }
+            #endif /* configGENERATE_RUN_TIME_STATS */
+
+            /* 检查堆栈溢出（如果已配置） */
+            taskCHECK_FOR_STACK_OVERFLOW();
+
+            #if ( configUSE_STACK_WATERMARK == 1 )
+            {
+                taskRECORD_STACK_WATERMARK( pxCurrentTCB );
+            }
+            #endif
+
+            /* 在当前运行任务被切换出前，保存其errno值 */
+            #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+            }
+            #endif
+
+            /* 使用通用C代码或端口优化的汇编代码选择下一个要运行的任务 */
+            /* MISRA参考 11.5.3 [空指针赋值] */
+            /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            taskSELECT_HIGHEST_PRIORITY_TASK(); // 选择最高优先级的就绪任务
+
+            #if ( configUSE_TASK_BUDGETS == 1 )
+            {
+                /* 预算用完且需要挂起的任务不能再运行：移入 xBudgetThrottledList 后重新选择。
+                 * 空闲任务不会被挂起，所以循环一定会结束。 */
+                while( pxCurrentTCB->ucBudgetState == taskBUDGET_THROTTLED )
+                {
+                    if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                    {
+                        taskRESET_READY_PRIORITY( pxCurrentTCB->uxPriority );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    listINSERT_END( &xBudgetThrottledList, &( pxCurrentTCB->xStateListItem ) );
+                    taskSELECT_HIGHEST_PRIORITY_TASK();
+                }
+            }
+            #endif /* configUSE_TASK_BUDGETS */
+
+            traceTASK_SWITCHED_IN();
+
+            /* 用于在切换任务后注入端口特定行为的宏，
+             * 例如设置堆栈结束监视点或重新配置MPU */
+            portTASK_SWITCH_HOOK( pxCurrentTCB );
+
+            /* 新任务切换进入后，更新全局errno */
+            #if ( configUSE_POSIX_ERRNO == 1 )
+            {
+                FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+            }
+            #endif
+
+            #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )  // 若启用C运行时TLS支持
+            {
+                /* 将C运行时的TLS块切换为指向该任务特定的TLS块 */
+                configSET_TLS_BLOCK( pxCurrentTCB->xTLSBlock );
+            }
+            #endif
+        }
+
+        traceRETURN_vTaskSwitchContext();
+    }
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+    void vTaskSwitchContext( BaseType_t xCoreID )
+    {
+        traceENTER_vTaskSwitchContext();
+
+        /* Acquire both locks:
+         * - The ISR lock protects the ready list from simultaneous access by
+         *   both other ISRs and tasks.
+         * - We also take the task lock to pause here in case another core has
+         *   suspended the scheduler. We don't want to simply set xYieldPending
+         *   and move on if another core suspended the scheduler. We should only
+         *   do that if the current core has suspended the scheduler. */
+
+        portGET_TASK_LOCK(); /* Must always acquire the task lock first. */
+        portGET_ISR_LOCK();
+        {
+            /* vTaskSwitchContext() must never be called from within a critical section.
+             * This is not necessarily true for single core FreeRTOS, but it is for this
+             * SMP port. */
+            configASSERT( portGET_CRITICAL_NESTING_COUNT() == 0 );
+
+            if( uxSchedulerSuspended != ( UBaseType_t ) 0U )
+            {
+                /* The scheduler is currently suspended - do not allow a context
+                 * switch. */
+                xYieldPendings[ xCoreID ] = pdTRUE;
+            }
+            else
+            {
+                xYieldPendings[ xCoreID ] = pdFALSE;
+                traceTASK_SWITCHED_OUT();
+
+                #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                {
+                    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                        portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime[ xCoreID ] );
+                    #else
+                        ulTotalRunTime[ xCoreID ] = portGET_RUN_TIME_COUNTER_VALUE();
+                    #endif
+
+                    /* Add the amount of time the task has been running to the
+                     * accumulated time so far.  The time the task started running was
+                     * stored in ulTaskSwitchedInTime.  Note that there is no overflow
+                     * protection here so count values are only valid until the timer
+                     * overflows.  The guard against negative values is to protect
+                     * against suspect run time stat counter implementations - which
+                     * are provided by the application, not the kernel. */
+                    if( ulTotalRunTime[ xCoreID ] > ulTaskSwitchedInTime[ xCoreID ] )
+                    {
+                        pxCurrentTCBs[ xCoreID ]->ulRunTimeCounter += ( ulTotalRunTime[ xCoreID ] - ulTaskSwitchedInTime[ xCoreID ] );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ulTaskSwitchedInTime[ xCoreID ] = ulTotalRunTime[ xCoreID ];
+                }
+                #endif /* configGENERATE_RUN_TIME_STATS */
+
+                /* Check for stack overflow, if configured. */
+                taskCHECK_FOR_STACK_OVERFLOW();
+
+                #if ( configUSE_STACK_WATERMARK == 1 )
+                {
+                    taskRECORD_STACK_WATERMARK( pxCurrentTCBs[ xCoreID ] );
+                }
+                #endif
+
+                /* Before the currently running task is switched out, save its errno. */
+                #if ( configUSE_POSIX_ERRNO == 1 )
+                {
+                    pxCurrentTCBs[ xCoreID ]->iTaskErrno = FreeRTOS_errno;
+                }
+                #endif
+
+                /* Select a new task to run. */
+                taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID );
+                traceTASK_SWITCHED_IN();
+
+                /* Macro to inject port specific behaviour immediately after
+                 * switching tasks, such as setting an end of stack watchpoint
+                 * or reconfiguring the MPU. */
+                portTASK_SWITCH_HOOK( pxCurrentTCBs[ portGET_CORE_ID() ] );
+
+                /* After the new task is switched in, update the global errno. */
+                #if ( configUSE_POSIX_ERRNO == 1 )
+                {
+                    FreeRTOS_errno = pxCurrentTCBs[ xCoreID ]->iTaskErrno;
+                }
+                #endif
+
+                #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+                {
+                    /* Switch C-Runtime's TLS Block to point to the TLS
+                     * Block specific to this task. */
+                    configSET_TLS_BLOCK( pxCurrentTCBs[ xCoreID ]->xTLSBlock );
+                }
+                #endif
+            }
+        }
+        portRELEASE_ISR_LOCK();
+        portRELEASE_TASK_LOCK();
+
+        traceRETURN_vTaskSwitchContext();
+    }
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+// 将当前任务放入事件链表（等待事件发生），并设置等待超时时间
+void vTaskPlaceOnEventList( List_t * const pxEventList,
+                            const TickType_t xTicksToWait )
+{
+    traceENTER_vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+
+    configASSERT( pxEventList );
+
+    /* 调用此函数时必须满足：
+     * 1. 调度器已挂起（vTaskSuspendAll()之后）
+     * 2. 正在访问的队列已加锁（防止并发修改） */
+
+    /* 将当前任务TCB的事件链表项放入指定的事件链表中。
+     * 链表按优先级排序，因此最高优先级的任务会最先被事件唤醒。
+     *
+     * 注意：链表按ListItem_t.xItemValue的升序排列。
+     * 通常，TCB的链表项xItemValue值定义为：
+     *      xItemValue = ( configMAX_PRIORITIES - uxPriority )
+     * 因此，事件链表实际按优先级降序排列（高优先级任务排在前）。
+     *
+     * 包含事件链表的队列已加锁，防止中断同时访问。 */
+    // 将当前任务的事件链表项插入事件链表（按优先级排序）
+    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+    // 将当前任务添加到延迟链表，设置超时时间（xTicksToWait）
+    // 第二个参数pdTRUE表示：若超时，需从事件链表中移除任务
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+
+    traceRETURN_vTaskPlaceOnEventList();
+}
+/*-----------------------------------------------------------*/
+
+// 将当前任务放入"无序事件链表"，并指定链表项值和等待超时时间
+void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
+                                     const TickType_t xItemValue,
+                                     const TickType_t xTicksToWait )
+{
+    traceENTER_vTaskPlaceOnUnorderedEventList( pxEventList, xItemValue, xTicksToWait );
+
+    configASSERT( pxEventList );
+
+    /* 调用此函数时必须已挂起调度器。该函数由事件组（event groups）实现使用 */
+    configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
+
+    /* 将项值存储到事件链表项中。
+     * 此处访问事件链表项是安全的，因为中断不会访问非阻塞状态任务的事件链表项 */
+    // 设置事件链表项的值，附加"正在使用"标记（避免与未使用项混淆）
+    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+    /* 将TCB的事件链表项放入对应事件链表的末尾。
+     * 此处访问事件链表是安全的，因为它属于事件组实现——
      * 中断不会直接访问事件组（而是通过挂起函数调用到任务级间接访问） */
     // 将任务的事件链表项插入到事件链表末尾（不按优先级排序，因此称为"无序"）
     listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
 
-    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+
+    traceRETURN_vTaskPlaceOnUnorderedEventList();
+}
+/*-----------------------------------------------------------*/
+
+// 仅当启用定时器功能时编译该函数
+#if ( configUSE_TIMERS == 1 )
+
+    // 将当前任务放入事件链表（受限版本），支持设置等待时间或无限等待
+    void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
+                                          TickType_t xTicksToWait,
+                                          const BaseType_t xWaitIndefinitely )
+    {
+        traceENTER_vTaskPlaceOnEventListRestricted( pxEventList, xTicksToWait, xWaitIndefinitely );
+
+        configASSERT( pxEventList );
+
+        /* 此函数不应由应用程序代码调用，因此名称中包含"Restricted"（受限）。
+         * 它不属于公共API，专为内核代码设计，并有特殊调用要求——
+         * 必须在调度器挂起的状态下调用。 */
+
+
+        /* 将TCB的事件链表项放入对应的事件链表中。
+         * 在这种情况下，假设只有一个任务会等待此事件链表，
+         * 因此可以使用更快的listINSERT_END()函数代替vListInsert()。 */
+        // 将当前任务的事件链表项插入事件链表末尾（因单任务等待，无需排序）
+        listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+        /* 若任务应无限期阻塞，则将阻塞时间设置为prvAddCurrentTaskToDelayedList()
+         * 函数中可识别为无限延迟的值。 */
+        if( xWaitIndefinitely != pdFALSE )
+        {
+            xTicksToWait = portMAX_DELAY;
+        }
+
+        traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
+        // 将当前任务加入延迟链表，传入等待时间和无限等待标志
+        prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+
+        traceRETURN_vTaskPlaceOnEventListRestricted();
+    }
+
+#endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+// 从事件链表中移除最高优先级的任务并唤醒，返回是否需要触发上下文切换
+BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+{
+    TCB_t * pxUnblockedTCB;
+    BaseType_t xReturn;
+
+    traceENTER_xTaskRemoveFromEventList( pxEventList );
+
+    /* 此函数必须在临界区中调用。也可在ISR（中断服务程序）的临界区中调用。 */
+
+    /* 事件链表按优先级排序，因此链表头部的任务是最高优先级，可直接移除。
+     * 将TCB从延迟链表中移除，并加入就绪链表。
+     *
+     * 若事件所属的队列已加锁，则不会调用此函数——而是修改队列的锁计数。
+     * 这确保此处对事件链表的访问具有独占性。
+     *
+     * 此函数假设调用前已检查过pxEventList非空（避免访问空链表）。 */
+    /* MISRA参考 11.5.3 [空指针赋值] */
+    /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+    /* coverity[misra_c_2012_rule_11_5_violation] */
+    // 获取事件链表头部任务的TCB（最高优先级等待任务）
+    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+    configASSERT( pxUnblockedTCB );
+    listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+
+    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+    {
+        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+        prvAddTaskToReadyList( pxUnblockedTCB );
+
+        #if ( configUSE_TICKLESS_IDLE != 0 )  // 若启用无滴答低功耗模式
+        {
+            /* 若任务因内核对象（如信号量、队列）阻塞，xNextTaskUnblockTime
+             * 可能被设为该任务的超时时间。若任务因非超时原因被唤醒，
+             * xNextTaskUnblockTime通常无需修改（因滴答计数达到该值时会自动重置）。
+             * 但启用无滴答空闲模式时，需尽早进入睡眠模式——因此此处重置xNextTaskUnblockTime，
+             * 确保其尽早更新为下一个任务的唤醒时间。 */
+            prvResetNextTaskUnblockTime();  // 重置下一个任务唤醒时间
+        }
+        #endif
+    }
+    else // 调度器已挂起（无法直接操作延迟/就绪链表）
+    {
+        /* 延迟链表和就绪链表不可访问，因此将该任务暂存到"挂起就绪链表"，
+         * 待调度器恢复后再处理。 */
+        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+    }
+
+    #if ( configNUMBER_OF_CORES == 1 )
+    {
+        if( ( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxUnblockedTCB ) ) )
+        {
+            /* Return true if the task removed from the event list has a higher
+             * priority than the calling task.  This allows the calling task to know if
+             * it should force a context switch now. */
+            xReturn = pdTRUE;
+
+            /* Mark that a yield is pending in case the user is not using the
+             * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+            xYieldPendings[ 0 ] = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+    {
+        xReturn = pdFALSE;
+
+        #if ( configUSE_PREEMPTION == 1 )
+        {
+            prvYieldForTask( pxUnblockedTCB );
+
+            if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
+            {
+                xReturn = pdTRUE;
+            }
+        }
+        #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+    }
+    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+
+    traceRETURN_xTaskRemoveFromEventList( xReturn );
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+// 从无序事件链表中移除指定任务链表项并唤醒任务，支持更新链表项值
+void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
+                                        const TickType_t xItemValue )
+{
+    TCB_t * pxUnblockedTCB;
+
+    traceENTER_vTaskRemoveFromUnorderedEventList( pxEventListItem, xItemValue );
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+     * the event flags implementation. */
+    configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
+
+    /* 将新的链表项值存入事件链表项中。 */
+    // 更新事件链表项的值（附加"正在使用"标记，避免与未使用项混淆）
+    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+    /* 从事件标志（事件组）的事件链表中移除该事件链表项。中断不会直接访问事件标志。 */
+    /* MISRA参考 11.5.3 [空指针赋值] */
+    /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+    /* coverity[misra_c_2012_rule_11_5_violation] */
+    // 通过事件链表项获取所属任务的TCB
+    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
+    configASSERT( pxUnblockedTCB );
+    listREMOVE_ITEM( pxEventListItem );
+
+    #if ( configUSE_TICKLESS_IDLE != 0 ) // 若启用无滴答低功耗模式
+    {
+        /* 若任务因内核对象（如事件组）阻塞，xNextTaskUnblockTime
+         * 可能被设为该任务的超时时间。若任务因非超时原因被唤醒，
+         * xNextTaskUnblockTime通常无需修改（因滴答计数达到该值时会自动重置）。
+         * 但启用无滴答空闲模式时，需尽早进入睡眠模式——因此此处重置xNextTaskUnblockTime，
+         * 确保其尽早更新为下一个任务的唤醒时间。 */
+        prvResetNextTaskUnblockTime();
+    }
+    #endif
+
+    /* 将任务从延迟链表中移除，并加入就绪链表。
+     * 此时调度器已挂起，因此中断不会访问就绪链表（无需额外加锁）。 */
+    // 从延迟链表中移除任务的状态链表项（解除超时等待）
+    listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+    prvAddTaskToReadyList( pxUnblockedTCB );
+
+    #if ( configNUMBER_OF_CORES == 1 )
+    {
+        if( ( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxUnblockedTCB ) ) )
+        {
+            /* The unblocked task has a priority above that of the calling task, so
+             * a context switch is required.  This function is called with the
+             * scheduler suspended so xYieldPending is set so the context switch
+             * occurs immediately that the scheduler is resumed (unsuspended). */
+            xYieldPendings[ 0 ] = pdTRUE;
+        }
+    }
+    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+    {
+        #if ( configUSE_PREEMPTION == 1 )
+        {
+            taskENTER_CRITICAL();
+            {
+                prvYieldForTask( pxUnblockedTCB );
+            }
+            taskEXIT_CRITICAL();
+        }
+        #endif
+    }
+    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+
+    traceRETURN_vTaskRemoveFromUnorderedEventList();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+
+    void vTaskSetHandOffBuffer( void * pvBuffer )
+    {
+        traceENTER_vTaskSetHandOffBuffer( pvBuffer );
+
+        configASSERT( pvBuffer != NULL );
+
+        pxCurrentTCB->pvHandOffBuffer = pvBuffer;
+
+        traceRETURN_vTaskSetHandOffBuffer();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskClearHandOffBuffer( void )
+    {
+        BaseType_t xReturn;
+        TCB_t * const pxTCB = pxCurrentTCB;
+
+        traceENTER_xTaskClearHandOffBuffer();
+
+        /* 只有对方完成复制后才会把登记的缓冲区清为 NULL；任务因超时、队列重置等原因被唤醒时仍是登记的值。 */
+        if( pxTCB->pvHandOffBuffer == NULL )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            pxTCB->pvHandOffBuffer = NULL;
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xTaskClearHandOffBuffer( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvTaskGetEventListHandOffBuffer( const List_t * const pxEventList )
+    {
+        void * pvReturn = NULL;
+        const TCB_t * pxTCB;
+
+        traceENTER_pvTaskGetEventListHandOffBuffer( pxEventList );
+
+        if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+        {
+            /* 事件链表按优先级排序，只看链表头部的任务：它是 xTaskRemoveFromEventList() 会唤醒的任务。 */
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+            pvReturn = pxTCB->pvHandOffBuffer;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_pvTaskGetEventListHandOffBuffer( pvReturn );
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskRemoveFromEventListAfterHandOff( const List_t * const pxEventList )
+    {
+        BaseType_t xReturn;
+        TCB_t * pxTCB;
+
+        traceENTER_xTaskRemoveFromEventListAfterHandOff( pxEventList );
+
+        pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+        configASSERT( pxTCB );
+        configASSERT( pxTCB->pvHandOffBuffer != NULL );
+        pxTCB->pvHandOffBuffer = NULL;
+
+        xReturn = xTaskRemoveFromEventList( pxEventList );
+
+        traceRETURN_xTaskRemoveFromEventListAfterHandOff( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_HANDOFF */
+/*-----------------------------------------------------------*/
+
+// 初始化/记录超时状态，为后续超时判断（xTaskCheckForTimeOut()）提供初始时间基准
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+    traceENTER_vTaskSetTimeOutState( pxTimeOut );
+
+    configASSERT( pxTimeOut );
+
+    #if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+    {
+        /* 溢出次数和滴答计数是一起发布的，不需要临界区 */
+        prvReadTickCount( pxTimeOut );
+    }
+    #else
+    {
+        taskENTER_CRITICAL();
+        {
+            // 记录当前系统的滴答计数器溢出次数（用于处理xTickCount溢出场景）
+            pxTimeOut->xOverflowCount = xNumOfOverflows;
+            // 记录调用该函数时的系统当前滴答计数（作为超时判断的起始时间）
+            pxTimeOut->xTimeOnEntering = xTickCount;
+        }
+        taskEXIT_CRITICAL();
+    }
+    #endif /* configUSE_TICK_COUNT_SEQLOCK */
+
+    traceRETURN_vTaskSetTimeOutState();
+}
+/*-----------------------------------------------------------*/
 
-    traceRETURN_vTaskPlaceOnUnorderedEventList();
+// 内核内部专用的超时状态初始化函数（无临界区保护，仅用于内核代码）
+void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+    traceENTER_vTaskInternalSetTimeOutState( pxTimeOut );
+
+    /* 仅内核内部使用，因为此函数不包含临界区保护 */
+    // 记录当前系统的溢出计数器值
+    // xNumOfOverflows：系统节拍计数器(xTickCount)溢出的次数
+    pxTimeOut->xOverflowCount = xNumOfOverflows;
+    
+    // 记录进入超时状态时的系统节拍值
+    // xTickCount：当前系统节拍计数器的值（每过一个时钟节拍加1）
+    pxTimeOut->xTimeOnEntering = xTickCount;
+
+    traceRETURN_vTaskInternalSetTimeOutState();
 }
 /*-----------------------------------------------------------*/
 
-// 仅当启用定时器功能时编译该函数
-#if ( configUSE_TIMERS == 1 )
+// 检查任务等待是否超时，更新剩余等待时间，返回超时状态
+// 参数1：pxTimeOut - 超时状态结构体（需先通过vTaskSetTimeOutState()初始化）
+// 参数2：pxTicksToWait - 指向剩余等待时间的指针（函数会更新该值）
+// 返回值：pdTRUE - 已超时；pdFALSE - 未超时
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
+                                 TickType_t * const pxTicksToWait )
+{
+    BaseType_t xReturn;
 
-    // 将当前任务放入事件链表（受限版本），支持设置等待时间或无限等待
-    void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
-                                          TickType_t xTicksToWait,
-                                          const BaseType_t xWaitIndefinitely )
+    #if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+        TimeOut_t xTickCountNow;
+    #endif
+
+    traceENTER_xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait );
+
+    configASSERT( pxTimeOut );
+    configASSERT( pxTicksToWait );
+
+    #if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
     {
-        traceENTER_vTaskPlaceOnEventListRestricted( pxEventList, xTicksToWait, xWaitIndefinitely );
+        /* 滴答计数和溢出次数取自同一次发布，下面的判断只用这份快照和调用者自己的数据，不需要临界区。
+         * 延迟中止标记只在任务阻塞时被其他任务设置，当前任务正在运行，可以直接读取和清除。 */
+        prvReadTickCount( &xTickCountNow );
+    }
+    #else
+    {
+        taskENTER_CRITICAL();
+    }
+    #endif /* configUSE_TICK_COUNT_SEQLOCK */
+    {
+        #if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+            const TickType_t xConstTickCount = xTickCountNow.xTimeOnEntering;
+            const BaseType_t xConstNumOfOverflows = xTickCountNow.xOverflowCount;
+        #else
+            /* 小优化：在临界区内，滴答计数（xTickCount）不会被中断修改，可缓存为常量 */
+            const TickType_t xConstTickCount = xTickCount;
+            const BaseType_t xConstNumOfOverflows = xNumOfOverflows;
+        #endif
+        // 计算从超时初始化到当前的已流逝时间（无符号减法，自动处理溢出）
+        const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
 
-        configASSERT( pxEventList );
+        #if ( INCLUDE_xTaskAbortDelay == 1 ) // 若启用"延迟中止"功能
+            // 检查当前任务的延迟是否被主动中止（如调用xTaskAbortDelay()）
+            if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+            {
+                /* 延迟被中止，虽与超时不同，但结果一致（任务需退出等待） */
+                pxCurrentTCB->ucDelayAborted = ( uint8_t ) pdFALSE; // 清除中止标记
+                xReturn = pdTRUE;  // 视为"超时"结果返回
+            }
+            else
+        #endif
 
-        /* 此函数不应由应用程序代码调用，因此名称中包含"Restricted"（受限）。
-         * 它不属于公共API，专为内核代码设计，并有特殊调用要求——
-         * 必须在调度器挂起的状态下调用。 */
+        #if ( INCLUDE_vTaskSuspend == 1 )  // 若启用"任务挂起"功能
+            if( *pxTicksToWait == portMAX_DELAY )
+            {
+                /* If INCLUDE_vTaskSuspend is set to 1 and the block time
+                 * specified is the maximum block time then the task should block
+                 * indefinitely, and therefore never time out. */
+                xReturn = pdFALSE;
+            }
+            else
+        #endif
+
+        // 场景1：处理xTickCount溢出导致的超时判断
+        if( ( xConstNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) )
+        {
+             /* 此时：
+             * 1. 滴答计数器溢出次数已变化（xNumOfOverflows != 初始值）；
+             * 2. 当前滴答计数 >= 初始滴答计数；
+             * 说明xTickCount已溢出并完整循环一次，且已超过初始时间，判定为超时。 */
+            xReturn = pdTRUE;
+            *pxTicksToWait = ( TickType_t ) 0; // 剩余等待时间设为0
+        }
+        // 场景2：未超时，更新剩余等待时间
+        else if( xElapsedTime < *pxTicksToWait )
+        {
+            /* 已流逝时间 < 剩余等待时间，未超时 */
+            *pxTicksToWait -= xElapsedTime; // 更新剩余等待时间（减去已流逝部分）
+
+            // 重置超时状态（为下次检查做准备）
+            #if ( configUSE_TICK_COUNT_SEQLOCK == 1 )
+                *pxTimeOut = xTickCountNow;
+            #else
+                vTaskInternalSetTimeOutState( pxTimeOut );
+            #endif
+            xReturn = pdFALSE;
+        }
+        // 场景3：已超时（已流逝时间 >= 剩余等待时间）
+        else
+        {
+            *pxTicksToWait = ( TickType_t ) 0; // 剩余等待时间设为0
+            xReturn = pdTRUE;
+        }
+    }
+    #if ( configUSE_TICK_COUNT_SEQLOCK == 0 )
+    {
+        taskEXIT_CRITICAL();
+    }
+    #endif
 
+    traceRETURN_xTaskCheckForTimeOut( xReturn );
 
-        /* 将TCB的事件链表项放入对应的事件链表中。
-         * 在这种情况下，假设只有一个任务会等待此事件链表，
-         * 因此可以使用更快的listINSERT_END()函数代替vListInsert()。 */
-        // 将当前任务的事件链表项插入事件链表末尾（因单任务等待，无需排序）
-        listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
 
-        /* 若任务应无限期阻塞，则将阻塞时间设置为prvAddCurrentTaskToDelayedList()
-         * 函数中可识别为无限延迟的值。 */
-        if( xWaitIndefinitely != pdFALSE )
+// 标记当前核心存在“遗漏的切换请求”，确保后续调度时触发上下文切换
+void vTaskMissedYield( void )
+{
+    traceENTER_vTaskMissedYield();
+
+    /* 必须在临界区中调用。 */
+    // 获取当前核心ID，将对应核心的“切换请求标记”设为pdTRUE（表示需要切换）
+    xYieldPendings[ portGET_CORE_ID() ] = pdTRUE;
+
+    traceRETURN_vTaskMissedYield();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+    {
+        UBaseType_t uxReturn;
+        TCB_t const * pxTCB;
+
+        traceENTER_uxTaskGetTaskNumber( xTask );
+
+        if( xTask != NULL )
         {
-            xTicksToWait = portMAX_DELAY;
+            pxTCB = xTask;
+            uxReturn = pxTCB->uxTaskNumber;
+        }
+        else
+        {
+            uxReturn = 0U;
         }
 
-        traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
-        // 将当前任务加入延迟链表，传入等待时间和无限等待标志
-        prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+        traceRETURN_uxTaskGetTaskNumber( uxReturn );
 
-        traceRETURN_vTaskPlaceOnEventListRestricted();
+        return uxReturn;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vTaskSetTaskNumber( TaskHandle_t xTask,
+                             const UBaseType_t uxHandle )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskSetTaskNumber( xTask, uxHandle );
+
+        if( xTask != NULL )
+        {
+            pxTCB = xTask;
+            pxTCB->uxTaskNumber = uxHandle;
+        }
+
+        traceRETURN_vTaskSetTaskNumber();
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+/*
+ * -----------------------------------------------------------
+ * 被动空闲任务（The passive idle task）
+ * ----------------------------------------------------------
+ *
+ * 被动空闲任务用于SMP（对称多处理）系统中的所有额外核心（非主核心）。
+ * SMP系统中必须仅存在1个主动空闲任务（active idle task），其余核心运行的均为被动空闲任务。
+ *
+ * portTASK_FUNCTION()宏用于支持特定端口/编译器的语言扩展。
+ * 该函数对应的标准函数原型为：
+ *
+ * void prvPassiveIdleTask( void *pvParameters );
+ */
+ 
+#if ( configNUMBER_OF_CORES > 1 )
+    static portTASK_FUNCTION( prvPassiveIdleTask, pvParameters )
+    {
+        ( void ) pvParameters;
+
+        taskYIELD();
+
+        for( ; configCONTROL_INFINITE_LOOP(); )
+        {
+            #if ( configUSE_PREEMPTION == 0 )
+            {
+                /* If we are not using preemption we keep forcing a task switch to
+                 * see if any other task has become available.  If we are using
+                 * preemption we don't need to do this as any task becoming available
+                 * will automatically get the processor anyway. */
+                taskYIELD();
+            }
+            #endif /* configUSE_PREEMPTION */
+
+            #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+            {
+                /* When using preemption tasks of equal priority will be
+                 * timesliced.  If a task that is sharing the idle priority is ready
+                 * to run then the idle task should yield before the end of the
+                 * timeslice.
+                 *
+                 * A critical region is not required here as we are just reading from
+                 * the list, and an occasional incorrect value will not matter.  If
+                 * the ready list at the idle priority contains one more task than the
+                 * number of idle tasks, which is equal to the configured numbers of cores
+                 * then a task other than the idle task is ready to execute. */
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
+                {
+                    taskYIELD();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
+
+            #if ( configUSE_PASSIVE_IDLE_HOOK == 1 )
+            {
+                /* Call the user defined function from within the idle task.  This
+                 * allows the application designer to add background functionality
+                 * without the overhead of a separate task.
+                 *
+                 * This hook is intended to manage core activity such as disabling cores that go idle.
+                 *
+                 * NOTE: vApplicationPassiveIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
+                 * CALL A FUNCTION THAT MIGHT BLOCK. */
+                vApplicationPassiveIdleHook();
+            }
+            #endif /* configUSE_PASSIVE_IDLE_HOOK */
+        }
     }
-
-#endif /* configUSE_TIMERS */
+#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
 /*-----------------------------------------------------------*/
 
-// 从事件链表中移除最高优先级的任务并唤醒，返回是否需要触发上下文切换
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+
+/*
+ * -----------------------------------------------------------
+ * 空闲任务（The idle task）
+ * ----------------------------------------------------------
+ *
+ * portTASK_FUNCTION()宏用于支持特定端口/编译器的语言扩展（如中断安全属性、调用约定）。
+ * 该函数对应的标准C函数原型为：
+ *
+ * void prvIdleTask( void *pvParameters );
+ *
+ */
+
+ // 定义空闲任务函数（static修饰：仅在当前文件可见；portTASK_FUNCTION宏适配端口特性）
+static portTASK_FUNCTION( prvIdleTask, pvParameters )
 {
-    TCB_t * pxUnblockedTCB;
-    BaseType_t xReturn;
+    /* 消除编译器未使用参数警告 */
+    ( void ) pvParameters;
 
-    traceENTER_xTaskRemoveFromEventList( pxEventList );
+    /** 这是RTOS空闲任务——调度器启动时会自动创建。**/
 
-    /* 此函数必须在临界区中调用。也可在ISR（中断服务程序）的临界区中调用。 */
+    /* 若某个具有安全上下文的任务自删除，空闲任务需负责删除该任务的安全上下文（如有）。
+     * （注：安全上下文常见于带安全扩展的CPU，如ARM TrustZone，用于隔离安全/非安全世界资源） */
+    portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
 
-    /* 事件链表按优先级排序，因此链表头部的任务是最高优先级，可直接移除。
-     * 将TCB从延迟链表中移除，并加入就绪链表。
-     *
-     * 若事件所属的队列已加锁，则不会调用此函数——而是修改队列的锁计数。
-     * 这确保此处对事件链表的访问具有独占性。
-     *
-     * 此函数假设调用前已检查过pxEventList非空（避免访问空链表）。 */
-    /* MISRA参考 11.5.3 [空指针赋值] */
-    /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-    /* coverity[misra_c_2012_rule_11_5_violation] */
-    // 获取事件链表头部任务的TCB（最高优先级等待任务）
-    pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+    #if ( configNUMBER_OF_CORES > 1 )  // SMP多核心场景
+    {
+        /* SMP all cores start up in the idle task. This initial yield gets the application
+         * tasks started. */
+        taskYIELD();
+    }
+    #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
 
-    if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+    // 空闲任务主循环（configCONTROL_INFINITE_LOOP()是端口无关的无限循环宏，通常为for(;;)）
+    for( ; configCONTROL_INFINITE_LOOP(); )
     {
-        listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-        prvAddTaskToReadyList( pxUnblockedTCB );
+         /* 检查是否有任务自删除——若有，空闲任务需负责释放被删除任务的TCB（任务控制块）和栈内存。
+         * （注：任务调用vTaskDelete()后不会立即释放资源，仅标记为“待清理”，由空闲任务异步处理） */
+        prvCheckTasksWaitingTermination();
 
-        #if ( configUSE_TICKLESS_IDLE != 0 )  // 若启用无滴答低功耗模式
+        #if ( configSTACK_WATERMARK_SCAN_WORDS > 0 )
         {
-            /* 若任务因内核对象（如信号量、队列）阻塞，xNextTaskUnblockTime
-             * 可能被设为该任务的超时时间。若任务因非超时原因被唤醒，
-             * xNextTaskUnblockTime通常无需修改（因滴答计数达到该值时会自动重置）。
-             * 但启用无滴答空闲模式时，需尽早进入睡眠模式——因此此处重置xNextTaskUnblockTime，
-             * 确保其尽早更新为下一个任务的唤醒时间。 */
-            prvResetNextTaskUnblockTime();  // 重置下一个任务唤醒时间
+            prvStackWatermarkScanStep();
         }
         #endif
-    }
-    else // 调度器已挂起（无法直接操作延迟/就绪链表）
-    {
-        /* 延迟链表和就绪链表不可访问，因此将该任务暂存到"挂起就绪链表"，
-         * 待调度器恢复后再处理。 */
-        listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
-    }
 
-    #if ( configNUMBER_OF_CORES == 1 )
-    {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        #if ( configUSE_PREEMPTION == 0 )
         {
-            /* Return true if the task removed from the event list has a higher
-             * priority than the calling task.  This allows the calling task to know if
-             * it should force a context switch now. */
-            xReturn = pdTRUE;
+            /* 若禁用抢占，需主动触发任务切换以检查是否有其他任务就绪。
+             * 若启用抢占，就绪任务会自动抢占CPU，无需此操作。 */
+            taskYIELD();
+        }
+        #endif /* configUSE_PREEMPTION */
 
-            /* Mark that a yield is pending in case the user is not using the
-             * "xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-            xYieldPendings[ 0 ] = pdTRUE;
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) // 启用抢占且空闲任务需让步
+        {
+            /* 启用抢占时，同优先级任务会按时间片调度。
+             * 若有其他同优先级（空闲优先级）的任务就绪，空闲任务应在当前时间片结束前主动让步。
+             *
+             * 此处无需临界区：仅读取就绪链表长度，偶发的错误值不影响整体逻辑。
+             * 若空闲优先级就绪链表的长度 > 核心数（每个核心对应1个空闲任务），
+             * 说明存在非空闲任务就绪，需触发切换。 */
+            if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
+            {
+                taskYIELD();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        else
+        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
+
+        #if ( configUSE_IDLE_HOOK == 1 )
         {
-            xReturn = pdFALSE;
+            /* 在空闲任务中调用用户定义的钩子函数。
+             * （注：钩子函数需轻量化，不可阻塞或调用可能导致阻塞的API，如vTaskDelay()） */
+            vApplicationIdleHook();
         }
-    }
-    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
-    {
-        xReturn = pdFALSE;
+        #endif /* configUSE_IDLE_HOOK */
 
-        #if ( configUSE_PREEMPTION == 1 )
+        /* 条件编译使用“!=0”而非“==1”，确保当用户自定义低功耗模式需将configUSE_TICKLESS_IDLE设为
+         * 非1值时，仍能调用portSUPPRESS_TICKS_AND_SLEEP()。 */
+        #if ( configUSE_TICKLESS_IDLE != 0 )
         {
-            prvYieldForTask( pxUnblockedTCB );
+            TickType_t xExpectedIdleTime;
 
-            if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
+            /* 不希望在空闲任务每次循环都挂起/恢复调度器，因此先在调度器未挂起时
+             * 初步计算预计空闲时间（此结果可能因任务就绪而失效）。 */
+            xExpectedIdleTime = prvGetExpectedIdleTime();
+
+            // 若预计空闲时间 >= 进入低功耗前的最小空闲时间阈值
+            if( xExpectedIdleTime >= ( TickType_t ) configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
             {
-                xReturn = pdTRUE;
+                vTaskSuspendAll();
+                {
+                    /* 调度器挂起后，重新采样预计空闲时间（此结果可靠，无任务干扰）。 */
+                    configASSERT( xNextTaskUnblockTime >= xTickCount );
+                    xExpectedIdleTime = prvGetExpectedIdleTime();
+
+                    /* 若应用不希望调用portSUPPRESS_TICKS_AND_SLEEP()，可定义此宏将xExpectedIdleTime设为0。
+                     * （用于自定义低功耗触发逻辑） */
+                    configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+
+                    // 再次确认预计空闲时间满足阈值
+                    if( xExpectedIdleTime >= ( TickType_t ) configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+                    {
+                        traceLOW_POWER_IDLE_BEGIN();
+                        portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ); // 进入低功耗模式（端口实现）
+                        traceLOW_POWER_IDLE_END();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
         }
-        #endif /* #if ( configUSE_PREEMPTION == 1 ) */
-    }
-    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+        #endif /* configUSE_TICKLESS_IDLE */
 
-    traceRETURN_xTaskRemoveFromEventList( xReturn );
-    return xReturn;
+        #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PASSIVE_IDLE_HOOK == 1 ) ) // SMP且启用被动空闲钩子
+        {
+            /* 在空闲任务中调用用户定义的被动空闲钩子函数。
+             * 允许应用在无额外任务开销的情况下添加后台功能。
+             *
+             * 此钩子用于管理核心活动（如禁用空闲核心以降低功耗）。
+             * 注意：vApplicationPassiveIdleHook()在任何情况下都不得调用可能阻塞的函数！ */
+            vApplicationPassiveIdleHook();
+        }
+        #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PASSIVE_IDLE_HOOK == 1 ) ) */
+    }
 }
 /*-----------------------------------------------------------*/
 
-// 从无序事件链表中移除指定任务链表项并唤醒任务，支持更新链表项值
-void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
-                                        const TickType_t xItemValue )
-{
-    TCB_t * pxUnblockedTCB;
-
-    traceENTER_vTaskRemoveFromUnorderedEventList( pxEventListItem, xItemValue );
-
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-     * the event flags implementation. */
-    configASSERT( uxSchedulerSuspended != ( UBaseType_t ) 0U );
+// 仅当启用无滴答低功耗模式时编译该函数
+#if ( configUSE_TICKLESS_IDLE != 0 )
 
-    /* 将新的链表项值存入事件链表项中。 */
-    // 更新事件链表项的值（附加"正在使用"标记，避免与未使用项混淆）
-    listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+    // 确认当前系统状态是否允许进入低功耗模式，返回低功耗状态类型
+    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+    {
+        #if ( INCLUDE_vTaskSuspend == 1 )
+            /* 系统中除应用任务外，还存在空闲任务（每个核心1个）。
+             * uxNonApplicationTasks = 核心数（所有空闲任务均为非应用任务） */
+            const UBaseType_t uxNonApplicationTasks = configNUMBER_OF_CORES;
+        #endif /* INCLUDE_vTaskSuspend */
 
-    /* 从事件标志（事件组）的事件链表中移除该事件链表项。中断不会直接访问事件标志。 */
-    /* MISRA参考 11.5.3 [空指针赋值] */
-    /* 更多细节：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-    /* coverity[misra_c_2012_rule_11_5_violation] */
-    // 通过事件链表项获取所属任务的TCB
-    pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem );
-    configASSERT( pxUnblockedTCB );
-    listREMOVE_ITEM( pxEventListItem );
+        eSleepModeStatus eReturn = eStandardSleep; // 默认返回“标准低功耗模式”
 
-    #if ( configUSE_TICKLESS_IDLE != 0 ) // 若启用无滴答低功耗模式
-    {
-        /* 若任务因内核对象（如事件组）阻塞，xNextTaskUnblockTime
-         * 可能被设为该任务的超时时间。若任务因非超时原因被唤醒，
-         * xNextTaskUnblockTime通常无需修改（因滴答计数达到该值时会自动重置）。
-         * 但启用无滴答空闲模式时，需尽早进入睡眠模式——因此此处重置xNextTaskUnblockTime，
-         * 确保其尽早更新为下一个任务的唤醒时间。 */
-        prvResetNextTaskUnblockTime();
-    }
-    #endif
+        traceENTER_eTaskConfirmSleepModeStatus();
 
-    /* 将任务从延迟链表中移除，并加入就绪链表。
-     * 此时调度器已挂起，因此中断不会访问就绪链表（无需额外加锁）。 */
-    // 从延迟链表中移除任务的状态链表项（解除超时等待）
-    listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-    prvAddTaskToReadyList( pxUnblockedTCB );
+        /* 此函数必须在临界区中调用。 */
 
-    #if ( configNUMBER_OF_CORES == 1 )
-    {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        // 场景1：挂起就绪链表非空（调度器挂起时，有任务被标记为“待就绪”）
+        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0U )
         {
-            /* The unblocked task has a priority above that of the calling task, so
-             * a context switch is required.  This function is called with the
-             * scheduler suspended so xYieldPending is set so the context switch
-             * occurs immediately that the scheduler is resumed (unsuspended). */
-            xYieldPendings[ 0 ] = pdTRUE;
+            /* 调度器挂起期间，已有任务变为就绪状态（需立即处理，不可进入低功耗） */
+            eReturn = eAbortSleep;  // 返回“中止低功耗”
         }
-    }
-    #else /* #if ( configNUMBER_OF_CORES == 1 ) */
-    {
-        #if ( configUSE_PREEMPTION == 1 )
+        // 场景2：当前核心存在挂起的切换请求
+        else if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
         {
-            taskENTER_CRITICAL();
+            /* 调度器挂起期间，已有切换请求被挂起（需立即处理切换，不可进入低功耗） */
+            eReturn = eAbortSleep;
+        }
+        // 场景3：存在未处理的滴答中断（xPendedTicks记录pending的滴答数）
+        else if( xPendedTicks != 0U )
+        {
+            /* 滴答中断已触发，但因调度器挂起而被挂起（需先处理滴答，不可进入低功耗） */
+            eReturn = eAbortSleep;
+        }
+
+        #if ( INCLUDE_vTaskSuspend == 1 )
+            // 场景4：所有应用任务均处于挂起状态（无任务等待超时）
+            else if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
             {
-                prvYieldForTask( pxUnblockedTCB );
+                /* 若所有任务都在挂起链表中（可能是无限阻塞，而非显式挂起），
+                 * 则可安全关闭所有时钟，仅等待外部中断唤醒（无需关注超时） */
+                eReturn = eNoTasksWaitingTimeout;
             }
-            taskEXIT_CRITICAL();
+        #endif /* INCLUDE_vTaskSuspend */
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-        #endif
+
+        traceRETURN_eTaskConfirmSleepModeStatus( eReturn );
+
+        return eReturn;
     }
-    #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 
-    traceRETURN_vTaskRemoveFromUnorderedEventList();
-}
+#endif /* configUSE_TICKLESS_IDLE */
 /*-----------------------------------------------------------*/
 
-// 初始化/记录超时状态，为后续超时判断（xTaskCheckForTimeOut()）提供初始时间基准
-void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-    traceENTER_vTaskSetTimeOutState( pxTimeOut );
+// 仅当配置了TLS指针数量（configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0）时编译该函数
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-    configASSERT( pxTimeOut );
-    taskENTER_CRITICAL();
+    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
+                                            BaseType_t xIndex,
+                                            void * pvValue )
     {
-        // 记录当前系统的滴答计数器溢出次数（用于处理xTickCount溢出场景）
-        pxTimeOut->xOverflowCount = xNumOfOverflows;
-        // 记录调用该函数时的系统当前滴答计数（作为超时判断的起始时间）
-        pxTimeOut->xTimeOnEntering = xTickCount;
-    }
-    taskEXIT_CRITICAL();
+        TCB_t * pxTCB;
 
-    traceRETURN_vTaskSetTimeOutState();
-}
-/*-----------------------------------------------------------*/
+        traceENTER_vTaskSetThreadLocalStoragePointer( xTaskToSet, xIndex, pvValue );
 
-// 内核内部专用的超时状态初始化函数（无临界区保护，仅用于内核代码）
-void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-    traceENTER_vTaskInternalSetTimeOutState( pxTimeOut );
+        if( ( xIndex >= 0 ) &&
+            ( xIndex < ( BaseType_t ) configNUM_THREAD_LOCAL_STORAGE_POINTERS ) )
+        {
+            pxTCB = prvGetTCBFromHandle( xTaskToSet );
+            configASSERT( pxTCB != NULL );
+            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+        }
 
-    /* 仅内核内部使用，因为此函数不包含临界区保护 */
-    // 记录当前系统的溢出计数器值
-    // xNumOfOverflows：系统节拍计数器(xTickCount)溢出的次数
-    pxTimeOut->xOverflowCount = xNumOfOverflows;
-    
-    // 记录进入超时状态时的系统节拍值
-    // xTickCount：当前系统节拍计数器的值（每过一个时钟节拍加1）
-    pxTimeOut->xTimeOnEntering = xTickCount;
+        traceRETURN_vTaskSetThreadLocalStoragePointer();
+    }
 
-    traceRETURN_vTaskInternalSetTimeOutState();
-}
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
-// 检查任务等待是否超时，更新剩余等待时间，返回超时状态
-// 参数1：pxTimeOut - 超时状态结构体（需先通过vTaskSetTimeOutState()初始化）
-// 参数2：pxTicksToWait - 指向剩余等待时间的指针（函数会更新该值）
-// 返回值：pdTRUE - 已超时；pdFALSE - 未超时
-BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
-                                 TickType_t * const pxTicksToWait )
-{
-    BaseType_t xReturn;
-
-    traceENTER_xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait );
-
-    configASSERT( pxTimeOut );
-    configASSERT( pxTicksToWait );
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
 
-    taskENTER_CRITICAL();
+    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
+                                               BaseType_t xIndex )
     {
-        /* 小优化：在临界区内，滴答计数（xTickCount）不会被中断修改，可缓存为常量 */
-        const TickType_t xConstTickCount = xTickCount;
-        // 计算从超时初始化到当前的已流逝时间（无符号减法，自动处理溢出）
-        const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
-
-        #if ( INCLUDE_xTaskAbortDelay == 1 ) // 若启用"延迟中止"功能
-            // 检查当前任务的延迟是否被主动中止（如调用xTaskAbortDelay()）
-            if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
-            {
-                /* 延迟被中止，虽与超时不同，但结果一致（任务需退出等待） */
-                pxCurrentTCB->ucDelayAborted = ( uint8_t ) pdFALSE; // 清除中止标记
-                xReturn = pdTRUE;  // 视为"超时"结果返回
-            }
-            else
-        #endif
+        void * pvReturn = NULL;
+        TCB_t * pxTCB;
 
-        #if ( INCLUDE_vTaskSuspend == 1 )  // 若启用"任务挂起"功能
-            if( *pxTicksToWait == portMAX_DELAY )
-            {
-                /* If INCLUDE_vTaskSuspend is set to 1 and the block time
-                 * specified is the maximum block time then the task should block
-                 * indefinitely, and therefore never time out. */
-                xReturn = pdFALSE;
-            }
-            else
-        #endif
+        traceENTER_pvTaskGetThreadLocalStoragePointer( xTaskToQuery, xIndex );
 
-        // 场景1：处理xTickCount溢出导致的超时判断
-        if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) )
-        {
-             /* 此时：
-             * 1. 滴答计数器溢出次数已变化（xNumOfOverflows != 初始值）；
-             * 2. 当前滴答计数 >= 初始滴答计数；
-             * 说明xTickCount已溢出并完整循环一次，且已超过初始时间，判定为超时。 */
-            xReturn = pdTRUE;
-            *pxTicksToWait = ( TickType_t ) 0; // 剩余等待时间设为0
-        }
-        // 场景2：未超时，更新剩余等待时间
-        else if( xElapsedTime < *pxTicksToWait )
+        if( ( xIndex >= 0 ) &&
+            ( xIndex < ( BaseType_t ) configNUM_THREAD_LOCAL_STORAGE_POINTERS ) )
         {
-            /* 已流逝时间 < 剩余等待时间，未超时 */
-            *pxTicksToWait -= xElapsedTime; // 更新剩余等待时间（减去已流逝部分）
-            vTaskInternalSetTimeOutState( pxTimeOut ); // 重置超时状态（为下次检查做准备）
-            xReturn = pdFALSE;
+            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
         }
-        // 场景3：已超时（已流逝时间 >= 剩余等待时间）
         else
         {
-            *pxTicksToWait = ( TickType_t ) 0; // 剩余等待时间设为0
-            xReturn = pdTRUE;
+            pvReturn = NULL;
         }
+
+        traceRETURN_pvTaskGetThreadLocalStoragePointer( pvReturn );
+
+        return pvReturn;
     }
-    taskEXIT_CRITICAL();
 
-    traceRETURN_xTaskCheckForTimeOut( xReturn );
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+/*-----------------------------------------------------------*/
 
-    return xReturn;
-}
+#if ( portUSING_MPU_WRAPPERS == 1 )
+
+    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
+                                  const MemoryRegion_t * const pxRegions )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskAllocateMPURegions( xTaskToModify, pxRegions );
+
+        /* If null is passed in here then we are modifying the MPU settings of
+         * the calling task. */
+        pxTCB = prvGetTCBFromHandle( xTaskToModify );
+
+        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), pxRegions, NULL, 0 );
+
+        traceRETURN_vTaskAllocateMPURegions();
+    }
+
+#endif /* portUSING_MPU_WRAPPERS */
 /*-----------------------------------------------------------*/
 
-// 标记当前核心存在“遗漏的切换请求”，确保后续调度时触发上下文切换
-void vTaskMissedYield( void )
+// 初始化FreeRTOS所有核心任务链表（就绪链表、延迟链表、挂起链表等）
+static void prvInitialiseTaskLists( void )
 {
-    traceENTER_vTaskMissedYield();
+    UBaseType_t uxPriority;
 
-    /* 必须在临界区中调用。 */
-    // 获取当前核心ID，将对应核心的“切换请求标记”设为pdTRUE（表示需要切换）
-    xYieldPendings[ portGET_CORE_ID() ] = pdTRUE;
+    // 1. 初始化“就绪任务链表”：为每个优先级创建一个就绪链表
+    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    {
+        // 初始化当前优先级对应的就绪链表（pxReadyTasksLists是数组，每个元素对应一个优先级的就绪链表）
+        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+    }
 
-    traceRETURN_vTaskMissedYield();
-}
-/*-----------------------------------------------------------*/
+    // 2. 初始化“延迟任务链表”：2个延迟链表用于处理xTickCount溢出（双缓冲机制）
+    vListInitialise( &xDelayedTaskList1 );
+    vListInitialise( &xDelayedTaskList2 );
+    // 3. 初始化“挂起就绪链表”：临时存储调度器挂起期间被唤醒的任务
+    vListInitialise( &xPendingReadyList );
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+    #if ( INCLUDE_vTaskDelete == 1 ) // 若启用任务删除功能
+    {
+        // 4. 初始化“待终止任务链表”：存储调用vTaskDelete()后待清理的任务
+        vListInitialise( &xTasksWaitingTermination );
+    }
+    #endif /* INCLUDE_vTaskDelete */
 
-    UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+    #if ( INCLUDE_vTaskSuspend == 1 )  // 若启用任务挂起功能
     {
-        UBaseType_t uxReturn;
-        TCB_t const * pxTCB;
+        // 5. 初始化“挂起任务链表”：存储调用vTaskSuspend()显式挂起的任务
+        vListInitialise( &xSuspendedTaskList );
+    }
+    #endif /* INCLUDE_vTaskSuspend */
 
-        traceENTER_uxTaskGetTaskNumber( xTask );
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        // 初始化预算用完的任务链表
+        vListInitialise( &xBudgetExhaustedList );
+        vListInitialise( &xBudgetThrottledList );
+    }
+    #endif
 
-        if( xTask != NULL )
+    #if ( taskTRACK_ALL_TASKS == 1 )
+    {
+        vListInitialise( &xAllTasksList );
+    }
+    #endif
+
+    /* 初始化延迟链表指针：
+     * - pxDelayedTaskList：当前活跃的延迟链表（用于添加/查询延迟任务）
+     * - pxOverflowDelayedTaskList：溢出备用延迟链表（xTickCount溢出时切换）
+     * 初始状态下，活跃链表使用xDelayedTaskList1，备用链表使用xDelayedTaskList2 */
+    pxDelayedTaskList = &xDelayedTaskList1;
+    pxOverflowDelayedTaskList = &xDelayedTaskList2;
+
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    {
+        UBaseType_t uxSlot;
+
+        // 6. 初始化时间轮的节拍轮和段轮
+        for( uxSlot = 0; uxSlot < ( UBaseType_t ) taskWHEEL_SLOTS; uxSlot++ )
         {
-            pxTCB = xTask;
-            uxReturn = pxTCB->uxTaskNumber;
+            vListInitialise( &( xDelayedTaskWheel[ 0 ][ uxSlot ] ) );
+            vListInitialise( &( xDelayedTaskWheel[ 1 ][ uxSlot ] ) );
         }
-        else
+
+        for( uxSlot = 0; uxSlot < taskWHEEL_MAP_WORDS; uxSlot++ )
         {
-            uxReturn = 0U;
+            ulDelayedTaskWheelMap[ 0 ][ uxSlot ] = 0U;
+            ulDelayedTaskWheelMap[ 1 ][ uxSlot ] = 0U;
         }
-
-        traceRETURN_uxTaskGetTaskNumber( uxReturn );
-
-        return uxReturn;
     }
-
-#endif /* configUSE_TRACE_FACILITY */
+    #endif /* configUSE_DELAYED_TASK_WHEEL */
+}
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+// 检查并清理“待终止任务链表”中的任务（释放TCB和栈内存）
+static void prvCheckTasksWaitingTermination( void )
+{
+     /** 此函数由RTOS空闲任务调用 **/
 
-    void vTaskSetTaskNumber( TaskHandle_t xTask,
-                             const UBaseType_t uxHandle )
+    #if ( ( INCLUDE_vTaskDelete == 1 ) && ( configUSE_BATCHED_TASK_CLEANUP == 1 ) )
     {
+        TCB_t * pxBatch[ configTASK_CLEANUP_BATCH_LENGTH ];
         TCB_t * pxTCB;
+        UBaseType_t uxBatched = 0U;
+        UBaseType_t uxTask;
 
-        traceENTER_vTaskSetTaskNumber( xTask, uxHandle );
+        /* 不进入临界区先看一眼，没有待清理的任务时不付出临界区的开销。 */
+        if( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* 一次取下最多 configTASK_CLEANUP_BATCH_LENGTH 个任务，限制每次循环的耗时。
+                 * SMP 中其他核心的空闲任务可能已经清理过，所以在临界区内重新读取计数。 */
+                while( ( uxBatched < ( UBaseType_t ) configTASK_CLEANUP_BATCH_LENGTH ) &&
+                       ( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U ) )
+                {
+                    /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
 
-        if( xTask != NULL )
+                    #if ( configNUMBER_OF_CORES > 1 )
+                    {
+                        if( pxTCB->xTaskRunState != taskTASK_NOT_RUNNING )
+                        {
+                            /* 还没有被调度器切换出去，留到下一次。 */
+                            break;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    --uxDeletedTasksWaitingCleanUp;
+                    pxBatch[ uxBatched ] = pxTCB;
+                    uxBatched++;
+                }
+
+                uxCurrentNumberOfTasks -= uxBatched;
+            }
+            taskEXIT_CRITICAL();
+
+            /* 释放内存不需要临界区。 */
+            for( uxTask = 0U; uxTask < uxBatched; uxTask++ )
+            {
+                prvDeleteTCB( pxBatch[ uxTask ] );
+            }
+        }
+        else
         {
-            pxTCB = xTask;
-            pxTCB->uxTaskNumber = uxHandle;
+            mtCOVERAGE_TEST_MARKER();
         }
-
-        traceRETURN_vTaskSetTaskNumber();
     }
-
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
-
-/*
- * -----------------------------------------------------------
- * 被动空闲任务（The passive idle task）
- * ----------------------------------------------------------
- *
- * 被动空闲任务用于SMP（对称多处理）系统中的所有额外核心（非主核心）。
- * SMP系统中必须仅存在1个主动空闲任务（active idle task），其余核心运行的均为被动空闲任务。
- *
- * portTASK_FUNCTION()宏用于支持特定端口/编译器的语言扩展。
- * 该函数对应的标准函数原型为：
- *
- * void prvPassiveIdleTask( void *pvParameters );
- */
- 
-#if ( configNUMBER_OF_CORES > 1 )
-    static portTASK_FUNCTION( prvPassiveIdleTask, pvParameters )
+    #elif ( INCLUDE_vTaskDelete == 1 )
     {
-        ( void ) pvParameters;
-
-        taskYIELD();
+        TCB_t * pxTCB;
 
-        for( ; configCONTROL_INFINITE_LOOP(); )
+        /* uxDeletedTasksWaitingCleanUp用于记录待清理任务数量，避免在空闲任务中过于频繁地进入临界区 */
+        while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
         {
-            #if ( configUSE_PREEMPTION == 0 )
+            #if ( configNUMBER_OF_CORES == 1 )
             {
-                /* If we are not using preemption we keep forcing a task switch to
-                 * see if any other task has become available.  If we are using
-                 * preemption we don't need to do this as any task becoming available
-                 * will automatically get the processor anyway. */
-                taskYIELD();
-            }
-            #endif /* configUSE_PREEMPTION */
+                taskENTER_CRITICAL();
+                {
+                    {
+                        /* MISRA规则11.5.3兼容处理（void指针赋值） */
+                        /* 详情参考：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                        /* coverity[misra_c_2012_rule_11_5_violation] */
+                        // 从“待终止任务链表”头部获取第一个待清理任务的TCB
+                        pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
+                        // 将该任务从链表中移除（xStateListItem是任务在状态链表中的节点）
+                        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                        --uxCurrentNumberOfTasks;  // 系统总任务数减1
+                        --uxDeletedTasksWaitingCleanUp;  // 待清理任务数减1
+                    }
+                }
+                taskEXIT_CRITICAL();
 
-            #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+                prvDeleteTCB( pxTCB );  // 释放TCB和栈内存（核心清理函数）
+            }
+            #else /* #if( configNUMBER_OF_CORES == 1 ) */
             {
-                /* When using preemption tasks of equal priority will be
-                 * timesliced.  If a task that is sharing the idle priority is ready
-                 * to run then the idle task should yield before the end of the
-                 * timeslice.
-                 *
-                 * A critical region is not required here as we are just reading from
-                 * the list, and an occasional incorrect value will not matter.  If
-                 * the ready list at the idle priority contains one more task than the
-                 * number of idle tasks, which is equal to the configured numbers of cores
-                 * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
+                pxTCB = NULL;
+
+                taskENTER_CRITICAL();
                 {
-                    taskYIELD();
+                    /* For SMP, multiple idles can be running simultaneously
+                     * and we need to check that other idles did not cleanup while we were
+                     * waiting to enter the critical section. */
+                    if( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+                    {
+                        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                        /* coverity[misra_c_2012_rule_11_5_violation] */
+                        pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
+
+                        if( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING )
+                        {
+                            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                            --uxCurrentNumberOfTasks;
+                            --uxDeletedTasksWaitingCleanUp;
+                        }
+                        else
+                        {
+                            /* The TCB to be deleted still has not yet been switched out
+                             * by the scheduler, so we will just exit this loop early and
+                             * try again next time. */
+                            taskEXIT_CRITICAL();
+                            break;
+                        }
+                    }
                 }
-                else
+                taskEXIT_CRITICAL();
+
+                if( pxTCB != NULL )
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    prvDeleteTCB( pxTCB );
                 }
             }
-            #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
-
-            #if ( configUSE_PASSIVE_IDLE_HOOK == 1 )
-            {
-                /* Call the user defined function from within the idle task.  This
-                 * allows the application designer to add background functionality
-                 * without the overhead of a separate task.
-                 *
-                 * This hook is intended to manage core activity such as disabling cores that go idle.
-                 *
-                 * NOTE: vApplicationPassiveIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
-                 * CALL A FUNCTION THAT MIGHT BLOCK. */
-                vApplicationPassiveIdleHook();
-            }
-            #endif /* configUSE_PASSIVE_IDLE_HOOK */
+            #endif /* #if( configNUMBER_OF_CORES == 1 ) */
         }
     }
-#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+    #endif /* INCLUDE_vTaskDelete */
+}
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-/*
- * -----------------------------------------------------------
- * 空闲任务（The idle task）
- * ----------------------------------------------------------
- *
- * portTASK_FUNCTION()宏用于支持特定端口/编译器的语言扩展（如中断安全属性、调用约定）。
- * 该函数对应的标准C函数原型为：
- *
- * void prvIdleTask( void *pvParameters );
- *
- */
+    void vTaskGetInfo( TaskHandle_t xTask,
+                       TaskStatus_t * pxTaskStatus,
+                       BaseType_t xGetFreeStackSpace,
+                       eTaskState eState )
+    {
+        TCB_t * pxTCB;
 
- // 定义空闲任务函数（static修饰：仅在当前文件可见；portTASK_FUNCTION宏适配端口特性）
-static portTASK_FUNCTION( prvIdleTask, pvParameters )
-{
-    /* 消除编译器未使用参数警告 */
-    ( void ) pvParameters;
+        traceENTER_vTaskGetInfo( xTask, pxTaskStatus, xGetFreeStackSpace, eState );
 
-    /** 这是RTOS空闲任务——调度器启动时会自动创建。**/
+        /* xTask is NULL then get the state of the calling task. */
+        pxTCB = prvGetTCBFromHandle( xTask );
 
-    /* 若某个具有安全上下文的任务自删除，空闲任务需负责删除该任务的安全上下文（如有）。
-     * （注：安全上下文常见于带安全扩展的CPU，如ARM TrustZone，用于隔离安全/非安全世界资源） */
-    portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+        pxTaskStatus->xHandle = pxTCB;
+        pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+        pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+        pxTaskStatus->pxStackBase = pxTCB->pxStack;
+        #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+            pxTaskStatus->pxTopOfStack = ( StackType_t * ) pxTCB->pxTopOfStack;
+            pxTaskStatus->pxEndOfStack = pxTCB->pxEndOfStack;
+        #endif
+        pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
 
-    #if ( configNUMBER_OF_CORES > 1 )  // SMP多核心场景
-    {
-        /* SMP all cores start up in the idle task. This initial yield gets the application
-         * tasks started. */
-        taskYIELD();
-    }
-    #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+        #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+        {
+            pxTaskStatus->uxCoreAffinityMask = pxTCB->uxCoreAffinityMask;
+        }
+        #endif
 
-    // 空闲任务主循环（configCONTROL_INFINITE_LOOP()是端口无关的无限循环宏，通常为for(;;)）
-    for( ; configCONTROL_INFINITE_LOOP(); )
-    {
-         /* 检查是否有任务自删除——若有，空闲任务需负责释放被删除任务的TCB（任务控制块）和栈内存。
-         * （注：任务调用vTaskDelete()后不会立即释放资源，仅标记为“待清理”，由空闲任务异步处理） */
-        prvCheckTasksWaitingTermination();
+        #if ( configUSE_MUTEXES == 1 )
+        {
+            pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
+        }
+        #else
+        {
+            pxTaskStatus->uxBasePriority = 0;
+        }
+        #endif
 
-        #if ( configUSE_PREEMPTION == 0 )
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
         {
-            /* 若禁用抢占，需主动触发任务切换以检查是否有其他任务就绪。
-             * 若启用抢占，就绪任务会自动抢占CPU，无需此操作。 */
-            taskYIELD();
+            pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
         }
-        #endif /* configUSE_PREEMPTION */
+        #else
+        {
+            pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
+        }
+        #endif
+
+        /* Obtaining the task state is a little fiddly, so is only done if the
+         * value of eState passed into this function is eInvalid - otherwise the
+         * state is just set to whatever is passed in. */
+        if( eState != eInvalid )
+        {
+            if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+            {
+                pxTaskStatus->eCurrentState = eRunning;
+            }
+            else
+            {
+                pxTaskStatus->eCurrentState = eState;
+
+                #if ( INCLUDE_vTaskSuspend == 1 )
+                {
+                    /* If the task is in the suspended list then there is a
+                     *  chance it is actually just blocked indefinitely - so really
+                     *  it should be reported as being in the Blocked state. */
+                    if( eState == eSuspended )
+                    {
+                        vTaskSuspendAll();
+                        {
+                            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                            {
+                                pxTaskStatus->eCurrentState = eBlocked;
+                            }
+                            else
+                            {
+                                #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                                {
+                                    BaseType_t x;
+
+                                    /* The task does not appear on the event list item of
+                                     * and of the RTOS objects, but could still be in the
+                                     * blocked state if it is waiting on its notification
+                                     * rather than waiting on an object.  If not, is
+                                     * suspended. */
+                                    for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+                                    {
+                                        if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+                                        {
+                                            pxTaskStatus->eCurrentState = eBlocked;
+                                            break;
+                                        }
+                                    }
+                                }
+                                #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+                            }
+                        }
+                        ( void ) xTaskResumeAll();
+                    }
+                }
+                #endif /* INCLUDE_vTaskSuspend */
 
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) // 启用抢占且空闲任务需让步
-        {
-            /* 启用抢占时，同优先级任务会按时间片调度。
-             * 若有其他同优先级（空闲优先级）的任务就绪，空闲任务应在当前时间片结束前主动让步。
-             *
-             * 此处无需临界区：仅读取就绪链表长度，偶发的错误值不影响整体逻辑。
-             * 若空闲优先级就绪链表的长度 > 核心数（每个核心对应1个空闲任务），
-             * 说明存在非空闲任务就绪，需触发切换。 */
-            if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
-            {
-                taskYIELD();
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
+                /* Tasks can be in pending ready list and other state list at the
+                 * same time. These tasks are in ready state no matter what state
+                 * list the task is in. */
+                taskENTER_CRITICAL();
+                {
+                    if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) != pdFALSE )
+                    {
+                        pxTaskStatus->eCurrentState = eReady;
+                    }
+                }
+                taskEXIT_CRITICAL();
             }
         }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
-
-        #if ( configUSE_IDLE_HOOK == 1 )
+        else
         {
-            /* 在空闲任务中调用用户定义的钩子函数。
-             * （注：钩子函数需轻量化，不可阻塞或调用可能导致阻塞的API，如vTaskDelay()） */
-            vApplicationIdleHook();
+            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
         }
-        #endif /* configUSE_IDLE_HOOK */
 
-        /* 条件编译使用“!=0”而非“==1”，确保当用户自定义低功耗模式需将configUSE_TICKLESS_IDLE设为
-         * 非1值时，仍能调用portSUPPRESS_TICKS_AND_SLEEP()。 */
-        #if ( configUSE_TICKLESS_IDLE != 0 )
+        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
+         * parameter is provided to allow it to be skipped. */
+        if( xGetFreeStackSpace != pdFALSE )
         {
-            TickType_t xExpectedIdleTime;
-
-            /* 不希望在空闲任务每次循环都挂起/恢复调度器，因此先在调度器未挂起时
-             * 初步计算预计空闲时间（此结果可能因任务就绪而失效）。 */
-            xExpectedIdleTime = prvGetExpectedIdleTime();
-
-            // 若预计空闲时间 >= 进入低功耗前的最小空闲时间阈值
-            if( xExpectedIdleTime >= ( TickType_t ) configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+            #if ( configUSE_STACK_WATERMARK == 1 )
             {
-                vTaskSuspendAll();
-                {
-                    /* 调度器挂起后，重新采样预计空闲时间（此结果可靠，无任务干扰）。 */
-                    configASSERT( xNextTaskUnblockTime >= xTickCount );
-                    xExpectedIdleTime = prvGetExpectedIdleTime();
-
-                    /* 若应用不希望调用portSUPPRESS_TICKS_AND_SLEEP()，可定义此宏将xExpectedIdleTime设为0。
-                     * （用于自定义低功耗触发逻辑） */
-                    configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
-
-                    // 再次确认预计空闲时间满足阈值
-                    if( xExpectedIdleTime >= ( TickType_t ) configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
-                    {
-                        traceLOW_POWER_IDLE_BEGIN();
-                        portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime ); // 进入低功耗模式（端口实现）
-                        traceLOW_POWER_IDLE_END();
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
-                ( void ) xTaskResumeAll();
+                pxTaskStatus->usStackHighWaterMark = prvTaskGetWatermarkFreeStackSpace( pxTCB );
             }
-            else
+            #elif ( portSTACK_GROWTH > 0 )
             {
-                mtCOVERAGE_TEST_MARKER();
+                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
             }
+            #else
+            {
+                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+            }
+            #endif
         }
-        #endif /* configUSE_TICKLESS_IDLE */
-
-        #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PASSIVE_IDLE_HOOK == 1 ) ) // SMP且启用被动空闲钩子
+        else
         {
-            /* 在空闲任务中调用用户定义的被动空闲钩子函数。
-             * 允许应用在无额外任务开销的情况下添加后台功能。
-             *
-             * 此钩子用于管理核心活动（如禁用空闲核心以降低功耗）。
-             * 注意：vApplicationPassiveIdleHook()在任何情况下都不得调用可能阻塞的函数！ */
-            vApplicationPassiveIdleHook();
+            pxTaskStatus->usStackHighWaterMark = 0;
         }
-        #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PASSIVE_IDLE_HOOK == 1 ) ) */
+
+        traceRETURN_vTaskGetInfo();
     }
-}
+
+#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-// 仅当启用无滴答低功耗模式时编译该函数
-#if ( configUSE_TICKLESS_IDLE != 0 )
+#if ( configUSE_TRACE_FACILITY == 1 )
 
-    // 确认当前系统状态是否允许进入低功耗模式，返回低功耗状态类型
-    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
+                                                     List_t * pxList,
+                                                     eTaskState eState )
     {
-        #if ( INCLUDE_vTaskSuspend == 1 )
-            /* 系统中除应用任务外，还存在空闲任务（每个核心1个）。
-             * uxNonApplicationTasks = 核心数（所有空闲任务均为非应用任务） */
-            const UBaseType_t uxNonApplicationTasks = configNUMBER_OF_CORES;
-        #endif /* INCLUDE_vTaskSuspend */
-
-        eSleepModeStatus eReturn = eStandardSleep; // 默认返回“标准低功耗模式”
-
-        traceENTER_eTaskConfirmSleepModeStatus();
-
-        /* 此函数必须在临界区中调用。 */
+        UBaseType_t uxTask = 0;
+        const ListItem_t * pxEndMarker = listGET_END_MARKER( pxList );
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB = NULL;
 
-        // 场景1：挂起就绪链表非空（调度器挂起时，有任务被标记为“待就绪”）
-        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0U )
-        {
-            /* 调度器挂起期间，已有任务变为就绪状态（需立即处理，不可进入低功耗） */
-            eReturn = eAbortSleep;  // 返回“中止低功耗”
-        }
-        // 场景2：当前核心存在挂起的切换请求
-        else if( xYieldPendings[ portGET_CORE_ID() ] != pdFALSE )
-        {
-            /* 调度器挂起期间，已有切换请求被挂起（需立即处理切换，不可进入低功耗） */
-            eReturn = eAbortSleep;
-        }
-        // 场景3：存在未处理的滴答中断（xPendedTicks记录pending的滴答数）
-        else if( xPendedTicks != 0U )
+        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
         {
-            /* 滴答中断已触发，但因调度器挂起而被挂起（需先处理滴答，不可进入低功耗） */
-            eReturn = eAbortSleep;
-        }
-
-        #if ( INCLUDE_vTaskSuspend == 1 )
-            // 场景4：所有应用任务均处于挂起状态（无任务等待超时）
-            else if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+            /* Populate an TaskStatus_t structure within the
+             * pxTaskStatusArray array for each task that is referenced from
+             * pxList.  See the definition of TaskStatus_t in task.h for the
+             * meaning of each TaskStatus_t structure member. */
+            for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
             {
-                /* 若所有任务都在挂起链表中（可能是无限阻塞，而非显式挂起），
-                 * 则可安全关闭所有时钟，仅等待外部中断唤醒（无需关注超时） */
-                eReturn = eNoTasksWaitingTimeout;
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+                vTaskGetInfo( ( TaskHandle_t ) pxTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+                uxTask++;
             }
-        #endif /* INCLUDE_vTaskSuspend */
+        }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_eTaskConfirmSleepModeStatus( eReturn );
-
-        return eReturn;
+        return uxTask;
     }
 
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-// 仅当配置了TLS指针数量（configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0）时编译该函数
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) && ( configUSE_STACK_WATERMARK == 0 ) )
 
-    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
-                                            BaseType_t xIndex,
-                                            void * pvValue )
+    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
     {
-        TCB_t * pxTCB;
-
-        traceENTER_vTaskSetThreadLocalStoragePointer( xTaskToSet, xIndex, pvValue );
+        configSTACK_DEPTH_TYPE uxCount = 0U;
 
-        if( ( xIndex >= 0 ) &&
-            ( xIndex < ( BaseType_t ) configNUM_THREAD_LOCAL_STORAGE_POINTERS ) )
+        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToSet );
-            configASSERT( pxTCB != NULL );
-            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+            pucStackByte -= portSTACK_GROWTH;
+            uxCount++;
         }
 
-        traceRETURN_vTaskSetThreadLocalStoragePointer();
+        uxCount /= ( configSTACK_DEPTH_TYPE ) sizeof( StackType_t );
+
+        return uxCount;
     }
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+#endif /* ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) && ( configUSE_STACK_WATERMARK == 0 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
 
-    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
-                                               BaseType_t xIndex )
+    static StackType_t prvStackCanaryValue( const TCB_t * pxTCB )
     {
-        void * pvReturn = NULL;
-        TCB_t * pxTCB;
+        StackType_t xCanary;
 
-        traceENTER_pvTaskGetThreadLocalStoragePointer( xTaskToQuery, xIndex );
+        #ifdef configSTACK_CANARY_RANDOM
+        {
+            ( void ) pxTCB;
+            xCanary = ( StackType_t ) configSTACK_CANARY_RANDOM();
+        }
+        #else
+        {
+            size_t x;
 
-        if( ( xIndex >= 0 ) &&
-            ( xIndex < ( BaseType_t ) configNUM_THREAD_LOCAL_STORAGE_POINTERS ) )
+            /* 没有硬件随机数时用 xorshift32，并混入 TCB 地址和节拍计数，
+             * 使不同任务、不同次运行的金丝雀值不同。StackType_t 比 32 位宽时多取几次。 */
+            ulStackCanarySeed ^= ( uint32_t ) ( portPOINTER_SIZE_TYPE ) pxTCB ^ ( uint32_t ) xTickCount;
+            xCanary = 0;
+
+            for( x = 0; x < sizeof( StackType_t ); x += sizeof( uint32_t ) )
+            {
+                ulStackCanarySeed ^= ulStackCanarySeed << 13;
+                ulStackCanarySeed ^= ulStackCanarySeed >> 17;
+                ulStackCanarySeed ^= ulStackCanarySeed << 5;
+
+                /* 分几次移位，StackType_t 只有 32 位时不会一次移出整个宽度。 */
+                xCanary = ( StackType_t ) ( ( ( xCanary << 8 ) << 8 ) << 8 ) << 8;
+                xCanary ^= ( StackType_t ) ulStackCanarySeed;
+            }
+        }
+        #endif /* configSTACK_CANARY_RANDOM */
+
+        if( xCanary == taskSTACK_FILL_WORD )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+            /* 金丝雀等于填充值时无法发现写入填充值的溢出。 */
+            xCanary ^= ( StackType_t ) 1U;
         }
         else
         {
-            pvReturn = NULL;
+            mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_pvTaskGetThreadLocalStoragePointer( pvReturn );
-
-        return pvReturn;
+        return xCanary;
     }
-
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
 /*-----------------------------------------------------------*/
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
-
-    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
-                                  const MemoryRegion_t * const pxRegions )
+    static void prvCheckNextStackGuard( void )
     {
         TCB_t * pxTCB;
+        const StackType_t * pxGuard;
+        UBaseType_t x;
 
-        traceENTER_vTaskAllocateMPURegions( xTaskToModify, pxRegions );
+        /* 在节拍中断中调用，xAllTasksList 不会同时被修改。 */
+        if( pxStackGuardTCB == NULL )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxStackGuardTCB = ( listLIST_IS_EMPTY( &xAllTasksList ) == pdFALSE ) ? listGET_OWNER_OF_HEAD_ENTRY( &xAllTasksList ) : NULL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-        /* If null is passed in here then we are modifying the MPU settings of
-         * the calling task. */
-        pxTCB = prvGetTCBFromHandle( xTaskToModify );
+        pxTCB = pxStackGuardTCB;
 
-        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), pxRegions, NULL, 0 );
+        if( pxTCB != NULL )
+        {
+            if( listGET_NEXT( &( pxTCB->xAllTasksListItem ) ) != listGET_END_MARKER( &xAllTasksList ) )
+            {
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxStackGuardTCB = listGET_LIST_ITEM_OWNER( listGET_NEXT( &( pxTCB->xAllTasksListItem ) ) );
+            }
+            else
+            {
+                pxStackGuardTCB = NULL;
+            }
 
-        traceRETURN_vTaskAllocateMPURegions();
+            pxGuard = taskSTACK_GUARD_START( pxTCB );
+
+            for( x = 0; x < ( UBaseType_t ) taskSTACK_GUARD_WORDS; x++ )
+            {
+                if( &( pxGuard[ x ] ) == taskSTACK_CANARY_LOCATION( pxTCB ) )
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+                else if( pxGuard[ x ] != taskSTACK_FILL_WORD )
+                {
+                    vApplicationStackOverflowHook( ( TaskHandle_t ) pxTCB, pxTCB->pcTaskName );
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
 
-#endif /* portUSING_MPU_WRAPPERS */
+#endif /* configCHECK_FOR_STACK_OVERFLOW == 3 */
 /*-----------------------------------------------------------*/
 
-// 初始化FreeRTOS所有核心任务链表（就绪链表、延迟链表、挂起链表等）
-static void prvInitialiseTaskLists( void )
-{
-    UBaseType_t uxPriority;
-
-    // 1. 初始化“就绪任务链表”：为每个优先级创建一个就绪链表
-    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
-    {
-        // 初始化当前优先级对应的就绪链表（pxReadyTasksLists是数组，每个元素对应一个优先级的就绪链表）
-        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
-    }
-
-    // 2. 初始化“延迟任务链表”：2个延迟链表用于处理xTickCount溢出（双缓冲机制）
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
-    // 3. 初始化“挂起就绪链表”：临时存储调度器挂起期间被唤醒的任务
-    vListInitialise( &xPendingReadyList );
+#if ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) && ( configUSE_STACK_WATERMARK == 1 ) )
 
-    #if ( INCLUDE_vTaskDelete == 1 ) // 若启用任务删除功能
+    static configSTACK_DEPTH_TYPE prvTaskGetWatermarkFreeStackSpace( const TCB_t * pxTCB )
     {
-        // 4. 初始化“待终止任务链表”：存储调用vTaskDelete()后待清理的任务
-        vListInitialise( &xTasksWaitingTermination );
-    }
-    #endif /* INCLUDE_vTaskDelete */
+        /* 记录只会向更深处移动，读一次指针即可，不需要临界区。 */
+        const StackType_t * const pxWatermark = pxTCB->pxStackWatermark;
 
-    #if ( INCLUDE_vTaskSuspend == 1 )  // 若启用任务挂起功能
-    {
-        // 5. 初始化“挂起任务链表”：存储调用vTaskSuspend()显式挂起的任务
-        vListInitialise( &xSuspendedTaskList );
+        #if ( portSTACK_GROWTH < 0 )
+        {
+            return ( configSTACK_DEPTH_TYPE ) ( pxWatermark - pxTCB->pxStack );
+        }
+        #else
+        {
+            return ( configSTACK_DEPTH_TYPE ) ( pxTCB->pxEndOfStack - pxWatermark );
+        }
+        #endif
     }
-    #endif /* INCLUDE_vTaskSuspend */
 
-    /* 初始化延迟链表指针：
-     * - pxDelayedTaskList：当前活跃的延迟链表（用于添加/查询延迟任务）
-     * - pxOverflowDelayedTaskList：溢出备用延迟链表（xTickCount溢出时切换）
-     * 初始状态下，活跃链表使用xDelayedTaskList1，备用链表使用xDelayedTaskList2 */
-    pxDelayedTaskList = &xDelayedTaskList1;
-    pxOverflowDelayedTaskList = &xDelayedTaskList2;
-}
+#endif /* ( ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) && ( configUSE_STACK_WATERMARK == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-// 检查并清理“待终止任务链表”中的任务（释放TCB和栈内存）
-static void prvCheckTasksWaitingTermination( void )
-{
-     /** 此函数由RTOS空闲任务调用 **/
+#if ( configSTACK_WATERMARK_SCAN_WORDS > 0 )
 
-    #if ( INCLUDE_vTaskDelete == 1 )
+    static void prvStackWatermarkScanStep( void )
     {
-        TCB_t * pxTCB;
+        UBaseType_t uxWord;
+        BaseType_t xTaskDone = pdFALSE;
 
-        /* uxDeletedTasksWaitingCleanUp用于记录待清理任务数量，避免在空闲任务中过于频繁地进入临界区 */
-        while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+        taskENTER_CRITICAL();
         {
-            #if ( configNUMBER_OF_CORES == 1 )
+            if( ( pxStackScanTCB == NULL ) && ( listLIST_IS_EMPTY( &xAllTasksList ) == pdFALSE ) )
             {
-                taskENTER_CRITICAL();
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxStackScanTCB = listGET_OWNER_OF_HEAD_ENTRY( &xAllTasksList );
+                pxStackScanPosition = taskSTACK_SCAN_START( pxStackScanTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxStackScanTCB != NULL )
+            {
+                for( uxWord = 0; ( uxWord < ( UBaseType_t ) configSTACK_WATERMARK_SCAN_WORDS ) && ( xTaskDone == pdFALSE ); uxWord++ )
                 {
+                    if( taskSTACK_IS_DEEPER( pxStackScanPosition, pxStackScanTCB->pxStackWatermark ) == pdFALSE )
                     {
-                        /* MISRA规则11.5.3兼容处理（void指针赋值） */
-                        /* 详情参考：https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-                        /* coverity[misra_c_2012_rule_11_5_violation] */
-                        // 从“待终止任务链表”头部获取第一个待清理任务的TCB
-                        pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
-                        // 将该任务从链表中移除（xStateListItem是任务在状态链表中的节点）
-                        ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                        --uxCurrentNumberOfTasks;  // 系统总任务数减1
-                        --uxDeletedTasksWaitingCleanUp;  // 待清理任务数减1
+                        /* 已经扫到或越过记录的位置，比它更深的字都没有被用过，记录不变。扫描分多次进行，
+                         * 两次之间的任务切换可能把记录改得比当前位置更深，所以不能只比较相等。 */
+                        xTaskDone = pdTRUE;
+                    }
+                    else if( *pxStackScanPosition != taskSTACK_FILL_WORD )
+                    {
+                        /* 从最深端数起第一个被改写过的字，位置比记录的更深。 */
+                        pxStackScanTCB->pxStackWatermark = pxStackScanPosition;
+                        xTaskDone = pdTRUE;
+                    }
+                    else
+                    {
+                        pxStackScanPosition -= portSTACK_GROWTH;
                     }
                 }
-                taskEXIT_CRITICAL();
 
-                prvDeleteTCB( pxTCB );  // 释放TCB和栈内存（核心清理函数）
-            }
-            #else /* #if( configNUMBER_OF_CORES == 1 ) */
-            {
-                pxTCB = NULL;
-
-                taskENTER_CRITICAL();
+                if( xTaskDone != pdFALSE )
                 {
-                    /* For SMP, multiple idles can be running simultaneously
-                     * and we need to check that other idles did not cleanup while we were
-                     * waiting to enter the critical section. */
-                    if( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+                    if( listGET_NEXT( &( pxStackScanTCB->xAllTasksListItem ) ) != listGET_END_MARKER( &xAllTasksList ) )
                     {
                         /* MISRA Ref 11.5.3 [Void pointer assignment] */
                         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
                         /* coverity[misra_c_2012_rule_11_5_violation] */
-                        pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
-
-                        if( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING )
-                        {
-                            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                            --uxCurrentNumberOfTasks;
-                            --uxDeletedTasksWaitingCleanUp;
-                        }
-                        else
-                        {
-                            /* The TCB to be deleted still has not yet been switched out
-                             * by the scheduler, so we will just exit this loop early and
-                             * try again next time. */
-                            taskEXIT_CRITICAL();
-                            break;
-                        }
+                        pxStackScanTCB = listGET_LIST_ITEM_OWNER( listGET_NEXT( &( pxStackScanTCB->xAllTasksListItem ) ) );
+                        pxStackScanPosition = taskSTACK_SCAN_START( pxStackScanTCB );
+                    }
+                    else
+                    {
+                        pxStackScanTCB = NULL;
                     }
                 }
-                taskEXIT_CRITICAL();
-
-                if( pxTCB != NULL )
+                else
                 {
-                    prvDeleteTCB( pxTCB );
+                    mtCOVERAGE_TEST_MARKER();
                 }
             }
-            #endif /* #if( configNUMBER_OF_CORES == 1 ) */
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
+        taskEXIT_CRITICAL();
     }
-    #endif /* INCLUDE_vTaskDelete */
-}
+
+#endif /* configSTACK_WATERMARK_SCAN_WORDS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
 
-    void vTaskGetInfo( TaskHandle_t xTask,
-                       TaskStatus_t * pxTaskStatus,
-                       BaseType_t xGetFreeStackSpace,
-                       eTaskState eState )
+/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+ * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+ * user to determine the return type.  It gets around the problem of the value
+ * overflowing on 8-bit types without breaking backward compatibility for
+ * applications that expect an 8-bit return type. */
+    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
     {
         TCB_t * pxTCB;
+        configSTACK_DEPTH_TYPE uxReturn;
 
-        traceENTER_vTaskGetInfo( xTask, pxTaskStatus, xGetFreeStackSpace, eState );
-
-        /* xTask is NULL then get the state of the calling task. */
-        pxTCB = prvGetTCBFromHandle( xTask );
-
-        pxTaskStatus->xHandle = pxTCB;
-        pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
-        pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
-        pxTaskStatus->pxStackBase = pxTCB->pxStack;
-        #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
-            pxTaskStatus->pxTopOfStack = ( StackType_t * ) pxTCB->pxTopOfStack;
-            pxTaskStatus->pxEndOfStack = pxTCB->pxEndOfStack;
-        #endif
-        pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+        traceENTER_uxTaskGetStackHighWaterMark2( xTask );
 
-        #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
-        {
-            pxTaskStatus->uxCoreAffinityMask = pxTCB->uxCoreAffinityMask;
-        }
-        #endif
+        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
+         * allows the user to determine the return type.  It gets around the
+         * problem of the value overflowing on 8-bit types without breaking
+         * backward compatibility for applications that expect an 8-bit return
+         * type. */
 
-        #if ( configUSE_MUTEXES == 1 )
-        {
-            pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
-        }
-        #else
-        {
-            pxTaskStatus->uxBasePriority = 0;
-        }
-        #endif
+        pxTCB = prvGetTCBFromHandle( xTask );
 
-        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        #if ( configUSE_STACK_WATERMARK == 1 )
         {
-            pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+            uxReturn = prvTaskGetWatermarkFreeStackSpace( pxTCB );
         }
         #else
         {
-            pxTaskStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0;
-        }
-        #endif
+            uint8_t * pucEndOfStack;
 
-        /* Obtaining the task state is a little fiddly, so is only done if the
-         * value of eState passed into this function is eInvalid - otherwise the
-         * state is just set to whatever is passed in. */
-        if( eState != eInvalid )
-        {
-            if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+            #if portSTACK_GROWTH < 0
             {
-                pxTaskStatus->eCurrentState = eRunning;
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
             }
-            else
+            #else
             {
-                pxTaskStatus->eCurrentState = eState;
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            }
+            #endif
 
-                #if ( INCLUDE_vTaskSuspend == 1 )
-                {
-                    /* If the task is in the suspended list then there is a
-                     *  chance it is actually just blocked indefinitely - so really
-                     *  it should be reported as being in the Blocked state. */
-                    if( eState == eSuspended )
-                    {
-                        vTaskSuspendAll();
-                        {
-                            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                            {
-                                pxTaskStatus->eCurrentState = eBlocked;
-                            }
-                            else
-                            {
-                                #if ( configUSE_TASK_NOTIFICATIONS == 1 )
-                                {
-                                    BaseType_t x;
+            uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+        }
+        #endif
 
-                                    /* The task does not appear on the event list item of
-                                     * and of the RTOS objects, but could still be in the
-                                     * blocked state if it is waiting on its notification
-                                     * rather than waiting on an object.  If not, is
-                                     * suspended. */
-                                    for( x = ( BaseType_t ) 0; x < ( BaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
-                                    {
-                                        if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
-                                        {
-                                            pxTaskStatus->eCurrentState = eBlocked;
-                                            break;
-                                        }
-                                    }
-                                }
-                                #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
-                            }
-                        }
-                        ( void ) xTaskResumeAll();
-                    }
-                }
-                #endif /* INCLUDE_vTaskSuspend */
+        traceRETURN_uxTaskGetStackHighWaterMark2( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxTaskGetStackHighWaterMark( xTask );
 
-                /* Tasks can be in pending ready list and other state list at the
-                 * same time. These tasks are in ready state no matter what state
-                 * list the task is in. */
-                taskENTER_CRITICAL();
-                {
-                    if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) != pdFALSE )
-                    {
-                        pxTaskStatus->eCurrentState = eReady;
-                    }
-                }
-                taskEXIT_CRITICAL();
-            }
-        }
-        else
+        pxTCB = prvGetTCBFromHandle( xTask );
+
+        #if ( configUSE_STACK_WATERMARK == 1 )
         {
-            pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+            uxReturn = ( UBaseType_t ) prvTaskGetWatermarkFreeStackSpace( pxTCB );
         }
-
-        /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
-         * parameter is provided to allow it to be skipped. */
-        if( xGetFreeStackSpace != pdFALSE )
+        #else
         {
-            #if ( portSTACK_GROWTH > 0 )
+            uint8_t * pucEndOfStack;
+
+            #if portSTACK_GROWTH < 0
             {
-                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
             }
             #else
             {
-                pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+                pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
             }
             #endif
+
+            uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
         }
-        else
-        {
-            pxTaskStatus->usStackHighWaterMark = 0;
-        }
+        #endif
 
-        traceRETURN_vTaskGetInfo();
+        traceRETURN_uxTaskGetStackHighWaterMark( uxReturn );
+
+        return uxReturn;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( INCLUDE_vTaskDelete == 1 )
 
-    static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t * pxTaskStatusArray,
-                                                     List_t * pxList,
-                                                     eTaskState eState )
+    static void prvDeleteTCB( TCB_t * pxTCB )
     {
-        UBaseType_t uxTask = 0;
-        const ListItem_t * pxEndMarker = listGET_END_MARKER( pxList );
-        ListItem_t * pxIterator;
-        TCB_t * pxTCB = NULL;
+        /* 此调用专为TriCore处理器端口设计，必须位于vPortFree()调用之前。
+         * 也适用于需要静态分配和清理RAM的端口/演示工程。 */
+        portCLEAN_UP_TCB( pxTCB );  // 端口专用TCB清理（如TriCore的上下文清理）
 
-        if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
         {
-            /* Populate an TaskStatus_t structure within the
-             * pxTaskStatusArray array for each task that is referenced from
-             * pxList.  See the definition of TaskStatus_t in task.h for the
-             * meaning of each TaskStatus_t structure member. */
-            for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
-            {
-                /* MISRA Ref 11.5.3 [Void pointer assignment] */
-                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-                /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+            /* Free up the memory allocated for the task's TLS Block. */
+            configDEINIT_TLS_BLOCK( pxTCB->xTLSBlock );
+        }
+        #endif
 
-                vTaskGetInfo( ( TaskHandle_t ) pxTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
-                uxTask++;
+        // 场景1：仅支持动态分配，且不使用MPU包装器
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+        {
+            /* 任务只能是动态分配的——需同时释放栈内存和TCB */
+            #if ( configUSE_TASK_POOL == 1 )
+            {
+                prvTaskPoolFree( pxTCB );
+            }
+            #else
+            {
+                vPortFreeStack( pxTCB->pxStack );
+                vPortFree( pxTCB );
             }
+            #endif
         }
-        else
+        // 场景2：同时支持静态和动态分配（tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0）
+        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
         {
-            mtCOVERAGE_TEST_MARKER();
+            /* 任务可能是静态分配或动态分配，因此释放前需先检查分配方式 */
+            // 子场景2.1：栈和TCB均为动态分配
+            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+            {
+                /* 栈和TCB均为动态分配，需同时释放两者 */
+                #if ( configUSE_TASK_POOL == 1 )
+                {
+                    prvTaskPoolFree( pxTCB );
+                }
+                #else
+                {
+                    vPortFreeStack( pxTCB->pxStack );
+                    vPortFree( pxTCB );
+                }
+                #endif
+            }
+            // 子场景2.2：仅栈为静态分配，TCB为动态分配
+            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+            {
+                /* 仅栈是静态分配（无需释放），只需释放TCB */
+                vPortFree( pxTCB );
+            }
+            // 子场景2.3：栈和TCB均为静态分配
+            else
+            {
+                /* 栈和TCB均为静态分配（用户管理内存），无需释放 */
+                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-
-        return uxTask;
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if defined( taskUSE_GENERIC_BIT_SCAN ) && ( configUSE_READY_PRIORITY_BITMAP == 1 )
 
-    static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+    static UBaseType_t prvHighestSetBit( uint32_t ulBits )
     {
-        configSTACK_DEPTH_TYPE uxCount = 0U;
+        UBaseType_t uxBit = 0;
 
-        while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+        /* 二分查找，固定 5 步。 */
+        if( ( ulBits & 0xFFFF0000U ) != 0U )
         {
-            pucStackByte -= portSTACK_GROWTH;
-            uxCount++;
+            ulBits >>= 16;
+            uxBit += 16U;
         }
 
-        uxCount /= ( configSTACK_DEPTH_TYPE ) sizeof( StackType_t );
+        if( ( ulBits & 0x0000FF00U ) != 0U )
+        {
+            ulBits >>= 8;
+            uxBit += 8U;
+        }
 
-        return uxCount;
+        if( ( ulBits & 0x000000F0U ) != 0U )
+        {
+            ulBits >>= 4;
+            uxBit += 4U;
+        }
+
+        if( ( ulBits & 0x0000000CU ) != 0U )
+        {
+            ulBits >>= 2;
+            uxBit += 2U;
+        }
+
+        if( ( ulBits & 0x00000002U ) != 0U )
+        {
+            uxBit += 1U;
+        }
+
+        return uxBit;
     }
+/*-----------------------------------------------------------*/
+
+#endif /* taskUSE_GENERIC_BIT_SCAN && configUSE_READY_PRIORITY_BITMAP */
+
+#if defined( taskUSE_GENERIC_BIT_SCAN ) && ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    static UBaseType_t prvLowestSetBit( uint32_t ulBits )
+    {
+        /* 32 位 de Bruijn 序列：只保留最低置位位后乘以该序列，高 5 位就是查表的下标。 */
+        static const uint8_t ucDeBruijnBitPosition[ 32 ] =
+        {
+            0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+            31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+        };
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+        return ( UBaseType_t ) ucDeBruijnBitPosition[ ( uint32_t ) ( ( ulBits & ( 0U - ulBits ) ) * 0x077CB531U ) >> 27 ];
+    }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+#endif /* taskUSE_GENERIC_BIT_SCAN && configUSE_DELAYED_TASK_WHEEL */
 
-/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
- * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
- * user to determine the return type.  It gets around the problem of the value
- * overflowing on 8-bit types without breaking backward compatibility for
- * applications that expect an 8-bit return type. */
-    configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+#if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+
+static void prvResetNextTaskUnblockTime( void )
+{
+    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
     {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        configSTACK_DEPTH_TYPE uxReturn;
+        /* 当前延迟链表为空，将xNextTaskUnblockTime设为最大可能值（portMAX_DELAY）。
+         * 这样可以确保：在延迟链表添加任务前，“xTickCount >= xNextTaskUnblockTime”的判断几乎不会成立，
+         * 避免误唤醒无延迟任务的情况。 */
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        /* 当前延迟链表非空，获取链表头部任务的“链表项值”。
+         * 该值即为链表头部任务的唤醒时间——头部任务是最早需要从阻塞状态唤醒的任务。 */
+        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+    }
+}
 
-        traceENTER_uxTaskGetStackHighWaterMark2( xTask );
+#else /* configUSE_DELAYED_TASK_WHEEL */
 
-        /* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
-         * the same except for their return type.  Using configSTACK_DEPTH_TYPE
-         * allows the user to determine the return type.  It gets around the
-         * problem of the value overflowing on 8-bit types without breaking
-         * backward compatibility for applications that expect an 8-bit return
-         * type. */
+/* 使用时间轮时，xNextTaskUnblockTime 是时间轮下一次需要处理的节拍：
+ * 节拍轮中最早的非空槽、段轮中最早的非空段的起点、远期任务进入段轮范围的那个段的起点，
+ * 三者取最早。它不会晚于任何任务的唤醒时间，节拍轮中的任务则正好在唤醒时间被处理，
+ * 所以无节拍空闲模式下 vTaskStepTick() 也不会跳过任何需要处理的节拍。
+ * 当前节拍也计算在内：节拍计数回绕时，taskSWITCH_DELAYED_LISTS() 会在当前节拍被处理之前调用本函数。 */
+static void prvResetNextTaskUnblockTime( void )
+{
+    const TickType_t xConstTickCount = xTickCount;
+    const TickType_t xSlotNow = xConstTickCount & taskWHEEL_SLOT_MASK;
+    TickType_t xTicksToEvent;
+    TickType_t xOffset;
+    TickType_t xSegments;
+    List_t * pxFarList;
+    BaseType_t x;
 
-        pxTCB = prvGetTCBFromHandle( xTask );
+    /* 节拍轮：只有当前段内、当前节拍及之后的槽有意义。 */
+    xTicksToEvent = prvDelayedWheelFindSlot( 0, xSlotNow, ( TickType_t ) ( taskWHEEL_SLOTS - xSlotNow ) );
 
-        #if portSTACK_GROWTH < 0
-        {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
-        }
-        #else
+    /* 段轮：本段的槽只有在段起点、还没有展开时才可能非空，此时需要立即处理。 */
+    xOffset = prvDelayedWheelFindSlot( 1, taskWHEEL_SEGMENT( xConstTickCount ) & taskWHEEL_SLOT_MASK, taskWHEEL_SLOTS );
+
+    if( xOffset != portMAX_DELAY )
+    {
+        xOffset = ( xOffset == ( TickType_t ) 0 ) ? ( TickType_t ) 0 : ( TickType_t ) ( ( xOffset << configDELAYED_TASK_WHEEL_BITS ) - xSlotNow );
+
+        if( xOffset < xTicksToEvent )
         {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            xTicksToEvent = xOffset;
         }
-        #endif
+    }
 
-        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+    /* 远期延迟链表是有序的，只需看链表头何时进入段轮的范围。 */
+    for( x = 0; x < 2; x++ )
+    {
+        pxFarList = ( x == 0 ) ? pxDelayedTaskList : pxOverflowDelayedTaskList;
 
-        traceRETURN_uxTaskGetStackHighWaterMark2( uxReturn );
+        if( listLIST_IS_EMPTY( pxFarList ) == pdFALSE )
+        {
+            xSegments = taskWHEEL_SEGMENT_DISTANCE( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxFarList ), xConstTickCount );
 
-        return uxReturn;
+            if( xSegments < taskWHEEL_SLOTS )
+            {
+                xOffset = 0;
+            }
+            else
+            {
+                xOffset = ( TickType_t ) ( ( ( TickType_t ) ( xSegments - ( taskWHEEL_SLOTS - 1U ) ) << configDELAYED_TASK_WHEEL_BITS ) - xSlotNow );
+            }
+
+            if( xOffset < xTicksToEvent )
+            {
+                xTicksToEvent = xOffset;
+            }
+        }
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+    /* 与不使用时间轮时一样，回绕之后才发生的事件由 taskSWITCH_DELAYED_LISTS() 重新计算。 */
+    xOffset = ( TickType_t ) ( portMAX_DELAY - xConstTickCount );
+
+    if( xTicksToEvent > xOffset )
+    {
+        xNextTaskUnblockTime = portMAX_DELAY;
+    }
+    else
+    {
+        xNextTaskUnblockTime = xConstTickCount + xTicksToEvent;
+    }
+}
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+static TickType_t prvDelayedWheelFindSlot( UBaseType_t uxLevel,
+                                           TickType_t xFrom,
+                                           TickType_t xCount )
+{
+    TickType_t xReturn = portMAX_DELAY;
+    TickType_t xOffset = 0;
+    TickType_t xSlot;
+    TickType_t xSkip;
+    uint32_t ulMap;
 
-    UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+    /* 从 xFrom 槽开始按字查找，到最后一个槽后回到 0 号槽。 */
+    while( xOffset < xCount )
     {
-        TCB_t * pxTCB;
-        uint8_t * pucEndOfStack;
-        UBaseType_t uxReturn;
+        xSlot = ( xFrom + xOffset ) & taskWHEEL_SLOT_MASK;
+        ulMap = ulDelayedTaskWheelMap[ uxLevel ][ xSlot >> 5 ] >> ( xSlot & 31U );
 
-        traceENTER_uxTaskGetStackHighWaterMark( xTask );
+        if( ulMap == 0U )
+        {
+            /* 这个字中 xSlot 及之后的槽都是空的，跳到下一个字（槽数小于 32 时跳到 0 号槽）。 */
+            xSkip = ( TickType_t ) ( 32U - ( xSlot & 31U ) );
 
-        pxTCB = prvGetTCBFromHandle( xTask );
+            if( xSkip > ( taskWHEEL_SLOTS - xSlot ) )
+            {
+                xSkip = taskWHEEL_SLOTS - xSlot;
+            }
+
+            xOffset += xSkip;
+        }
+        else
+        {
+            xOffset += ( TickType_t ) taskLOWEST_SET_BIT( ulMap );
+
+            if( xOffset >= xCount )
+            {
+                break;
+            }
+
+            xSlot = ( xFrom + xOffset ) & taskWHEEL_SLOT_MASK;
+
+            if( listLIST_IS_EMPTY( &( xDelayedTaskWheel[ uxLevel ][ xSlot ] ) ) == pdFALSE )
+            {
+                xReturn = xOffset;
+                break;
+            }
+
+            /* 槽中的任务都已因事件提前离开阻塞态，清除位图中残留的标记后继续查找。 */
+            taskWHEEL_MAP_CLEAR( uxLevel, xSlot );
+        }
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayedWheelInsert( ListItem_t * const pxStateListItem )
+{
+    const TickType_t xConstTickCount = xTickCount;
+    const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxStateListItem );
+    const TickType_t xSegments = taskWHEEL_SEGMENT_DISTANCE( xTimeToWake, xConstTickCount );
+    TickType_t xSlot;
+    TickType_t xTicksToEvent;
+    TickType_t xTicksToWrap;
 
-        #if portSTACK_GROWTH < 0
+    if( xSegments == ( TickType_t ) 0 )
+    {
+        /* 唤醒时间在当前段内：放入节拍轮，唤醒时间那一拍直接处理。 */
+        xSlot = xTimeToWake & taskWHEEL_SLOT_MASK;
+        listINSERT_END( &( xDelayedTaskWheel[ 0 ][ xSlot ] ), pxStateListItem );
+        taskWHEEL_MAP_SET( 0, xSlot );
+        xTicksToEvent = ( TickType_t ) ( xTimeToWake - xConstTickCount );
+    }
+    else if( xSegments < taskWHEEL_SLOTS )
+    {
+        /* 唤醒时间在之后的段内：放入段轮，到该段起点时再展开到节拍轮。 */
+        xSlot = taskWHEEL_SEGMENT( xTimeToWake ) & taskWHEEL_SLOT_MASK;
+        listINSERT_END( &( xDelayedTaskWheel[ 1 ][ xSlot ] ), pxStateListItem );
+        taskWHEEL_MAP_SET( 1, xSlot );
+        xTicksToEvent = ( TickType_t ) ( ( TickType_t ) ( xSegments << configDELAYED_TASK_WHEEL_BITS ) - ( xConstTickCount & taskWHEEL_SLOT_MASK ) );
+    }
+    else
+    {
+        /* 超出时间轮的范围：和原来一样按唤醒时间有序插入延迟链表或溢出延迟链表。 */
+        if( xTimeToWake < xConstTickCount )
         {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+            vListInsert( pxOverflowDelayedTaskList, pxStateListItem );
         }
-        #else
+        else
         {
-            pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+            vListInsert( pxDelayedTaskList, pxStateListItem );
         }
-        #endif
 
-        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+        xTicksToEvent = ( TickType_t ) ( ( ( TickType_t ) ( xSegments - ( taskWHEEL_SLOTS - 1U ) ) << configDELAYED_TASK_WHEEL_BITS ) - ( xConstTickCount & taskWHEEL_SLOT_MASK ) );
+    }
+
+    /* 只有回绕之前的事件才需要更新，回绕之后的由 taskSWITCH_DELAYED_LISTS() 重新计算。 */
+    xTicksToWrap = ( TickType_t ) ( portMAX_DELAY - xConstTickCount );
+
+    if( ( xTicksToEvent <= xTicksToWrap ) &&
+        ( ( TickType_t ) ( xConstTickCount + xTicksToEvent ) < xNextTaskUnblockTime ) )
+    {
+        xNextTaskUnblockTime = xConstTickCount + xTicksToEvent;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddCurrentTaskToDelayedWheel( TickType_t xTimeToWake )
+{
+    const TickType_t xConstTickCount = xTickCount;
 
-        traceRETURN_uxTaskGetStackHighWaterMark( uxReturn );
+    /* 当前节拍的槽已经处理过了，唤醒时间等于当前节拍的任务放到下一拍，
+     * 和有序延迟链表一样在下一次节拍中断时被唤醒。 */
+    if( xTimeToWake == xConstTickCount )
+    {
+        xTimeToWake++;
+        listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
 
-        return uxReturn;
+    if( xTimeToWake < xConstTickCount )
+    {
+        traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST();
+    }
+    else
+    {
+        traceMOVED_TASK_TO_DELAYED_LIST();
     }
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+    prvDelayedWheelInsert( &( pxCurrentTCB->xStateListItem ) );
+}
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+static List_t * prvDelayedWheelAdvance( const TickType_t xConstTickCount )
+{
+    List_t * volatile pxSourceList; /* 原因见 xTaskIncrementTick() 中的 pxExpiredList。 */
+    ListItem_t * pxItem;
+    TickType_t xSlot;
+    BaseType_t x;
 
-    static void prvDeleteTCB( TCB_t * pxTCB )
+    /* 1. 远期延迟链表有序，链表头进入段轮范围后依次移入时间轮。 */
+    for( x = 0; x < 2; x++ )
     {
-        /* 此调用专为TriCore处理器端口设计，必须位于vPortFree()调用之前。
-         * 也适用于需要静态分配和清理RAM的端口/演示工程。 */
-        portCLEAN_UP_TCB( pxTCB );  // 端口专用TCB清理（如TriCore的上下文清理）
+        pxSourceList = ( x == 0 ) ? pxDelayedTaskList : pxOverflowDelayedTaskList;
 
-        #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
+        while( listLIST_IS_EMPTY( pxSourceList ) == pdFALSE )
         {
-            /* Free up the memory allocated for the task's TLS Block. */
-            configDEINIT_TLS_BLOCK( pxTCB->xTLSBlock );
-        }
-        #endif
+            pxItem = listGET_HEAD_ENTRY( pxSourceList );
 
-        // 场景1：仅支持动态分配，且不使用MPU包装器
-        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
-        {
-            /* 任务只能是动态分配的——需同时释放栈内存和TCB */
-            vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
-        }
-        // 场景2：同时支持静态和动态分配（tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0）
-        #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
-        {
-            /* 任务可能是静态分配或动态分配，因此释放前需先检查分配方式 */
-            // 子场景2.1：栈和TCB均为动态分配
-            if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
-            {
-                /* 栈和TCB均为动态分配，需同时释放两者 */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
-            }
-            // 子场景2.2：仅栈为静态分配，TCB为动态分配
-            else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
-            {
-                /* 仅栈是静态分配（无需释放），只需释放TCB */
-                vPortFree( pxTCB );
-            }
-            // 子场景2.3：栈和TCB均为静态分配
-            else
+            if( taskWHEEL_SEGMENT_DISTANCE( listGET_LIST_ITEM_VALUE( pxItem ), xConstTickCount ) >= taskWHEEL_SLOTS )
             {
-                /* 栈和TCB均为静态分配（用户管理内存），无需释放 */
-                configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
-                mtCOVERAGE_TEST_MARKER();
+                break;
             }
+
+            listREMOVE_ITEM( pxItem );
+            prvDelayedWheelInsert( pxItem );
         }
-        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
     }
 
-#endif /* INCLUDE_vTaskDelete */
-/*-----------------------------------------------------------*/
-
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+    /* 2. 到达段的起点：把段轮中属于本段的任务按唤醒时间分散到节拍轮。 */
+    if( ( xConstTickCount & taskWHEEL_SLOT_MASK ) == ( TickType_t ) 0 )
     {
-        /* 当前延迟链表为空，将xNextTaskUnblockTime设为最大可能值（portMAX_DELAY）。
-         * 这样可以确保：在延迟链表添加任务前，“xTickCount >= xNextTaskUnblockTime”的判断几乎不会成立，
-         * 避免误唤醒无延迟任务的情况。 */
-        xNextTaskUnblockTime = portMAX_DELAY;
+        xSlot = taskWHEEL_SEGMENT( xConstTickCount ) & taskWHEEL_SLOT_MASK;
+        pxSourceList = &( xDelayedTaskWheel[ 1 ][ xSlot ] );
+
+        while( listLIST_IS_EMPTY( pxSourceList ) == pdFALSE )
+        {
+            pxItem = listGET_HEAD_ENTRY( pxSourceList );
+            listREMOVE_ITEM( pxItem );
+            prvDelayedWheelInsert( pxItem );
+        }
+
+        taskWHEEL_MAP_CLEAR( 1, xSlot );
     }
     else
     {
-        /* 当前延迟链表非空，获取链表头部任务的“链表项值”。
-         * 该值即为链表头部任务的唤醒时间——头部任务是最早需要从阻塞状态唤醒的任务。 */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        mtCOVERAGE_TEST_MARKER();
     }
+
+    return &( xDelayedTaskWheel[ 0 ][ xConstTickCount & taskWHEEL_SLOT_MASK ] );
 }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
 // 如果启用了获取当前任务句柄功能，或者启用了互斥锁功能，或者是多核系统
@@ -7104,7 +9919,7 @@ static void prvResetNextTaskUnblockTime( void )
     {
         traceENTER_vTaskYieldWithinAPI();
 
-        if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+        if( ( portGET_CRITICAL_NESTING_COUNT() == 0U ) && ( taskOBJECT_CRITICAL_NESTING() == 0U ) )
         {
             portYIELD();
         }
@@ -7179,142 +9994,320 @@ static void prvResetNextTaskUnblockTime( void )
              * critical section. */
             if( portGET_CRITICAL_NESTING_COUNT() == 1U )
             {
-                portASSERT_IF_IN_ISR();
+                portASSERT_IF_IN_ISR();
+
+                /* 持有对象锁时不能在这里开中断让出处理器，切换推迟到对象临界区退出。 */
+                if( ( uxSchedulerSuspended == 0U ) && ( taskOBJECT_CRITICAL_NESTING() == 0U ) )
+                {
+                    /* The only time there would be a problem is if this is called
+                     * before a context switch and vTaskExitCritical() is called
+                     * after pxCurrentTCB changes. Therefore this should not be
+                     * used within vTaskSwitchContext(). */
+                    prvCheckForRunStateChange();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskEnterCritical();
+    }
+
+#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    UBaseType_t vTaskEnterCriticalFromISR( void )
+    {
+        UBaseType_t uxSavedInterruptStatus = 0;
+
+        traceENTER_vTaskEnterCriticalFromISR();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+
+            if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+            {
+                portGET_ISR_LOCK();
+            }
+
+            portINCREMENT_CRITICAL_NESTING_COUNT();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskEnterCriticalFromISR( uxSavedInterruptStatus );
+
+        return uxSavedInterruptStatus;
+    }
+
+#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+
+    void vTaskExitCritical( void )
+    {
+        traceENTER_vTaskExitCritical();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            /* If pxCurrentTCB->uxCriticalNesting is zero then this function
+             * does not match a previous call to vTaskEnterCritical(). */
+            configASSERT( pxCurrentTCB->uxCriticalNesting > 0U );
+
+            /* This function should not be called in ISR. Use vTaskExitCriticalFromISR
+             * to exit critical section from ISR. */
+            portASSERT_IF_IN_ISR();
+
+            if( pxCurrentTCB->uxCriticalNesting > 0U )
+            {
+                ( pxCurrentTCB->uxCriticalNesting )--;
+
+                if( pxCurrentTCB->uxCriticalNesting == 0U )
+                {
+                    portENABLE_INTERRUPTS();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskExitCritical();
+    }
+
+#endif /* #if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskExitCritical( void )
+    {
+        traceENTER_vTaskExitCritical();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            /* If critical nesting count is zero then this function
+             * does not match a previous call to vTaskEnterCritical(). */
+            configASSERT( portGET_CRITICAL_NESTING_COUNT() > 0U );
+
+            /* This function should not be called in ISR. Use vTaskExitCriticalFromISR
+             * to exit critical section from ISR. */
+            portASSERT_IF_IN_ISR();
+
+            if( portGET_CRITICAL_NESTING_COUNT() > 0U )
+            {
+                portDECREMENT_CRITICAL_NESTING_COUNT();
+
+                if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+                {
+                    BaseType_t xYieldCurrentTask;
+
+                    /* Get the xYieldPending stats inside the critical section. */
+                    xYieldCurrentTask = xYieldPendings[ portGET_CORE_ID() ];
+
+                    portRELEASE_ISR_LOCK();
+                    portRELEASE_TASK_LOCK();
+
+                    /* 仍处于对象临界区内时保持中断屏蔽，挂起的切换由
+                     * vTaskExitCriticalObject() 处理。 */
+                    if( taskOBJECT_CRITICAL_NESTING() == 0U )
+                    {
+                        portENABLE_INTERRUPTS();
+
+                        /* When a task yields in a critical section it just sets
+                         * xYieldPending to true. So now that we have exited the
+                         * critical section check if xYieldPending is true, and
+                         * if so yield. */
+                        if( xYieldCurrentTask != pdFALSE )
+                        {
+                            portYIELD();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskExitCritical();
+    }
+
+#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus )
+    {
+        traceENTER_vTaskExitCriticalFromISR( uxSavedInterruptStatus );
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            /* If critical nesting count is zero then this function
+             * does not match a previous call to vTaskEnterCritical(). */
+            configASSERT( portGET_CRITICAL_NESTING_COUNT() > 0U );
+
+            if( portGET_CRITICAL_NESTING_COUNT() > 0U )
+            {
+                portDECREMENT_CRITICAL_NESTING_COUNT();
 
-                if( uxSchedulerSuspended == 0U )
+                if( portGET_CRITICAL_NESTING_COUNT() == 0U )
                 {
-                    /* The only time there would be a problem is if this is called
-                     * before a context switch and vTaskExitCritical() is called
-                     * after pxCurrentTCB changes. Therefore this should not be
-                     * used within vTaskSwitchContext(). */
-                    prvCheckForRunStateChange();
+                    portRELEASE_ISR_LOCK();
+                    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
                 }
             }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskEnterCritical();
+        traceRETURN_vTaskExitCriticalFromISR();
     }
 
 #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
-
 /*-----------------------------------------------------------*/
 
-#if ( configNUMBER_OF_CORES > 1 )
+#if ( configUSE_GRANULAR_LOCKS == 1 )
 
-    UBaseType_t vTaskEnterCriticalFromISR( void )
+    void vTaskEnterCriticalObject( portSPINLOCK_TYPE * pxSpinlock )
     {
-        UBaseType_t uxSavedInterruptStatus = 0;
+        traceENTER_vTaskEnterCriticalObject( pxSpinlock );
 
-        traceENTER_vTaskEnterCriticalFromISR();
+        portDISABLE_INTERRUPTS();
 
         if( xSchedulerRunning != pdFALSE )
         {
-            uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
 
-            if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+            /* 对象锁排在内核中断锁之前，持有内核临界区时不能再获取对象锁。 */
+            configASSERT( portGET_CRITICAL_NESTING_COUNT() == 0U );
+
+            portGET_SPINLOCK( xCoreID, pxSpinlock );
+            uxObjectCriticalNesting[ xCoreID ]++;
+
+            if( uxObjectCriticalNesting[ xCoreID ] == 1U )
             {
-                portGET_ISR_LOCK();
+                portASSERT_IF_IN_ISR();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
-
-            portINCREMENT_CRITICAL_NESTING_COUNT();
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskEnterCriticalFromISR( uxSavedInterruptStatus );
-
-        return uxSavedInterruptStatus;
+        traceRETURN_vTaskEnterCriticalObject();
     }
 
-#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+#if ( configUSE_GRANULAR_LOCKS == 1 )
 
-    void vTaskExitCritical( void )
+    UBaseType_t vTaskEnterCriticalObjectFromISR( portSPINLOCK_TYPE * pxSpinlock )
     {
-        traceENTER_vTaskExitCritical();
+        UBaseType_t uxSavedInterruptStatus = 0;
+
+        traceENTER_vTaskEnterCriticalObjectFromISR( pxSpinlock );
 
         if( xSchedulerRunning != pdFALSE )
         {
-            /* If pxCurrentTCB->uxCriticalNesting is zero then this function
-             * does not match a previous call to vTaskEnterCritical(). */
-            configASSERT( pxCurrentTCB->uxCriticalNesting > 0U );
+            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
 
-            /* This function should not be called in ISR. Use vTaskExitCriticalFromISR
-             * to exit critical section from ISR. */
-            portASSERT_IF_IN_ISR();
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 
-            if( pxCurrentTCB->uxCriticalNesting > 0U )
-            {
-                ( pxCurrentTCB->uxCriticalNesting )--;
+            configASSERT( portGET_CRITICAL_NESTING_COUNT() == 0U );
 
-                if( pxCurrentTCB->uxCriticalNesting == 0U )
-                {
-                    portENABLE_INTERRUPTS();
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+            portGET_SPINLOCK( xCoreID, pxSpinlock );
+            uxObjectCriticalNesting[ xCoreID ]++;
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskExitCritical();
+        traceRETURN_vTaskEnterCriticalObjectFromISR( uxSavedInterruptStatus );
+
+        return uxSavedInterruptStatus;
     }
 
-#endif /* #if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) ) */
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configNUMBER_OF_CORES > 1 )
+#if ( configUSE_GRANULAR_LOCKS == 1 )
 
-    void vTaskExitCritical( void )
+    void vTaskExitCriticalObject( portSPINLOCK_TYPE * pxSpinlock )
     {
-        traceENTER_vTaskExitCritical();
+        traceENTER_vTaskExitCriticalObject( pxSpinlock );
 
         if( xSchedulerRunning != pdFALSE )
         {
-            /* If critical nesting count is zero then this function
-             * does not match a previous call to vTaskEnterCritical(). */
-            configASSERT( portGET_CRITICAL_NESTING_COUNT() > 0U );
+            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
 
-            /* This function should not be called in ISR. Use vTaskExitCriticalFromISR
-             * to exit critical section from ISR. */
+            /* 嵌套深度为 0 说明没有对应的 vTaskEnterCriticalObject()。 */
+            configASSERT( uxObjectCriticalNesting[ xCoreID ] > 0U );
             portASSERT_IF_IN_ISR();
 
-            if( portGET_CRITICAL_NESTING_COUNT() > 0U )
+            if( uxObjectCriticalNesting[ xCoreID ] > 0U )
             {
-                portDECREMENT_CRITICAL_NESTING_COUNT();
+                uxObjectCriticalNesting[ xCoreID ]--;
+                portRELEASE_SPINLOCK( xCoreID, pxSpinlock );
 
-                if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+                if( ( uxObjectCriticalNesting[ xCoreID ] == 0U ) && ( portGET_CRITICAL_NESTING_COUNT() == 0U ) )
                 {
                     BaseType_t xYieldCurrentTask;
 
-                    /* Get the xYieldPending stats inside the critical section. */
-                    xYieldCurrentTask = xYieldPendings[ portGET_CORE_ID() ];
+                    /* 对象临界区内唤醒的更高优先级任务只记录在 xYieldPendings 中，
+                     * 在这里开中断后补做切换。 */
+                    xYieldCurrentTask = xYieldPendings[ xCoreID ];
 
-                    portRELEASE_ISR_LOCK();
-                    portRELEASE_TASK_LOCK();
                     portENABLE_INTERRUPTS();
 
-                    /* When a task yields in a critical section it just sets
-                     * xYieldPending to true. So now that we have exited the
-                     * critical section check if xYieldPending is true, and
-                     * if so yield. */
                     if( xYieldCurrentTask != pdFALSE )
                     {
                         portYIELD();
@@ -7335,31 +10328,32 @@ static void prvResetNextTaskUnblockTime( void )
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskExitCritical();
+        traceRETURN_vTaskExitCriticalObject();
     }
 
-#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configNUMBER_OF_CORES > 1 )
+#if ( configUSE_GRANULAR_LOCKS == 1 )
 
-    void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus )
+    void vTaskExitCriticalObjectFromISR( UBaseType_t uxSavedInterruptStatus,
+                                         portSPINLOCK_TYPE * pxSpinlock )
     {
-        traceENTER_vTaskExitCriticalFromISR( uxSavedInterruptStatus );
+        traceENTER_vTaskExitCriticalObjectFromISR( uxSavedInterruptStatus, pxSpinlock );
 
         if( xSchedulerRunning != pdFALSE )
         {
-            /* If critical nesting count is zero then this function
-             * does not match a previous call to vTaskEnterCritical(). */
-            configASSERT( portGET_CRITICAL_NESTING_COUNT() > 0U );
+            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
 
-            if( portGET_CRITICAL_NESTING_COUNT() > 0U )
+            configASSERT( uxObjectCriticalNesting[ xCoreID ] > 0U );
+
+            if( uxObjectCriticalNesting[ xCoreID ] > 0U )
             {
-                portDECREMENT_CRITICAL_NESTING_COUNT();
+                uxObjectCriticalNesting[ xCoreID ]--;
+                portRELEASE_SPINLOCK( xCoreID, pxSpinlock );
 
-                if( portGET_CRITICAL_NESTING_COUNT() == 0U )
+                if( uxObjectCriticalNesting[ xCoreID ] == 0U )
                 {
-                    portRELEASE_ISR_LOCK();
                     portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
                 }
                 else
@@ -7377,10 +10371,10 @@ static void prvResetNextTaskUnblockTime( void )
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskExitCriticalFromISR();
+        traceRETURN_vTaskExitCriticalObjectFromISR();
     }
 
-#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
 /*-----------------------------------------------------------*/
 
 // 如果启用了任务统计信息格式化功能（configUSE_STATS_FORMATTING_FUNCTIONS > 0）
@@ -7475,7 +10469,15 @@ static void prvResetNextTaskUnblockTime( void )
         if( pxTaskStatusArray != NULL )
         {
             /* Generate the (binary) data. */
-            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+            #if ( configUSE_TASK_SNAPSHOT == 1 )
+            {
+                uxArraySize = prvGetSystemStateInChunks( pxTaskStatusArray, uxArraySize, NULL );
+            }
+            #else
+            {
+                uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+            }
+            #endif
 
             /* Create a human readable table from the binary data. */
             for( x = 0; x < uxArraySize; x++ )
@@ -7644,7 +10646,15 @@ static void prvResetNextTaskUnblockTime( void )
         if( pxTaskStatusArray != NULL )
         {
             /* Generate the (binary) data. */
-            uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+            #if ( configUSE_TASK_SNAPSHOT == 1 )
+            {
+                uxArraySize = prvGetSystemStateInChunks( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+            }
+            #else
+            {
+                uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+            }
+            #endif
 
             /* For percentage calculations. */
             ulTotalTime /= ( ( configRUN_TIME_COUNTER_TYPE ) 100U );
@@ -7820,6 +10830,184 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+
+    void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+
+        traceENTER_vTaskPriorityRaiseToCeiling( uxCeilingPriority );
+
+        configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        /* 调度器启动前获取互斥量时 pxCurrentTCB 可能为 NULL。优先级已经不低于天花板时
+         * （基础优先级高于天花板，或者持有的其它互斥量已经提升过）保持不变。 */
+        if( ( pxTCB != NULL ) && ( pxTCB->uxPriority < uxCeilingPriority ) )
+        {
+            if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0U ) )
+            {
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxCeilingPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* 调用方是正在运行的任务，它在自己优先级的就绪列表中，移到天花板优先级的就绪列表。
+             * 只提升 uxPriority，uxBasePriority 不变，释放最后一个互斥量时由
+             * xTaskPriorityDisinherit() 恢复。提升的是自己的优先级，不需要切换任务。 */
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceTASK_PRIORITY_CEILING( pxTCB, uxCeilingPriority );
+
+            pxTCB->uxPriority = uxCeilingPriority;
+            prvAddTaskToReadyList( pxTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskPriorityRaiseToCeiling();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPriorityDisinheritCeiling( TaskHandle_t const pxMutexHolder )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xTaskPriorityDisinheritCeiling( pxMutexHolder );
+
+        xReturn = xTaskPriorityDisinherit( pxMutexHolder );
+
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            /* xTaskPriorityDisinherit() 恢复了基础优先级就返回 pdTRUE，但天花板优先级是任务获取互斥量时
+             * 自己提升的，不是因为有任务在等待而继承的，释放时只有持有期间就绪、优先级高于基础优先级的
+             * 任务才需要立即运行。调用者在临界区中，持有者就是当前任务。 */
+            if( xReturn != pdFALSE )
+            {
+                UBaseType_t uxTopPriority;
+
+                #if ( configUSE_READY_PRIORITY_BITMAP == 1 )
+                {
+                    UBaseType_t uxTopGroup = taskHIGHEST_SET_BIT( ulReadyPriorityGroupMap );
+                    uxTopPriority = ( uxTopGroup << 5 ) + taskHIGHEST_SET_BIT( ulReadyPriorityMap[ uxTopGroup ] );
+                }
+                #elif ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+                {
+                    /* uxTopReadyPriority 只是上限，持有期间它停在天花板优先级，向下查找到非空的就绪链表。 */
+                    while( ( uxTopReadyPriority > pxCurrentTCB->uxPriority ) &&
+                           ( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopReadyPriority ] ) ) != pdFALSE ) )
+                    {
+                        --uxTopReadyPriority;
+                    }
+
+                    uxTopPriority = uxTopReadyPriority;
+                }
+                #else
+                {
+                    portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+                }
+                #endif
+
+                if( uxTopPriority <= pxCurrentTCB->uxPriority )
+                {
+                    xReturn = pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* if ( configNUMBER_OF_CORES == 1 ) */
+
+        traceRETURN_xTaskPriorityDisinheritCeiling( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_PRIORITY_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_SEMAPHORE_FAST_PATH == 1 ) )
+
+    BaseType_t xTaskDecrementMutexHeldCount( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskDecrementMutexHeldCount();
+
+        configASSERT( pxTCB->uxMutexesHeld );
+
+        /* 继承了优先级时，恢复优先级要修改就绪列表，交给 xTaskPriorityDisinherit() 在临界区内完成。
+         * 互斥量已经释放，此后不会再有任务通过它把优先级继承给当前任务。 */
+        if( pxTCB->uxPriority == pxTCB->uxBasePriority )
+        {
+            ( pxTCB->uxMutexesHeld )--;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xTaskDecrementMutexHeldCount( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_SEMAPHORE_FAST_PATH == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+
+    BaseType_t xTaskIsRunningOnOtherCore( TaskHandle_t xTask )
+    {
+        const TCB_t * const pxTCB = xTask;
+        BaseType_t xTaskRunState;
+        BaseType_t xReturn;
+
+        traceENTER_xTaskIsRunningOnOtherCore( xTask );
+
+        configASSERT( pxTCB );
+
+        /* 只读一次运行状态，不进入临界区：读到之后任务可能马上被切换出去，调用方据此决定是否
+         * 继续自旋，判断错误只会多自旋一段或提前阻塞。 */
+        xTaskRunState = pxTCB->xTaskRunState;
+
+        if( ( xTaskRunState >= ( BaseType_t ) 0 ) &&
+            ( xTaskRunState < ( BaseType_t ) configNUMBER_OF_CORES ) &&
+            ( xTaskRunState != ( BaseType_t ) portGET_CORE_ID() ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xTaskIsRunningOnOtherCore( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_ADAPTIVE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 // 如果启用了任务通知功能（configUSE_TASK_NOTIFICATIONS == 1）
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
@@ -8318,7 +11506,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8436,7 +11624,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) || ( taskEDF_SHOULD_PREEMPT( pxTCB ) ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8719,6 +11907,14 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
              * 延迟链表按“唤醒时间升序”排序，确保最早唤醒的任务排在链表头部，便于调度器快速查找 */
             listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                prvAddCurrentTaskToDelayedWheel( xTimeToWake );
+                ( void ) pxDelayedList;
+                ( void ) pxOverflowDelayedList;
+            }
+            #else /* configUSE_DELAYED_TASK_WHEEL */
+
             /* 判断唤醒时间是否溢出：
              * 若xTimeToWake < xConstTickCount，说明系统节拍计数溢出（如uint32_t从0xFFFFFFFF加1变为0） */
             if( xTimeToWake < xConstTickCount )
@@ -8746,6 +11942,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
         }
     }
     #else /* INCLUDE_vTaskSuspend */
@@ -8756,6 +11953,14 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         /* 设置链表项值为唤醒时间，用于延迟链表排序 */
         listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+        #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        {
+            prvAddCurrentTaskToDelayedWheel( xTimeToWake );
+            ( void ) pxDelayedList;
+            ( void ) pxOverflowDelayedList;
+        }
+        #else /* configUSE_DELAYED_TASK_WHEEL */
+
         /* 判断唤醒时间是否溢出，分发到对应延迟链表 */
         if( xTimeToWake < xConstTickCount )
         {
@@ -8781,6 +11986,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                 mtCOVERAGE_TEST_MARKER();
             }
         }
+        #endif /* configUSE_DELAYED_TASK_WHEEL */
 
         /* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
         ( void ) xCanBlockIndefinitely;
@@ -8934,6 +12140,12 @@ void vTaskResetState( void )
     uxCurrentNumberOfTasks = ( UBaseType_t ) 0U;
     xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
     uxTopReadyPriority = tskIDLE_PRIORITY;
+    #if ( configUSE_READY_PRIORITY_BITMAP == 1 )
+    {
+        ( void ) memset( ulReadyPriorityMap, 0x00, sizeof( ulReadyPriorityMap ) );
+        ulReadyPriorityGroupMap = 0U;
+    }
+    #endif
     xSchedulerRunning = pdFALSE;
     xPendedTicks = ( TickType_t ) 0U;
 
@@ -8943,9 +12155,34 @@ void vTaskResetState( void )
     }
 
     xNumOfOverflows = ( BaseType_t ) 0;
+    taskPUBLISH_TICK_COUNT();
     uxTaskNumber = ( UBaseType_t ) 0U;
     xNextTaskUnblockTime = ( TickType_t ) 0U;
 
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        xNextBudgetReplenishTime = ( TickType_t ) 0U;
+    }
+    #endif
+
+    #if ( configUSE_TASK_NAME_INDEX == 1 )
+    {
+        ( void ) memset( pxTaskNameIndex, 0x00, sizeof( pxTaskNameIndex ) );
+    }
+    #endif
+
+    #if ( configSTACK_WATERMARK_SCAN_WORDS > 0 )
+    {
+        pxStackScanTCB = NULL;
+    }
+    #endif
+
+    #if ( configCHECK_FOR_STACK_OVERFLOW == 3 )
+    {
+        pxStackGuardTCB = NULL;
+    }
+    #endif
+
     uxSchedulerSuspended = ( UBaseType_t ) 0U;
 
     #if ( configGENERATE_RUN_TIME_STATS == 1 )
@@ -34,7 +34,7 @@
     #error "include FreeRTOS.h must appear in source files before include task.h"
 #endif
 
-#include "list.h"
+#include "List.h"
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -172,6 +172,31 @@ typedef struct xTASK_STATUS
     #endif
 } TaskStatus_t;
 
+/* 分段读取任务状态的游标，由 vTaskSnapshotBegin() 初始化，成员只供内核使用。 */
+typedef struct xTASK_SNAPSHOT
+{
+    UBaseType_t uxTaskNumber;                   /* 开始读取时的 uxTaskNumber，创建或删除任务后会变化。 */
+    void * pvNextTask;                          /* 下一段从哪个任务开始读取，NULL 表示已经读完。 */
+    configRUN_TIME_COUNTER_TYPE ulTotalRunTime; /* 最近一次 eTaskSnapshotRead() 时的总运行时间。 */
+} TaskSnapshot_t;
+
+/* eTaskSnapshotRead() 的返回值。 */
+typedef enum
+{
+    eTaskSnapshotMore = 0, /* 还有任务没有读取。 */
+    eTaskSnapshotComplete, /* 所有任务都已读取。 */
+    eTaskSnapshotChanged   /* 开始读取之后有任务被创建或删除：已读到的记录作废，游标已重新指向第一个任务。 */
+} eTaskSnapshotStatus;
+
+/* 与 uxTaskPoolGetStats() 一起使用，描述任务对象池中的一种规格。 */
+typedef struct xTASK_POOL_STATS
+{
+    configSTACK_DEPTH_TYPE uxStackDepth; /* 该规格的栈深度（字数），TCB 池为 0。 */
+    UBaseType_t uxObjects;               /* 已从堆分配的对象数。 */
+    UBaseType_t uxInUse;                 /* 正被任务使用的对象数。 */
+    UBaseType_t uxHighWater;             /* uxInUse 的历史最大值。 */
+} TaskPoolStats_t;
+
 /* eTaskConfirmSleepModeStatus()的可能返回值。 */
 // 定义睡眠模式状态枚举
 typedef enum
@@ -184,6 +209,13 @@ typedef enum
     #endif /* INCLUDE_vTaskSuspend */
 } eSleepModeStatus;
 
+/* 任务用完 CPU 预算后的处理方式，传给 vTaskSetBudget()。 */
+typedef enum
+{
+    eBudgetDemote = 0, /* 把任务降到 vTaskSetBudget() 指定的优先级，补充预算后恢复原优先级。 */
+    eBudgetSuspend     /* 挂起任务（eTaskGetState() 返回 eSuspended），补充预算后恢复就绪。 */
+} eBudgetAction;
+
 /**
  * 定义空闲任务（idle task）所使用的优先级。此宏的值不得修改。
  *
@@ -278,6 +310,26 @@ typedef enum
 // 3. 多核系统中使用portEXIT_CRITICAL_FROM_ISR(x)，处理更复杂的跨核心状态恢复；
 // 4. 必须在ISR中与对应的进入宏成对使用，确保中断状态正确恢复，避免系统异常。
 
+/**
+ * task.h
+ *
+ * 对象临界区（仅 configUSE_GRANULAR_LOCKS == 1 时可用）：屏蔽本核中断并获取指定对象的自旋锁，
+ * 而不获取内核的任务锁和中断锁。内核对象用它保护自身的数据，其他核心可以同时进入其它对象的临界区。
+ *
+ * 锁的获取顺序为：内核任务锁 -> 对象锁 -> 内核中断锁。对象临界区内可以嵌套
+ * taskENTER_CRITICAL_FROM_ISR() 以操作事件列表，但不能嵌套 taskENTER_CRITICAL()，
+ * 除非调用者已经通过挂起调度器持有了任务锁。对象临界区内请求的任务切换推迟到退出时执行。
+ *
+ * \defgroup taskENTER_CRITICAL_OBJECT taskENTER_CRITICAL_OBJECT
+ * \ingroup SchedulerControl
+ */
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    #define taskENTER_CRITICAL_OBJECT( pxSpinlock )                                 vTaskEnterCriticalObject( pxSpinlock )
+    #define taskEXIT_CRITICAL_OBJECT( pxSpinlock )                                  vTaskExitCriticalObject( pxSpinlock )
+    #define taskENTER_CRITICAL_OBJECT_FROM_ISR( pxSpinlock )                        vTaskEnterCriticalObjectFromISR( pxSpinlock )
+    #define taskEXIT_CRITICAL_OBJECT_FROM_ISR( uxSavedInterruptStatus, pxSpinlock ) vTaskExitCriticalObjectFromISR( uxSavedInterruptStatus, pxSpinlock )
+#endif
+
 /**
  * task.h  // 宏定义所在的头文件
  *
@@ -948,6 +1000,142 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
     BaseType_t xTaskAbortDelay( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task.h
+ * @code{c}
+ * void vTaskSetDeadline( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xRelativeDeadline );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_EDF_SCHEDULING 定义为 1，此函数才会生效。
+ *
+ * 把任务加入最早截止时间优先（EDF）调度类。优先级为 configEDF_PRIORITY 的就绪任务中，
+ * 绝对截止时间最早的任务先运行；截止时间更早的任务就绪时会抢占同一优先级的当前任务。
+ * 任务的优先级不会被修改，只有优先级（包括继承得到的优先级）等于 configEDF_PRIORITY 时才按截止时间调度。
+ *
+ * 调用后任务的绝对截止时间为“当前节拍 + xRelativeDeadline”；之后任务每次调用 xTaskDelayUntil()
+ * 开始新的周期时，绝对截止时间更新为“新周期的释放时间（即唤醒时间）+ xRelativeDeadline”。
+ * 若调用 xTaskDelayUntil() 时已经过了本周期的截止时间，会调用 traceTASK_DEADLINE_MISSED()。
+ *
+ * @param xTask 任务句柄，传入 NULL 表示调用者自身。
+ *
+ * @param xPeriod 任务的周期（节拍数），必须与传给 xTaskDelayUntil() 的 xTimeIncrement 相同，
+ * 否则 xTaskDelayUntil() 中的 configASSERT() 失败。
+ * 传入 0 表示任务退出 EDF 调度类：在 configEDF_PRIORITY 优先级中排在所有有截止时间的任务之后，
+ * 彼此之间按时间片轮转。
+ *
+ * @param xRelativeDeadline 相对截止时间（节拍数），不能大于 xPeriod；传入 0 表示等于周期。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vControlLoop( void * pvParameters )
+ * {
+ * const TickType_t xPeriod = pdMS_TO_TICKS( 10 );
+ * TickType_t xLastWakeTime;
+ *
+ *     // 周期 10ms，必须在释放后 8ms 内完成。
+ *     vTaskSetDeadline( NULL, xPeriod, pdMS_TO_TICKS( 8 ) );
+ *     xLastWakeTime = xTaskGetTickCount();
+ *
+ *     for( ;; )
+ *     {
+ *         vRunController();
+ *         xTaskDelayUntil( &xLastWakeTime, xPeriod );
+ *     }
+ * }
+ * @endcode
+ * \defgroup vTaskSetDeadline vTaskSetDeadline
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    void vTaskSetDeadline( TaskHandle_t xTask,
+                           TickType_t xPeriod,
+                           TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * TickType_t xTaskGetDeadline( TaskHandle_t xTask );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_EDF_SCHEDULING 定义为 1，此函数才会生效。
+ *
+ * @param xTask 任务句柄，传入 NULL 表示调用者自身。
+ *
+ * @return 任务当前周期的绝对截止时间（节拍计数）；任务不属于 EDF 调度类时返回 portMAX_DELAY。
+ *
+ * \defgroup xTaskGetDeadline xTaskGetDeadline
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    TickType_t xTaskGetDeadline( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * void vTaskSetBudget( TaskHandle_t xTask, TickType_t xBudget, TickType_t xPeriod, eBudgetAction eAction, UBaseType_t uxDemotedPriority );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_TASK_BUDGETS 定义为 1，此函数才会生效。
+ *
+ * 给任务设置 CPU 预算：从调用时刻开始，每 xPeriod 个节拍为一个补充周期，任务在一个周期内最多运行 xBudget 个节拍。
+ * 运行时间在节拍中断中按“节拍到来时正在运行的任务”计数。预算用完时调用 traceTASK_BUDGET_EXHAUSTED()，
+ * 并按 eAction 把任务降级或挂起，直到本周期结束时补充预算（调用 traceTASK_BUDGET_REPLENISHED()）。
+ *
+ * 降级只修改任务的基础优先级：任务若正持有互斥量并继承了更高的优先级，继承的优先级仍然有效，
+ * 避免降级造成无界的优先级反转。挂起则没有这一保护，持有互斥量的任务建议使用 eBudgetDemote。
+ * 降级期间调用 vTaskPrioritySet() 修改了任务优先级时，补充预算后不再恢复原优先级。
+ *
+ * @param xTask 任务句柄，传入 NULL 表示调用者自身。不能是空闲任务。
+ *
+ * @param xBudget 每个周期的预算（节拍数），不能大于 xPeriod。传入 0 表示取消预算限制，
+ * 已被降级或挂起的任务会立即恢复。
+ *
+ * @param xPeriod 补充周期（节拍数）。
+ *
+ * @param eAction 预算用完后的处理方式，eBudgetDemote 或 eBudgetSuspend。
+ *
+ * @param uxDemotedPriority eAction 为 eBudgetDemote 时任务被降到的优先级，应低于任务的正常优先级。
+ *
+ * 使用示例：
+ * @code{c}
+ * void vAFunction( TaskHandle_t xLoggingTask )
+ * {
+ *     // 日志任务每 100ms 最多运行 20ms，超出后降到空闲优先级。
+ *     vTaskSetBudget( xLoggingTask, pdMS_TO_TICKS( 20 ), pdMS_TO_TICKS( 100 ), eBudgetDemote, tskIDLE_PRIORITY );
+ * }
+ * @endcode
+ * \defgroup vTaskSetBudget vTaskSetBudget
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    void vTaskSetBudget( TaskHandle_t xTask,
+                         TickType_t xBudget,
+                         TickType_t xPeriod,
+                         eBudgetAction eAction,
+                         UBaseType_t uxDemotedPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * TickType_t xTaskGetBudgetRemaining( TaskHandle_t xTask );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_TASK_BUDGETS 定义为 1，此函数才会生效。
+ *
+ * @param xTask 任务句柄，传入 NULL 表示调用者自身。
+ *
+ * @return 任务在本周期内剩余的预算（节拍数）；任务没有设置预算时返回 portMAX_DELAY。
+ *
+ * \defgroup xTaskGetBudgetRemaining xTaskGetBudgetRemaining
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    TickType_t xTaskGetBudgetRemaining( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2161,6 +2349,129 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
                                       configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSnapshotBegin( TaskSnapshot_t * pxSnapshot );
+ * eTaskSnapshotStatus eTaskSnapshotRead( TaskSnapshot_t * pxSnapshot, TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, UBaseType_t * const puxCount );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_TASK_SNAPSHOT 和 configUSE_TRACE_FACILITY 定义为 1，这两个函数才可用。
+ *
+ * uxTaskGetSystemState() 的分段版本。uxTaskGetSystemState() 在一次调度器挂起期间遍历所有状态链表
+ * 并计算每个任务的栈高水位，任务多时会造成明显的调度延迟；eTaskSnapshotRead() 每次只读取
+ * uxArraySize 个任务，两次调用之间调度器正常运行。
+ *
+ * 任务按创建顺序读取，每个任务恰好读取一次。任务的创建和删除会改变 uxTaskNumber，
+ * eTaskSnapshotRead() 发现它与开始时不同就返回 eTaskSnapshotChanged 并把游标指回第一个任务，
+ * 调用者丢弃已读到的记录后继续读取即可，因此读完时得到的任务集合是一致的。每条记录中的状态、
+ * 优先级和运行时间是读取该段时的值。已删除但空闲任务还没有释放的任务不在结果中。
+ *
+ * @param pxSnapshot 游标。
+ *
+ * @param pxTaskStatusArray 本段记录的输出数组。
+ *
+ * @param uxArraySize 本段最多读取的任务数。
+ *
+ * @param puxCount 输出本段实际读取的任务数。返回 eTaskSnapshotChanged 时为 0。
+ *
+ * @return eTaskSnapshotMore、eTaskSnapshotComplete 或 eTaskSnapshotChanged。
+ *
+ * 使用示例：
+ * @code{c}
+ *  // 监控任务每次只挂起调度器读取 8 个任务。
+ *  void vMonitorTask( void * pvParameters )
+ *  {
+ *      TaskSnapshot_t xSnapshot;
+ *      TaskStatus_t xStatus[ 8 ];
+ *      UBaseType_t uxCount, x;
+ *      eTaskSnapshotStatus eStatus;
+ *
+ *      for( ;; )
+ *      {
+ *          vTaskSnapshotBegin( &xSnapshot );
+ *
+ *          do
+ *          {
+ *              eStatus = eTaskSnapshotRead( &xSnapshot, xStatus, 8, &uxCount );
+ *
+ *              if( eStatus == eTaskSnapshotChanged )
+ *              {
+ *                  vDiscardReport();
+ *              }
+ *
+ *              for( x = 0; x < uxCount; x++ )
+ *              {
+ *                  vAddToReport( &( xStatus[ x ] ) );
+ *              }
+ *          } while( eStatus != eTaskSnapshotComplete );
+ *
+ *          vPublishReport();
+ *          vTaskDelay( pdMS_TO_TICKS( 1000 ) );
+ *      }
+ *  }
+ * @endcode
+ * \defgroup eTaskSnapshotRead eTaskSnapshotRead
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_TASK_SNAPSHOT == 1 )
+    void vTaskSnapshotBegin( TaskSnapshot_t * pxSnapshot ) PRIVILEGED_FUNCTION;
+    eTaskSnapshotStatus eTaskSnapshotRead( TaskSnapshot_t * pxSnapshot,
+                                           TaskStatus_t * const pxTaskStatusArray,
+                                           const UBaseType_t uxArraySize,
+                                           UBaseType_t * const puxCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskPoolReserve( configSTACK_DEPTH_TYPE uxStackDepth, UBaseType_t uxCount );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_TASK_POOL 定义为 1，此函数才可用。
+ *
+ * 预先从堆中分配对象，保证之后至少还能创建 uxCount 个栈深度为 uxStackDepth 的任务而不访问堆。
+ * 通常在启动调度器之前调用，运行期间创建和删除任务都只是在池中取还对象，耗时固定。
+ *
+ * @param uxStackDepth 栈深度（字数），与传给 xTaskCreate() 的值相同。超过最大规格时只预留 TCB。
+ *
+ * @param uxCount 需要空闲的对象数。
+ *
+ * @return 成功返回 pdPASS，堆空间不足返回 errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY。
+ *
+ * \defgroup xTaskPoolReserve xTaskPoolReserve
+ * \ingroup Tasks
+ */
+#if ( configUSE_TASK_POOL == 1 )
+    BaseType_t xTaskPoolReserve( configSTACK_DEPTH_TYPE uxStackDepth,
+                                 UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskPoolGetStats( TaskPoolStats_t * const pxStatsArray, const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * 需在 FreeRTOSConfig.h 中将 configUSE_TASK_POOL 定义为 1，此函数才可用。
+ *
+ * 读取任务对象池的占用情况。第 0 项是 TCB 池，之后按栈深度从小到大依次是各栈规格，
+ * 共 configTASK_POOL_STACK_CLASSES + 1 项。
+ *
+ * @param pxStatsArray 输出数组。
+ *
+ * @param uxArraySize 数组长度，不足时只填写前 uxArraySize 项。
+ *
+ * @return 填写的项数。
+ *
+ * \defgroup uxTaskPoolGetStats uxTaskPoolGetStats
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_TASK_POOL == 1 )
+    UBaseType_t uxTaskPoolGetStats( TaskPoolStats_t * const pxStatsArray,
+                                    const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -3578,6 +3889,48 @@ void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Called from a critical section after the calling
+ * task has taken a priority ceiling mutex.  Raise the calling task's priority
+ * to uxCeilingPriority if it is currently lower.  The base priority is not
+ * changed, so xTaskPriorityDisinherit() restores it once the task no longer
+ * holds any mutexes.
+ */
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+    void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Called in place of xTaskPriorityDisinherit() when a
+ * priority ceiling mutex is given.  The priority is restored in the same way,
+ * but pdTRUE is only returned if a ready task has a priority above the
+ * restored priority, as no task can have been waiting on the raised priority.
+ */
+#if ( configUSE_PRIORITY_CEILING_MUTEXES == 1 )
+    BaseType_t xTaskPriorityDisinheritCeiling( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Called by the semaphore fast path after the calling
+ * task has released a mutex without entering a critical section.  Decrement
+ * the mutex held count and return pdTRUE if the calling task's priority is not
+ * inherited.  Otherwise leave the count unchanged and return pdFALSE; the
+ * caller must then call xTaskPriorityDisinherit() from a critical section.
+ */
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_SEMAPHORE_FAST_PATH == 1 ) )
+    BaseType_t xTaskDecrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Return pdTRUE if xTask is currently running on a
+ * core other than the calling one.  The run state is read without taking a
+ * lock, so the result is only a hint, used by adaptive mutexes to decide
+ * whether to keep spinning while waiting for the holder.
+ */
+#if ( configUSE_ADAPTIVE_MUTEXES == 1 )
+    BaseType_t xTaskIsRunningOnOtherCore( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critical
  * section.
@@ -3636,6 +3989,41 @@ void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNC
     void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
 #endif
 
+/*
+ * For internal use only.  Enter and exit the critical section of a single
+ * kernel object, see taskENTER_CRITICAL_OBJECT().  Only available when
+ * configUSE_GRANULAR_LOCKS is set to 1.
+ */
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    void vTaskEnterCriticalObject( portSPINLOCK_TYPE * pxSpinlock );
+    void vTaskExitCriticalObject( portSPINLOCK_TYPE * pxSpinlock );
+    UBaseType_t vTaskEnterCriticalObjectFromISR( portSPINLOCK_TYPE * pxSpinlock );
+    void vTaskExitCriticalObjectFromISR( UBaseType_t uxSavedInterruptStatus,
+                                         portSPINLOCK_TYPE * pxSpinlock );
+#endif
+
+/*
+ * For internal use only.  Direct hand-off of a queue item between a running
+ * task and a task blocked on the queue, see queue.c.  Only available when
+ * configUSE_QUEUE_HANDOFF is set to 1.
+ *
+ * vTaskSetHandOffBuffer() registers the buffer of the calling task before it
+ * is placed on an event list.  pvTaskGetEventListHandOffBuffer() returns the
+ * buffer registered by the task at the head of an event list, or NULL.  After
+ * copying the item, xTaskRemoveFromEventListAfterHandOff() clears that buffer
+ * and behaves as xTaskRemoveFromEventList().  Once unblocked, the waiting task
+ * calls xTaskClearHandOffBuffer(), which returns pdTRUE if the item has been
+ * handed off.  vTaskSetHandOffBuffer() is called with the queue locked, just
+ * before vTaskPlaceOnEventList(); the others must be called from within the
+ * critical section of the queue.
+ */
+#if ( configUSE_QUEUE_HANDOFF == 1 )
+    void vTaskSetHandOffBuffer( void * pvBuffer ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskClearHandOffBuffer( void ) PRIVILEGED_FUNCTION;
+    void * pvTaskGetEventListHandOffBuffer( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskRemoveFromEventListAfterHandOff( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( portUSING_MPU_WRAPPERS == 1 )
 
 /*
@@ -77,6 +77,16 @@
     #define tmrSTATUS_IS_STATICALLY_ALLOCATED    ( 0x02U ) /* 定时器由静态内存分配 */
     #define tmrSTATUS_IS_AUTORELOAD              ( 0x04U ) /* 定时器为自动重载模式 */
 
+/* 保护单个定时器状态（ucStatus、pvTimerID）的临界区。configUSE_GRANULAR_LOCKS == 1 时只获取该定时器自身的自旋锁，
+ * 否则与 taskENTER_CRITICAL() 相同。定时器列表和命令队列仍由内核临界区保护。 */
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        #define tmrENTER_CRITICAL( pxTimer )    taskENTER_CRITICAL_OBJECT( &( ( pxTimer )->xSpinlock ) )
+        #define tmrEXIT_CRITICAL( pxTimer )     taskEXIT_CRITICAL_OBJECT( &( ( pxTimer )->xSpinlock ) )
+    #else
+        #define tmrENTER_CRITICAL( pxTimer )    taskENTER_CRITICAL()
+        #define tmrEXIT_CRITICAL( pxTimer )     taskEXIT_CRITICAL()
+    #endif
+
 /* The definition of the timers themselves. */
     typedef struct tmrTimerControl                                               /* 使用旧的命名约定是为了避免破坏内核感知调试器 */
     {
@@ -89,6 +99,9 @@
             UBaseType_t uxTimerNumber;                                           /**< 由FreeRTOS+Trace等跟踪工具分配的ID */
         #endif
         uint8_t ucStatus;                                                        /**< 包含位信息，用于表示定时器是否为静态分配以及是否处于活动状态 */
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+            portSPINLOCK_TYPE xSpinlock;                                         /**< 定时器自身的自旋锁，保护 ucStatus 与 pvTimerID */
+        #endif
     } xTIMER;
 
 /* 上面保留了旧的 xTIMER 名称，然后在下面将其类型定义为新的 Timer_t 名称，以支持旧版的内核感知调试器。 */
@@ -457,6 +470,12 @@ static void prvInitialiseNewTimer( const char * const pcTimerName,          // 
         pxNewTimer->pxCallbackFunction = pxCallbackFunction;  // 赋值超时回调函数（定时器到期后执行）
         vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );  // 初始化定时器的列表项（用于加入FreeRTOS列表管理）
 
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            portINIT_SPINLOCK( &( pxNewTimer->xSpinlock ) );  // 初始化定时器自身的自旋锁
+        }
+        #endif
+
         // 若配置为自动重载定时器（xAutoReload不为pdFALSE）
         if( xAutoReload != pdFALSE )
         {
@@ -623,7 +642,7 @@ void vTimerSetReloadMode( TimerHandle_t xTimer,          // 目标定时器句
         configASSERT( xTimer );
 
         // 进入临界区：确保修改状态位的操作是原子的（不受其他任务或中断干扰）
-        taskENTER_CRITICAL();
+        tmrENTER_CRITICAL( pxTimer );
         {
             // 若设置为自动重载模式（xAutoReload不为pdFALSE）
             if( xAutoReload != pdFALSE )
@@ -638,7 +657,7 @@ void vTimerSetReloadMode( TimerHandle_t xTimer,          // 目标定时器句
             }
         }
         // 退出临界区：恢复任务调度和中断响应
-        taskEXIT_CRITICAL();
+        tmrEXIT_CRITICAL( pxTimer );
 
         // 跟踪函数返回（调试/跟踪用）
         traceRETURN_vTimerSetReloadMode();
@@ -653,7 +672,7 @@ void vTimerSetReloadMode( TimerHandle_t xTimer,          // 目标定时器句
         traceENTER_xTimerGetReloadMode( xTimer );
 
         configASSERT( xTimer );
-        taskENTER_CRITICAL();
+        tmrENTER_CRITICAL( pxTimer );
         {
             if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) == 0U )
             {
@@ -666,7 +685,7 @@ void vTimerSetReloadMode( TimerHandle_t xTimer,          // 目标定时器句
                 xReturn = pdTRUE;
             }
         }
-        taskEXIT_CRITICAL();
+        tmrEXIT_CRITICAL( pxTimer );
 
         traceRETURN_xTimerGetReloadMode( xReturn );
 
@@ -1309,7 +1328,7 @@ static void prvCheckForValidListAndQueue( void )
         configASSERT( xTimer );
 
         /* Is the timer in the list of active timers? */
-        taskENTER_CRITICAL();
+        tmrENTER_CRITICAL( pxTimer );
         {
             if( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) == 0U )
             {
@@ -1320,7 +1339,7 @@ static void prvCheckForValidListAndQueue( void )
                 xReturn = pdTRUE;
             }
         }
-        taskEXIT_CRITICAL();
+        tmrEXIT_CRITICAL( pxTimer );
 
         traceRETURN_xTimerIsTimerActive( xReturn );
 
@@ -1337,11 +1356,11 @@ static void prvCheckForValidListAndQueue( void )
 
         configASSERT( xTimer );
 
-        taskENTER_CRITICAL();
+        tmrENTER_CRITICAL( pxTimer );
         {
             pvReturn = pxTimer->pvTimerID;
         }
-        taskEXIT_CRITICAL();
+        tmrEXIT_CRITICAL( pxTimer );
 
         traceRETURN_pvTimerGetTimerID( pvReturn );
 
@@ -1358,11 +1377,11 @@ static void prvCheckForValidListAndQueue( void )
 
         configASSERT( xTimer );
 
-        taskENTER_CRITICAL();
+        tmrENTER_CRITICAL( pxTimer );
         {
             pxTimer->pvTimerID = pvNewID;
         }
-        taskEXIT_CRITICAL();
+        tmrEXIT_CRITICAL( pxTimer );
 
         traceRETURN_vTimerSetTimerID();
     }
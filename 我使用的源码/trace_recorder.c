@@ -0,0 +1,443 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* 应用程序没有启用跟踪记录器时整个文件都不参与编译，对应的 #endif 在文件末尾。 */
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/*
+ * 写位置的比较交换和完整内存屏障，与 mpmc_queue.c 相同：atomic.h 的实现依靠屏蔽本核中断，
+ * 只在单核上是原子的，SMP 移植层必须在 portmacro.h 中用硬件原子指令提供这两个宏。
+ */
+    #ifndef portATOMIC_COMPARE_AND_SWAP_U32
+        #if ( configNUMBER_OF_CORES > 1 )
+            #error portATOMIC_COMPARE_AND_SWAP_U32 must be defined in portmacro.h to build trace_recorder.c in SMP FreeRTOS
+        #endif
+
+        #include "atomic.h"
+
+        #define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand ) \
+    ( ( Atomic_CompareAndSwap_u32( ( pulDestination ), ( ulExchange ), ( ulComparand ) ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS ) ? pdTRUE : pdFALSE )
+    #endif
+
+    #ifndef portMEMORY_FULL_BARRIER
+        #if ( configNUMBER_OF_CORES > 1 )
+            #error portMEMORY_FULL_BARRIER must be defined in portmacro.h to build trace_recorder.c in SMP FreeRTOS
+        #endif
+
+        #define portMEMORY_FULL_BARRIER()    portMEMORY_BARRIER()
+    #endif
+
+    #define traceRECORDER_RING_MASK    ( ( uint32_t ) configTRACE_RECORDER_RING_LENGTH - 1U )
+
+/* xDrainingCore 的取值：没有核心在转存事件。 */
+    #define traceRECORDER_NO_CORE      ( ( BaseType_t ) -1 )
+
+/* 每个 TASK_NAME 事件携带的字符数：时间戳字 4 个，参数 3 个。 */
+    #define traceRECORDER_NAME_CHARS_PER_EVENT    7U
+
+/*-----------------------------------------------------------*/
+
+/* 环形缓冲区中的一个槽位。 */
+typedef struct TraceRecorderSlot
+{
+    volatile uint32_t ulSequence; /* 等于写位置表示空闲，等于写位置 + 1 表示事件已写入。 */
+    uint32_t ulTimestamp;
+    uint32_t ulEvent;             /* 高 8 位为事件码，低 24 位为参数。 */
+} TraceRecorderSlot_t;
+
+/* 每个核心一个环形缓冲区。写入者是本核心上的任务和（可能嵌套的）中断，用比较交换占用写位置；
+ * 读取者只有节拍中断中的转存，遇到尚未写完的槽位就停下，下一个节拍再继续。 */
+typedef struct TraceRecorderRing
+{
+    volatile uint32_t ulWritePosition; /* 下一个写位置。 */
+    uint32_t ulReadPosition;           /* 下一个读位置，只由转存修改。 */
+    volatile uint32_t ulDropped;       /* 环形缓冲区满时丢弃的事件数，转存时清零。 */
+    TraceRecorderSlot_t xSlots[ configTRACE_RECORDER_RING_LENGTH ];
+} TraceRecorderRing_t;
+
+/*-----------------------------------------------------------*/
+
+PRIVILEGED_DATA static TraceRecorderRing_t xRings[ configNUMBER_OF_CORES ];
+PRIVILEGED_DATA static StreamBufferHandle_t xTraceStream = NULL;
+PRIVILEGED_DATA static volatile BaseType_t xRecording = pdFALSE;
+
+/* 正在转存事件的核心。转存时调用的流缓冲区和任务通知函数本身也会触发跟踪宏，这些事件不记录。 */
+PRIVILEGED_DATA static volatile BaseType_t xDrainingCore = traceRECORDER_NO_CORE;
+
+/* 转存用的暂存区：一个 CORE 事件加上最多 configTRACE_RECORDER_DRAIN_EVENTS 个事件。 */
+PRIVILEGED_DATA static uint32_t ulDrainBuffer[ ( configTRACE_RECORDER_DRAIN_EVENTS + 1U ) * 2U ];
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+        PRIVILEGED_DATA static StaticStreamBuffer_t xTraceStreamStruct;
+        PRIVILEGED_DATA static uint8_t ucTraceStreamStorage[ configTRACE_RECORDER_STREAM_BUFFER_SIZE + 1U ];
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * 把一个事件写入当前核心的环形缓冲区，缓冲区满时丢弃并计数。
+ */
+static void prvWriteEvent( uint32_t ulTimestamp,
+                           uint32_t ulEvent );
+
+/*
+ * 把一个核心的环形缓冲区中的事件转存到流缓冲区，最多转存 uxMaxEvents 个。
+ */
+static void prvDrainRing( BaseType_t xCore,
+                          UBaseType_t uxMaxEvents );
+
+/*-----------------------------------------------------------*/
+
+static void prvWriteEvent( uint32_t ulTimestamp,
+                           uint32_t ulEvent )
+{
+    TraceRecorderRing_t * const pxRing = &( xRings[ portGET_CORE_ID() ] );
+    TraceRecorderSlot_t * pxSlot = NULL;
+    uint32_t ulPosition;
+    uint32_t ulDropped;
+    int32_t lDifference;
+
+    for( ; ; )
+    {
+        ulPosition = pxRing->ulWritePosition;
+        lDifference = ( int32_t ) ( pxRing->xSlots[ ulPosition & traceRECORDER_RING_MASK ].ulSequence - ulPosition );
+
+        if( lDifference == 0 )
+        {
+            /* 槽位空闲，占用它。失败说明被打断本次写入的中断抢先占用了，重试。 */
+            if( portATOMIC_COMPARE_AND_SWAP_U32( &( pxRing->ulWritePosition ), ulPosition + 1U, ulPosition ) != pdFALSE )
+            {
+                pxSlot = &( pxRing->xSlots[ ulPosition & traceRECORDER_RING_MASK ] );
+                break;
+            }
+        }
+        else if( lDifference < 0 )
+        {
+            /* 槽位上一轮的事件还没有转存：缓冲区满。 */
+            break;
+        }
+        else
+        {
+            /* 读到的写位置已经过时，重读。 */
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    if( pxSlot != NULL )
+    {
+        pxSlot->ulTimestamp = ulTimestamp;
+        pxSlot->ulEvent = ulEvent;
+        portMEMORY_FULL_BARRIER();
+        pxSlot->ulSequence = ulPosition + 1U;
+    }
+    else
+    {
+        do
+        {
+            ulDropped = pxRing->ulDropped;
+        } while( portATOMIC_COMPARE_AND_SWAP_U32( &( pxRing->ulDropped ), ulDropped + 1U, ulDropped ) == pdFALSE );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvDrainRing( BaseType_t xCore,
+                          UBaseType_t uxMaxEvents )
+{
+    TraceRecorderRing_t * const pxRing = &( xRings[ xCore ] );
+    TraceRecorderSlot_t * pxSlot;
+    uint32_t ulPosition = pxRing->ulReadPosition;
+    uint32_t ulDropped;
+    UBaseType_t uxCount = 0U;
+
+    while( uxCount < uxMaxEvents )
+    {
+        pxSlot = &( pxRing->xSlots[ ulPosition & traceRECORDER_RING_MASK ] );
+
+        /* 槽位还没有写完（写入者被打断或者在其它核心上）：停在这里，下一个节拍再继续。 */
+        if( pxSlot->ulSequence != ( ulPosition + 1U ) )
+        {
+            break;
+        }
+
+        portMEMORY_FULL_BARRIER();
+        ulDrainBuffer[ ( uxCount + 1U ) * 2U ] = pxSlot->ulTimestamp;
+        ulDrainBuffer[ ( ( uxCount + 1U ) * 2U ) + 1U ] = pxSlot->ulEvent;
+        portMEMORY_FULL_BARRIER();
+
+        /* 释放槽位给下一轮的写位置。 */
+        pxSlot->ulSequence = ulPosition + ( uint32_t ) configTRACE_RECORDER_RING_LENGTH;
+        ulPosition++;
+        uxCount++;
+    }
+
+    pxRing->ulReadPosition = ulPosition;
+
+    do
+    {
+        ulDropped = pxRing->ulDropped;
+    } while( portATOMIC_COMPARE_AND_SWAP_U32( &( pxRing->ulDropped ), 0U, ulDropped ) == pdFALSE );
+
+    if( ( uxCount > 0U ) || ( ulDropped > 0U ) )
+    {
+        ulDrainBuffer[ 0 ] = ulDropped;
+        ulDrainBuffer[ 1 ] = ( ( uint32_t ) traceRECORDER_EVENT_CORE << 24 ) | ( uint32_t ) xCore;
+
+        /* 可用空间已在调用前检查过，这里一定能全部写入。 */
+        ( void ) xStreamBufferSendFromISR( xTraceStream, ulDrainBuffer, ( uxCount + 1U ) * traceRECORDER_EVENT_BYTES, NULL );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTraceRecorderStart( void )
+{
+    StreamBufferHandle_t xStream;
+    uint32_t ulHeader[ traceRECORDER_HEADER_BYTES / sizeof( uint32_t ) ];
+    BaseType_t xCore;
+    uint32_t ulSlot;
+    BaseType_t xReturn = pdPASS;
+
+    if( xTraceStream == NULL )
+    {
+        for( xCore = 0; xCore < ( BaseType_t ) configNUMBER_OF_CORES; xCore++ )
+        {
+            xRings[ xCore ].ulWritePosition = 0U;
+            xRings[ xCore ].ulReadPosition = 0U;
+            xRings[ xCore ].ulDropped = 0U;
+
+            for( ulSlot = 0U; ulSlot < ( uint32_t ) configTRACE_RECORDER_RING_LENGTH; ulSlot++ )
+            {
+                xRings[ xCore ].xSlots[ ulSlot ].ulSequence = ulSlot;
+            }
+        }
+
+        /* 触发级别取缓冲区的四分之一，读取任务不必每个节拍都被唤醒。 */
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        {
+            xStream = xStreamBufferCreate( configTRACE_RECORDER_STREAM_BUFFER_SIZE, configTRACE_RECORDER_STREAM_BUFFER_SIZE / 4U );
+        }
+        #else
+        {
+            xStream = xStreamBufferCreateStatic( configTRACE_RECORDER_STREAM_BUFFER_SIZE, configTRACE_RECORDER_STREAM_BUFFER_SIZE / 4U, ucTraceStreamStorage, &xTraceStreamStruct );
+        }
+        #endif
+
+        if( xStream != NULL )
+        {
+            ulHeader[ 0 ] = traceRECORDER_MAGIC;
+            ulHeader[ 1 ] = ( uint32_t ) traceRECORDER_VERSION | ( ( uint32_t ) configNUMBER_OF_CORES << 16 ) | ( ( uint32_t ) traceRECORDER_EVENT_BYTES << 24 );
+            ulHeader[ 2 ] = ( uint32_t ) configTRACE_RECORDER_TIMESTAMP_HZ;
+            ulHeader[ 3 ] = ( uint32_t ) configTICK_RATE_HZ;
+            ( void ) xStreamBufferSend( xStream, ulHeader, sizeof( ulHeader ), 0 );
+
+            /* 文件头写入之后节拍中断才能开始转存。 */
+            portMEMORY_FULL_BARRIER();
+            xTraceStream = xStream;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xReturn == pdPASS )
+    {
+        xRecording = pdTRUE;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+    xRecording = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+size_t xTraceRecorderRead( void * pvBuffer,
+                           size_t xBufferLengthBytes,
+                           TickType_t xTicksToWait )
+{
+    size_t xReturn = 0;
+
+    configASSERT( pvBuffer );
+
+    if( xTraceStream != NULL )
+    {
+        xReturn = xStreamBufferReceive( xTraceStream, pvBuffer, xBufferLengthBytes, xTicksToWait );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint32_t ulEvent,
+                          uint32_t ulParameter )
+{
+    if( ( xRecording != pdFALSE ) && ( xDrainingCore != ( BaseType_t ) portGET_CORE_ID() ) )
+    {
+        prvWriteEvent( configTRACE_RECORDER_TIMESTAMP(), ( ulEvent << 24 ) | ( ulParameter & 0x00FFFFFFUL ) );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderTaskCreate( const void * pvTask,
+                               const char * pcName )
+{
+    uint8_t ucChars[ traceRECORDER_NAME_CHARS_PER_EVENT ];
+    UBaseType_t uxOffset = 0U;
+    UBaseType_t x;
+    BaseType_t xEnd = pdFALSE;
+
+    if( ( xRecording != pdFALSE ) && ( xDrainingCore != ( BaseType_t ) portGET_CORE_ID() ) )
+    {
+        prvWriteEvent( configTRACE_RECORDER_TIMESTAMP(), ( ( uint32_t ) traceRECORDER_EVENT_TASK_CREATE << 24 ) | traceRECORDER_OBJECT_ID( pvTask ) );
+
+        /* 任务名紧跟在 TASK_CREATE 之后，每个 TASK_NAME 事件 7 个字符，以 '\0' 或名称最大长度结束。
+         * 本核心上打断的中断不会创建任务，解码时把 TASK_NAME 归到同一核心上最近的 TASK_CREATE。 */
+        while( xEnd == pdFALSE )
+        {
+            for( x = 0U; x < traceRECORDER_NAME_CHARS_PER_EVENT; x++ )
+            {
+                if( ( xEnd == pdFALSE ) && ( ( uxOffset + x ) < ( UBaseType_t ) configMAX_TASK_NAME_LEN ) && ( pcName[ uxOffset + x ] != ( char ) 0x00 ) )
+                {
+                    ucChars[ x ] = ( uint8_t ) pcName[ uxOffset + x ];
+                }
+                else
+                {
+                    ucChars[ x ] = 0U;
+                    xEnd = pdTRUE;
+                }
+            }
+
+            prvWriteEvent( ( uint32_t ) ucChars[ 0 ] | ( ( uint32_t ) ucChars[ 1 ] << 8 ) | ( ( uint32_t ) ucChars[ 2 ] << 16 ) | ( ( uint32_t ) ucChars[ 3 ] << 24 ),
+                           ( ( uint32_t ) traceRECORDER_EVENT_TASK_NAME << 24 ) | ( uint32_t ) ucChars[ 4 ] | ( ( uint32_t ) ucChars[ 5 ] << 8 ) | ( ( uint32_t ) ucChars[ 6 ] << 16 ) );
+
+            uxOffset += traceRECORDER_NAME_CHARS_PER_EVENT;
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStreamBlocked( uint32_t ulEvent,
+                                  const void * pvStreamBuffer )
+{
+    if( pvStreamBuffer != ( const void * ) xTraceStream )
+    {
+        vTraceRecorderEvent( ulEvent, traceRECORDER_OBJECT_ID( pvStreamBuffer ) );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderTick( void )
+{
+    BaseType_t xCore;
+    size_t xSpace;
+    UBaseType_t uxMaxEvents;
+
+    if( xTraceStream != NULL )
+    {
+        xDrainingCore = ( BaseType_t ) portGET_CORE_ID();
+
+        for( xCore = 0; xCore < ( BaseType_t ) configNUMBER_OF_CORES; xCore++ )
+        {
+            /* 留出 CORE 事件的位置；流缓冲区放不下时事件留在环形缓冲区中。 */
+            xSpace = xStreamBufferSpacesAvailable( xTraceStream ) / traceRECORDER_EVENT_BYTES;
+
+            if( xSpace <= 1U )
+            {
+                break;
+            }
+
+            uxMaxEvents = ( UBaseType_t ) ( xSpace - 1U );
+
+            if( uxMaxEvents > ( UBaseType_t ) configTRACE_RECORDER_DRAIN_EVENTS )
+            {
+                uxMaxEvents = ( UBaseType_t ) configTRACE_RECORDER_DRAIN_EVENTS;
+            }
+
+            prvDrainRing( xCore, uxMaxEvents );
+        }
+
+        xDrainingCore = traceRECORDER_NO_CORE;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TRACE_RECORDER */
@@ -0,0 +1,453 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+/*
+ * 内核跟踪记录器。
+ *
+ * 把 FreeRTOS.h 中的一部分跟踪宏（任务切换、就绪、阻塞原因、中断进出和常用 API 的进入/返回）
+ * 实现为定长 8 字节的带时间戳事件，写入每个核心各自的无锁环形缓冲区；节拍中断把环形缓冲区
+ * 中的事件批量转存到一个流缓冲区，应用程序用 xTraceRecorderRead() 读出后送往串口、文件等，
+ * 在主机上由 Posix/trace/trace_decode.c 解码为调度时间线、API 延迟直方图和阻塞原因统计。
+ *
+ * 记录一个事件只需一次比较交换和三次写入，不进入临界区，也不调用其它内核 API，可以常开。
+ * 环形缓冲区满时丢弃新事件并计数，丢弃数随下一批事件一起输出。
+ *
+ * 在 FreeRTOSConfig.h 中将 configUSE_TRACE_RECORDER 设为 1 后由 FreeRTOS.h 包含本文件，
+ * 应用程序只需在创建任务之前调用一次 xTraceRecorderStart()。
+ *
+ * 输出格式（小端）：开头 16 字节的文件头，之后是连续的 8 字节事件：
+ *   第 0 个字：时间戳（configTRACE_RECORDER_TIMESTAMP() 的低 32 位）；
+ *   第 1 个字：高 8 位为事件码，低 24 位为参数（对象标识、API 编号等）。
+ * 每批事件之前有一个 traceRECORDER_EVENT_CORE 事件，指明后面的事件来自哪个核心，
+ * 它的第 0 个字是该核心自上一批以来丢弃的事件数。
+ */
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+/* 以下事件码和 API 编号也由主机端解码程序使用，不依赖内核的其它头文件。 */
+
+#define traceRECORDER_MAGIC                      0x52545246UL /* "FRTR" */
+#define traceRECORDER_VERSION                    1U
+#define traceRECORDER_HEADER_BYTES               16U
+#define traceRECORDER_EVENT_BYTES                8U
+
+/* 事件码。参数为“任务”或“对象”的事件，参数是对象地址右移 2 位后的低 24 位。 */
+#define traceRECORDER_EVENT_CORE                 0x01U /* 参数：核心号；时间戳字：丢弃的事件数。 */
+#define traceRECORDER_EVENT_TASK_CREATE          0x02U /* 参数：任务。 */
+#define traceRECORDER_EVENT_TASK_NAME            0x03U /* 紧跟在 TASK_CREATE 之后：时间戳字存 4 个字符，参数存 3 个字符。 */
+#define traceRECORDER_EVENT_TASK_DELETE          0x04U /* 参数：任务。 */
+#define traceRECORDER_EVENT_TASK_SWITCHED_IN     0x05U /* 参数：任务。 */
+#define traceRECORDER_EVENT_TASK_READY           0x06U /* 参数：任务。 */
+#define traceRECORDER_EVENT_TASK_SUSPEND         0x07U /* 参数：任务。 */
+#define traceRECORDER_EVENT_QUEUE_CREATE         0x08U /* 参数：队列。 */
+#define traceRECORDER_EVENT_MUTEX_CREATE         0x09U /* 参数：互斥量。 */
+#define traceRECORDER_EVENT_BLOCK_DELAY          0x10U /* 以下为当前任务进入阻塞态的原因，参数见各宏。 */
+#define traceRECORDER_EVENT_BLOCK_QUEUE_RECEIVE  0x11U /* 参数：队列（也用于信号量、互斥量）。 */
+#define traceRECORDER_EVENT_BLOCK_QUEUE_PEEK     0x12U /* 参数：队列。 */
+#define traceRECORDER_EVENT_BLOCK_QUEUE_SEND     0x13U /* 参数：队列。 */
+#define traceRECORDER_EVENT_BLOCK_STREAM_RECEIVE 0x14U /* 参数：流缓冲区。 */
+#define traceRECORDER_EVENT_BLOCK_STREAM_SEND    0x15U /* 参数：流缓冲区。 */
+#define traceRECORDER_EVENT_BLOCK_NOTIFY         0x16U /* 参数：通知索引。 */
+#define traceRECORDER_EVENT_BLOCK_EVENT_GROUP    0x17U /* 参数：事件组。 */
+#define traceRECORDER_EVENT_ISR_ENTER            0x20U
+#define traceRECORDER_EVENT_ISR_EXIT             0x21U
+#define traceRECORDER_EVENT_ISR_EXIT_TO_SCHEDULER 0x22U
+#define traceRECORDER_EVENT_API_ENTER            0x30U /* 参数：API 编号。 */
+#define traceRECORDER_EVENT_API_RETURN           0x31U /* 参数：API 编号。 */
+
+/* 记录进入/返回事件的 API，X( 编号, 函数名 )。 */
+#define traceRECORDER_API_LIST( X )        \
+    X( 1, xQueueGenericSend )              \
+    X( 2, xQueueGenericSendFromISR )       \
+    X( 3, xQueueGiveFromISR )              \
+    X( 4, xQueueReceive )                  \
+    X( 5, xQueueReceiveFromISR )           \
+    X( 6, xQueueSemaphoreTake )            \
+    X( 7, xQueuePeek )                     \
+    X( 8, vTaskDelay )                     \
+    X( 9, xTaskDelayUntil )                \
+    X( 10, vTaskSuspend )                  \
+    X( 11, xTaskGenericNotify )            \
+    X( 12, xTaskGenericNotifyFromISR )     \
+    X( 13, xTaskGenericNotifyWait )        \
+    X( 14, ulTaskGenericNotifyTake )       \
+    X( 15, xEventGroupWaitBits )           \
+    X( 16, xEventGroupSync )               \
+    X( 17, xTimerGenericCommandFromTask )
+
+#define traceRECORDER_API_ENUM( xId, xName )    traceRECORDER_API_##xName = xId,
+enum
+{
+    traceRECORDER_API_LIST( traceRECORDER_API_ENUM )
+    traceRECORDER_API_COUNT
+};
+#undef traceRECORDER_API_ENUM
+
+#ifndef traceRECORDER_CODES_ONLY
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include trace_recorder.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* 每个核心的环形缓冲区能存放的事件数，必须是 2 的幂。 */
+#ifndef configTRACE_RECORDER_RING_LENGTH
+    #define configTRACE_RECORDER_RING_LENGTH    256U
+#endif
+
+/* 输出事件用的流缓冲区字节数。 */
+#ifndef configTRACE_RECORDER_STREAM_BUFFER_SIZE
+    #define configTRACE_RECORDER_STREAM_BUFFER_SIZE    4096U
+#endif
+
+/* 每个节拍从每个核心的环形缓冲区转存的最多事件数，限制节拍中断中转存的耗时。 */
+#ifndef configTRACE_RECORDER_DRAIN_EVENTS
+    #define configTRACE_RECORDER_DRAIN_EVENTS    64U
+#endif
+
+/* 时间戳来源及其频率。默认使用节拍计数；需要测量 API 延迟时应改用周期计数器等更细的时钟，
+ * 例如 Cortex-M3 的 DWT->CYCCNT，同时定义 configTRACE_RECORDER_TIMESTAMP_HZ。 */
+#ifndef configTRACE_RECORDER_TIMESTAMP
+    #define configTRACE_RECORDER_TIMESTAMP()    ( ( uint32_t ) xTaskGetTickCountFromISR() )
+    #define configTRACE_RECORDER_TIMESTAMP_HZ    configTICK_RATE_HZ
+#endif
+
+#ifndef configTRACE_RECORDER_TIMESTAMP_HZ
+    #error configTRACE_RECORDER_TIMESTAMP_HZ must be defined together with configTRACE_RECORDER_TIMESTAMP
+#endif
+
+#if ( ( configTRACE_RECORDER_RING_LENGTH & ( configTRACE_RECORDER_RING_LENGTH - 1U ) ) != 0U )
+    #error configTRACE_RECORDER_RING_LENGTH must be a power of 2
+#endif
+
+/* 对象标识：地址右移 2 位后的低 24 位。 */
+#define traceRECORDER_OBJECT_ID( pvObject )    ( ( uint32_t ) ( ( ( portPOINTER_SIZE_TYPE ) ( pvObject ) ) >> 2 ) & 0x00FFFFFFUL )
+
+/**
+ * trace_recorder.h
+ *
+ * @code{c}
+ * BaseType_t xTraceRecorderStart( void );
+ * @endcode
+ *
+ * 创建输出用的流缓冲区，写入文件头并开始记录。应在创建任务之前调用，这样解码时才能
+ * 得到所有任务的名称。可以在启动调度器之前调用。
+ *
+ * @return 成功返回 pdPASS；流缓冲区创建失败返回 pdFAIL。
+ */
+BaseType_t xTraceRecorderStart( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *
+ * @code{c}
+ * void vTraceRecorderStop( void );
+ * @endcode
+ *
+ * 停止记录。已经记录的事件仍会转存到流缓冲区，可以继续读出。
+ */
+void vTraceRecorderStop( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *
+ * @code{c}
+ * size_t xTraceRecorderRead( void * pvBuffer, size_t xBufferLengthBytes, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * 从流缓冲区读出跟踪数据，只能由一个任务调用。数据是按字节流读出的，
+ * 读出的长度不一定是事件长度的整数倍，按顺序保存即可。
+ *
+ * @param pvBuffer 存放读出数据的缓冲区。
+ * @param xBufferLengthBytes pvBuffer 的字节数。
+ * @param xTicksToWait 没有数据时最多阻塞的节拍数。
+ *
+ * @return 读出的字节数。
+ */
+size_t xTraceRecorderRead( void * pvBuffer,
+                           size_t xBufferLengthBytes,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/* 以下函数由跟踪宏调用，应用程序不应直接调用。 */
+void vTraceRecorderEvent( uint32_t ulEvent,
+                          uint32_t ulParameter ) PRIVILEGED_FUNCTION;
+void vTraceRecorderTaskCreate( const void * pvTask,
+                               const char * pcName ) PRIVILEGED_FUNCTION;
+void vTraceRecorderStreamBlocked( uint32_t ulEvent,
+                                  const void * pvStreamBuffer ) PRIVILEGED_FUNCTION;
+void vTraceRecorderTick( void ) PRIVILEGED_FUNCTION;
+
+#define traceRECORDER_API_ENTER( xName )     vTraceRecorderEvent( traceRECORDER_EVENT_API_ENTER, ( uint32_t ) traceRECORDER_API_##xName )
+#define traceRECORDER_API_RETURN( xName )    vTraceRecorderEvent( traceRECORDER_EVENT_API_RETURN, ( uint32_t ) traceRECORDER_API_##xName )
+
+/*-----------------------------------------------------------
+ * 由记录器实现的跟踪宏。应用程序在 FreeRTOSConfig.h 中自己定义的同名宏优先。
+ *----------------------------------------------------------*/
+
+#ifndef traceTASK_SWITCHED_IN
+    #define traceTASK_SWITCHED_IN()    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_SWITCHED_IN, traceRECORDER_OBJECT_ID( pxCurrentTCB ) )
+#endif
+
+#ifndef traceMOVED_TASK_TO_READY_STATE
+    #define traceMOVED_TASK_TO_READY_STATE( pxTCB )    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_READY, traceRECORDER_OBJECT_ID( pxTCB ) )
+#endif
+
+#ifndef traceTASK_CREATE
+    #define traceTASK_CREATE( pxNewTCB )    vTraceRecorderTaskCreate( ( pxNewTCB ), ( pxNewTCB )->pcTaskName )
+#endif
+
+#ifndef traceTASK_DELETE
+    #define traceTASK_DELETE( pxTaskToDelete )    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_DELETE, traceRECORDER_OBJECT_ID( pxTaskToDelete ) )
+#endif
+
+#ifndef traceTASK_SUSPEND
+    #define traceTASK_SUSPEND( pxTaskToSuspend )    vTraceRecorderEvent( traceRECORDER_EVENT_TASK_SUSPEND, traceRECORDER_OBJECT_ID( pxTaskToSuspend ) )
+#endif
+
+#ifndef traceQUEUE_CREATE
+    #define traceQUEUE_CREATE( pxNewQueue )    vTraceRecorderEvent( traceRECORDER_EVENT_QUEUE_CREATE, traceRECORDER_OBJECT_ID( pxNewQueue ) )
+#endif
+
+#ifndef traceCREATE_MUTEX
+    #define traceCREATE_MUTEX( pxNewQueue )    vTraceRecorderEvent( traceRECORDER_EVENT_MUTEX_CREATE, traceRECORDER_OBJECT_ID( pxNewQueue ) )
+#endif
+
+#ifndef traceTASK_DELAY
+    #define traceTASK_DELAY()    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_DELAY, 0U )
+#endif
+
+#ifndef traceTASK_DELAY_UNTIL
+    #define traceTASK_DELAY_UNTIL( x )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_DELAY, 0U )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_RECEIVE
+    #define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_QUEUE_RECEIVE, traceRECORDER_OBJECT_ID( pxQueue ) )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_PEEK
+    #define traceBLOCKING_ON_QUEUE_PEEK( pxQueue )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_QUEUE_PEEK, traceRECORDER_OBJECT_ID( pxQueue ) )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_SEND
+    #define traceBLOCKING_ON_QUEUE_SEND( pxQueue )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_QUEUE_SEND, traceRECORDER_OBJECT_ID( pxQueue ) )
+#endif
+
+/* 读取跟踪数据的任务阻塞在记录器自己的流缓冲区上，这类事件不记录。 */
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_RECEIVE
+    #define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )    vTraceRecorderStreamBlocked( traceRECORDER_EVENT_BLOCK_STREAM_RECEIVE, ( xStreamBuffer ) )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_SEND
+    #define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )    vTraceRecorderStreamBlocked( traceRECORDER_EVENT_BLOCK_STREAM_SEND, ( xStreamBuffer ) )
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE_BLOCK
+    #define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_NOTIFY, ( uint32_t ) ( uxIndexToWait ) )
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT_BLOCK
+    #define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_NOTIFY, ( uint32_t ) ( uxIndexToWait ) )
+#endif
+
+#ifndef traceEVENT_GROUP_WAIT_BITS_BLOCK
+    #define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_EVENT_GROUP, traceRECORDER_OBJECT_ID( xEventGroup ) )
+#endif
+
+#ifndef traceEVENT_GROUP_SYNC_BLOCK
+    #define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )    vTraceRecorderEvent( traceRECORDER_EVENT_BLOCK_EVENT_GROUP, traceRECORDER_OBJECT_ID( xEventGroup ) )
+#endif
+
+#ifndef traceISR_ENTER
+    #define traceISR_ENTER()    vTraceRecorderEvent( traceRECORDER_EVENT_ISR_ENTER, 0U )
+#endif
+
+#ifndef traceISR_EXIT
+    #define traceISR_EXIT()    vTraceRecorderEvent( traceRECORDER_EVENT_ISR_EXIT, 0U )
+#endif
+
+#ifndef traceISR_EXIT_TO_SCHEDULER
+    #define traceISR_EXIT_TO_SCHEDULER()    vTraceRecorderEvent( traceRECORDER_EVENT_ISR_EXIT_TO_SCHEDULER, 0U )
+#endif
+
+/* 节拍中断负责把环形缓冲区中的事件转存到流缓冲区。 */
+#ifndef traceTASK_INCREMENT_TICK
+    #define traceTASK_INCREMENT_TICK( xTickCount )    vTraceRecorderTick()
+#endif
+
+#ifndef traceENTER_xQueueGenericSend
+    #define traceENTER_xQueueGenericSend( xQueue, pvItemToQueue, xTicksToWait, xCopyPosition )    traceRECORDER_API_ENTER( xQueueGenericSend )
+#endif
+
+#ifndef traceRETURN_xQueueGenericSend
+    #define traceRETURN_xQueueGenericSend( xReturn )    traceRECORDER_API_RETURN( xQueueGenericSend )
+#endif
+
+#ifndef traceENTER_xQueueGenericSendFromISR
+    #define traceENTER_xQueueGenericSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken, xCopyPosition )    traceRECORDER_API_ENTER( xQueueGenericSendFromISR )
+#endif
+
+#ifndef traceRETURN_xQueueGenericSendFromISR
+    #define traceRETURN_xQueueGenericSendFromISR( xReturn )    traceRECORDER_API_RETURN( xQueueGenericSendFromISR )
+#endif
+
+#ifndef traceENTER_xQueueGiveFromISR
+    #define traceENTER_xQueueGiveFromISR( xQueue, pxHigherPriorityTaskWoken )    traceRECORDER_API_ENTER( xQueueGiveFromISR )
+#endif
+
+#ifndef traceRETURN_xQueueGiveFromISR
+    #define traceRETURN_xQueueGiveFromISR( xReturn )    traceRECORDER_API_RETURN( xQueueGiveFromISR )
+#endif
+
+#ifndef traceENTER_xQueueReceive
+    #define traceENTER_xQueueReceive( xQueue, pvBuffer, xTicksToWait )    traceRECORDER_API_ENTER( xQueueReceive )
+#endif
+
+#ifndef traceRETURN_xQueueReceive
+    #define traceRETURN_xQueueReceive( xReturn )    traceRECORDER_API_RETURN( xQueueReceive )
+#endif
+
+#ifndef traceENTER_xQueueReceiveFromISR
+    #define traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken )    traceRECORDER_API_ENTER( xQueueReceiveFromISR )
+#endif
+
+#ifndef traceRETURN_xQueueReceiveFromISR
+    #define traceRETURN_xQueueReceiveFromISR( xReturn )    traceRECORDER_API_RETURN( xQueueReceiveFromISR )
+#endif
+
+#ifndef traceENTER_xQueueSemaphoreTake
+    #define traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait )    traceRECORDER_API_ENTER( xQueueSemaphoreTake )
+#endif
+
+#ifndef traceRETURN_xQueueSemaphoreTake
+    #define traceRETURN_xQueueSemaphoreTake( xReturn )    traceRECORDER_API_RETURN( xQueueSemaphoreTake )
+#endif
+
+#ifndef traceENTER_xQueuePeek
+    #define traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait )    traceRECORDER_API_ENTER( xQueuePeek )
+#endif
+
+#ifndef traceRETURN_xQueuePeek
+    #define traceRETURN_xQueuePeek( xReturn )    traceRECORDER_API_RETURN( xQueuePeek )
+#endif
+
+#ifndef traceENTER_vTaskDelay
+    #define traceENTER_vTaskDelay( xTicksToDelay )    traceRECORDER_API_ENTER( vTaskDelay )
+#endif
+
+#ifndef traceRETURN_vTaskDelay
+    #define traceRETURN_vTaskDelay()    traceRECORDER_API_RETURN( vTaskDelay )
+#endif
+
+#ifndef traceENTER_xTaskDelayUntil
+    #define traceENTER_xTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement )    traceRECORDER_API_ENTER( xTaskDelayUntil )
+#endif
+
+#ifndef traceRETURN_xTaskDelayUntil
+    #define traceRETURN_xTaskDelayUntil( xShouldDelay )    traceRECORDER_API_RETURN( xTaskDelayUntil )
+#endif
+
+#ifndef traceENTER_vTaskSuspend
+    #define traceENTER_vTaskSuspend( xTaskToSuspend )    traceRECORDER_API_ENTER( vTaskSuspend )
+#endif
+
+#ifndef traceRETURN_vTaskSuspend
+    #define traceRETURN_vTaskSuspend()    traceRECORDER_API_RETURN( vTaskSuspend )
+#endif
+
+#ifndef traceENTER_xTaskGenericNotify
+    #define traceENTER_xTaskGenericNotify( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue )    traceRECORDER_API_ENTER( xTaskGenericNotify )
+#endif
+
+#ifndef traceRETURN_xTaskGenericNotify
+    #define traceRETURN_xTaskGenericNotify( xReturn )    traceRECORDER_API_RETURN( xTaskGenericNotify )
+#endif
+
+#ifndef traceENTER_xTaskGenericNotifyFromISR
+    #define traceENTER_xTaskGenericNotifyFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken )    traceRECORDER_API_ENTER( xTaskGenericNotifyFromISR )
+#endif
+
+#ifndef traceRETURN_xTaskGenericNotifyFromISR
+    #define traceRETURN_xTaskGenericNotifyFromISR( xReturn )    traceRECORDER_API_RETURN( xTaskGenericNotifyFromISR )
+#endif
+
+#ifndef traceENTER_xTaskGenericNotifyWait
+    #define traceENTER_xTaskGenericNotifyWait( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait )    traceRECORDER_API_ENTER( xTaskGenericNotifyWait )
+#endif
+
+#ifndef traceRETURN_xTaskGenericNotifyWait
+    #define traceRETURN_xTaskGenericNotifyWait( xReturn )    traceRECORDER_API_RETURN( xTaskGenericNotifyWait )
+#endif
+
+#ifndef traceENTER_ulTaskGenericNotifyTake
+    #define traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait )    traceRECORDER_API_ENTER( ulTaskGenericNotifyTake )
+#endif
+
+#ifndef traceRETURN_ulTaskGenericNotifyTake
+    #define traceRETURN_ulTaskGenericNotifyTake( ulReturn )    traceRECORDER_API_RETURN( ulTaskGenericNotifyTake )
+#endif
+
+#ifndef traceENTER_xEventGroupWaitBits
+    #define traceENTER_xEventGroupWaitBits( xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait )    traceRECORDER_API_ENTER( xEventGroupWaitBits )
+#endif
+
+#ifndef traceRETURN_xEventGroupWaitBits
+    #define traceRETURN_xEventGroupWaitBits( uxReturn )    traceRECORDER_API_RETURN( xEventGroupWaitBits )
+#endif
+
+#ifndef traceENTER_xEventGroupSync
+    #define traceENTER_xEventGroupSync( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTicksToWait )    traceRECORDER_API_ENTER( xEventGroupSync )
+#endif
+
+#ifndef traceRETURN_xEventGroupSync
+    #define traceRETURN_xEventGroupSync( uxReturn )    traceRECORDER_API_RETURN( xEventGroupSync )
+#endif
+
+#ifndef traceENTER_xTimerGenericCommandFromTask
+    #define traceENTER_xTimerGenericCommandFromTask( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait )    traceRECORDER_API_ENTER( xTimerGenericCommandFromTask )
+#endif
+
+#ifndef traceRETURN_xTimerGenericCommandFromTask
+    #define traceRETURN_xTimerGenericCommandFromTask( xReturn )    traceRECORDER_API_RETURN( xTimerGenericCommandFromTask )
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* traceRECORDER_CODES_ONLY */
+
+#endif /* TRACE_RECORDER_H */